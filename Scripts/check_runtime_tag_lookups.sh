@@ -0,0 +1,92 @@
+#!/bin/bash
+
+# check_runtime_tag_lookups.sh - Report runtime string->GameplayTag lookups
+# Copyright Suspense Team. All Rights Reserved.
+#
+# FGameplayTag::RequestGameplayTag("...") builds an FName and hits the tag manager
+# hash on every call. Hot code must use the native tag registries instead:
+#   BridgeSystem    - SuspenseCore/Tags/SuspenseCoreGameplayTags.h        (SuspenseCoreTags::)
+#   EquipmentSystem - SuspenseCore/Tags/SuspenseCoreEquipmentNativeTags.h (SuspenseCoreEquipmentTags::)
+#   GAS             - SuspenseCore/Tags/SuspenseCoreMedicalNativeTags.h   (SuspenseCoreMedicalTags::)
+#
+# Usage (from plugin root):
+#   Scripts/check_runtime_tag_lookups.sh          # summary + hot-file gate
+#   Scripts/check_runtime_tag_lookups.sh -v       # also list every literal lookup
+#
+# Exit code 1 if a file in HOT_FILES still contains a literal lookup.
+# A line can be exempted with a trailing "// tag-lookup-ok: <reason>" comment.
+
+SRC_DIR="Source"
+VERBOSE=0
+[ "$1" = "-v" ] && VERBOSE=1
+
+# Per-operation / per-tick code; must stay free of literal lookups
+HOT_FILES=(
+    "Source/GAS/Private/SuspenseCore/Effects/StatusEffects/SuspenseCoreStatusEffects.cpp"
+    "Source/EquipmentSystem/Private/SuspenseCore/Services/SuspenseCoreEquipmentDataService.cpp"
+    "Source/EquipmentSystem/Private/SuspenseCore/Components/Core/SuspenseCoreEquipmentDataStore.cpp"
+    "Source/EquipmentSystem/Private/SuspenseCore/Components/Transaction/SuspenseCoreEquipmentTransactionProcessor.cpp"
+    "Source/EquipmentSystem/Private/SuspenseCore/Components/Rules/SuspenseCoreConflictRulesEngine.cpp"
+    "Source/EquipmentSystem/Private/SuspenseCore/Components/Core/SuspenseCoreWeaponStateManager.cpp"
+)
+
+# RequestGameplayTag( followed by "...", TEXT("..."), FName("...") or FName(TEXT("..."));
+# a call whose argument starts on the next line is reported as well
+LITERAL_LOOKUP='RequestGameplayTag\([[:space:]]*((FName\([[:space:]]*)?(TEXT\([[:space:]]*)?"|$)'
+EXEMPT='tag-lookup-ok'
+
+# Tag strings that already have a native definition
+NATIVE_TAGS=$(grep -rhoE 'UE_DEFINE_GAMEPLAY_TAG(_COMMENT)?\([[:space:]]*[A-Za-z0-9_]+[[:space:]]*,[[:space:]]*(TEXT\()?"[^"]+"' "$SRC_DIR" \
+    | sed -E 's/.*"([^"]+)"$/\1/' | sort -u)
+
+echo "🔍 Runtime GameplayTag lookups (string literals)"
+echo "================================================"
+
+TOTAL=0
+TOTAL_NATIVE=0
+ROWS=()
+while IFS= read -r file; do
+    lines=$(grep -nE "$LITERAL_LOOKUP" "$file" | grep -v "$EXEMPT")
+    [ -z "$lines" ] && continue
+
+    count=$(echo "$lines" | wc -l)
+    native=$(echo "$lines" | sed -E 's/.*RequestGameplayTag\([^"]*"([^"]+)".*/\1/' \
+        | grep -cxF -f <(echo "$NATIVE_TAGS"))
+    TOTAL=$((TOTAL + count))
+    TOTAL_NATIVE=$((TOTAL_NATIVE + native))
+    ROWS+=("$count"$'\t'"$native"$'\t'"$file")
+done < <(find "$SRC_DIR" -name "*.cpp" | sort)
+
+# Busiest files first; the loop above runs in this shell so the totals survive
+while IFS=$'\t' read -r count native file; do
+    [ -z "$file" ] && continue
+    printf "%5d  (%4d have native tag)  %s\n" "$count" "$native" "$file"
+    if [ $VERBOSE -eq 1 ]; then
+        grep -nE "$LITERAL_LOOKUP" "$file" | grep -v "$EXEMPT" | sed 's/^/         /'
+    fi
+done < <(printf '%s\n' "${ROWS[@]}" | sort -rn)
+
+echo ""
+printf "%5d  (%4d have native tag)  total in %d files\n" "$TOTAL" "$TOTAL_NATIVE" "${#ROWS[@]}"
+
+echo ""
+echo "Hot-path gate"
+echo "-------------"
+
+FAILED=0
+for file in "${HOT_FILES[@]}"; do
+    if [ ! -f "$file" ]; then
+        echo "⚠️  missing: $file"
+        continue
+    fi
+    lines=$(grep -nE "$LITERAL_LOOKUP" "$file" | grep -v "$EXEMPT")
+    if [ -n "$lines" ]; then
+        echo "❌ $file"
+        echo "$lines" | sed 's/^/     /'
+        FAILED=1
+    else
+        echo "✅ $(basename "$file")"
+    fi
+done
+
+exit $FAILED
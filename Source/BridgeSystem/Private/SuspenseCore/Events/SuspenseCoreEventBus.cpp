@@ -4,11 +4,157 @@
 
 #include "SuspenseCore/Events/SuspenseCoreEventBus.h"
 #include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogSuspenseCoreEventBus, Log, All);
 
+/** Debug tracing of individual events. Compiled out of Shipping builds. */
+#ifndef SUSPENSECORE_EVENTBUS_DEBUG
+	#define SUSPENSECORE_EVENTBUS_DEBUG !UE_BUILD_SHIPPING
+#endif
+
+static TAutoConsoleVariable<float> CVarSuspenseCoreEventBusDeferredBudgetMs(
+	TEXT("suspensecore.eventbus.deferred_budget_ms"),
+	2.0f,
+	TEXT("Per-frame time budget for dispatching deferred events, in milliseconds.\n")
+	TEXT("Events left when the budget runs out are carried over to the next frame.\n")
+	TEXT("0: Unlimited"),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<int32> CVarSuspenseCoreEventBusAsyncRingCapacity(
+	TEXT("suspensecore.eventbus.async_ring_capacity"),
+	1024,
+	TEXT("Capacity of the PublishAsync ingestion ring (rounded up to a power of two).\n")
+	TEXT("Read when the event bus is created."),
+	ECVF_ReadOnly
+);
+
+static TAutoConsoleVariable<int32> CVarSuspenseCoreEventBusAsyncOverflow(
+	TEXT("suspensecore.eventbus.async_overflow"),
+	0,
+	TEXT("What PublishAsync does when the ingestion ring is full.\n")
+	TEXT("0: Fall back to a game-thread task (lossless, default)\n")
+	TEXT("1: Drop the event\n")
+	TEXT("2: Block the producer until the game thread drains"),
+	ECVF_Default
+);
+
+#if SUSPENSECORE_EVENTBUS_DEBUG
+static TAutoConsoleVariable<int32> CVarSuspenseCoreEventBusDebugTrace(
+	TEXT("suspensecore.eventbus.debug_trace"),
+	0,
+	TEXT("Trace subscribe/publish of events matching suspensecore.eventbus.debug_filter.\n")
+	TEXT("0: Disabled (no per-event string work)\n")
+	TEXT("1: Enabled"),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<FString> CVarSuspenseCoreEventBusDebugFilter(
+	TEXT("suspensecore.eventbus.debug_filter"),
+	TEXT("Visual.Spawned"),
+	TEXT("Substring of event tags traced when suspensecore.eventbus.debug_trace is 1 (empty = all events)."),
+	ECVF_Default
+);
+
+namespace SuspenseCoreEventBusDebug
+{
+	static bool ShouldTrace(const FGameplayTag& EventTag)
+	{
+		if (CVarSuspenseCoreEventBusDebugTrace.GetValueOnAnyThread() == 0)
+		{
+			return false;
+		}
+
+		const FString Filter = CVarSuspenseCoreEventBusDebugFilter.GetValueOnAnyThread();
+		return Filter.IsEmpty() || EventTag.ToString().Contains(Filter);
+	}
+}
+
+	#define SUSPENSECORE_EVENTBUS_SHOULD_TRACE(Tag) SuspenseCoreEventBusDebug::ShouldTrace(Tag)
+#else
+	#define SUSPENSECORE_EVENTBUS_SHOULD_TRACE(Tag) false
+#endif
+
+namespace
+{
+	/** Marks a publish as reading the active snapshot; retired snapshots are not freed while any are alive */
+	struct FSnapshotReadScope
+	{
+		explicit FSnapshotReadScope(std::atomic<int32>& InReaders)
+			: Readers(InReaders)
+		{
+			Readers.fetch_add(1, std::memory_order_seq_cst);
+		}
+
+		~FSnapshotReadScope()
+		{
+			Readers.fetch_sub(1, std::memory_order_release);
+		}
+
+		std::atomic<int32>& Readers;
+	};
+
+	/** Copy-on-write removal: only lists that actually contain a match are reallocated */
+	template<typename PredicateType>
+	void RemoveSubscriptionsWhere(
+		TMap<FGameplayTag, FSuspenseCoreSubscriptionListPtr>& Map,
+		PredicateType Predicate,
+		TArray<FGameplayTag>& OutChangedTags)
+	{
+		for (auto It = Map.CreateIterator(); It; ++It)
+		{
+			const FSuspenseCoreSubscriptionList& Current = *It.Value();
+			if (!Current.ContainsByPredicate(Predicate))
+			{
+				continue;
+			}
+
+			TSharedRef<FSuspenseCoreSubscriptionList, ESPMode::ThreadSafe> NewList =
+				MakeShared<FSuspenseCoreSubscriptionList, ESPMode::ThreadSafe>(Current);
+			NewList->RemoveAll(Predicate);
+			OutChangedTags.Add(It.Key());
+
+			if (NewList->Num() == 0)
+			{
+				It.RemoveCurrent();
+			}
+			else
+			{
+				It.Value() = NewList;
+			}
+		}
+	}
+}
+
 USuspenseCoreEventBus::USuspenseCoreEventBus()
 {
+	if (!HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		AsyncRing = MakeUnique<TSuspenseCoreMpscRing<FSuspenseCoreQueuedEvent>>(
+			static_cast<uint32>(FMath::Max(2, CVarSuspenseCoreEventBusAsyncRingCapacity.GetValueOnAnyThread())));
+	}
+}
+
+void USuspenseCoreEventBus::BeginDestroy()
+{
+	{
+		FScopeLock Lock(&SubscriptionLock);
+
+		RetiredSnapshots.Add(ActiveSnapshot.exchange(nullptr, std::memory_order_seq_cst));
+		for (const FSuspenseCoreSubscriptionSnapshot* Snapshot : RetiredSnapshots)
+		{
+			delete Snapshot;
+		}
+		RetiredSnapshots.Empty();
+
+		Subscriptions.Empty();
+		ChildSubscriptions.Empty();
+		DispatchTables.Empty();
+		PublishedEventTags.Empty();
+	}
+
+	Super::BeginDestroy();
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -34,14 +180,84 @@ void USuspenseCoreEventBus::PublishDeferred(FGameplayTag EventTag, const FSuspen
 		return;
 	}
 
-	FScopeLock Lock(&SubscriptionLock);
-
 	FSuspenseCoreQueuedEvent QueuedEvent;
 	QueuedEvent.EventTag = EventTag;
 	QueuedEvent.EventData = EventData;
 	QueuedEvent.QueuedTime = FPlatformTime::Seconds();
 
-	DeferredEvents.Add(QueuedEvent);
+	FScopeLock Lock(&DeferredLock);
+	EnqueueDeferred_NoLock(MoveTemp(QueuedEvent));
+}
+
+void USuspenseCoreEventBus::EnqueueDeferred_NoLock(FSuspenseCoreQueuedEvent&& Event)
+{
+	const FSuspenseCoreEventCoalesceRule* Rule = CoalesceRules.Find(Event.EventTag);
+	if (!Rule || Rule->Policy == ESuspenseCoreEventCoalescePolicy::KeepAll)
+	{
+		DeferredEvents.Add(MoveTemp(Event));
+		return;
+	}
+
+	FSuspenseCoreDeferredEventKey Key;
+	Key.EventTag = Event.EventTag;
+	Key.Source = FObjectKey(Event.EventData.Source.Get());
+	if (!Rule->DiscriminatorKey.IsNone())
+	{
+		if (const FSuspenseCoreEventPayload::FValue* Value = Event.EventData.Payload.FindValue(Rule->DiscriminatorKey))
+		{
+			Key.Discriminator.Emplace(*Value);
+		}
+	}
+
+	const int32* ExistingIndex = DeferredEventIndex.Find(Key);
+	if (!ExistingIndex)
+	{
+		DeferredEventIndex.Add(Key, DeferredEvents.Num());
+		DeferredEvents.Add(MoveTemp(Event));
+		return;
+	}
+
+	// Keep the queue position (and QueuedTime) of the first event for this key
+	FSuspenseCoreQueuedEvent& Queued = DeferredEvents[*ExistingIndex];
+	const int32 FoldedCount = Queued.CoalescedCount + Event.CoalescedCount + 1;
+
+	if (Rule->Policy == ESuspenseCoreEventCoalescePolicy::LastValueWins)
+	{
+		Queued.EventData = MoveTemp(Event.EventData);
+		++DeferredEventsDropped;
+	}
+	else
+	{
+		Queued.EventData.Payload.MergeFrom(Event.EventData.Payload, Rule->AccumulateKeys);
+		Queued.EventData.Tags.AppendTags(Event.EventData.Tags);
+		Queued.EventData.Timestamp = Event.EventData.Timestamp;
+		++DeferredEventsMerged;
+	}
+
+	Queued.CoalescedCount = FoldedCount;
+}
+
+void USuspenseCoreEventBus::SetCoalesceRule(FGameplayTag EventTag, const FSuspenseCoreEventCoalesceRule& Rule)
+{
+	if (!EventTag.IsValid())
+	{
+		UE_LOG(LogSuspenseCoreEventBus, Warning, TEXT("SetCoalesceRule: Invalid EventTag"));
+		return;
+	}
+
+	FScopeLock Lock(&DeferredLock);
+	CoalesceRules.Add(EventTag, Rule);
+
+	// Events already queued under the old rule keep their slots; the index only
+	// ever points into the current frame's queue, so it stays valid.
+	UE_LOG(LogSuspenseCoreEventBus, Verbose, TEXT("Coalesce rule for %s: %s"),
+		*EventTag.ToString(), *UEnum::GetValueAsString(Rule.Policy));
+}
+
+void USuspenseCoreEventBus::ClearCoalesceRule(FGameplayTag EventTag)
+{
+	FScopeLock Lock(&DeferredLock);
+	CoalesceRules.Remove(EventTag);
 }
 
 void USuspenseCoreEventBus::PublishSimple(FGameplayTag EventTag, UObject* Source)
@@ -66,21 +282,13 @@ void USuspenseCoreEventBus::PublishAsync(FGameplayTag EventTag, const FSuspenseC
 		return;
 	}
 
-	// On background thread - dispatch to game thread
-	// Copy the data to ensure it survives the async dispatch
-	FSuspenseCoreEventData DataCopy = EventData;
-	FGameplayTag TagCopy = EventTag;
-
-	// Weak reference to self for safety
-	TWeakObjectPtr<USuspenseCoreEventBus> WeakThis(this);
+	// On background thread - hand over through the ingestion ring
+	FSuspenseCoreQueuedEvent QueuedEvent;
+	QueuedEvent.EventTag = EventTag;
+	QueuedEvent.EventData = EventData;
+	QueuedEvent.QueuedTime = FPlatformTime::Seconds();
 
-	AsyncTask(ENamedThreads::GameThread, [WeakThis, TagCopy, DataCopy]()
-	{
-		if (USuspenseCoreEventBus* StrongThis = WeakThis.Get())
-		{
-			StrongThis->PublishInternal(TagCopy, DataCopy);
-		}
-	});
+	EnqueueAsync(MoveTemp(QueuedEvent));
 }
 
 void USuspenseCoreEventBus::PublishBatchAsync(const TArray<TPair<FGameplayTag, FSuspenseCoreEventData>>& Events)
@@ -104,111 +312,168 @@ void USuspenseCoreEventBus::PublishBatchAsync(const TArray<TPair<FGameplayTag, F
 		return;
 	}
 
-	// On background thread - dispatch batch to game thread
-	// Copy events to ensure they survive
-	TArray<TPair<FGameplayTag, FSuspenseCoreEventData>> EventsCopy = Events;
-
-	// Weak reference to self for safety
-	TWeakObjectPtr<USuspenseCoreEventBus> WeakThis(this);
-
-	AsyncTask(ENamedThreads::GameThread, [WeakThis, EventsCopy]()
+	// On background thread - hand over through the ingestion ring
+	const double QueuedTime = FPlatformTime::Seconds();
+	for (const auto& Pair : Events)
 	{
-		if (USuspenseCoreEventBus* StrongThis = WeakThis.Get())
+		if (!Pair.Key.IsValid())
 		{
-			for (const auto& Pair : EventsCopy)
-			{
-				if (Pair.Key.IsValid())
-				{
-					StrongThis->PublishInternal(Pair.Key, Pair.Value);
-				}
-			}
+			continue;
 		}
-	});
-}
 
-void USuspenseCoreEventBus::PublishInternal(FGameplayTag EventTag, const FSuspenseCoreEventData& EventData)
-{
-	TotalEventsPublished++;
+		FSuspenseCoreQueuedEvent QueuedEvent;
+		QueuedEvent.EventTag = Pair.Key;
+		QueuedEvent.EventData = Pair.Value;
+		QueuedEvent.QueuedTime = QueuedTime;
 
-	// DEBUG: Log Visual.Spawned events for troubleshooting
-	const bool bIsVisualSpawned = EventTag.ToString().Contains(TEXT("Visual.Spawned"));
-	if (bIsVisualSpawned)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("[EventBus DEBUG] ═══════════════════════════════════════════════════════"));
-		UE_LOG(LogTemp, Warning, TEXT("[EventBus DEBUG] PublishInternal: %s"), *EventTag.ToString());
-		UE_LOG(LogTemp, Warning, TEXT("[EventBus DEBUG]   EventBus address: %p"), this);
-		UE_LOG(LogTemp, Warning, TEXT("[EventBus DEBUG]   Total subscriptions maps: %d"), Subscriptions.Num());
+		EnqueueAsync(MoveTemp(QueuedEvent));
 	}
+}
 
-	// Direct subscribers - copy under lock, call without lock
-	TArray<FSuspenseCoreSubscription> DirectSubs;
+void USuspenseCoreEventBus::EnqueueAsync(FSuspenseCoreQueuedEvent&& Event)
+{
+	if (AsyncRing.IsValid())
 	{
-		FScopeLock Lock(&SubscriptionLock);
-		if (TArray<FSuspenseCoreSubscription>* Subs = Subscriptions.Find(EventTag))
+		if (AsyncRing->TryEnqueue(MoveTemp(Event)))
 		{
-			DirectSubs = *Subs;
-			if (bIsVisualSpawned)
+			const int32 Depth = AsyncRing->Num();
+			int32 Peak = AsyncQueuePeakDepth.load(std::memory_order_relaxed);
+			while (Depth > Peak && !AsyncQueuePeakDepth.compare_exchange_weak(Peak, Depth, std::memory_order_relaxed))
 			{
-				UE_LOG(LogTemp, Warning, TEXT("[EventBus DEBUG]   Found %d direct subscribers for tag"), DirectSubs.Num());
 			}
+			return;
 		}
-		else if (bIsVisualSpawned)
+
+		AsyncEventsOverflowed.fetch_add(1, std::memory_order_relaxed);
+
+		switch (CVarSuspenseCoreEventBusAsyncOverflow.GetValueOnAnyThread())
 		{
-			UE_LOG(LogTemp, Error, TEXT("[EventBus DEBUG]   ✗ NO subscribers found for exact tag!"));
-			// List all registered tags for debugging
-			UE_LOG(LogTemp, Warning, TEXT("[EventBus DEBUG]   Registered tags:"));
-			for (const auto& Pair : Subscriptions)
+		case 1:
+			UE_LOG(LogSuspenseCoreEventBus, Verbose, TEXT("PublishAsync: ring full, dropped %s"), *Event.EventTag.ToString());
+			return;
+
+		case 2:
+			// The game thread never produces into the ring, so waiting on it cannot self-deadlock
+			while (!AsyncRing->TryEnqueue(MoveTemp(Event)))
 			{
-				UE_LOG(LogTemp, Warning, TEXT("[EventBus DEBUG]     - %s (%d subs)"),
-					*Pair.Key.ToString(), Pair.Value.Num());
+				FPlatformProcess::Yield();
 			}
+			return;
+
+		default:
+			break;
 		}
 	}
 
-	if (DirectSubs.Num() > 0)
+	// Overflow fallback: one game-thread task, as before the ring existed
+	TWeakObjectPtr<USuspenseCoreEventBus> WeakThis(this);
+	AsyncTask(ENamedThreads::GameThread, [WeakThis, Event = MoveTemp(Event)]()
 	{
-		if (bIsVisualSpawned)
+		if (USuspenseCoreEventBus* StrongThis = WeakThis.Get())
 		{
-			UE_LOG(LogTemp, Warning, TEXT("[EventBus DEBUG]   Notifying %d direct subscribers..."), DirectSubs.Num());
+			StrongThis->PublishInternal(Event.EventTag, Event.EventData);
 		}
-		NotifySubscribers(DirectSubs, EventTag, EventData);
+	});
+}
+
+void USuspenseCoreEventBus::DrainAsyncEvents()
+{
+	if (!AsyncRing.IsValid())
+	{
+		return;
 	}
 
-	// Child tag subscribers - collect under lock
-	TArray<FSuspenseCoreSubscription> ChildSubs;
+	// Bound the drain by what is queued now so busy producers cannot starve the frame
+	const int32 ToDrain = AsyncRing->Num();
+	if (ToDrain == 0)
 	{
-		FScopeLock Lock(&SubscriptionLock);
-		for (const auto& Pair : ChildSubscriptions)
+		LastAsyncDrainCount.store(0, std::memory_order_relaxed);
+		return;
+	}
+
+	const double DrainTime = FPlatformTime::Seconds();
+	double TotalLatency = 0.0;
+	double MaxLatency = 0.0;
+	int32 Drained = 0;
+
+	{
+		// Ring events join the deferred queue in order and are dispatched by the caller
+		// (ProcessDeferredEvents) in the same frame, coalesced like PublishDeferred
+		FScopeLock Lock(&DeferredLock);
+
+		FSuspenseCoreQueuedEvent Event;
+		while (Drained < ToDrain && AsyncRing->TryDequeue(Event))
 		{
-			if (EventTag.MatchesTag(Pair.Key))
-			{
-				ChildSubs.Append(Pair.Value);
-			}
+			const double Latency = DrainTime - Event.QueuedTime;
+			TotalLatency += Latency;
+			MaxLatency = FMath::Max(MaxLatency, Latency);
+			++Drained;
+
+			EnqueueDeferred_NoLock(MoveTemp(Event));
+		}
+	}
+
+	LastAsyncDrainCount.store(Drained, std::memory_order_relaxed);
+	LastAsyncDrainMaxLatencyMs.store(static_cast<float>(MaxLatency * 1000.0), std::memory_order_relaxed);
+	LastAsyncDrainAvgLatencyMs.store(Drained > 0 ? static_cast<float>(TotalLatency * 1000.0 / Drained) : 0.0f, std::memory_order_relaxed);
+}
+
+void USuspenseCoreEventBus::PublishInternal(FGameplayTag EventTag, const FSuspenseCoreEventData& EventData)
+{
+	TotalEventsPublished.fetch_add(1, std::memory_order_relaxed);
+
+	// Lock-free read: pin the current snapshot for the duration of dispatch.
+	// Callbacks may Subscribe/Unsubscribe freely - they swap in a new snapshot
+	// and never mutate the lists we are iterating.
+	FSnapshotReadScope ReadScope(ActiveReaders);
+	const FSuspenseCoreSubscriptionSnapshot* Snapshot = ActiveSnapshot.load(std::memory_order_seq_cst);
+
+	const bool bTrace = SUSPENSECORE_EVENTBUS_SHOULD_TRACE(EventTag);
+	if (bTrace)
+	{
+		UE_LOG(LogSuspenseCoreEventBus, Warning, TEXT("[EventBus DEBUG] PublishInternal: %s (Bus=%p, DirectTags=%d)"),
+			*EventTag.ToString(), this, Snapshot ? Snapshot->Direct.Num() : 0);
+	}
+
+	// Flattened direct + ancestor subscribers, already merged by priority
+	if (const FSuspenseCoreSubscriptionListPtr* Resolved = Snapshot ? Snapshot->Resolved.Find(EventTag) : nullptr)
+	{
+		if (Resolved->IsValid())
+		{
+			NotifySubscribers(**Resolved, EventTag, EventData);
+		}
+		else if (bTrace)
+		{
+			UE_LOG(LogSuspenseCoreEventBus, Warning, TEXT("[EventBus DEBUG]   NO subscribers found for tag"));
 		}
+		return;
 	}
 
-	if (ChildSubs.Num() > 0)
+	// First publish of this tag since the table was built - resolve once and cache
+	const FSuspenseCoreSubscriptionListPtr Resolved = ResolveAndCacheDispatchTable(EventTag);
+	if (Resolved.IsValid())
 	{
-		NotifySubscribers(ChildSubs, EventTag, EventData);
+		NotifySubscribers(*Resolved, EventTag, EventData);
 	}
 }
 
 void USuspenseCoreEventBus::NotifySubscribers(
-	const TArray<FSuspenseCoreSubscription>& Subs,
+	const FSuspenseCoreSubscriptionList& Subs,
 	FGameplayTag EventTag,
 	const FSuspenseCoreEventData& EventData)
 {
-	// DEBUG: Log Visual.Spawned events for troubleshooting
-	const bool bIsVisualSpawned = EventTag.ToString().Contains(TEXT("Visual.Spawned"));
+	const bool bTrace = SUSPENSECORE_EVENTBUS_SHOULD_TRACE(EventTag);
+
+	// Blueprint subscribers read the reflected payload maps; built once per dispatch, only if needed
+	TOptional<FSuspenseCoreEventData> BlueprintEventData;
 
 	for (const FSuspenseCoreSubscription& Sub : Subs)
 	{
 		if (!Sub.IsValid())
 		{
-			if (bIsVisualSpawned)
+			if (bTrace)
 			{
-				UE_LOG(LogTemp, Error, TEXT("[EventBus DEBUG]   ✗ Subscriber INVALID (ID=%llu, Subscriber=%s)"),
-					Sub.Id, Sub.Subscriber.IsValid() ? *Sub.Subscriber->GetName() : TEXT("STALE"));
+				UE_LOG(LogSuspenseCoreEventBus, Warning, TEXT("[EventBus DEBUG]   Subscriber INVALID (ID=%llu)"), Sub.Id);
 			}
 			continue;
 		}
@@ -216,48 +481,31 @@ void USuspenseCoreEventBus::NotifySubscribers(
 		// Check source filter
 		if (Sub.SourceFilter.IsValid() && Sub.SourceFilter.Get() != EventData.Source.Get())
 		{
-			if (bIsVisualSpawned)
-			{
-				UE_LOG(LogTemp, Warning, TEXT("[EventBus DEBUG]   Skipping due to SourceFilter mismatch"));
-			}
 			continue;
 		}
 
-		if (bIsVisualSpawned)
+		if (bTrace)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("[EventBus DEBUG]   ✓ Calling subscriber: %s (ID=%llu, Native=%d)"),
-				*GetNameSafe(Sub.Subscriber.Get()), Sub.Id, Sub.bUseNativeCallback);
+			UE_LOG(LogSuspenseCoreEventBus, Warning, TEXT("[EventBus DEBUG]   Calling subscriber: %s (ID=%llu, Native=%d, Bound=%d)"),
+				*GetNameSafe(Sub.Subscriber.Get()), Sub.Id, Sub.bUseNativeCallback,
+				Sub.bUseNativeCallback ? Sub.NativeCallback.IsBound() : Sub.DynamicCallback.IsBound());
 		}
 
 		// Call callback
 		if (Sub.bUseNativeCallback)
 		{
-			if (Sub.NativeCallback.IsBound())
-			{
-				Sub.NativeCallback.Execute(EventTag, EventData);
-				if (bIsVisualSpawned)
-				{
-					UE_LOG(LogTemp, Warning, TEXT("[EventBus DEBUG]   ✓ Native callback executed"));
-				}
-			}
-			else if (bIsVisualSpawned)
-			{
-				UE_LOG(LogTemp, Error, TEXT("[EventBus DEBUG]   ✗ Native callback NOT bound!"));
-			}
+			Sub.NativeCallback.ExecuteIfBound(EventTag, EventData);
 		}
-		else
+		else if (Sub.DynamicCallback.IsBound())
 		{
-			if (Sub.DynamicCallback.IsBound())
+			if (!BlueprintEventData.IsSet())
 			{
-				Sub.DynamicCallback.Execute(EventTag, EventData);
+				BlueprintEventData.Emplace(EventData);
+				BlueprintEventData->SyncBlueprintPayload();
 			}
+			Sub.DynamicCallback.Execute(EventTag, BlueprintEventData.GetValue());
 		}
 	}
-
-	if (bIsVisualSpawned)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("[EventBus DEBUG] ═══════════════════════════════════════════════════════"));
-	}
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -385,19 +633,6 @@ FSuspenseCoreSubscriptionHandle USuspenseCoreEventBus::CreateSubscription(
 		return FSuspenseCoreSubscriptionHandle();
 	}
 
-	// DEBUG: Log Visual.Spawned subscriptions
-	const bool bIsVisualSpawned = EventTag.ToString().Contains(TEXT("Visual.Spawned"));
-	if (bIsVisualSpawned)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("[EventBus DEBUG] ═══════════════════════════════════════════════════════"));
-		UE_LOG(LogTemp, Warning, TEXT("[EventBus DEBUG] CreateSubscription: %s"), *EventTag.ToString());
-		UE_LOG(LogTemp, Warning, TEXT("[EventBus DEBUG]   EventBus address: %p"), this);
-		UE_LOG(LogTemp, Warning, TEXT("[EventBus DEBUG]   Subscriber: %s (Valid=%d)"),
-			*GetNameSafe(Subscriber), IsValid(Subscriber));
-		UE_LOG(LogTemp, Warning, TEXT("[EventBus DEBUG]   NativeCallback bound: %d"), NativeCallback.IsBound());
-		UE_LOG(LogTemp, Warning, TEXT("[EventBus DEBUG]   SubscribeToChildren: %d"), bSubscribeToChildren);
-	}
-
 	FScopeLock Lock(&SubscriptionLock);
 
 	FSuspenseCoreSubscription NewSub;
@@ -409,20 +644,35 @@ FSuspenseCoreSubscriptionHandle USuspenseCoreEventBus::CreateSubscription(
 	NewSub.DynamicCallback = DynamicCallback;
 	NewSub.bUseNativeCallback = NativeCallback.IsBound();
 
-	TMap<FGameplayTag, TArray<FSuspenseCoreSubscription>>& TargetMap =
+	TMap<FGameplayTag, FSuspenseCoreSubscriptionListPtr>& TargetMap =
 		bSubscribeToChildren ? ChildSubscriptions : Subscriptions;
 
-	TArray<FSuspenseCoreSubscription>& Subs = TargetMap.FindOrAdd(EventTag);
-	Subs.Add(NewSub);
+	// Copy-on-write: the old list may still be iterated by an in-flight publish
+	FSuspenseCoreSubscriptionListPtr& Existing = TargetMap.FindOrAdd(EventTag);
+	TSharedRef<FSuspenseCoreSubscriptionList, ESPMode::ThreadSafe> NewList = Existing.IsValid()
+		? MakeShared<FSuspenseCoreSubscriptionList, ESPMode::ThreadSafe>(*Existing)
+		: MakeShared<FSuspenseCoreSubscriptionList, ESPMode::ThreadSafe>();
+	NewList->Add(NewSub);
 
 	// Sort by priority
-	SortSubscriptionsByPriority(Subs);
+	SortSubscriptionsByPriority(*NewList);
+	Existing = NewList;
 
-	if (bIsVisualSpawned)
+	if (bSubscribeToChildren)
+	{
+		InvalidateDispatchTables_NoLock(TArray<FGameplayTag>(), TArray<FGameplayTag>{ EventTag });
+	}
+	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[EventBus DEBUG]   ✓ Subscription created (ID=%llu), total for tag: %d"),
-			NewSub.Id, Subs.Num());
-		UE_LOG(LogTemp, Warning, TEXT("[EventBus DEBUG] ═══════════════════════════════════════════════════════"));
+		InvalidateDispatchTables_NoLock(TArray<FGameplayTag>{ EventTag }, TArray<FGameplayTag>());
+	}
+	PublishSnapshot_NoLock();
+
+	if (SUSPENSECORE_EVENTBUS_SHOULD_TRACE(EventTag))
+	{
+		UE_LOG(LogSuspenseCoreEventBus, Warning, TEXT("[EventBus DEBUG] CreateSubscription: %s (Bus=%p, Subscriber=%s, Native=%d, Children=%d, ID=%llu, Total=%d)"),
+			*EventTag.ToString(), this, *GetNameSafe(Subscriber), NewSub.bUseNativeCallback,
+			bSubscribeToChildren, NewSub.Id, NewList->Num());
 	}
 
 	UE_LOG(LogSuspenseCoreEventBus, Verbose, TEXT("Subscribed to %s (ID: %llu, Children: %d)"),
@@ -444,24 +694,22 @@ void USuspenseCoreEventBus::Unsubscribe(FSuspenseCoreSubscriptionHandle Handle)
 
 	FScopeLock Lock(&SubscriptionLock);
 
-	uint64 TargetId = Handle.GetId();
-
-	// Search in regular subscriptions
-	for (auto& Pair : Subscriptions)
+	const uint64 TargetId = Handle.GetId();
+	auto MatchesId = [TargetId](const FSuspenseCoreSubscription& Sub)
 	{
-		Pair.Value.RemoveAll([TargetId](const FSuspenseCoreSubscription& Sub)
-		{
-			return Sub.Id == TargetId;
-		});
-	}
+		return Sub.Id == TargetId;
+	};
 
-	// Search in child subscriptions
-	for (auto& Pair : ChildSubscriptions)
+	// Search in regular and child subscriptions
+	TArray<FGameplayTag> ChangedTags;
+	TArray<FGameplayTag> ChangedParentTags;
+	RemoveSubscriptionsWhere(Subscriptions, MatchesId, ChangedTags);
+	RemoveSubscriptionsWhere(ChildSubscriptions, MatchesId, ChangedParentTags);
+
+	if (ChangedTags.Num() > 0 || ChangedParentTags.Num() > 0)
 	{
-		Pair.Value.RemoveAll([TargetId](const FSuspenseCoreSubscription& Sub)
-		{
-			return Sub.Id == TargetId;
-		});
+		InvalidateDispatchTables_NoLock(ChangedTags, ChangedParentTags);
+		PublishSnapshot_NoLock();
 	}
 
 	UE_LOG(LogSuspenseCoreEventBus, Verbose, TEXT("Unsubscribed (ID: %llu)"), TargetId);
@@ -476,20 +724,20 @@ void USuspenseCoreEventBus::UnsubscribeAll(UObject* Subscriber)
 
 	FScopeLock Lock(&SubscriptionLock);
 
-	for (auto& Pair : Subscriptions)
+	auto MatchesSubscriber = [Subscriber](const FSuspenseCoreSubscription& Sub)
 	{
-		Pair.Value.RemoveAll([Subscriber](const FSuspenseCoreSubscription& Sub)
-		{
-			return Sub.Subscriber.Get() == Subscriber;
-		});
-	}
+		return Sub.Subscriber.Get() == Subscriber;
+	};
 
-	for (auto& Pair : ChildSubscriptions)
+	TArray<FGameplayTag> ChangedTags;
+	TArray<FGameplayTag> ChangedParentTags;
+	RemoveSubscriptionsWhere(Subscriptions, MatchesSubscriber, ChangedTags);
+	RemoveSubscriptionsWhere(ChildSubscriptions, MatchesSubscriber, ChangedParentTags);
+
+	if (ChangedTags.Num() > 0 || ChangedParentTags.Num() > 0)
 	{
-		Pair.Value.RemoveAll([Subscriber](const FSuspenseCoreSubscription& Sub)
-		{
-			return Sub.Subscriber.Get() == Subscriber;
-		});
+		InvalidateDispatchTables_NoLock(ChangedTags, ChangedParentTags);
+		PublishSnapshot_NoLock();
 	}
 
 	UE_LOG(LogSuspenseCoreEventBus, Verbose, TEXT("Unsubscribed all for %s"), *GetNameSafe(Subscriber));
@@ -501,94 +749,274 @@ void USuspenseCoreEventBus::UnsubscribeAll(UObject* Subscriber)
 
 void USuspenseCoreEventBus::ProcessDeferredEvents()
 {
+	// Events handed over by worker threads since last frame
+	DrainAsyncEvents();
+
 	TArray<FSuspenseCoreQueuedEvent> EventsToProcess;
 
 	{
-		FScopeLock Lock(&SubscriptionLock);
+		FScopeLock Lock(&DeferredLock);
 		EventsToProcess = MoveTemp(DeferredEvents);
-		DeferredEvents.Empty();
+		DeferredEvents.Reset();
+		DeferredEventIndex.Reset();
 	}
 
-	for (const FSuspenseCoreQueuedEvent& Event : EventsToProcess)
+	const double BudgetSeconds = FMath::Max(0.0f, CVarSuspenseCoreEventBusDeferredBudgetMs.GetValueOnAnyThread()) / 1000.0;
+	const double StartTime = FPlatformTime::Seconds();
+
+	int32 ProcessedCount = 0;
+	for (; ProcessedCount < EventsToProcess.Num(); ++ProcessedCount)
 	{
+		// Always make progress: at least one event per frame
+		if (BudgetSeconds > 0.0 && ProcessedCount > 0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+		{
+			break;
+		}
+
+		FSuspenseCoreQueuedEvent& Event = EventsToProcess[ProcessedCount];
+		if (Event.CoalescedCount > 0)
+		{
+			Event.EventData.SetInt(TEXT("CoalescedCount"), Event.CoalescedCount);
+		}
 		PublishInternal(Event.EventTag, Event.EventData);
 	}
+
+	{
+		FScopeLock Lock(&DeferredLock);
+
+		if (ProcessedCount < EventsToProcess.Num())
+		{
+			// Spilled events go ahead of anything queued by handlers this frame,
+			// and stay coalescable with it
+			TArray<FSuspenseCoreQueuedEvent> QueuedDuringDispatch = MoveTemp(DeferredEvents);
+			DeferredEvents.Reset();
+			DeferredEventIndex.Reset();
+
+			for (int32 Index = ProcessedCount; Index < EventsToProcess.Num(); ++Index)
+			{
+				EnqueueDeferred_NoLock(MoveTemp(EventsToProcess[Index]));
+			}
+			for (FSuspenseCoreQueuedEvent& Event : QueuedDuringDispatch)
+			{
+				EnqueueDeferred_NoLock(MoveTemp(Event));
+			}
+
+			DeferredEventsSpilled += EventsToProcess.Num() - ProcessedCount;
+		}
+
+		LastDeferredProcessMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+
+	// Frame boundary - usually no publish is in flight, free swapped-out snapshots
+	FScopeLock Lock(&SubscriptionLock);
+	ReclaimRetiredSnapshots_NoLock();
 }
 
 void USuspenseCoreEventBus::CleanupStaleSubscriptions()
 {
 	FScopeLock Lock(&SubscriptionLock);
 
-	for (auto& Pair : Subscriptions)
+	auto IsStale = [](const FSuspenseCoreSubscription& Sub)
 	{
-		Pair.Value.RemoveAll([](const FSuspenseCoreSubscription& Sub)
-		{
-			return !Sub.IsValid();
-		});
+		return !Sub.IsValid();
+	};
+
+	// Empty entries are removed by the helper
+	TArray<FGameplayTag> ChangedTags;
+	TArray<FGameplayTag> ChangedParentTags;
+	RemoveSubscriptionsWhere(Subscriptions, IsStale, ChangedTags);
+	RemoveSubscriptionsWhere(ChildSubscriptions, IsStale, ChangedParentTags);
+
+	if (ChangedTags.Num() > 0 || ChangedParentTags.Num() > 0)
+	{
+		InvalidateDispatchTables_NoLock(ChangedTags, ChangedParentTags);
+		PublishSnapshot_NoLock();
 	}
+}
 
-	for (auto& Pair : ChildSubscriptions)
+FSuspenseCoreEventBusStats USuspenseCoreEventBus::GetStats() const
+{
+	FScopeLock Lock(&SubscriptionLock);
+
+	FSuspenseCoreEventBusStats Stats;
+
+	for (const auto& Pair : Subscriptions)
 	{
-		Pair.Value.RemoveAll([](const FSuspenseCoreSubscription& Sub)
-		{
-			return !Sub.IsValid();
-		});
+		Stats.ActiveSubscriptions += Pair.Value->Num();
+	}
+	for (const auto& Pair : ChildSubscriptions)
+	{
+		Stats.ActiveSubscriptions += Pair.Value->Num();
 	}
 
-	// Remove empty entries
-	for (auto It = Subscriptions.CreateIterator(); It; ++It)
+	Stats.UniqueEventTags = Subscriptions.Num() + ChildSubscriptions.Num();
+	Stats.ResolvedEventTags = DispatchTables.Num();
+	Stats.TotalEventsPublished = TotalEventsPublished.load(std::memory_order_relaxed);
+
 	{
-		if (It.Value().Num() == 0)
-		{
-			It.RemoveCurrent();
-		}
+		FScopeLock DeferredScope(&DeferredLock);
+		Stats.DeferredEventsQueued = DeferredEvents.Num();
+		Stats.DeferredEventsDropped = DeferredEventsDropped;
+		Stats.DeferredEventsMerged = DeferredEventsMerged;
+		Stats.DeferredEventsSpilled = DeferredEventsSpilled;
+		Stats.LastDeferredProcessMs = LastDeferredProcessMs;
 	}
 
-	for (auto It = ChildSubscriptions.CreateIterator(); It; ++It)
+	Stats.AsyncQueueDepth = AsyncRing.IsValid() ? AsyncRing->Num() : 0;
+	Stats.AsyncQueueCapacity = AsyncRing.IsValid() ? AsyncRing->Capacity() : 0;
+	Stats.AsyncQueuePeakDepth = AsyncQueuePeakDepth.load(std::memory_order_relaxed);
+	Stats.AsyncEventsOverflowed = AsyncEventsOverflowed.load(std::memory_order_relaxed);
+	Stats.LastAsyncDrainCount = LastAsyncDrainCount.load(std::memory_order_relaxed);
+	Stats.LastAsyncDrainMaxLatencyMs = LastAsyncDrainMaxLatencyMs.load(std::memory_order_relaxed);
+	Stats.LastAsyncDrainAvgLatencyMs = LastAsyncDrainAvgLatencyMs.load(std::memory_order_relaxed);
+
+	return Stats;
+}
+
+bool USuspenseCoreEventBus::HasSubscribers(FGameplayTag EventTag) const
+{
+	FSnapshotReadScope ReadScope(ActiveReaders);
+	const FSuspenseCoreSubscriptionSnapshot* Snapshot = ActiveSnapshot.load(std::memory_order_seq_cst);
+
+	if (!Snapshot)
 	{
-		if (It.Value().Num() == 0)
+		return false;
+	}
+
+	const FSuspenseCoreSubscriptionListPtr* Subs = Snapshot->Direct.Find(EventTag);
+	return Subs && (*Subs)->Num() > 0;
+}
+
+void USuspenseCoreEventBus::SortSubscriptionsByPriority(FSuspenseCoreSubscriptionList& Subs)
+{
+	// Stable so equal priorities keep subscription order
+	Subs.StableSort();
+}
+
+void USuspenseCoreEventBus::PublishSnapshot_NoLock()
+{
+	FSuspenseCoreSubscriptionSnapshot* NewSnapshot = new FSuspenseCoreSubscriptionSnapshot();
+	NewSnapshot->Direct = Subscriptions;
+
+	// Re-resolve every tag that has been published and was invalidated by this change
+	for (const FGameplayTag& KnownTag : PublishedEventTags)
+	{
+		if (!DispatchTables.Contains(KnownTag))
 		{
-			It.RemoveCurrent();
+			DispatchTables.Add(KnownTag, BuildDispatchTable_NoLock(KnownTag));
 		}
 	}
+	NewSnapshot->Resolved = DispatchTables;
+
+	const FSuspenseCoreSubscriptionSnapshot* OldSnapshot =
+		ActiveSnapshot.exchange(NewSnapshot, std::memory_order_seq_cst);
+
+	if (OldSnapshot)
+	{
+		RetiredSnapshots.Add(OldSnapshot);
+	}
+
+	ReclaimRetiredSnapshots_NoLock();
 }
 
-FSuspenseCoreEventBusStats USuspenseCoreEventBus::GetStats() const
+void USuspenseCoreEventBus::ReclaimRetiredSnapshots_NoLock()
 {
-	FScopeLock Lock(&SubscriptionLock);
+	if (RetiredSnapshots.Num() == 0)
+	{
+		return;
+	}
 
-	FSuspenseCoreEventBusStats Stats;
+	// Every retired snapshot was swapped out before this load. A reader that
+	// registers after it can only observe the current snapshot, so zero here
+	// means nobody can still hold a retired pointer.
+	if (ActiveReaders.load(std::memory_order_seq_cst) != 0)
+	{
+		return;
+	}
 
-	for (const auto& Pair : Subscriptions)
+	for (const FSuspenseCoreSubscriptionSnapshot* Snapshot : RetiredSnapshots)
 	{
-		Stats.ActiveSubscriptions += Pair.Value.Num();
+		delete Snapshot;
 	}
+	RetiredSnapshots.Reset();
+}
+
+
+FSuspenseCoreSubscriptionListPtr USuspenseCoreEventBus::BuildDispatchTable_NoLock(const FGameplayTag& EventTag) const
+{
+	const FSuspenseCoreSubscriptionListPtr* DirectSubs = Subscriptions.Find(EventTag);
+
+	TArray<const FSuspenseCoreSubscriptionList*, TInlineAllocator<8>> AncestorLists;
 	for (const auto& Pair : ChildSubscriptions)
 	{
-		Stats.ActiveSubscriptions += Pair.Value.Num();
+		if (EventTag.MatchesTag(Pair.Key))
+		{
+			AncestorLists.Add(Pair.Value.Get());
+		}
+	}
+
+	// No hierarchical listeners - share the direct list as-is
+	if (AncestorLists.Num() == 0)
+	{
+		return DirectSubs ? *DirectSubs : FSuspenseCoreSubscriptionListPtr();
 	}
 
-	Stats.UniqueEventTags = Subscriptions.Num() + ChildSubscriptions.Num();
-	Stats.TotalEventsPublished = TotalEventsPublished;
-	Stats.DeferredEventsQueued = DeferredEvents.Num();
+	TSharedRef<FSuspenseCoreSubscriptionList, ESPMode::ThreadSafe> Merged =
+		MakeShared<FSuspenseCoreSubscriptionList, ESPMode::ThreadSafe>();
 
-	return Stats;
+	if (DirectSubs)
+	{
+		Merged->Append(**DirectSubs);
+	}
+	for (const FSuspenseCoreSubscriptionList* List : AncestorLists)
+	{
+		Merged->Append(*List);
+	}
+
+	// Stable: on equal priority direct subscribers run before parent-tag subscribers
+	SortSubscriptionsByPriority(*Merged);
+	return Merged;
 }
 
-bool USuspenseCoreEventBus::HasSubscribers(FGameplayTag EventTag) const
+FSuspenseCoreSubscriptionListPtr USuspenseCoreEventBus::ResolveAndCacheDispatchTable(const FGameplayTag& EventTag)
 {
 	FScopeLock Lock(&SubscriptionLock);
 
-	if (const TArray<FSuspenseCoreSubscription>* Subs = Subscriptions.Find(EventTag))
+	// Another thread may have resolved it while we waited
+	if (const FSuspenseCoreSubscriptionListPtr* Existing = DispatchTables.Find(EventTag))
 	{
-		return Subs->Num() > 0;
+		return *Existing;
 	}
 
-	return false;
+	PublishedEventTags.Add(EventTag);
+	PublishSnapshot_NoLock();
+
+	return DispatchTables.FindRef(EventTag);
 }
 
-void USuspenseCoreEventBus::SortSubscriptionsByPriority(TArray<FSuspenseCoreSubscription>& Subs)
+void USuspenseCoreEventBus::InvalidateDispatchTables_NoLock(
+	const TArray<FGameplayTag>& ChangedTags,
+	const TArray<FGameplayTag>& ChangedParentTags)
 {
-	// Uses FSuspenseCoreSubscription::operator< for sorting
-	Subs.Sort();
+	for (const FGameplayTag& Tag : ChangedTags)
+	{
+		DispatchTables.Remove(Tag);
+	}
+
+	if (ChangedParentTags.Num() == 0)
+	{
+		return;
+	}
+
+	for (auto It = DispatchTables.CreateIterator(); It; ++It)
+	{
+		for (const FGameplayTag& ParentTag : ChangedParentTags)
+		{
+			if (It.Key().MatchesTag(ParentTag))
+			{
+				It.RemoveCurrent();
+				break;
+			}
+		}
+	}
 }
@@ -0,0 +1,108 @@
+// SuspenseCoreEventDataLibrary.cpp
+// SuspenseCore - Clean Architecture Foundation
+// Copyright (c) 2025. All Rights Reserved.
+
+#include "SuspenseCore/Events/SuspenseCoreEventDataLibrary.h"
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// GETTERS
+// ═══════════════════════════════════════════════════════════════════════════════
+
+FString USuspenseCoreEventDataLibrary::GetString(const FSuspenseCoreEventData& EventData, FName Key, const FString& Default)
+{
+	return EventData.GetString(Key, Default);
+}
+
+float USuspenseCoreEventDataLibrary::GetFloat(const FSuspenseCoreEventData& EventData, FName Key, float Default)
+{
+	return EventData.GetFloat(Key, Default);
+}
+
+int32 USuspenseCoreEventDataLibrary::GetInt(const FSuspenseCoreEventData& EventData, FName Key, int32 Default)
+{
+	return EventData.GetInt(Key, Default);
+}
+
+bool USuspenseCoreEventDataLibrary::GetBool(const FSuspenseCoreEventData& EventData, FName Key, bool Default)
+{
+	return EventData.GetBool(Key, Default);
+}
+
+FVector USuspenseCoreEventDataLibrary::GetVector(const FSuspenseCoreEventData& EventData, FName Key)
+{
+	return EventData.GetVector(Key);
+}
+
+UObject* USuspenseCoreEventDataLibrary::GetObject(const FSuspenseCoreEventData& EventData, FName Key)
+{
+	return EventData.GetObject<UObject>(Key);
+}
+
+FGameplayTag USuspenseCoreEventDataLibrary::GetGameplayTag(const FSuspenseCoreEventData& EventData, FName Key)
+{
+	return EventData.GetGameplayTag(Key);
+}
+
+FName USuspenseCoreEventDataLibrary::GetNameValue(const FSuspenseCoreEventData& EventData, FName Key)
+{
+	return EventData.GetName(Key);
+}
+
+FGuid USuspenseCoreEventDataLibrary::GetGuid(const FSuspenseCoreEventData& EventData, FName Key)
+{
+	return EventData.GetGuid(Key);
+}
+
+bool USuspenseCoreEventDataLibrary::HasKey(const FSuspenseCoreEventData& EventData, FName Key)
+{
+	return EventData.HasKey(Key);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// SETTERS
+// ═══════════════════════════════════════════════════════════════════════════════
+
+void USuspenseCoreEventDataLibrary::SetString(FSuspenseCoreEventData& EventData, FName Key, const FString& Value)
+{
+	EventData.SetString(Key, Value);
+}
+
+void USuspenseCoreEventDataLibrary::SetFloat(FSuspenseCoreEventData& EventData, FName Key, float Value)
+{
+	EventData.SetFloat(Key, Value);
+}
+
+void USuspenseCoreEventDataLibrary::SetInt(FSuspenseCoreEventData& EventData, FName Key, int32 Value)
+{
+	EventData.SetInt(Key, Value);
+}
+
+void USuspenseCoreEventDataLibrary::SetBool(FSuspenseCoreEventData& EventData, FName Key, bool Value)
+{
+	EventData.SetBool(Key, Value);
+}
+
+void USuspenseCoreEventDataLibrary::SetVector(FSuspenseCoreEventData& EventData, FName Key, FVector Value)
+{
+	EventData.SetVector(Key, Value);
+}
+
+void USuspenseCoreEventDataLibrary::SetObject(FSuspenseCoreEventData& EventData, FName Key, UObject* Value)
+{
+	EventData.SetObject(Key, Value);
+}
+
+void USuspenseCoreEventDataLibrary::SetGameplayTag(FSuspenseCoreEventData& EventData, FName Key, FGameplayTag Value)
+{
+	EventData.SetGameplayTag(Key, Value);
+}
+
+void USuspenseCoreEventDataLibrary::SetNameValue(FSuspenseCoreEventData& EventData, FName Key, FName Value)
+{
+	EventData.SetName(Key, Value);
+}
+
+void USuspenseCoreEventDataLibrary::SetGuid(FSuspenseCoreEventData& EventData, FName Key, FGuid Value)
+{
+	EventData.SetGuid(Key, Value);
+}
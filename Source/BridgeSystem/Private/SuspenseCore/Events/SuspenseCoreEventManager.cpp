@@ -5,6 +5,7 @@
 #include "SuspenseCore/Events/SuspenseCoreEventManager.h"
 #include "SuspenseCore/Events/SuspenseCoreEventBus.h"
 #include "SuspenseCore/Services/SuspenseCoreServiceLocator.h"
+#include "SuspenseCore/Tags/SuspenseCoreGameplayTags.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
 
@@ -171,6 +172,42 @@ void USuspenseCoreEventManager::CreateSubsystems()
 	// Register EventBus and ServiceLocator as services
 	ServiceLocator->RegisterService<USuspenseCoreEventBus>(EventBus);
 	ServiceLocator->RegisterService<USuspenseCoreServiceLocator>(ServiceLocator);
+
+	RegisterDefaultCoalesceRules(EventBus);
+}
+
+void USuspenseCoreEventManager::RegisterDefaultCoalesceRules(USuspenseCoreEventBus* Bus)
+{
+	if (!Bus)
+	{
+		return;
+	}
+
+	// Rules only apply to deferred and async-ring events: the producers of these tags
+	// (fire/reload abilities, weapon interface, inventory component, DoT service) use PublishDeferred,
+	// so their subscribers run from ProcessDeferredEvents, up to one frame after the change.
+
+	// Bursty HUD-bound producers: one deferred dispatch per source per frame
+	FSuspenseCoreEventCoalesceRule LatestState;
+	LatestState.Policy = ESuspenseCoreEventCoalescePolicy::LastValueWins;
+
+	Bus->SetCoalesceRule(SuspenseCoreTags::Event::Weapon::SpreadChanged, LatestState);
+	Bus->SetCoalesceRule(SuspenseCoreTags::Event::Inventory::Updated, LatestState);
+
+	// Magazine state (fire/reload abilities) and reserve counts (weapon interface) carry
+	// different fields: keep the latest of each kind instead of letting one replace the other
+	FSuspenseCoreEventCoalesceRule LatestAmmo = LatestState;
+	LatestAmmo.DiscriminatorKey = TEXT("AmmoKind");
+
+	Bus->SetCoalesceRule(SuspenseCoreTags::Event::Weapon::AmmoChanged, LatestAmmo);
+
+	// DoT ticks: one event per target and DoT type, damage summed
+	FSuspenseCoreEventCoalesceRule DoTTicks;
+	DoTTicks.Policy = ESuspenseCoreEventCoalescePolicy::Accumulate;
+	DoTTicks.DiscriminatorKey = TEXT("DoTType");
+	DoTTicks.AccumulateKeys.Add(TEXT("DamageDealt"));
+
+	Bus->SetCoalesceRule(SuspenseCoreTags::Event::DoT::Tick, DoTTicks);
 }
 
 bool USuspenseCoreEventManager::Tick(float DeltaTime)
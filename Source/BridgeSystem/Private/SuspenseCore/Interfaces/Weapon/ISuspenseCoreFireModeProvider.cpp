@@ -32,7 +32,7 @@ void ISuspenseCoreFireModeProvider::BroadcastFireModeChanged(
 		if (USuspenseCoreEventBus* EventBus = Manager->GetEventBus())
 		{
 			FSuspenseCoreEventData EventData = FSuspenseCoreEventData::Create(const_cast<UObject*>(FireModeProvider))
-				.SetString(TEXT("FireModeTag"), NewFireMode.ToString())
+				.SetGameplayTag(TEXT("FireModeTag"), NewFireMode)
 				.SetFloat(TEXT("CurrentSpread"), CurrentSpread);
 
 			EventBus->Publish(
@@ -58,7 +58,7 @@ void ISuspenseCoreFireModeProvider::BroadcastFireModeAvailabilityChanged(
 		if (USuspenseCoreEventBus* EventBus = Manager->GetEventBus())
 		{
 			FSuspenseCoreEventData EventData = FSuspenseCoreEventData::Create(const_cast<UObject*>(FireModeProvider))
-				.SetString(TEXT("FireModeTag"), FireModeTag.ToString())
+				.SetGameplayTag(TEXT("FireModeTag"), FireModeTag)
 				.SetBool(TEXT("Enabled"), bEnabled);
 
 			EventBus->Publish(
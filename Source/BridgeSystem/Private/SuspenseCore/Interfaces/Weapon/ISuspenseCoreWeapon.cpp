@@ -4,6 +4,7 @@
 #include "SuspenseCore/Events/SuspenseCoreEventManager.h"
 #include "SuspenseCore/Events/SuspenseCoreEventBus.h"
 #include "SuspenseCore/Types/SuspenseCoreTypes.h"
+#include "SuspenseCore/Tags/SuspenseCoreGameplayTags.h"
 #include "Engine/World.h"
 #include "Engine/GameInstance.h"
 
@@ -37,7 +38,7 @@ void ISuspenseCoreWeapon::BroadcastWeaponFired(
                 .SetVector(TEXT("Origin"), Origin)
                 .SetVector(TEXT("Impact"), Impact)
                 .SetBool(TEXT("Success"), bSuccess)
-                .SetString(TEXT("ShotType"), ShotType.ToString());
+                .SetName(TEXT("ShotType"), ShotType);
 
             EventBus->Publish(
                 FGameplayTag::RequestGameplayTag(TEXT("SuspenseCore.Event.Weapon.Fired")),
@@ -65,12 +66,11 @@ void ISuspenseCoreWeapon::BroadcastAmmoChanged(
             FSuspenseCoreEventData EventData = FSuspenseCoreEventData::Create(const_cast<UObject*>(Weapon))
                 .SetFloat(TEXT("CurrentAmmo"), CurrentAmmo)
                 .SetFloat(TEXT("RemainingAmmo"), RemainingAmmo)
-                .SetFloat(TEXT("MagazineSize"), MagazineSize);
+                .SetFloat(TEXT("MagazineSize"), MagazineSize)
+                .SetName(TEXT("AmmoKind"), TEXT("Reserve"));
 
-            EventBus->Publish(
-                FGameplayTag::RequestGameplayTag(TEXT("SuspenseCore.Event.Weapon.AmmoChanged")),
-                EventData
-            );
+            // Deferred: coalesced to one reserve update per weapon per frame
+            EventBus->PublishDeferred(SuspenseCoreTags::Event::Weapon::AmmoChanged, EventData);
         }
     }
 }
@@ -146,7 +146,7 @@ void ISuspenseCoreWeapon::BroadcastFireModeChanged(
             }
 
             FSuspenseCoreEventData EventData = FSuspenseCoreEventData::Create(const_cast<UObject*>(Weapon))
-                .SetString(TEXT("FireModeTag"), NewFireMode.ToString())
+                .SetGameplayTag(TEXT("FireModeTag"), NewFireMode)
                 .SetFloat(TEXT("CurrentSpread"), CurrentSpread);
 
             EventBus->Publish(
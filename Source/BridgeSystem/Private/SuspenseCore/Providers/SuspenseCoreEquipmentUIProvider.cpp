@@ -627,8 +627,8 @@ bool USuspenseCoreEquipmentUIProvider::RequestUseItem(int32 SlotIndex)
 
 	FSuspenseCoreEventData EventData;
 	EventData.Source = const_cast<USuspenseCoreEquipmentUIProvider*>(this);
-	EventData.IntPayload.Add(TEXT("SlotIndex"), SlotIndex);
-	EventData.StringPayload.Add(TEXT("ProviderID"), ProviderID.ToString());
+	EventData.SetInt(TEXT("SlotIndex"), SlotIndex);
+	EventData.SetString(TEXT("ProviderID"), ProviderID.ToString());
 
 	EventBus->Publish(TAG_SuspenseCore_Event_UIRequest_UseItem, EventData);
 
@@ -673,11 +673,11 @@ bool USuspenseCoreEquipmentUIProvider::RequestTransferItem(int32 SlotIndex, cons
 
 	FSuspenseCoreEventData EventData;
 	EventData.Source = const_cast<USuspenseCoreEquipmentUIProvider*>(this);
-	EventData.IntPayload.Add(TEXT("SourceSlot"), SlotIndex);
-	EventData.StringPayload.Add(TEXT("SourceProviderID"), ProviderID.ToString());
-	EventData.StringPayload.Add(TEXT("TargetProviderID"), TargetProviderID.ToString());
-	EventData.IntPayload.Add(TEXT("TargetSlot"), TargetSlot);
-	EventData.IntPayload.Add(TEXT("Quantity"), Quantity);
+	EventData.SetInt(TEXT("SourceSlot"), SlotIndex);
+	EventData.SetString(TEXT("SourceProviderID"), ProviderID.ToString());
+	EventData.SetString(TEXT("TargetProviderID"), TargetProviderID.ToString());
+	EventData.SetInt(TEXT("TargetSlot"), TargetSlot);
+	EventData.SetInt(TEXT("Quantity"), Quantity);
 
 	EventBus->Publish(TAG_SuspenseCore_Event_UIRequest_TransferItem, EventData);
 
@@ -5,7 +5,10 @@
 #include "SuspenseCore/Replication/Nodes/SuspenseCoreRepNode_PlayerStateFrequency.h"
 #include "GameFramework/PlayerState.h"
 #include "GameFramework/PlayerController.h"
+#include "SuspenseCore/Replication/SuspenseCoreReplicationGraph.h"
+#include "GameFramework/Pawn.h"
 #include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
 
 // ═══════════════════════════════════════════════════════════════════════════════
 // CONSTRUCTION
@@ -26,6 +29,7 @@ USuspenseCoreRepNode_PlayerStateFrequency::USuspenseCoreRepNode_PlayerStateFrequ
 
 	// Frame counter
 	FrameCounter = 0;
+	FrameFireMask = ComputeFireMask();
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -38,6 +42,7 @@ void USuspenseCoreRepNode_PlayerStateFrequency::NotifyAddNetworkActor(const FNew
 	if (PlayerState && !AllPlayerStates.Contains(PlayerState))
 	{
 		AllPlayerStates.Add(PlayerState);
+		AddPacked(PlayerState);
 	}
 }
 
@@ -46,6 +51,21 @@ bool USuspenseCoreRepNode_PlayerStateFrequency::NotifyRemoveNetworkActor(const F
 	APlayerState* PlayerState = Cast<APlayerState>(ActorInfo.Actor);
 	if (PlayerState)
 	{
+		// Removed actors must not be gathered again this frame
+		int32 PackedIndex = INDEX_NONE;
+		if (PackedIndexByState.RemoveAndCopyValue(PlayerState, PackedIndex))
+		{
+			const int32 LastIndex = PackedPlayerStates.Num() - 1;
+			if (PackedIndex != LastIndex)
+			{
+				PackedIndexByState.Add(PackedPlayerStates[LastIndex], PackedIndex);
+			}
+			PackedPlayerStates.RemoveAtSwap(PackedIndex, 1, EAllowShrinking::No);
+			PackedX.RemoveAtSwap(PackedIndex, 1, EAllowShrinking::No);
+			PackedY.RemoveAtSwap(PackedIndex, 1, EAllowShrinking::No);
+			PackedZ.RemoveAtSwap(PackedIndex, 1, EAllowShrinking::No);
+		}
+
 		const int32 NumRemoved = AllPlayerStates.Remove(PlayerState);
 		return NumRemoved > 0;
 	}
@@ -54,63 +74,45 @@ bool USuspenseCoreRepNode_PlayerStateFrequency::NotifyRemoveNetworkActor(const F
 
 void USuspenseCoreRepNode_PlayerStateFrequency::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
 {
-	// Get viewer location for distance calculation
-	FVector ViewerLocation = GetViewerLocation(Params);
-
 	// Get the connection's own PlayerState - always replicate at full frequency
 	APlayerState* ConnectionPlayerState = GetConnectionPlayerState(Params);
 
 	// Build replication list
 	ReplicationActorList.Reset();
 
-	// Iterate through all tracked PlayerStates
-	for (TObjectPtr<APlayerState>& PlayerState : AllPlayerStates)
+	if (ConnectionPlayerState && PackedIndexByState.Contains(ConnectionPlayerState))
 	{
-		if (!PlayerState || !IsValid(PlayerState))
-		{
-			continue;
-		}
+		ReplicationActorList.Add(ConnectionPlayerState);
+	}
 
-		// Own PlayerState - always replicate
-		if (PlayerState == ConnectionPlayerState)
+	if (FrameFireMask == AllBuckets)
+	{
+		// Every bucket is due this frame - distance does not matter
+		for (APlayerState* PlayerState : PackedPlayerStates)
 		{
-			ReplicationActorList.Add(PlayerState);
-			continue;
+			if (PlayerState != ConnectionPlayerState)
+			{
+				ReplicationActorList.Add(PlayerState);
+			}
 		}
+	}
+	else if (FrameFireMask != 0)
+	{
+		// Get viewer location for distance calculation
+		const FVector3f ViewerLocation(GetViewerLocation(Params));
+		const FVector3f ThresholdsSq(NearDistanceSq, MidDistanceSq, FarDistanceSq);
 
-		// Get PlayerState location (use pawn location)
-		FVector PlayerStateLocation = GetPlayerStateLocation(PlayerState);
-
-		// Calculate distance squared
-		float DistSq = FVector::DistSquared(ViewerLocation, PlayerStateLocation);
-
-		// Determine bucket and check if should replicate this frame
-		bool bShouldReplicate = false;
+		GatherScratch.Reset();
+		ClassifyPlayers(PackedX.GetData(), PackedY.GetData(), PackedZ.GetData(), PackedPlayerStates.Num(),
+			ViewerLocation, ThresholdsSq, FrameFireMask, GatherScratch);
 
-		if (DistSq <= NearDistanceSq)
-		{
-			// Near bucket - full frequency
-			bShouldReplicate = ShouldReplicateNear();
-		}
-		else if (DistSq <= MidDistanceSq)
-		{
-			// Mid bucket - reduced frequency
-			bShouldReplicate = ShouldReplicateMid();
-		}
-		else if (DistSq <= FarDistanceSq)
+		for (const int32 Index : GatherScratch)
 		{
-			// Far bucket - minimal frequency
-			bShouldReplicate = ShouldReplicateFar();
-		}
-		else
-		{
-			// Very far bucket - sparse frequency
-			bShouldReplicate = ShouldReplicateVeryFar();
-		}
-
-		if (bShouldReplicate)
-		{
-			ReplicationActorList.Add(PlayerState);
+			APlayerState* PlayerState = PackedPlayerStates[Index];
+			if (PlayerState != ConnectionPlayerState)
+			{
+				ReplicationActorList.Add(PlayerState);
+			}
 		}
 	}
 
@@ -127,17 +129,98 @@ void USuspenseCoreRepNode_PlayerStateFrequency::PrepareForReplication()
 
 	// Increment frame counter (with wrap-around)
 	FrameCounter++;
+	FrameFireMask = ComputeFireMask();
+
+	// Once per frame for all connections (also drops invalid references)
+	RefreshPackedPositions();
+}
 
-	// Clean up invalid references periodically
-	if ((FrameCounter % 60) == 0) // Every ~1 second at 60Hz
+// ═══════════════════════════════════════════════════════════════════════════════
+// Classification
+// ═══════════════════════════════════════════════════════════════════════════════
+
+void USuspenseCoreRepNode_PlayerStateFrequency::ClassifyPlayers(
+	const float* X, const float* Y, const float* Z, int32 Num,
+	const FVector3f& Viewer, const FVector3f& ThresholdsSq, uint32 FireMask,
+	TArray<int32>& OutIndices)
+{
+	const VectorRegister4Float ViewX = VectorSetFloat1(Viewer.X);
+	const VectorRegister4Float ViewY = VectorSetFloat1(Viewer.Y);
+	const VectorRegister4Float ViewZ = VectorSetFloat1(Viewer.Z);
+	const VectorRegister4Float NearSq = VectorSetFloat1(ThresholdsSq.X);
+	const VectorRegister4Float MidSq = VectorSetFloat1(ThresholdsSq.Y);
+	const VectorRegister4Float FarSq = VectorSetFloat1(ThresholdsSq.Z);
+
+	auto EmitLanes = [FireMask, &OutIndices](int32 Base, int32 Lanes, uint32 BeyondNear, uint32 BeyondMid, uint32 BeyondFar)
 	{
-		AllPlayerStates.RemoveAll([](const TObjectPtr<APlayerState>& PS)
+		for (int32 Lane = 0; Lane < Lanes; ++Lane)
 		{
-			return !PS || !IsValid(PS);
-		});
+			const uint32 Bucket = ((BeyondNear >> Lane) & 1) + ((BeyondMid >> Lane) & 1) + ((BeyondFar >> Lane) & 1);
+			if (FireMask & (1u << Bucket))
+			{
+				OutIndices.Add(Base + Lane);
+			}
+		}
+	};
+
+	int32 Index = 0;
+	for (; Index + 4 <= Num; Index += 4)
+	{
+		const VectorRegister4Float DX = VectorSubtract(VectorLoad(X + Index), ViewX);
+		const VectorRegister4Float DY = VectorSubtract(VectorLoad(Y + Index), ViewY);
+		const VectorRegister4Float DZ = VectorSubtract(VectorLoad(Z + Index), ViewZ);
+		const VectorRegister4Float DistSq = VectorMultiplyAdd(DZ, DZ, VectorMultiplyAdd(DY, DY, VectorMultiply(DX, DX)));
+
+		EmitLanes(Index, 4,
+			VectorMaskBits(VectorCompareGT(DistSq, NearSq)),
+			VectorMaskBits(VectorCompareGT(DistSq, MidSq)),
+			VectorMaskBits(VectorCompareGT(DistSq, FarSq)));
+	}
+
+	// Tail (< 4 players)
+	for (; Index < Num; ++Index)
+	{
+		const float DistSq = FMath::Square(X[Index] - Viewer.X) + FMath::Square(Y[Index] - Viewer.Y) + FMath::Square(Z[Index] - Viewer.Z);
+		EmitLanes(Index, 1, DistSq > ThresholdsSq.X, DistSq > ThresholdsSq.Y, DistSq > ThresholdsSq.Z);
+	}
+}
+
+uint32 USuspenseCoreRepNode_PlayerStateFrequency::ComputeFireMask() const
+{
+	return (ShouldReplicateNear() ? NearBit : 0)
+		| (ShouldReplicateMid() ? MidBit : 0)
+		| (ShouldReplicateFar() ? FarBit : 0)
+		| (ShouldReplicateVeryFar() ? VeryFarBit : 0);
+}
+
+void USuspenseCoreRepNode_PlayerStateFrequency::RefreshPackedPositions()
+{
+	AllPlayerStates.RemoveAll([](const TObjectPtr<APlayerState>& PS)
+	{
+		return !PS || !IsValid(PS);
+	});
+
+	PackedPlayerStates.Reset();
+	PackedIndexByState.Reset();
+	PackedX.Reset();
+	PackedY.Reset();
+	PackedZ.Reset();
+
+	for (const TObjectPtr<APlayerState>& PlayerState : AllPlayerStates)
+	{
+		AddPacked(PlayerState);
 	}
 }
 
+void USuspenseCoreRepNode_PlayerStateFrequency::AddPacked(APlayerState* PlayerState)
+{
+	const FVector3f Location(GetPlayerStateLocation(PlayerState));
+	PackedIndexByState.Add(PlayerState, PackedPlayerStates.Add(PlayerState));
+	PackedX.Add(Location.X);
+	PackedY.Add(Location.Y);
+	PackedZ.Add(Location.Z);
+}
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // Configuration
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -155,6 +238,7 @@ void USuspenseCoreRepNode_PlayerStateFrequency::SetReplicationPeriods(int32 Near
 	MidPeriod = FMath::Max(1, Mid);
 	FarPeriod = FMath::Max(1, Far);
 	VeryFarPeriod = FMath::Max(1, VeryFar);
+	FrameFireMask = ComputeFireMask();
 }
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -208,3 +292,187 @@ APlayerState* USuspenseCoreRepNode_PlayerStateFrequency::GetConnectionPlayerStat
 
 	return nullptr;
 }
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Benchmark
+// ═══════════════════════════════════════════════════════════════════════════════
+
+namespace
+{
+	/** Stand-ins for APawn / APlayerState: location behind two pointer hops, like the live path */
+	struct FBenchPawn
+	{
+		FVector Location;
+		uint8 Padding[232];
+	};
+
+	struct FBenchPlayerState
+	{
+		FBenchPawn* Pawn = nullptr;
+		uint8 Padding[248];
+	};
+}
+
+FString USuspenseCoreRepNode_PlayerStateFrequency::RunBenchmark(const TArray<int32>& ConnectionCounts, int32 NumFrames)
+{
+	NumFrames = FMath::Clamp(NumFrames, 1, 100000);
+
+	// Defaults from the constructor (20m / 50m / 100m, periods 1/2/3/5)
+	const float NearSq = FMath::Square(2000.0f);
+	const float MidSq = FMath::Square(5000.0f);
+	const float FarSq = FMath::Square(10000.0f);
+	const uint32 Periods[] = { 1, 2, 3, 5 };
+
+	FString Report = FString::Printf(TEXT("PlayerState gather benchmark, %d frames (players = connections, 400m x 400m)\n"), NumFrames);
+	Report += TEXT("Conns | Scan us/frame | Packed us/frame | Speedup | Gathered scan/packed\n");
+
+	for (const int32 RawCount : ConnectionCounts)
+	{
+		const int32 Num = FMath::Clamp(RawCount, 1, 4096);
+
+		FRandomStream Random(0x5EED + Num);
+		TArray<FBenchPawn> Pawns;
+		Pawns.SetNumZeroed(Num);
+		TArray<FBenchPlayerState> States;
+		States.SetNumZeroed(Num);
+
+		// Shuffled so the scan walks memory out of order, like actors spread over the heap
+		TArray<int32> Order;
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Order.Add(i);
+		}
+		for (int32 i = Num - 1; i > 0; --i)
+		{
+			Order.Swap(i, Random.RandHelper(i + 1));
+		}
+
+		TArray<FBenchPlayerState*> Tracked;
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Pawns[i].Location = FVector(Random.FRandRange(-20000.0f, 20000.0f), Random.FRandRange(-20000.0f, 20000.0f), Random.FRandRange(0.0f, 500.0f));
+			States[Order[i]].Pawn = &Pawns[i];
+			Tracked.Add(&States[Order[i]]);
+		}
+
+		auto FireMaskAt = [&Periods](uint32 Frame)
+		{
+			uint32 Mask = 0;
+			for (int32 Bucket = 0; Bucket < 4; ++Bucket)
+			{
+				Mask |= (Frame % Periods[Bucket] == 0) ? (1u << Bucket) : 0;
+			}
+			return Mask;
+		};
+
+		// Previous path: every connection walks every PlayerState -> Pawn -> location
+		TArray<FBenchPlayerState*> ScanList;
+		int64 ScanGathered = 0;
+		double Start = FPlatformTime::Seconds();
+		for (uint32 Frame = 1; Frame <= uint32(NumFrames); ++Frame)
+		{
+			for (int32 Conn = 0; Conn < Num; ++Conn)
+			{
+				const FVector Viewer = Tracked[Conn]->Pawn->Location;
+				ScanList.Reset();
+				for (FBenchPlayerState* State : Tracked)
+				{
+					if (State == Tracked[Conn])
+					{
+						ScanList.Add(State);
+						continue;
+					}
+
+					const double DistSq = FVector::DistSquared(Viewer, State->Pawn->Location);
+					const uint32 Period = DistSq <= NearSq ? Periods[0] : DistSq <= MidSq ? Periods[1] : DistSq <= FarSq ? Periods[2] : Periods[3];
+					if (Frame % Period == 0)
+					{
+						ScanList.Add(State);
+					}
+				}
+				ScanGathered += ScanList.Num();
+			}
+		}
+		const double ScanUs = (FPlatformTime::Seconds() - Start) * 1e6 / NumFrames;
+
+		// New path: pack once per frame, then fire-mask shortcut or SIMD classify per connection
+		TArray<FBenchPlayerState*> Packed;
+		TArray<float> X, Y, Z;
+		TArray<int32> Scratch;
+		TArray<FBenchPlayerState*> PackedList;
+		int64 PackedGathered = 0;
+		const FVector3f ThresholdsSq(NearSq, MidSq, FarSq);
+		Start = FPlatformTime::Seconds();
+		for (uint32 Frame = 1; Frame <= uint32(NumFrames); ++Frame)
+		{
+			const uint32 FireMask = FireMaskAt(Frame);
+
+			Packed.Reset();
+			X.Reset();
+			Y.Reset();
+			Z.Reset();
+			for (FBenchPlayerState* State : Tracked)
+			{
+				const FVector3f Location(State->Pawn->Location);
+				Packed.Add(State);
+				X.Add(Location.X);
+				Y.Add(Location.Y);
+				Z.Add(Location.Z);
+			}
+
+			for (int32 Conn = 0; Conn < Num; ++Conn)
+			{
+				FBenchPlayerState* Own = Tracked[Conn];
+				PackedList.Reset();
+				PackedList.Add(Own);
+
+				if (FireMask == AllBuckets)
+				{
+					for (FBenchPlayerState* State : Packed)
+					{
+						if (State != Own)
+						{
+							PackedList.Add(State);
+						}
+					}
+				}
+				else if (FireMask != 0)
+				{
+					Scratch.Reset();
+					ClassifyPlayers(X.GetData(), Y.GetData(), Z.GetData(), Packed.Num(),
+						FVector3f(X[Conn], Y[Conn], Z[Conn]), ThresholdsSq, FireMask, Scratch);
+					for (const int32 Index : Scratch)
+					{
+						if (Packed[Index] != Own)
+						{
+							PackedList.Add(Packed[Index]);
+						}
+					}
+				}
+				PackedGathered += PackedList.Num();
+			}
+		}
+		const double PackedUs = (FPlatformTime::Seconds() - Start) * 1e6 / NumFrames;
+
+		Report += FString::Printf(TEXT("%5d | %13.2f | %15.2f | %6.1fx | %lld/%lld\n"),
+			Num, ScanUs, PackedUs, ScanUs / FMath::Max(PackedUs, 1e-6), ScanGathered, PackedGathered);
+	}
+
+	return Report;
+}
+
+#if !UE_BUILD_SHIPPING
+static void HandlePlayerStateGatherBenchCommand(const TArray<FString>& Args)
+{
+	const int32 NumFrames = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 300;
+
+	const FString Report = USuspenseCoreRepNode_PlayerStateFrequency::RunBenchmark({ 16, 32, 64, 100, 150, 200 }, NumFrames);
+	UE_LOG(LogSuspenseCoreReplicationGraph, Log, TEXT("%s"), *Report);
+}
+
+static FAutoConsoleCommand GSuspenseCorePlayerStateGatherBenchCommand(
+	TEXT("SuspenseCore.Replication.BenchPlayerStateGather"),
+	TEXT("Benchmark PlayerState frequency gather at 16-200 connections (scan vs packed SoA). Args: [Frames=300]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&HandlePlayerStateGatherBenchCommand)
+);
+#endif
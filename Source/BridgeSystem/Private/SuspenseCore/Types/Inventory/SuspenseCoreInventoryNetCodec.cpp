@@ -0,0 +1,875 @@
+// SuspenseCoreInventoryNetCodec.cpp
+// Quantized, bit-packed delta serialization for FSuspenseCoreReplicatedInventory
+// Copyright Suspense Team. All Rights Reserved.
+
+#include "SuspenseCore/Types/Inventory/SuspenseCoreInventoryNetCodec.h"
+#include "SuspenseCore/Types/Inventory/SuspenseCoreInventoryTypes.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+#include "UObject/CoreNet.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSuspenseCoreInventoryNetCodec, Log, All);
+
+namespace
+{
+	/** Sanity limits for the reader (a corrupt or hostile stream must not allocate freely) */
+	constexpr uint32 MaxItemsPerMessage = 4096;
+	constexpr uint32 MaxNameTableSize = 4096;
+	constexpr uint32 MaxRuntimeProperties = 256;
+	constexpr uint32 MaxGridDimension = 1024;
+
+	/** Item as the connection last saw it, in wire units */
+	struct FSuspenseCoreQuantizedItem
+	{
+		int32 ReplicationKey = INDEX_NONE;
+		FName ItemID;
+
+		/** SlotIndex + 1, 0 = not placed */
+		uint32 Slot = 0;
+
+		/** Quarter turns */
+		uint8 Rotation = 0;
+
+		uint32 Quantity = 0;
+		bool bHasAmmo = false;
+		uint32 CurrentAmmo = 0;
+		uint32 ReserveAmmo = 0;
+		uint32 PropertiesHash = 0;
+	};
+
+	/** Per-connection base state: what the client has (or will have once in-flight packets land) */
+	class FSuspenseCoreInventoryNetBaseState : public INetDeltaBaseState
+	{
+	public:
+		virtual bool IsStateEqual(INetDeltaBaseState* OtherState) override
+		{
+			const FSuspenseCoreInventoryNetBaseState* Other = static_cast<const FSuspenseCoreInventoryNetBaseState*>(OtherState);
+			if (ArrayReplicationKey != Other->ArrayReplicationKey ||
+				GridWidth != Other->GridWidth ||
+				GridHeight != Other->GridHeight ||
+				MaxWeight != Other->MaxWeight ||
+				Items.Num() != Other->Items.Num())
+			{
+				return false;
+			}
+
+			for (const TPair<int32, FSuspenseCoreQuantizedItem>& Pair : Items)
+			{
+				const FSuspenseCoreQuantizedItem* OtherItem = Other->Items.Find(Pair.Key);
+				if (!OtherItem || OtherItem->ReplicationKey != Pair.Value.ReplicationKey)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		virtual void CountBytes(FArchive& Ar) const override
+		{
+			Items.CountBytes(Ar);
+			NameIndices.CountBytes(Ar);
+		}
+
+		int32 ArrayReplicationKey = INDEX_NONE;
+		int32 GridWidth = 0;
+		int32 GridHeight = 0;
+		float MaxWeight = 0.0f;
+
+		/** By handle (ReplicationID) */
+		TMap<int32, FSuspenseCoreQuantizedItem> Items;
+
+		/** ItemID -> name table index known to this connection */
+		TMap<FName, int32> NameIndices;
+	};
+
+	int32 NumCells(int32 GridWidth, int32 GridHeight)
+	{
+		return FMath::Max(GridWidth, 0) * FMath::Max(GridHeight, 0);
+	}
+
+	uint32 QuantizeCount(float Value)
+	{
+		return static_cast<uint32>(FMath::Max(FMath::RoundToInt(Value), 0));
+	}
+
+	uint32 HashProperties(const TArray<FSuspenseCoreRuntimeProperty>& Properties)
+	{
+		uint32 Hash = ::GetTypeHash(Properties.Num());
+		for (const FSuspenseCoreRuntimeProperty& Property : Properties)
+		{
+			Hash = HashCombine(Hash, GetTypeHash(Property.PropertyName));
+			Hash = HashCombine(Hash, ::GetTypeHash(Property.Value));
+		}
+		return Hash;
+	}
+
+	FSuspenseCoreQuantizedItem Quantize(const FSuspenseCoreReplicatedItem& Item, int32 Cells)
+	{
+		FSuspenseCoreQuantizedItem Quantized;
+		Quantized.ReplicationKey = Item.ReplicationKey;
+		Quantized.ItemID = Item.ItemID;
+		Quantized.Slot = (Item.SlotIndex >= 0 && Item.SlotIndex < Cells) ? static_cast<uint32>(Item.SlotIndex + 1) : 0;
+		Quantized.Rotation = static_cast<uint8>((Item.Rotation / 90) & 3);
+		Quantized.Quantity = static_cast<uint32>(FMath::Max(Item.Quantity, 0));
+		Quantized.bHasAmmo = (Item.PackedFlags & 0x01) != 0;
+		if (Quantized.bHasAmmo)
+		{
+			Quantized.CurrentAmmo = QuantizeCount(Item.CurrentAmmo);
+			Quantized.ReserveAmmo = QuantizeCount(Item.ReserveAmmo);
+		}
+		Quantized.PropertiesHash = HashProperties(Item.RuntimeProperties);
+		return Quantized;
+	}
+
+	uint8 DiffFields(const FSuspenseCoreQuantizedItem& Old, const FSuspenseCoreQuantizedItem& New)
+	{
+		using FCodec = FSuspenseCoreInventoryNetCodec;
+
+		uint8 Mask = 0;
+		Mask |= Old.ItemID != New.ItemID ? FCodec::Field_ItemID : 0;
+		Mask |= Old.Slot != New.Slot ? FCodec::Field_Slot : 0;
+		Mask |= Old.Rotation != New.Rotation ? FCodec::Field_Rotation : 0;
+		Mask |= Old.Quantity != New.Quantity ? FCodec::Field_Quantity : 0;
+		Mask |= (Old.bHasAmmo != New.bHasAmmo || Old.CurrentAmmo != New.CurrentAmmo || Old.ReserveAmmo != New.ReserveAmmo) ? FCodec::Field_Ammo : 0;
+		Mask |= Old.PropertiesHash != New.PropertiesHash ? FCodec::Field_Properties : 0;
+		return Mask;
+	}
+
+	void WriteItem(FBitWriter& Writer, const FSuspenseCoreReplicatedItem& Item, const FSuspenseCoreQuantizedItem& Quantized,
+		uint8 Mask, bool bNew, TMap<FName, int32>& NameIndices, int32& NextNameIndex)
+	{
+		using FCodec = FSuspenseCoreInventoryNetCodec;
+
+		uint32 Handle = static_cast<uint32>(Item.ReplicationID);
+		Writer.SerializeIntPacked(Handle);
+		Writer.WriteBit(bNew ? 1 : 0);
+		if (bNew)
+		{
+			FGuid InstanceID = Item.InstanceID;
+			Writer << InstanceID;
+		}
+		else
+		{
+			Writer.WriteInt(Mask, 1u << FCodec::NumFieldBits);
+		}
+
+		if (Mask & FCodec::Field_ItemID)
+		{
+			const int32* Known = NameIndices.Find(Quantized.ItemID);
+			uint32 NameIndex = Known ? static_cast<uint32>(*Known) : static_cast<uint32>(NextNameIndex++);
+			Writer.SerializeIntPacked(NameIndex);
+			Writer.WriteBit(Known ? 0 : 1);
+			if (!Known)
+			{
+				FName ItemID = Quantized.ItemID;
+				UPackageMap::StaticSerializeName(Writer, ItemID);
+				NameIndices.Add(Quantized.ItemID, static_cast<int32>(NameIndex));
+			}
+		}
+
+		if (Mask & FCodec::Field_Slot)
+		{
+			uint32 Slot = Quantized.Slot;
+			Writer.SerializeIntPacked(Slot);
+		}
+
+		if (Mask & FCodec::Field_Rotation)
+		{
+			Writer.WriteInt(Quantized.Rotation, 4);
+		}
+
+		if (Mask & FCodec::Field_Quantity)
+		{
+			uint32 Quantity = Quantized.Quantity;
+			Writer.SerializeIntPacked(Quantity);
+		}
+
+		if (Mask & FCodec::Field_Ammo)
+		{
+			Writer.WriteBit(Quantized.bHasAmmo ? 1 : 0);
+			if (Quantized.bHasAmmo)
+			{
+				uint32 CurrentAmmo = Quantized.CurrentAmmo;
+				uint32 ReserveAmmo = Quantized.ReserveAmmo;
+				Writer.SerializeIntPacked(CurrentAmmo);
+				Writer.SerializeIntPacked(ReserveAmmo);
+			}
+		}
+
+		if (Mask & FCodec::Field_Properties)
+		{
+			uint32 NumProperties = static_cast<uint32>(FMath::Min(Item.RuntimeProperties.Num(), static_cast<int32>(MaxRuntimeProperties)));
+			Writer.SerializeIntPacked(NumProperties);
+			for (uint32 Index = 0; Index < NumProperties; ++Index)
+			{
+				FName PropertyName = Item.RuntimeProperties[Index].PropertyName;
+				float Value = Item.RuntimeProperties[Index].Value;
+				UPackageMap::StaticSerializeName(Writer, PropertyName);
+				Writer << Value;
+			}
+		}
+	}
+
+	/**
+	 * Decode the masked fields into Item (which holds the previous client values).
+	 * Always consumes the whole record; bOutKnown is cleared when the record
+	 * references a name index this client has not been given yet.
+	 */
+	void ReadFields(FBitReader& Reader, uint8 Mask, int32 GridWidth,
+		TArray<FName>& ReceivedItemIDs, FSuspenseCoreReplicatedItem& Item, bool& bOutKnown)
+	{
+		using FCodec = FSuspenseCoreInventoryNetCodec;
+
+		if (Mask & FCodec::Field_ItemID)
+		{
+			uint32 NameIndex = 0;
+			Reader.SerializeIntPacked(NameIndex);
+			const bool bDefinition = Reader.ReadBit() != 0;
+			if (NameIndex >= MaxNameTableSize)
+			{
+				Reader.SetError();
+				return;
+			}
+
+			if (bDefinition)
+			{
+				FName ItemID;
+				UPackageMap::StaticSerializeName(Reader, ItemID);
+				if (ReceivedItemIDs.Num() <= static_cast<int32>(NameIndex))
+				{
+					ReceivedItemIDs.SetNum(NameIndex + 1);
+				}
+				ReceivedItemIDs[NameIndex] = ItemID;
+				Item.ItemID = ItemID;
+			}
+			else if (ReceivedItemIDs.IsValidIndex(NameIndex) && !ReceivedItemIDs[NameIndex].IsNone())
+			{
+				Item.ItemID = ReceivedItemIDs[NameIndex];
+			}
+			else
+			{
+				bOutKnown = false;
+			}
+		}
+
+		if (Mask & FCodec::Field_Slot)
+		{
+			uint32 Slot = 0;
+			Reader.SerializeIntPacked(Slot);
+			if (Slot > MaxGridDimension * MaxGridDimension)
+			{
+				Reader.SetError();
+				return;
+			}
+			Item.SlotIndex = static_cast<int32>(Slot) - 1;
+			Item.GridPosition = (Slot > 0 && GridWidth > 0)
+				? FIntPoint(Item.SlotIndex % GridWidth, Item.SlotIndex / GridWidth)
+				: FIntPoint::NoneValue;
+		}
+
+		if (Mask & FCodec::Field_Rotation)
+		{
+			Item.Rotation = static_cast<uint8>(Reader.ReadInt(4) * 90);
+		}
+
+		if (Mask & FCodec::Field_Quantity)
+		{
+			uint32 Quantity = 0;
+			Reader.SerializeIntPacked(Quantity);
+			Item.Quantity = static_cast<int32>(FMath::Min<uint32>(Quantity, MAX_int32));
+		}
+
+		if (Mask & FCodec::Field_Ammo)
+		{
+			if (Reader.ReadBit())
+			{
+				uint32 CurrentAmmo = 0;
+				uint32 ReserveAmmo = 0;
+				Reader.SerializeIntPacked(CurrentAmmo);
+				Reader.SerializeIntPacked(ReserveAmmo);
+				Item.PackedFlags |= 0x01;
+				Item.CurrentAmmo = static_cast<float>(CurrentAmmo);
+				Item.ReserveAmmo = static_cast<float>(ReserveAmmo);
+			}
+			else
+			{
+				Item.PackedFlags &= ~0x01;
+				Item.CurrentAmmo = 0.0f;
+				Item.ReserveAmmo = 0.0f;
+			}
+		}
+
+		if (Mask & FCodec::Field_Properties)
+		{
+			uint32 NumProperties = 0;
+			Reader.SerializeIntPacked(NumProperties);
+			if (NumProperties > MaxRuntimeProperties)
+			{
+				Reader.SetError();
+				return;
+			}
+
+			Item.RuntimeProperties.SetNum(NumProperties);
+			for (FSuspenseCoreRuntimeProperty& Property : Item.RuntimeProperties)
+			{
+				UPackageMap::StaticSerializeName(Reader, Property.PropertyName);
+				Reader << Property.Value;
+			}
+		}
+	}
+
+	int32 FindItemByHandle(const FSuspenseCoreReplicatedInventory& Inventory, int32 Handle)
+	{
+		return Inventory.Items.IndexOfByPredicate([Handle](const FSuspenseCoreReplicatedItem& Item)
+		{
+			return Item.ReplicationID == Handle;
+		});
+	}
+
+	bool WriteDelta(FSuspenseCoreReplicatedInventory& Inventory, FNetDeltaSerializeInfo& DeltaParams)
+	{
+		FBitWriter& Writer = *DeltaParams.Writer;
+		const FSuspenseCoreInventoryNetBaseState* OldState = static_cast<const FSuspenseCoreInventoryNetBaseState*>(DeltaParams.OldState);
+
+		// Name indices come from a per-connection counter, not the base state: after a NAK the
+		// base forgets definitions the client may already hold, and reusing their indices would
+		// rebind names under packets still in flight. When the table could overflow, start over.
+		int32& NextNameIndex = Inventory.NextItemIDIndices.FindOrAdd(TObjectKey<UPackageMap>(DeltaParams.Map), 0);
+		if (OldState && NextNameIndex + Inventory.Items.Num() > static_cast<int32>(MaxNameTableSize))
+		{
+			OldState = nullptr;
+		}
+		if (!OldState)
+		{
+			NextNameIndex = 0;
+		}
+
+		const bool bConfigChanged = !OldState ||
+			OldState->GridWidth != Inventory.GridWidth ||
+			OldState->GridHeight != Inventory.GridHeight ||
+			OldState->MaxWeight != Inventory.MaxWeight;
+
+		// Same early-out as FastArrayDeltaSerialize: nothing was marked since the base
+		if (OldState && !bConfigChanged && OldState->ArrayReplicationKey == Inventory.ArrayReplicationKey)
+		{
+			return false;
+		}
+
+		TSharedPtr<FSuspenseCoreInventoryNetBaseState> NewState = MakeShared<FSuspenseCoreInventoryNetBaseState>();
+		NewState->GridWidth = Inventory.GridWidth;
+		NewState->GridHeight = Inventory.GridHeight;
+		NewState->MaxWeight = Inventory.MaxWeight;
+		NewState->Items.Reserve(Inventory.Items.Num());
+		if (OldState)
+		{
+			NewState->NameIndices = OldState->NameIndices;
+		}
+
+		struct FPendingWrite
+		{
+			int32 ItemIndex;
+			uint8 Mask;
+			bool bNew;
+		};
+
+		const int32 Cells = NumCells(Inventory.GridWidth, Inventory.GridHeight);
+		TArray<FPendingWrite, TInlineAllocator<16>> PendingWrites;
+
+		for (int32 ItemIndex = 0; ItemIndex < Inventory.Items.Num(); ++ItemIndex)
+		{
+			FSuspenseCoreReplicatedItem& Item = Inventory.Items[ItemIndex];
+			if (Item.ReplicationID == INDEX_NONE)
+			{
+				// Added without MarkItemDirty; FastArrayDeltaSerialize does the same
+				Inventory.MarkItemDirty(Item);
+			}
+
+			const FSuspenseCoreQuantizedItem Quantized = Quantize(Item, Cells);
+			const FSuspenseCoreQuantizedItem* Base = OldState ? OldState->Items.Find(Item.ReplicationID) : nullptr;
+			if (!Base)
+			{
+				PendingWrites.Add({ ItemIndex, FSuspenseCoreInventoryNetCodec::Field_All, true });
+			}
+			else if (Base->ReplicationKey != Item.ReplicationKey || bConfigChanged)
+			{
+				const uint8 Mask = DiffFields(*Base, Quantized);
+				if (Mask != 0)
+				{
+					PendingWrites.Add({ ItemIndex, Mask, false });
+				}
+			}
+
+			NewState->Items.Add(Item.ReplicationID, Quantized);
+		}
+		NewState->ArrayReplicationKey = Inventory.ArrayReplicationKey;
+
+		TArray<int32, TInlineAllocator<8>> Removed;
+		if (OldState)
+		{
+			for (const TPair<int32, FSuspenseCoreQuantizedItem>& Pair : OldState->Items)
+			{
+				if (!NewState->Items.Contains(Pair.Key))
+				{
+					Removed.Add(Pair.Key);
+				}
+			}
+		}
+
+		if (OldState && !bConfigChanged && Removed.Num() == 0 && PendingWrites.Num() == 0)
+		{
+			// Marked dirty, but nothing changed in wire units
+			return false;
+		}
+
+		Writer.WriteBit(OldState ? 0 : 1);
+		Writer.WriteBit(bConfigChanged ? 1 : 0);
+		if (bConfigChanged)
+		{
+			uint32 GridWidth = static_cast<uint32>(FMath::Max(Inventory.GridWidth, 0));
+			uint32 GridHeight = static_cast<uint32>(FMath::Max(Inventory.GridHeight, 0));
+			float MaxWeight = Inventory.MaxWeight;
+			Writer.SerializeIntPacked(GridWidth);
+			Writer.SerializeIntPacked(GridHeight);
+			Writer << MaxWeight;
+		}
+
+		uint32 NumRemoved = static_cast<uint32>(Removed.Num());
+		Writer.SerializeIntPacked(NumRemoved);
+		for (const int32 Handle : Removed)
+		{
+			uint32 PackedHandle = static_cast<uint32>(Handle);
+			Writer.SerializeIntPacked(PackedHandle);
+		}
+
+		uint32 NumWritten = static_cast<uint32>(PendingWrites.Num());
+		Writer.SerializeIntPacked(NumWritten);
+		for (const FPendingWrite& Pending : PendingWrites)
+		{
+			const FSuspenseCoreReplicatedItem& Item = Inventory.Items[Pending.ItemIndex];
+			WriteItem(Writer, Item, NewState->Items.FindChecked(Item.ReplicationID), Pending.Mask, Pending.bNew, NewState->NameIndices, NextNameIndex);
+		}
+
+		*DeltaParams.NewState = NewState;
+		return true;
+	}
+
+	bool ReadDelta(FSuspenseCoreReplicatedInventory& Inventory, FNetDeltaSerializeInfo& DeltaParams)
+	{
+		FBitReader& Reader = *DeltaParams.Reader;
+
+		const bool bReset = Reader.ReadBit() != 0;
+		const bool bConfig = Reader.ReadBit() != 0;
+		if (bConfig)
+		{
+			uint32 GridWidth = 0;
+			uint32 GridHeight = 0;
+			float MaxWeight = 0.0f;
+			Reader.SerializeIntPacked(GridWidth);
+			Reader.SerializeIntPacked(GridHeight);
+			Reader << MaxWeight;
+			if (Reader.IsError() || GridWidth > MaxGridDimension || GridHeight > MaxGridDimension)
+			{
+				UE_LOG(LogSuspenseCoreInventoryNetCodec, Error, TEXT("ReadDelta: bad grid config %ux%u"), GridWidth, GridHeight);
+				Reader.SetError();
+				return false;
+			}
+			Inventory.GridWidth = static_cast<int32>(GridWidth);
+			Inventory.GridHeight = static_cast<int32>(GridHeight);
+			Inventory.MaxWeight = MaxWeight;
+		}
+
+		if (bReset)
+		{
+			Inventory.ReceivedItemIDs.Reset();
+		}
+
+		uint32 NumRemoved = 0;
+		Reader.SerializeIntPacked(NumRemoved);
+		if (NumRemoved > MaxItemsPerMessage)
+		{
+			Reader.SetError();
+		}
+		for (uint32 Index = 0; Index < NumRemoved && !Reader.IsError(); ++Index)
+		{
+			uint32 Handle = 0;
+			Reader.SerializeIntPacked(Handle);
+
+			// Unknown handle: its add was lost, nothing to remove
+			const int32 ItemIndex = FindItemByHandle(Inventory, static_cast<int32>(Handle));
+			if (ItemIndex != INDEX_NONE)
+			{
+				Inventory.Items[ItemIndex].PreReplicatedRemove(Inventory);
+				Inventory.Items.RemoveAtSwap(ItemIndex, 1, EAllowShrinking::No);
+			}
+		}
+
+		uint32 NumWritten = 0;
+		Reader.SerializeIntPacked(NumWritten);
+		if (NumWritten > MaxItemsPerMessage)
+		{
+			Reader.SetError();
+		}
+
+		TArray<int32, TInlineAllocator<16>> AddedHandles;
+		TArray<int32, TInlineAllocator<16>> ChangedHandles;
+		TSet<int32> SeenHandles;
+
+		for (uint32 Index = 0; Index < NumWritten && !Reader.IsError(); ++Index)
+		{
+			uint32 Handle = 0;
+			Reader.SerializeIntPacked(Handle);
+			const bool bNew = Reader.ReadBit() != 0;
+
+			FGuid InstanceID;
+			uint8 Mask = FSuspenseCoreInventoryNetCodec::Field_All;
+			if (bNew)
+			{
+				Reader << InstanceID;
+			}
+			else
+			{
+				Mask = static_cast<uint8>(Reader.ReadInt(1u << FSuspenseCoreInventoryNetCodec::NumFieldBits));
+			}
+
+			const int32 ItemIndex = FindItemByHandle(Inventory, static_cast<int32>(Handle));
+			FSuspenseCoreReplicatedItem Decoded = ItemIndex != INDEX_NONE ? Inventory.Items[ItemIndex] : FSuspenseCoreReplicatedItem();
+
+			bool bKnown = true;
+			ReadFields(Reader, Mask, Inventory.GridWidth, Inventory.ReceivedItemIDs, Decoded, bKnown);
+			if (Reader.IsError())
+			{
+				break;
+			}
+
+			// Based on a packet this client never got; the resend after the NAK carries it in full
+			if (!bKnown || (!bNew && ItemIndex == INDEX_NONE))
+			{
+				continue;
+			}
+
+			const int32 ItemHandle = static_cast<int32>(Handle);
+			if (bNew)
+			{
+				Decoded.InstanceID = InstanceID;
+			}
+			Decoded.ReplicationID = ItemHandle;
+			SeenHandles.Add(ItemHandle);
+
+			if (ItemIndex == INDEX_NONE)
+			{
+				Inventory.Items.Add(MoveTemp(Decoded));
+				AddedHandles.Add(ItemHandle);
+			}
+			else
+			{
+				Inventory.Items[ItemIndex] = MoveTemp(Decoded);
+				ChangedHandles.Add(ItemHandle);
+			}
+		}
+
+		if (Reader.IsError())
+		{
+			UE_LOG(LogSuspenseCoreInventoryNetCodec, Error, TEXT("ReadDelta: malformed inventory delta"));
+			return false;
+		}
+
+		// Fresh base on the server side: anything it did not send is gone
+		if (bReset)
+		{
+			for (int32 ItemIndex = Inventory.Items.Num() - 1; ItemIndex >= 0; --ItemIndex)
+			{
+				if (!SeenHandles.Contains(Inventory.Items[ItemIndex].ReplicationID))
+				{
+					Inventory.Items[ItemIndex].PreReplicatedRemove(Inventory);
+					Inventory.Items.RemoveAt(ItemIndex, 1, EAllowShrinking::No);
+				}
+			}
+		}
+
+		for (const int32 Handle : AddedHandles)
+		{
+			const int32 ItemIndex = FindItemByHandle(Inventory, Handle);
+			if (ItemIndex != INDEX_NONE)
+			{
+				Inventory.Items[ItemIndex].PostReplicatedAdd(Inventory);
+			}
+		}
+
+		for (const int32 Handle : ChangedHandles)
+		{
+			const int32 ItemIndex = FindItemByHandle(Inventory, Handle);
+			if (ItemIndex != INDEX_NONE)
+			{
+				Inventory.Items[ItemIndex].PostReplicatedChange(Inventory);
+			}
+		}
+
+		return true;
+	}
+}
+
+bool FSuspenseCoreInventoryNetCodec::NetDeltaSerialize(FSuspenseCoreReplicatedInventory& Inventory, FNetDeltaSerializeInfo& DeltaParams)
+{
+	// The payload holds no object references: nothing to gather or remap
+	if (DeltaParams.GatherGuidReferences || DeltaParams.MoveGuidToUnmapped || DeltaParams.bUpdateUnmappedObjects)
+	{
+		return false;
+	}
+
+	if (DeltaParams.Writer)
+	{
+		return WriteDelta(Inventory, DeltaParams);
+	}
+
+	if (DeltaParams.Reader)
+	{
+		return ReadDelta(Inventory, DeltaParams);
+	}
+
+	return false;
+}
+
+//==================================================================
+// Benchmark
+//==================================================================
+
+namespace
+{
+	/**
+	 * Bits FastArrayDeltaSerialize spends on the same change with the item's
+	 * property layout: array header (4 x int32), int32 per delete, and per changed
+	 * item its ReplicationID plus every property at full width.
+	 */
+	int64 FastArrayItemBits(const FSuspenseCoreReplicatedItem& Item)
+	{
+		FBitWriter NameWriter(0, true);
+		FName ItemID = Item.ItemID;
+		UPackageMap::StaticSerializeName(NameWriter, ItemID);
+
+		int64 Bits = 32;                  // ReplicationID
+		Bits += 128;                      // InstanceID
+		Bits += NameWriter.GetNumBits();  // ItemID
+		Bits += 32 + 32 + 64 + 8 + 8;     // Quantity, SlotIndex, GridPosition, Rotation, PackedFlags
+		Bits += 32 + 32;                  // CurrentAmmo, ReserveAmmo
+		Bits += 16;                       // RuntimeProperties count
+		for (const FSuspenseCoreRuntimeProperty& Property : Item.RuntimeProperties)
+		{
+			FBitWriter PropertyWriter(0, true);
+			FName PropertyName = Property.PropertyName;
+			UPackageMap::StaticSerializeName(PropertyWriter, PropertyName);
+			Bits += PropertyWriter.GetNumBits() + 32;
+		}
+		return Bits;
+	}
+
+	constexpr int64 FastArrayHeaderBits = 4 * 32;
+	constexpr int64 FastArrayDeleteBits = 32;
+
+	bool ItemsMatch(const FSuspenseCoreReplicatedInventory& Server, const FSuspenseCoreReplicatedInventory& Client)
+	{
+		if (Server.Items.Num() != Client.Items.Num() ||
+			Server.GridWidth != Client.GridWidth ||
+			Server.GridHeight != Client.GridHeight)
+		{
+			return false;
+		}
+
+		for (const FSuspenseCoreReplicatedItem& Expected : Server.Items)
+		{
+			const FSuspenseCoreReplicatedItem* Actual = Client.Items.FindByPredicate([&Expected](const FSuspenseCoreReplicatedItem& Item)
+			{
+				return Item.InstanceID == Expected.InstanceID;
+			});
+
+			if (!Actual ||
+				Actual->ItemID != Expected.ItemID ||
+				Actual->Quantity != Expected.Quantity ||
+				Actual->SlotIndex != Expected.SlotIndex ||
+				Actual->GridPosition != Expected.GridPosition ||
+				Actual->Rotation != Expected.Rotation ||
+				(Actual->PackedFlags & 0x01) != (Expected.PackedFlags & 0x01) ||
+				Actual->CurrentAmmo != FMath::RoundToFloat(Expected.CurrentAmmo) ||
+				Actual->ReserveAmmo != FMath::RoundToFloat(Expected.ReserveAmmo) ||
+				Actual->RuntimeProperties != Expected.RuntimeProperties)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+FString FSuspenseCoreInventoryNetCodec::RunBenchmark(int32 NumItems)
+{
+	NumItems = FMath::Clamp(NumItems, 4, 1000);
+
+	static const FName ItemPool[] =
+	{
+		FName(TEXT("Ammo_545x39_PS")), FName(TEXT("Magazine_AK74_30")), FName(TEXT("Medkit_AI2")), FName(TEXT("Bandage")),
+		FName(TEXT("Weapon_AK74M")), FName(TEXT("Grenade_F1")), FName(TEXT("Food_Tushonka")), FName(TEXT("Key_Dorm_214"))
+	};
+	static const FName DurabilityName(TEXT("Durability"));
+
+	FSuspenseCoreReplicatedInventory Server;
+	FSuspenseCoreReplicatedInventory Client;
+	Server.GridWidth = 10;
+	Server.GridHeight = FMath::Max(6, FMath::DivideAndRoundUp(NumItems * 2, 10));
+
+	auto MakeItem = [&Server](int32 Seed, FName ItemID, int32 Slot)
+	{
+		FSuspenseCoreReplicatedItem Item;
+		Item.InstanceID = FGuid::NewGuid();
+		Item.ItemID = ItemID;
+		Item.Quantity = 1 + Seed % 60;
+		Item.SlotIndex = Slot;
+		Item.GridPosition = FIntPoint(Slot % Server.GridWidth, Slot / Server.GridWidth);
+		if (Seed % 4 == 0)
+		{
+			Item.PackedFlags |= 0x01;
+			Item.CurrentAmmo = 30.0f;
+			Item.ReserveAmmo = 90.0f;
+		}
+		if (Seed % 5 == 0)
+		{
+			Item.RuntimeProperties.Add(FSuspenseCoreRuntimeProperty(DurabilityName, 100.0f));
+		}
+		return Item;
+	};
+
+	for (int32 Index = 0; Index < NumItems; ++Index)
+	{
+		Server.Items.Add(MakeItem(Index, ItemPool[Index % UE_ARRAY_COUNT(ItemPool)], Index * 2));
+		Server.MarkItemDirty(Server.Items.Last());
+	}
+
+	TSharedPtr<INetDeltaBaseState> BaseState;
+	bool bAllMatched = true;
+
+	FString Report = FString::Printf(TEXT("Inventory delta replication: %d items, %dx%d grid\n"), NumItems, Server.GridWidth, Server.GridHeight);
+	Report += FString::Printf(TEXT("  %-22s %5s %12s %12s %8s  %s\n"), TEXT("Op"), TEXT("Ops"), TEXT("Quantized B"), TEXT("FastArray B"), TEXT("Ratio"), TEXT("Check"));
+
+	// One replication pass: server writes against the acked base, client decodes, states compared
+	auto Replicate = [&](const TCHAR* Label, int32 NumOps, int64 FastArrayBits)
+	{
+		FBitWriter Writer(0, true);
+		TSharedPtr<INetDeltaBaseState> NewState;
+		FNetDeltaSerializeInfo WriteParams;
+		WriteParams.Writer = &Writer;
+		WriteParams.OldState = BaseState.Get();
+		WriteParams.NewState = &NewState;
+
+		if (NetDeltaSerialize(Server, WriteParams))
+		{
+			BaseState = NewState;
+
+			FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+			FNetDeltaSerializeInfo ReadParams;
+			ReadParams.Reader = &Reader;
+			NetDeltaSerialize(Client, ReadParams);
+		}
+
+		const bool bMatched = ItemsMatch(Server, Client);
+		bAllMatched &= bMatched;
+
+		const double QuantizedBytes = Writer.GetNumBits() / 8.0 / NumOps;
+		const double FastArrayBytes = FastArrayBits / 8.0 / NumOps;
+		Report += FString::Printf(TEXT("  %-22s %5d %12.2f %12.2f %7.1fx  %s\n"),
+			Label, NumOps, QuantizedBytes, FastArrayBytes,
+			QuantizedBytes > 0.0 ? FastArrayBytes / QuantizedBytes : 0.0,
+			bMatched ? TEXT("OK") : TEXT("MISMATCH"));
+	};
+
+	auto DirtyBits = [](const FSuspenseCoreReplicatedItem& Item)
+	{
+		return FastArrayHeaderBits + FastArrayItemBits(Item);
+	};
+
+	// Initial sync
+	{
+		int64 Bits = FastArrayHeaderBits;
+		for (const FSuspenseCoreReplicatedItem& Item : Server.Items)
+		{
+			Bits += FastArrayItemBits(Item);
+		}
+		Replicate(TEXT("InitialSync (per item)"), NumItems, Bits);
+	}
+
+	const int32 FreeSlot = NumItems * 2 + 1;
+	const int32 FreeSlotForNewID = NumItems * 2 + 3;
+
+	// Add, ItemID already in the name table
+	Server.Items.Add(MakeItem(1, ItemPool[1], FreeSlot));
+	Server.MarkItemDirty(Server.Items.Last());
+	Replicate(TEXT("Add"), 1, DirtyBits(Server.Items.Last()));
+
+	// Add, first use of an ItemID on this connection
+	Server.Items.Add(MakeItem(1, FName(TEXT("Armor_Paca_Class2")), FreeSlotForNewID));
+	Server.MarkItemDirty(Server.Items.Last());
+	Replicate(TEXT("Add (new ItemID)"), 1, DirtyBits(Server.Items.Last()));
+
+	// Move
+	{
+		FSuspenseCoreReplicatedItem& Item = Server.Items[1];
+		Item.SlotIndex += 1;
+		Item.GridPosition = FIntPoint(Item.SlotIndex % Server.GridWidth, Item.SlotIndex / Server.GridWidth);
+		Server.MarkItemDirty(Item);
+		Replicate(TEXT("Move"), 1, DirtyBits(Item));
+	}
+
+	// Rotate
+	{
+		FSuspenseCoreReplicatedItem& Item = Server.Items[2];
+		Item.Rotation = 90;
+		Server.MarkItemDirty(Item);
+		Replicate(TEXT("Rotate"), 1, DirtyBits(Item));
+	}
+
+	// Stack change
+	{
+		FSuspenseCoreReplicatedItem& Item = Server.Items[3];
+		Item.Quantity += 5;
+		Server.MarkItemDirty(Item);
+		Replicate(TEXT("StackChange"), 1, DirtyBits(Item));
+	}
+
+	// Ammo change (item 0 carries weapon state)
+	{
+		FSuspenseCoreReplicatedItem& Item = Server.Items[0];
+		Item.CurrentAmmo -= 1.0f;
+		Server.MarkItemDirty(Item);
+		Replicate(TEXT("AmmoChange"), 1, DirtyBits(Item));
+	}
+
+	// Runtime property change (item 0 carries Durability)
+	{
+		FSuspenseCoreReplicatedItem& Item = Server.Items[0];
+		Item.RuntimeProperties[0].Value = 87.5f;
+		Server.MarkItemDirty(Item);
+		Replicate(TEXT("PropertyChange"), 1, DirtyBits(Item));
+	}
+
+	// Batch of stack changes in one pass
+	{
+		const int32 BatchSize = FMath::Min(8, Server.Items.Num());
+		int64 Bits = FastArrayHeaderBits;
+		for (int32 Index = 0; Index < BatchSize; ++Index)
+		{
+			FSuspenseCoreReplicatedItem& Item = Server.Items[Index];
+			Item.Quantity += 1;
+			Server.MarkItemDirty(Item);
+			Bits += FastArrayItemBits(Item);
+		}
+		Replicate(TEXT("StackChange x8"), BatchSize, Bits);
+	}
+
+	// Remove
+	Server.RemoveItem(Server.Items.Last().InstanceID);
+	Replicate(TEXT("Remove"), 1, FastArrayHeaderBits + FastArrayDeleteBits);
+
+	// Marked dirty, no visible change
+	Server.MarkItemDirty(Server.Items[4]);
+	Replicate(TEXT("Idle (dirty, unchanged)"), 1, DirtyBits(Server.Items[4]));
+
+	Report += FString::Printf(TEXT("  Round trip: %s\n"), bAllMatched ? TEXT("all states matched") : TEXT("MISMATCH"));
+	return Report;
+}
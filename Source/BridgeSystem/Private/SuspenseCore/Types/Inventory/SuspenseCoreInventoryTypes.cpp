@@ -7,6 +7,7 @@
 // the actual replication logic without circular module dependencies.
 
 #include "SuspenseCore/Types/Inventory/SuspenseCoreInventoryTypes.h"
+#include "SuspenseCore/Types/Inventory/SuspenseCoreInventoryNetCodec.h"
 
 //==================================================================
 // FSuspenseCoreReplicatedItem - Delta Replication Callbacks
@@ -39,3 +40,12 @@ void FSuspenseCoreReplicatedItem::PostReplicatedChange(const FSuspenseCoreReplic
 		InArraySerializer.OnPostChangeDelegate.Execute(*this, InArraySerializer);
 	}
 }
+
+//==================================================================
+// FSuspenseCoreReplicatedInventory
+//==================================================================
+
+bool FSuspenseCoreReplicatedInventory::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParams)
+{
+	return FSuspenseCoreInventoryNetCodec::NetDeltaSerialize(*this, DeltaParams);
+}
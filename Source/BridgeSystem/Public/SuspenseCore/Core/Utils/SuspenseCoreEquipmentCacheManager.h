@@ -9,6 +9,7 @@
 #include "Misc/ScopeLock.h"
 #include "HAL/PlatformTime.h"
 #include "Templates/SharedPointer.h"
+#include "Templates/UniquePtr.h"
 #include "Templates/Function.h"
 #include "Misc/Crc.h"
 #include <utility>
@@ -183,12 +184,18 @@ struct FCacheEntry
  * Equipment cache manager (thread-safe).
  *
  * Architecture:
- * - Supports two initialization modes: basic (MaxEntries only) and advanced (DefaultTTL + MaxEntries)
+ * - Supports two initialization modes: basic (MaxEntries only) and advanced (DefaultTTL + MaxEntries [+ NumShards])
  * - DefaultTTL applies to all entries unless overridden per-entry in Set()
- * - Thread-safe via FScopeLock on all public methods
+ * - Entries live in a per-shard node pool threaded on an intrusive doubly-linked LRU list:
+ *   touch, insert and evict are O(1) (no array shuffling on every hit)
  *
  * Locking:
- * - All public methods acquire CacheLock (FCriticalSection) via FScopeLock.
+ * - Keys are striped across NumShards shards (power of two, default 1) by key hash.
+ *   Each shard has its own FCriticalSection, map, LRU list and frequency table.
+ * - With more than one shard, capacity is split evenly and LRU order is per shard
+ *   (approximate global LRU) - use for hot caches hit from several threads.
+ * - Configuration setters lock every shard, so readers only ever need their shard lock.
+ * - Hit/miss/eviction counters are relaxed atomics kept per shard and summed on read.
  */
 template<typename KeyType, typename ValueType>
 class FSuspenseCoreEquipmentCacheManager
@@ -199,40 +206,35 @@ public:
 	 * @param MaxEntries Maximum number of cache entries before LRU eviction
 	 */
 	FSuspenseCoreEquipmentCacheManager(int32 MaxEntries = 100)
-		: MaxCacheEntries(MaxEntries)
+		: MaxCacheEntries(FMath::Max(1, MaxEntries))
 		, DefaultTTL(0.0f)  // No expiration by default
 		, MaxValueSize(1024 * 1024)
 		, MaxUpdateRatePerSecond(10)
 		, EnablePoisoningProtection(true)
-		, TotalHits(0)
-		, TotalMisses(0)
-		, TotalEvictions(0)
-		, RejectedEntries(0)
-		, SuspiciousPatterns(0)
 	{
-		CacheLock = MakeShareable(new FCriticalSection());
+		InitShards(1);
 	}
 
 	/**
 	 * Advanced constructor with default TTL support
 	 * @param InDefaultTTL Default time-to-live for all entries (in seconds, 0 = no expiration)
 	 * @param MaxEntries Maximum number of cache entries before LRU eviction
+	 * @param NumShards Lock stripes (rounded up to power of two, 1 = single lock, exact LRU)
 	 */
-	FSuspenseCoreEquipmentCacheManager(float InDefaultTTL, int32 MaxEntries = 100)
-		: MaxCacheEntries(MaxEntries)
+	FSuspenseCoreEquipmentCacheManager(float InDefaultTTL, int32 MaxEntries = 100, int32 NumShards = 1)
+		: MaxCacheEntries(FMath::Max(1, MaxEntries))
 		, DefaultTTL(FMath::Max(0.0f, InDefaultTTL))
 		, MaxValueSize(1024 * 1024)
 		, MaxUpdateRatePerSecond(10)
 		, EnablePoisoningProtection(true)
-		, TotalHits(0)
-		, TotalMisses(0)
-		, TotalEvictions(0)
-		, RejectedEntries(0)
-		, SuspiciousPatterns(0)
 	{
-		CacheLock = MakeShareable(new FCriticalSection());
+		InitShards(NumShards);
 	}
 
+	// Non-copyable (shards own their locks)
+	FSuspenseCoreEquipmentCacheManager(const FSuspenseCoreEquipmentCacheManager&) = delete;
+	FSuspenseCoreEquipmentCacheManager& operator=(const FSuspenseCoreEquipmentCacheManager&) = delete;
+
 	/**
 	 * Set cache entry with optional TTL override
 	 * @param Key Cache key
@@ -242,14 +244,15 @@ public:
 	 */
 	bool Set(const KeyType& Key, const ValueType& Value, float TTLSeconds = -1.0f)
 	{
-		FScopeLock Lock(CacheLock.Get());
+		FShard& Shard = GetShard(Key);
+		FScopeLock Lock(&Shard.Lock);
 
 		// Determine effective TTL: use explicit if >= 0, otherwise use default
 		const float EffectiveTTL = (TTLSeconds >= 0.0f) ? TTLSeconds : DefaultTTL;
 
 		if (!CheckValueSize(Value))
 		{
-			RejectedEntries.fetch_add(1);
+			Shard.Rejected.fetch_add(1, std::memory_order_relaxed);
 			UE_LOG(LogTemp, Warning,
 				TEXT("FSuspenseCoreEquipmentCacheManager: Rejected cache set due to size constraint (KeyHash=%u)"),
 				EquipmentCacheHash::Compute(Key));
@@ -260,13 +263,13 @@ public:
 		{
 			const double Now = FPlatformTime::Seconds();
 
-			FUpdateFrequencyData& FreqData = UpdateFrequency.FindOrAdd(Key);
+			FUpdateFrequencyData& FreqData = Shard.UpdateFrequency.FindOrAdd(Key);
 			FreqData.RecordUpdate(Now);
 
 			if (FreqData.IsExcessiveUpdateRate(MaxUpdateRatePerSecond))
 			{
-				RejectedEntries.fetch_add(1);
-				SuspiciousPatterns.fetch_add(1);
+				Shard.Rejected.fetch_add(1, std::memory_order_relaxed);
+				Shard.Suspicious.fetch_add(1, std::memory_order_relaxed);
 
 				UE_LOG(LogTemp, Warning,
 					TEXT("FSuspenseCoreEquipmentCacheManager: Rejected update due to excessive rate (KeyHash=%u, Rate=%d/s, Limit=%d/s)"),
@@ -277,7 +280,7 @@ public:
 
 			if (ValidationFunc && !ValidationFunc(Key, Value))
 			{
-				RejectedEntries.fetch_add(1);
+				Shard.Rejected.fetch_add(1, std::memory_order_relaxed);
 				UE_LOG(LogTemp, Warning,
 					TEXT("FSuspenseCoreEquipmentCacheManager: External validation failed for cache entry (KeyHash=%u)"),
 					EquipmentCacheHash::Compute(Key));
@@ -286,8 +289,8 @@ public:
 
 			if (IsAnomalousNumericValue(Value))
 			{
-				RejectedEntries.fetch_add(1);
-				SuspiciousPatterns.fetch_add(1);
+				Shard.Rejected.fetch_add(1, std::memory_order_relaxed);
+				Shard.Suspicious.fetch_add(1, std::memory_order_relaxed);
 				UE_LOG(LogTemp, Warning,
 					TEXT("FSuspenseCoreEquipmentCacheManager: Anomalous numeric value detected (KeyHash=%u)"),
 					EquipmentCacheHash::Compute(Key));
@@ -295,25 +298,25 @@ public:
 			}
 		}
 
-		if (FCacheEntry<ValueType>* Existing = CacheMap.Find(Key))
+		if (const int32* NodeIndex = Shard.Index.Find(Key))
 		{
-			Existing->Value = Value;
-			Existing->TTL = EffectiveTTL;
-			Existing->Timestamp = FDateTime::Now();
-			Existing->IncrementUpdateCount();
-			Existing->DataHash = EquipmentCacheHash::Compute(Value);
-			TouchAccess_NoLock(Key);
+			FCacheEntry<ValueType>& Existing = Shard.Nodes[*NodeIndex].Entry;
+			Existing.Value = Value;
+			Existing.TTL = EffectiveTTL;
+			Existing.Timestamp = FDateTime::Now();
+			Existing.IncrementUpdateCount();
+			Existing.DataHash = EquipmentCacheHash::Compute(Value);
+			Shard.MoveToFront(*NodeIndex);
 		}
 		else
 		{
-			if (CacheMap.Num() >= MaxCacheEntries)
+			if (Shard.Index.Num() >= Shard.Capacity)
 			{
-				EvictLRU_NoLock();
+				EvictLRU_NoLock(Shard);
 			}
 
-			CacheMap.Add(Key, FCacheEntry<ValueType>(Value, EffectiveTTL));
-			AccessOrder.Add(Key);
-			UpdateFrequency.FindOrAdd(Key);
+			Shard.Insert(Key, FCacheEntry<ValueType>(Value, EffectiveTTL));
+			Shard.UpdateFrequency.FindOrAdd(Key);
 		}
 
 		return true;
@@ -321,49 +324,54 @@ public:
 
 	bool Get(const KeyType& Key, ValueType& OutValue)
 	{
-		FScopeLock Lock(CacheLock.Get());
+		FShard& Shard = GetShard(Key);
+		FScopeLock Lock(&Shard.Lock);
 
-		if (FCacheEntry<ValueType>* Entry = CacheMap.Find(Key))
+		if (const int32* NodeIndexPtr = Shard.Index.Find(Key))
 		{
-			if (!Entry->VerifyIntegrity())
+			const int32 NodeIndex = *NodeIndexPtr;
+			FCacheEntry<ValueType>& Entry = Shard.Nodes[NodeIndex].Entry;
+
+			if (!Entry.VerifyIntegrity())
 			{
-				CacheMap.Remove(Key);
+				Shard.RemoveNode(NodeIndex);
 				UE_LOG(LogTemp, Error,
 					TEXT("FSuspenseCoreEquipmentCacheManager: Integrity check failed, entry removed (KeyHash=%u)"),
 					EquipmentCacheHash::Compute(Key));
-				RemoveFromAccess_NoLock(Key);
-				UpdateFrequency.Remove(Key);
+				Shard.UpdateFrequency.Remove(Key);
 				return false;
 			}
 
-			if (Entry->IsExpired())
+			if (Entry.IsExpired())
 			{
-				CacheMap.Remove(Key);
-				RemoveFromAccess_NoLock(Key);
-				UpdateFrequency.Remove(Key);
-				TotalEvictions.fetch_add(1);
-				TotalMisses.fetch_add(1);
+				Shard.RemoveNode(NodeIndex);
+				Shard.UpdateFrequency.Remove(Key);
+				Shard.Evictions.fetch_add(1, std::memory_order_relaxed);
+				Shard.Misses.fetch_add(1, std::memory_order_relaxed);
 				return false;
 			}
 
-			OutValue = Entry->Value;
-			Entry->RecordHit();
-			Entry->Touch();
-			TouchAccess_NoLock(Key);
-			TotalHits.fetch_add(1);
+			OutValue = Entry.Value;
+			Entry.RecordHit();
+			Entry.Touch();
+			Shard.MoveToFront(NodeIndex);
+			Shard.Hits.fetch_add(1, std::memory_order_relaxed);
 			return true;
 		}
 
-		TotalMisses.fetch_add(1);
+		Shard.Misses.fetch_add(1, std::memory_order_relaxed);
 		return false;
 	}
 
 	void Invalidate(const KeyType& Key)
 	{
-		FScopeLock Lock(CacheLock.Get());
-		CacheMap.Remove(Key);
-		RemoveFromAccess_NoLock(Key);
-		UpdateFrequency.Remove(Key);
+		FShard& Shard = GetShard(Key);
+		FScopeLock Lock(&Shard.Lock);
+		if (const int32* NodeIndex = Shard.Index.Find(Key))
+		{
+			Shard.RemoveNode(*NodeIndex);
+		}
+		Shard.UpdateFrequency.Remove(Key);
 	}
 
 	void Remove(const KeyType& Key)
@@ -373,25 +381,32 @@ public:
 
 	void Clear()
 	{
-		FScopeLock Lock(CacheLock.Get());
-		CacheMap.Reset();
-		AccessOrder.Reset();
-		UpdateFrequency.Reset();
-		TotalHits.store(0);
-		TotalMisses.store(0);
-		TotalEvictions.store(0);
-		RejectedEntries.store(0);
-		// SuspiciousPatterns оставляем для отладки после чистки
+		for (const TUniquePtr<FShard>& Shard : Shards)
+		{
+			FScopeLock Lock(&Shard->Lock);
+			Shard->Reset();
+			Shard->UpdateFrequency.Reset();
+			Shard->Hits.store(0, std::memory_order_relaxed);
+			Shard->Misses.store(0, std::memory_order_relaxed);
+			Shard->Evictions.store(0, std::memory_order_relaxed);
+			Shard->Rejected.store(0, std::memory_order_relaxed);
+			// SuspiciousPatterns оставляем для отладки после чистки
+		}
 	}
 
 	void SetMaxEntries(int32 MaxEntries)
 	{
-		FScopeLock Lock(CacheLock.Get());
+		FAllShardsLock Lock(*this);
 
 		MaxCacheEntries = FMath::Max(1, MaxEntries);
-		while (CacheMap.Num() > MaxCacheEntries)
+		const int32 PerShardCapacity = ComputeShardCapacity();
+		for (const TUniquePtr<FShard>& Shard : Shards)
 		{
-			EvictLRU_NoLock();
+			Shard->Capacity = PerShardCapacity;
+			while (Shard->Index.Num() > Shard->Capacity)
+			{
+				EvictLRU_NoLock(*Shard);
+			}
 		}
 	}
 
@@ -401,7 +416,8 @@ public:
 	 */
 	float GetDefaultTTL() const
 	{
-		FScopeLock Lock(CacheLock.Get());
+		// Writers hold every shard lock - any single shard lock is enough to read
+		FScopeLock Lock(&Shards[0]->Lock);
 		return DefaultTTL;
 	}
 
@@ -411,109 +427,133 @@ public:
 	 */
 	void SetDefaultTTL(float InTTL)
 	{
-		FScopeLock Lock(CacheLock.Get());
+		FAllShardsLock Lock(*this);
 		DefaultTTL = FMath::Max(0.0f, InTTL);
 	}
 
 	void SetValidationDelegate(FValidateEntryFunc<KeyType, ValueType> InFunc)
 	{
-		FScopeLock Lock(CacheLock.Get());
+		FAllShardsLock Lock(*this);
 		ValidationFunc = MoveTemp(InFunc);
 		UE_LOG(LogTemp, Verbose, TEXT("FSuspenseCoreEquipmentCacheManager: Validation function set"));
 	}
 
 	void SetPoisoningProtectionEnabled(bool bEnabled)
 	{
-		FScopeLock Lock(CacheLock.Get());
+		FAllShardsLock Lock(*this);
 		EnablePoisoningProtection = bEnabled;
 	}
 
 	void SetMaxValueSize(int32 InBytes)
 	{
-		FScopeLock Lock(CacheLock.Get());
+		FAllShardsLock Lock(*this);
 		MaxValueSize = FMath::Max(0, InBytes);
 	}
 
 	void SetMaxUpdateRatePerSecond(int32 InRate)
 	{
-		FScopeLock Lock(CacheLock.Get());
+		FAllShardsLock Lock(*this);
 		MaxUpdateRatePerSecond = FMath::Max(0, InRate);
 	}
 
 	void ResetSecurityCounters()
 	{
-		FScopeLock Lock(CacheLock.Get());
-		RejectedEntries.store(0);
-		SuspiciousPatterns.store(0);
-		UpdateFrequency.Empty();
+		for (const TUniquePtr<FShard>& Shard : Shards)
+		{
+			FScopeLock Lock(&Shard->Lock);
+			Shard->Rejected.store(0, std::memory_order_relaxed);
+			Shard->Suspicious.store(0, std::memory_order_relaxed);
+			Shard->UpdateFrequency.Empty();
+		}
 	}
 
 public:
 	// --- Stats & Introspection ---
 
-	int32 GetTotalHits() const { return TotalHits.load(); }
-	int32 GetTotalMisses() const { return TotalMisses.load(); }
-	int32 GetTotalEvictions() const { return TotalEvictions.load(); }
-	int32 GetRejectedEntries() const { return RejectedEntries.load(); }
-	int32 GetSuspiciousPatterns() const { return SuspiciousPatterns.load(); }
+	int32 GetTotalHits() const { return SumCounter(&FShard::Hits); }
+	int32 GetTotalMisses() const { return SumCounter(&FShard::Misses); }
+	int32 GetTotalEvictions() const { return SumCounter(&FShard::Evictions); }
+	int32 GetRejectedEntries() const { return SumCounter(&FShard::Rejected); }
+	int32 GetSuspiciousPatterns() const { return SumCounter(&FShard::Suspicious); }
+	int32 GetNumShards() const { return Shards.Num(); }
+
+	/** Current entry count across shards */
+	int32 Num() const
+	{
+		int32 Count = 0;
+		for (const TUniquePtr<FShard>& Shard : Shards)
+		{
+			FScopeLock Lock(&Shard->Lock);
+			Count += Shard->Index.Num();
+		}
+		return Count;
+	}
 
 	float GetHitRate() const
 	{
-		const int32 Hits = TotalHits.load();
-		const int32 Misses = TotalMisses.load();
+		const int32 Hits = GetTotalHits();
+		const int32 Misses = GetTotalMisses();
 		const int32 Total = Hits + Misses;
 		return (Total > 0) ? (float)Hits / (float)Total : 0.0f;
 	}
 
 	FString DumpStats() const
 	{
-		FScopeLock Lock(CacheLock.Get());
+		const float TTL = GetDefaultTTL();
 		FString Stats;
-		Stats += FString::Printf(TEXT("Entries: %d / %d\n"), CacheMap.Num(), MaxCacheEntries);
+		Stats += FString::Printf(TEXT("Entries: %d / %d (shards: %d)\n"), Num(), MaxCacheEntries, Shards.Num());
 		Stats += FString::Printf(TEXT("Hits: %d, Misses: %d, HitRate: %.2f\n"),
-			TotalHits.load(), TotalMisses.load(), GetHitRate());
+			GetTotalHits(), GetTotalMisses(), GetHitRate());
 		Stats += FString::Printf(TEXT("Evictions: %d, Rejected: %d, Suspicious: %d\n"),
-			TotalEvictions.load(), RejectedEntries.load(), SuspiciousPatterns.load());
-		Stats += FString::Printf(TEXT("DefaultTTL: %.1fs\n"), DefaultTTL);
+			GetTotalEvictions(), GetRejectedEntries(), GetSuspiciousPatterns());
+		Stats += FString::Printf(TEXT("DefaultTTL: %.1fs\n"), TTL);
 		return Stats;
 	}
 
 	float ComputeIntegrityScore() const
 	{
-		FScopeLock Lock(CacheLock.Get());
-
 		float Integrity = 1.0f;
 
 		Integrity *= (0.5f + 0.5f * GetHitRate()); // 0.5..1.0
 
+		int32 Entries = 0;
 		int32 Expired = 0;
-		for (const auto& Pair : CacheMap)
+		int32 Excessive = 0;
+		for (const TUniquePtr<FShard>& Shard : Shards)
 		{
-			if (Pair.Value.IsExpired()) ++Expired;
+			FScopeLock Lock(&Shard->Lock);
+			Entries += Shard->Index.Num();
+
+			for (const auto& Pair : Shard->Index)
+			{
+				if (Shard->Nodes[Pair.Value].Entry.IsExpired()) ++Expired;
+			}
+
+			for (const auto& UF : Shard->UpdateFrequency)
+			{
+				if (UF.Value.UpdateCount > MaxUpdateRatePerSecond)
+				{
+					++Excessive;
+				}
+			}
 		}
-		if (CacheMap.Num() > 0)
+
+		if (Entries > 0)
 		{
-			const float ExpiredRatio = (float)Expired / (float)CacheMap.Num();
+			const float ExpiredRatio = (float)Expired / (float)Entries;
 			Integrity *= (1.0f - ExpiredRatio * 0.5f); // Up to -50%
 		}
 
-		int32 Excessive = 0;
-		for (const auto& UF : UpdateFrequency)
-		{
-			if (UF.Value.UpdateCount > MaxUpdateRatePerSecond)
-			{
-				++Excessive;
-			}
-		}
-		if (CacheMap.Num() > 0 && Excessive > 0)
+		if (Entries > 0 && Excessive > 0)
 		{
-			const float ExcessiveRate = (float)Excessive / (float)CacheMap.Num();
+			const float ExcessiveRate = (float)Excessive / (float)Entries;
 			Integrity *= (1.0f - ExcessiveRate * 0.3f); // Up to -30%
 		}
 
-		if (TotalEvictions.load() > CacheMap.Num())
+		const int32 Evictions = GetTotalEvictions();
+		if (Evictions > Entries)
 		{
-			const float Pressure = FMath::Min(1.0f, (float)TotalEvictions.load() / (float)(CacheMap.Num() * 10));
+			const float Pressure = FMath::Min(1.0f, (float)Evictions / (float)(FMath::Max(Entries, 1) * 10));
 			Integrity *= (1.0f - Pressure * 0.2f); // Up to -20%
 		}
 
@@ -544,50 +584,192 @@ public:
 
 	FCacheStatistics GetStatistics() const
 	{
-		FScopeLock Lock(CacheLock.Get());
 		FCacheStatistics S;
-		S.Entries    = CacheMap.Num();
+		S.Entries    = Num();
 		S.Capacity   = MaxCacheEntries;
-		S.Hits       = TotalHits.load();
-		S.Misses     = TotalMisses.load();
-		S.Evictions  = TotalEvictions.load();
-		S.Rejected   = RejectedEntries.load();
-		S.Suspicious = SuspiciousPatterns.load();
+		S.Hits       = GetTotalHits();
+		S.Misses     = GetTotalMisses();
+		S.Evictions  = GetTotalEvictions();
+		S.Rejected   = GetRejectedEntries();
+		S.Suspicious = GetSuspiciousPatterns();
 		S.HitRate    = GetHitRate();
 		S.Integrity  = ComputeIntegrityScore();
-		S.DefaultTTL = DefaultTTL;
+		S.DefaultTTL = GetDefaultTTL();
 		return S;
 	}
 
 private:
-	void EvictLRU_NoLock()
+	/** Pool node: entry + intrusive LRU links (indices into FShard::Nodes) */
+	struct FLruNode
+	{
+		KeyType Key;
+		FCacheEntry<ValueType> Entry;
+		int32 Prev = INDEX_NONE;
+		int32 Next = INDEX_NONE;
+	};
+
+	/** One lock stripe. Head = most recently used, Tail = eviction candidate */
+	struct FShard
+	{
+		mutable FCriticalSection Lock;
+
+		TMap<KeyType, int32> Index;
+		TArray<FLruNode> Nodes;
+		TArray<int32> FreeNodes;
+		int32 Head = INDEX_NONE;
+		int32 Tail = INDEX_NONE;
+		int32 Capacity = 0;
+
+		TMap<KeyType, FUpdateFrequencyData> UpdateFrequency;
+
+		std::atomic<int32> Hits{0};
+		std::atomic<int32> Misses{0};
+		std::atomic<int32> Evictions{0};
+		std::atomic<int32> Rejected{0};
+		std::atomic<int32> Suspicious{0};
+
+		void Unlink(int32 NodeIndex)
+		{
+			FLruNode& Node = Nodes[NodeIndex];
+			if (Node.Prev != INDEX_NONE) { Nodes[Node.Prev].Next = Node.Next; } else { Head = Node.Next; }
+			if (Node.Next != INDEX_NONE) { Nodes[Node.Next].Prev = Node.Prev; } else { Tail = Node.Prev; }
+			Node.Prev = Node.Next = INDEX_NONE;
+		}
+
+		void LinkFront(int32 NodeIndex)
+		{
+			FLruNode& Node = Nodes[NodeIndex];
+			Node.Prev = INDEX_NONE;
+			Node.Next = Head;
+			if (Head != INDEX_NONE) { Nodes[Head].Prev = NodeIndex; }
+			Head = NodeIndex;
+			if (Tail == INDEX_NONE) { Tail = NodeIndex; }
+		}
+
+		void MoveToFront(int32 NodeIndex)
+		{
+			if (Head != NodeIndex)
+			{
+				Unlink(NodeIndex);
+				LinkFront(NodeIndex);
+			}
+		}
+
+		void Insert(const KeyType& Key, FCacheEntry<ValueType>&& Entry)
+		{
+			int32 NodeIndex;
+			if (FreeNodes.Num() > 0)
+			{
+				NodeIndex = FreeNodes.Pop(EAllowShrinking::No);
+			}
+			else
+			{
+				NodeIndex = Nodes.AddDefaulted();
+			}
+
+			FLruNode& Node = Nodes[NodeIndex];
+			Node.Key = Key;
+			Node.Entry = MoveTemp(Entry);
+			LinkFront(NodeIndex);
+			Index.Add(Key, NodeIndex);
+		}
+
+		void RemoveNode(int32 NodeIndex)
+		{
+			Unlink(NodeIndex);
+			FLruNode& Node = Nodes[NodeIndex];
+			Index.Remove(Node.Key);
+
+			// Release whatever the value holds (shared pointers, strings) right away
+			Node.Entry = FCacheEntry<ValueType>();
+			FreeNodes.Add(NodeIndex);
+		}
+
+		void Reset()
+		{
+			Index.Reset();
+			Nodes.Reset();
+			FreeNodes.Reset();
+			Head = Tail = INDEX_NONE;
+		}
+	};
+
+	/** Locks every shard in index order (configuration changes) */
+	struct FAllShardsLock
 	{
-		if (AccessOrder.Num() == 0) return;
+		const FSuspenseCoreEquipmentCacheManager& Owner;
+
+		explicit FAllShardsLock(const FSuspenseCoreEquipmentCacheManager& InOwner)
+			: Owner(InOwner)
+		{
+			for (const TUniquePtr<FShard>& Shard : Owner.Shards)
+			{
+				Shard->Lock.Lock();
+			}
+		}
 
-		const KeyType& LRUKey = AccessOrder[0];
-		CacheMap.Remove(LRUKey);
-		AccessOrder.RemoveAt(0);
-		UpdateFrequency.Remove(LRUKey);
-		TotalEvictions.fetch_add(1);
+		~FAllShardsLock()
+		{
+			for (int32 i = Owner.Shards.Num() - 1; i >= 0; --i)
+			{
+				Owner.Shards[i]->Lock.Unlock();
+			}
+		}
+	};
+
+	void InitShards(int32 NumShards)
+	{
+		const int32 ShardCount = (int32)FMath::RoundUpToPowerOfTwo((uint32)FMath::Clamp(NumShards, 1, 64));
+		ShardMask = (uint32)ShardCount - 1;
+
+		Shards.Reserve(ShardCount);
+		for (int32 i = 0; i < ShardCount; ++i)
+		{
+			Shards.Add(MakeUnique<FShard>());
+		}
+
+		const int32 PerShardCapacity = ComputeShardCapacity();
+		for (const TUniquePtr<FShard>& Shard : Shards)
+		{
+			Shard->Capacity = PerShardCapacity;
+		}
+	}
+
+	int32 ComputeShardCapacity() const
+	{
+		return FMath::Max(1, FMath::DivideAndRoundUp(MaxCacheEntries, Shards.Num()));
 	}
 
-	void TouchAccess_NoLock(const KeyType& Key)
+	FShard& GetShard(const KeyType& Key) const
 	{
-		const int32 Index = AccessOrder.Find(Key);
-		if (Index != INDEX_NONE)
+		if (ShardMask == 0)
 		{
-			AccessOrder.RemoveAt(Index);
+			return *Shards[0];
 		}
-		AccessOrder.Add(Key);
+
+		// Fold high bits in - small integer keys would otherwise hit few stripes
+		const uint32 Hash = EquipmentCacheHash::Compute(Key);
+		return *Shards[(Hash ^ (Hash >> 16)) & ShardMask];
 	}
 
-	void RemoveFromAccess_NoLock(const KeyType& Key)
+	int32 SumCounter(std::atomic<int32> FShard::* Counter) const
 	{
-		const int32 Index = AccessOrder.Find(Key);
-		if (Index != INDEX_NONE)
+		int32 Total = 0;
+		for (const TUniquePtr<FShard>& Shard : Shards)
 		{
-			AccessOrder.RemoveAt(Index);
+			Total += ((*Shard).*Counter).load(std::memory_order_relaxed);
 		}
+		return Total;
+	}
+
+	void EvictLRU_NoLock(FShard& Shard)
+	{
+		if (Shard.Tail == INDEX_NONE) return;
+
+		const KeyType LRUKey = Shard.Nodes[Shard.Tail].Key;
+		Shard.RemoveNode(Shard.Tail);
+		Shard.UpdateFrequency.Remove(LRUKey);
+		Shard.Evictions.fetch_add(1, std::memory_order_relaxed);
 	}
 
 	template<typename T>
@@ -629,25 +811,18 @@ private:
 	}
 
 private:
-	TMap<KeyType, FCacheEntry<ValueType>> CacheMap;
-	TArray<KeyType> AccessOrder;
-	TMap<KeyType, FUpdateFrequencyData> UpdateFrequency;
+	/** Lock stripes; fixed after construction */
+	TArray<TUniquePtr<FShard>> Shards;
+	uint32 ShardMask = 0;
 
+	// Configuration: written with every shard locked, read under any one shard lock
 	int32 MaxCacheEntries;
 	float DefaultTTL;  // Default time-to-live for entries when not specified explicitly
 	int32 MaxValueSize;
 	int32 MaxUpdateRatePerSecond;
 	bool  EnablePoisoningProtection;
 
-	mutable std::atomic<int32> TotalHits;
-	mutable std::atomic<int32> TotalMisses;
-	mutable std::atomic<int32> TotalEvictions;
-	mutable std::atomic<int32> RejectedEntries;
-	mutable std::atomic<int32> SuspiciousPatterns;
-
 	FValidateEntryFunc<KeyType, ValueType> ValidationFunc;
-
-	mutable TSharedPtr<FCriticalSection> CacheLock;
 };
 
 // Specialized caches
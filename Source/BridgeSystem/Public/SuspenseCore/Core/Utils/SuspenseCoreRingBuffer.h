@@ -0,0 +1,148 @@
+// SuspenseCoreRingBuffer.h
+// Copyright Suspense Team. All Rights Reserved.
+//
+// Fixed-capacity ring buffer for bounded histories (undo/redo, recent-ops windows).
+// Push on a full buffer overwrites the oldest element instead of shifting the array.
+//
+// Usage:
+//   TSuspenseCoreRingBuffer<FEntry> History;
+//   History.SetCapacity(50);
+//   History.Push(MoveTemp(Entry));      // O(1), evicts oldest when full
+//   History[0] / History.Last();        // oldest / newest
+//   History.Pop();                      // removes newest
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * TSuspenseCoreRingBuffer
+ *
+ * Logical index 0 is the oldest element, Num()-1 the newest.
+ * Storage is allocated once in SetCapacity; Push/Pop/Last never allocate.
+ *
+ * THREAD SAFETY:
+ * - None; callers guard it with their own lock
+ */
+template<typename ElementType>
+class TSuspenseCoreRingBuffer
+{
+public:
+	/** Reallocate storage. Keeps the newest elements that fit */
+	void SetCapacity(int32 InCapacity)
+	{
+		InCapacity = FMath::Max(InCapacity, 0);
+		if (InCapacity == Storage.Num())
+		{
+			return;
+		}
+
+		TArray<ElementType> NewStorage;
+		NewStorage.SetNum(InCapacity);
+
+		const int32 Kept = FMath::Min(Count, InCapacity);
+		for (int32 Index = 0; Index < Kept; ++Index)
+		{
+			NewStorage[Index] = MoveTemp((*this)[Count - Kept + Index]);
+		}
+
+		Storage = MoveTemp(NewStorage);
+		Head = 0;
+		Count = Kept;
+	}
+
+	/**
+	 * Append as newest element.
+	 * @return true if the oldest element was overwritten
+	 */
+	bool Push(ElementType&& Value)
+	{
+		const int32 Capacity = Storage.Num();
+		if (Capacity == 0)
+		{
+			return false;
+		}
+
+		if (Count < Capacity)
+		{
+			Storage[Wrap(Head + Count)] = MoveTemp(Value);
+			++Count;
+			return false;
+		}
+
+		Storage[Head] = MoveTemp(Value);
+		Head = Wrap(Head + 1);
+		return true;
+	}
+
+	bool Push(const ElementType& Value)
+	{
+		ElementType Copy = Value;
+		return Push(MoveTemp(Copy));
+	}
+
+	/** Remove and return newest element. Buffer must not be empty */
+	ElementType Pop()
+	{
+		check(Count > 0);
+		--Count;
+		return MoveTemp(Storage[Wrap(Head + Count)]);
+	}
+
+	/**
+	 * Remove element at logical index, shifting the newer ones down.
+	 * Cost is proportional to the number of elements newer than Index.
+	 */
+	void RemoveAt(int32 Index)
+	{
+		check(Index >= 0 && Index < Count);
+		for (int32 Cur = Index; Cur < Count - 1; ++Cur)
+		{
+			(*this)[Cur] = MoveTemp((*this)[Cur + 1]);
+		}
+		--Count;
+		Storage[Wrap(Head + Count)] = ElementType();
+	}
+
+	/** Drop all elements, keep storage */
+	void Reset()
+	{
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			(*this)[Index] = ElementType();
+		}
+		Head = 0;
+		Count = 0;
+	}
+
+	ElementType& operator[](int32 Index)
+	{
+		checkSlow(Index >= 0 && Index < Count);
+		return Storage[Wrap(Head + Index)];
+	}
+
+	const ElementType& operator[](int32 Index) const
+	{
+		checkSlow(Index >= 0 && Index < Count);
+		return Storage[Wrap(Head + Index)];
+	}
+
+	ElementType& Last() { return (*this)[Count - 1]; }
+	const ElementType& Last() const { return (*this)[Count - 1]; }
+
+	int32 Num() const { return Count; }
+	int32 Capacity() const { return Storage.Num(); }
+	bool IsEmpty() const { return Count == 0; }
+	bool IsFull() const { return Count == Storage.Num(); }
+
+private:
+	FORCEINLINE int32 Wrap(int32 Index) const
+	{
+		// Index < 2 * Capacity for every caller
+		return Index >= Storage.Num() ? Index - Storage.Num() : Index;
+	}
+
+	TArray<ElementType> Storage;
+	int32 Head = 0;
+	int32 Count = 0;
+};
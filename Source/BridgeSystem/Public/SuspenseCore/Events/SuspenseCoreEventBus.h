@@ -6,6 +6,9 @@
 
 #include "CoreMinimal.h"
 #include "SuspenseCore/Types/SuspenseCoreTypes.h"
+#include "SuspenseCore/Events/SuspenseCoreEventRing.h"
+#include "UObject/ObjectKey.h"
+#include <atomic>
 #include "SuspenseCoreEventBus.generated.h"
 
 /**
@@ -53,6 +56,58 @@ struct FSuspenseCoreSubscription
 	}
 };
 
+/** Immutable, priority-sorted subscriber list shared between snapshots */
+using FSuspenseCoreSubscriptionList = TArray<FSuspenseCoreSubscription>;
+using FSuspenseCoreSubscriptionListPtr = TSharedPtr<const FSuspenseCoreSubscriptionList, ESPMode::ThreadSafe>;
+
+/**
+ * FSuspenseCoreSubscriptionSnapshot
+ *
+ * Read-only view of the subscription table used by the publish path.
+ * Built under SubscriptionLock on every Subscribe/Unsubscribe and swapped in atomically.
+ * Per-tag lists are shared (copy-on-write), so a rebuild only copies the changed lists.
+ */
+struct FSuspenseCoreSubscriptionSnapshot
+{
+	/** Exact tag subscribers */
+	TMap<FGameplayTag, FSuspenseCoreSubscriptionListPtr> Direct;
+
+	/**
+	 * Dispatch table per published tag: direct + ancestor (SubscribeToChildren)
+	 * subscribers, flattened and merged by priority. Null value = no subscribers.
+	 */
+	TMap<FGameplayTag, FSuspenseCoreSubscriptionListPtr> Resolved;
+};
+
+/**
+ * FSuspenseCoreDeferredEventKey
+ *
+ * Coalescing key for deferred events: tag + source (+ optional payload discriminator).
+ * The discriminator value itself is part of the key - its hash only picks the bucket,
+ * so two different values that collide are never merged.
+ */
+struct FSuspenseCoreDeferredEventKey
+{
+	FGameplayTag EventTag;
+	FObjectKey Source;
+	TOptional<FSuspenseCoreEventPayload::FValue> Discriminator;
+
+	bool operator==(const FSuspenseCoreDeferredEventKey& Other) const
+	{
+		if (EventTag != Other.EventTag || Source != Other.Source || Discriminator.IsSet() != Other.Discriminator.IsSet())
+		{
+			return false;
+		}
+		return !Discriminator.IsSet() || FSuspenseCoreEventPayload::ValuesEqual(Discriminator.GetValue(), Other.Discriminator.GetValue());
+	}
+
+	friend uint32 GetTypeHash(const FSuspenseCoreDeferredEventKey& Key)
+	{
+		const uint32 DiscriminatorHash = Key.Discriminator.IsSet() ? FSuspenseCoreEventPayload::HashValue(Key.Discriminator.GetValue()) : 0;
+		return HashCombine(HashCombine(GetTypeHash(Key.EventTag), GetTypeHash(Key.Source)), DiscriminatorHash);
+	}
+};
+
 /**
  * USuspenseCoreEventBus
  *
@@ -65,17 +120,25 @@ struct FSuspenseCoreSubscription
  * - Source filtering (receive events only from specific objects)
  * - Thread-safe operations (copy-then-notify pattern to avoid deadlocks)
  * - Deferred events (processed at end of frame via EventManager)
+ *   - per-tag coalescing (KeepAll / LastValueWins / Accumulate), see SetCoalesceRule
+ *   - per-frame time budget (suspensecore.eventbus.deferred_budget_ms), remainder spills to next frame
  * - Child tag subscription (subscribe to parent, receive all children)
  *
  * Thread Safety:
  * - All public methods are thread-safe
- * - Uses copy-then-notify: subscribers are copied under lock, then notified without lock
+ * - Subscribe/Unsubscribe mutate the table under SubscriptionLock and publish a new
+ *   immutable snapshot (RCU-style); publish never takes a lock
+ * - Retired snapshots are freed once no publish is in flight (reader counter)
  * - Subscriptions are sorted once on add, not on every publish
  *
  * Performance Optimizations:
- * - O(1) subscription lookup via TMap<FGameplayTag, TArray<...>>
+ * - O(1) subscription lookup via TMap<FGameplayTag, ...>
+ * - Publish is an atomic snapshot load plus iteration, zero heap allocations
+ * - Hierarchical subscribers are resolved once per concrete tag into a cached,
+ *   priority-merged dispatch table; only subscription changes invalidate it
  * - Subscriptions sorted by priority at registration time
  * - Native C++ callbacks avoid reflection overhead
+ * - Debug tracing compiled out in Shipping, gated by suspensecore.eventbus.debug_trace elsewhere
  *
  * Usage:
  *   // Subscribe
@@ -123,12 +186,18 @@ public:
 	 * Async publish - dispatches to game thread from any thread.
 	 * Safe to call from background threads for non-critical events.
 	 * Useful for: analytics, logging, state updates that don't need immediate response.
+	 *
+	 * Worker threads enqueue into a lock-free MPSC ring that the game thread drains
+	 * once per frame into the deferred queue, so coalesce rules apply to ring events too.
+	 * On the game thread the event is dispatched immediately (use PublishDeferred to coalesce).
+	 * Ring capacity and overflow behaviour:
+	 * suspensecore.eventbus.async_ring_capacity / suspensecore.eventbus.async_overflow.
 	 */
 	void PublishAsync(FGameplayTag EventTag, const FSuspenseCoreEventData& EventData);
 
 	/**
 	 * Batch publish multiple events asynchronously.
-	 * More efficient than multiple individual PublishAsync calls.
+	 * Same ring as PublishAsync; events keep their order relative to this producer.
 	 */
 	void PublishBatchAsync(const TArray<TPair<FGameplayTag, FSuspenseCoreEventData>>& Events);
 
@@ -205,13 +274,34 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SuspenseCore|Events")
 	void UnsubscribeAll(UObject* Subscriber);
 
+	virtual void BeginDestroy() override;
+
+	// ═══════════════════════════════════════════════════════════════════════════
+	// ОБЪЕДИНЕНИЕ ОТЛОЖЕННЫХ СОБЫТИЙ
+	// ═══════════════════════════════════════════════════════════════════════════
+
+	/**
+	 * Задать правило объединения отложенных событий для тега (точное совпадение).
+	 * Применяется к PublishDeferred и к событиям из async ring; не влияет на Publish
+	 * и на PublishAsync с game thread.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SuspenseCore|Events")
+	void SetCoalesceRule(FGameplayTag EventTag, const FSuspenseCoreEventCoalesceRule& Rule);
+
+	/**
+	 * Удалить правило объединения (тег снова KeepAll).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SuspenseCore|Events")
+	void ClearCoalesceRule(FGameplayTag EventTag);
+
 	// ═══════════════════════════════════════════════════════════════════════════
 	// УТИЛИТЫ
 	// ═══════════════════════════════════════════════════════════════════════════
 
 	/**
 	 * Обработка отложенных событий.
-	 * Вызывается EventManager каждый кадр.
+	 * Вызывается EventManager каждый кадр. Ограничена бюджетом времени,
+	 * необработанный остаток переносится на следующий кадр.
 	 */
 	void ProcessDeferredEvents();
 
@@ -233,30 +323,87 @@ public:
 	bool HasSubscribers(FGameplayTag EventTag) const;
 
 protected:
-	/** Карта подписок: Tag -> Array of Subscribers */
-	TMap<FGameplayTag, TArray<FSuspenseCoreSubscription>> Subscriptions;
+	/** Карта подписок: Tag -> Array of Subscribers (writer side, guarded by SubscriptionLock) */
+	TMap<FGameplayTag, FSuspenseCoreSubscriptionListPtr> Subscriptions;
+
+	/** Подписки на дочерние теги (writer side, guarded by SubscriptionLock) */
+	TMap<FGameplayTag, FSuspenseCoreSubscriptionListPtr> ChildSubscriptions;
 
-	/** Подписки на дочерние теги */
-	TMap<FGameplayTag, TArray<FSuspenseCoreSubscription>> ChildSubscriptions;
+	/** Cached dispatch tables, see FSuspenseCoreSubscriptionSnapshot::Resolved (guarded by SubscriptionLock) */
+	TMap<FGameplayTag, FSuspenseCoreSubscriptionListPtr> DispatchTables;
 
-	/** Очередь отложенных событий */
+	/** Tags published at least once; their dispatch tables are rebuilt eagerly (guarded by SubscriptionLock) */
+	TSet<FGameplayTag> PublishedEventTags;
+
+	/** Snapshot read by the publish path without locking */
+	std::atomic<const FSuspenseCoreSubscriptionSnapshot*> ActiveSnapshot{nullptr};
+
+	/** Number of publishes currently iterating a snapshot */
+	mutable std::atomic<int32> ActiveReaders{0};
+
+	/** Swapped-out snapshots waiting for ActiveReaders to drop to zero (guarded by SubscriptionLock) */
+	TArray<const FSuspenseCoreSubscriptionSnapshot*> RetiredSnapshots;
+
+	/** Async ingestion ring: worker threads produce, game thread consumes (null on CDO) */
+	TUniquePtr<TSuspenseCoreMpscRing<FSuspenseCoreQueuedEvent>> AsyncRing;
+
+	/** Async ingestion counters (written by producers / game thread, read by GetStats) */
+	std::atomic<int64> AsyncEventsOverflowed{0};
+	std::atomic<int32> AsyncQueuePeakDepth{0};
+	std::atomic<int32> LastAsyncDrainCount{0};
+	std::atomic<float> LastAsyncDrainMaxLatencyMs{0.0f};
+	std::atomic<float> LastAsyncDrainAvgLatencyMs{0.0f};
+
+	/** Очередь отложенных событий (guarded by DeferredLock) */
 	TArray<FSuspenseCoreQueuedEvent> DeferredEvents;
 
+	/** Coalescing key -> index in DeferredEvents for the pending frame (guarded by DeferredLock) */
+	TMap<FSuspenseCoreDeferredEventKey, int32> DeferredEventIndex;
+
+	/** Правила объединения по тегу (guarded by DeferredLock) */
+	TMap<FGameplayTag, FSuspenseCoreEventCoalesceRule> CoalesceRules;
+
+	/** Deferred pipeline counters (guarded by DeferredLock) */
+	int64 DeferredEventsDropped = 0;
+	int64 DeferredEventsMerged = 0;
+	int64 DeferredEventsSpilled = 0;
+	float LastDeferredProcessMs = 0.0f;
+
 	/** Счётчик для генерации уникальных handle */
 	uint64 NextSubscriptionId = 1;
 
 	/** Статистика */
-	int64 TotalEventsPublished = 0;
+	std::atomic<int64> TotalEventsPublished{0};
 
-	/** Критическая секция для thread-safety */
+	/** Критическая секция для thread-safety (subscription writers only) */
 	mutable FCriticalSection SubscriptionLock;
 
+	/** Критическая секция для очереди отложенных событий */
+	mutable FCriticalSection DeferredLock;
+
 private:
 	/**
 	 * Внутренний метод публикации.
 	 */
 	void PublishInternal(FGameplayTag EventTag, const FSuspenseCoreEventData& EventData);
 
+	/**
+	 * Push one event into the async ring, applying the overflow policy when full.
+	 */
+	void EnqueueAsync(FSuspenseCoreQueuedEvent&& Event);
+
+	/**
+	 * Move everything that was in the async ring when the drain started into the
+	 * deferred queue (coalesce rules apply). Game thread only.
+	 */
+	void DrainAsyncEvents();
+
+	/**
+	 * Поставить событие в очередь, применяя правило объединения.
+	 * Caller must hold DeferredLock.
+	 */
+	void EnqueueDeferred_NoLock(FSuspenseCoreQueuedEvent&& Event);
+
 	/**
 	 * Создать подписку.
 	 */
@@ -274,7 +421,7 @@ private:
 	 * Уведомить подписчиков.
 	 */
 	void NotifySubscribers(
-		const TArray<FSuspenseCoreSubscription>& Subs,
+		const FSuspenseCoreSubscriptionList& Subs,
 		FGameplayTag EventTag,
 		const FSuspenseCoreEventData& EventData
 	);
@@ -282,5 +429,36 @@ private:
 	/**
 	 * Сортировка по приоритету.
 	 */
-	void SortSubscriptionsByPriority(TArray<FSuspenseCoreSubscription>& Subs);
+	static void SortSubscriptionsByPriority(FSuspenseCoreSubscriptionList& Subs);
+
+	/**
+	 * Build a snapshot from the writer-side maps and swap it in.
+	 * Caller must hold SubscriptionLock.
+	 */
+	void PublishSnapshot_NoLock();
+
+	/**
+	 * Merge direct and ancestor subscribers of a concrete tag by priority.
+	 * Caller must hold SubscriptionLock.
+	 */
+	FSuspenseCoreSubscriptionListPtr BuildDispatchTable_NoLock(const FGameplayTag& EventTag) const;
+
+	/**
+	 * Slow path for the first publish of a tag: resolve, cache and publish a new snapshot.
+	 */
+	FSuspenseCoreSubscriptionListPtr ResolveAndCacheDispatchTable(const FGameplayTag& EventTag);
+
+	/**
+	 * Drop cached dispatch tables affected by a subscription change.
+	 * Caller must hold SubscriptionLock.
+	 */
+	void InvalidateDispatchTables_NoLock(
+		const TArray<FGameplayTag>& ChangedTags,
+		const TArray<FGameplayTag>& ChangedParentTags);
+
+	/**
+	 * Free retired snapshots if no publish is in flight.
+	 * Caller must hold SubscriptionLock.
+	 */
+	void ReclaimRetiredSnapshots_NoLock();
 };
@@ -0,0 +1,91 @@
+// SuspenseCoreEventDataLibrary.h
+// SuspenseCore - Clean Architecture Foundation
+// Copyright (c) 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "SuspenseCore/Types/SuspenseCoreTypes.h"
+#include "SuspenseCoreEventDataLibrary.generated.h"
+
+/**
+ * USuspenseCoreEventDataLibrary
+ *
+ * Blueprint access to the typed payload of FSuspenseCoreEventData.
+ * The payload is an inline store (FSuspenseCoreEventPayload) that is not
+ * reflected, so Blueprints read and write it through these nodes. Getters also
+ * see values set through the legacy *Payload map members.
+ */
+UCLASS()
+class BRIDGESYSTEM_API USuspenseCoreEventDataLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	// ═══════════════════════════════════════════════════════════════════════════
+	// GETTERS
+	// ═══════════════════════════════════════════════════════════════════════════
+
+	UFUNCTION(BlueprintPure, Category = "SuspenseCore|Events|Payload")
+	static FString GetString(const FSuspenseCoreEventData& EventData, FName Key, const FString& Default);
+
+	UFUNCTION(BlueprintPure, Category = "SuspenseCore|Events|Payload")
+	static float GetFloat(const FSuspenseCoreEventData& EventData, FName Key, float Default = 0.0f);
+
+	UFUNCTION(BlueprintPure, Category = "SuspenseCore|Events|Payload")
+	static int32 GetInt(const FSuspenseCoreEventData& EventData, FName Key, int32 Default = 0);
+
+	UFUNCTION(BlueprintPure, Category = "SuspenseCore|Events|Payload")
+	static bool GetBool(const FSuspenseCoreEventData& EventData, FName Key, bool Default = false);
+
+	UFUNCTION(BlueprintPure, Category = "SuspenseCore|Events|Payload")
+	static FVector GetVector(const FSuspenseCoreEventData& EventData, FName Key);
+
+	UFUNCTION(BlueprintPure, Category = "SuspenseCore|Events|Payload")
+	static UObject* GetObject(const FSuspenseCoreEventData& EventData, FName Key);
+
+	UFUNCTION(BlueprintPure, Category = "SuspenseCore|Events|Payload")
+	static FGameplayTag GetGameplayTag(const FSuspenseCoreEventData& EventData, FName Key);
+
+	/** Named GetNameValue to avoid hiding UObject::GetName */
+	UFUNCTION(BlueprintPure, Category = "SuspenseCore|Events|Payload", meta = (DisplayName = "Get Name"))
+	static FName GetNameValue(const FSuspenseCoreEventData& EventData, FName Key);
+
+	UFUNCTION(BlueprintPure, Category = "SuspenseCore|Events|Payload")
+	static FGuid GetGuid(const FSuspenseCoreEventData& EventData, FName Key);
+
+	UFUNCTION(BlueprintPure, Category = "SuspenseCore|Events|Payload")
+	static bool HasKey(const FSuspenseCoreEventData& EventData, FName Key);
+
+	// ═══════════════════════════════════════════════════════════════════════════
+	// SETTERS
+	// ═══════════════════════════════════════════════════════════════════════════
+
+	UFUNCTION(BlueprintCallable, Category = "SuspenseCore|Events|Payload")
+	static void SetString(UPARAM(ref) FSuspenseCoreEventData& EventData, FName Key, const FString& Value);
+
+	UFUNCTION(BlueprintCallable, Category = "SuspenseCore|Events|Payload")
+	static void SetFloat(UPARAM(ref) FSuspenseCoreEventData& EventData, FName Key, float Value);
+
+	UFUNCTION(BlueprintCallable, Category = "SuspenseCore|Events|Payload")
+	static void SetInt(UPARAM(ref) FSuspenseCoreEventData& EventData, FName Key, int32 Value);
+
+	UFUNCTION(BlueprintCallable, Category = "SuspenseCore|Events|Payload")
+	static void SetBool(UPARAM(ref) FSuspenseCoreEventData& EventData, FName Key, bool Value);
+
+	UFUNCTION(BlueprintCallable, Category = "SuspenseCore|Events|Payload")
+	static void SetVector(UPARAM(ref) FSuspenseCoreEventData& EventData, FName Key, FVector Value);
+
+	UFUNCTION(BlueprintCallable, Category = "SuspenseCore|Events|Payload")
+	static void SetObject(UPARAM(ref) FSuspenseCoreEventData& EventData, FName Key, UObject* Value);
+
+	UFUNCTION(BlueprintCallable, Category = "SuspenseCore|Events|Payload")
+	static void SetGameplayTag(UPARAM(ref) FSuspenseCoreEventData& EventData, FName Key, FGameplayTag Value);
+
+	UFUNCTION(BlueprintCallable, Category = "SuspenseCore|Events|Payload", meta = (DisplayName = "Set Name"))
+	static void SetNameValue(UPARAM(ref) FSuspenseCoreEventData& EventData, FName Key, FName Value);
+
+	UFUNCTION(BlueprintCallable, Category = "SuspenseCore|Events|Payload")
+	static void SetGuid(UPARAM(ref) FSuspenseCoreEventData& EventData, FName Key, FGuid Value);
+};
@@ -117,6 +117,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SuspenseCore|Debug")
 	void SetEventLogging(bool bEnabled);
 
+	/**
+	 * Правила объединения отложенных событий для частых HUD-событий.
+	 * Вызывается при создании шины; публичный для тестов.
+	 */
+	static void RegisterDefaultCoalesceRules(USuspenseCoreEventBus* Bus);
+
 protected:
 	/** EventBus instance */
 	UPROPERTY()
@@ -0,0 +1,135 @@
+// SuspenseCoreEventRing.h
+// SuspenseCore - Clean Architecture Foundation
+// Copyright (c) 2025. All Rights Reserved.
+//
+// Bounded lock-free multi-producer / single-consumer ring buffer.
+// Used by USuspenseCoreEventBus to ingest PublishAsync events from worker threads;
+// the game thread drains it once per frame.
+//
+// Usage:
+//   TSuspenseCoreMpscRing<FMyItem> Ring(1024);
+//   Ring.TryEnqueue(MoveTemp(Item));   // any thread, fails when full
+//   while (Ring.TryDequeue(Item)) {}   // single consumer thread only
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/TypeCompatibleBytes.h"
+#include <atomic>
+
+/**
+ * TSuspenseCoreMpscRing
+ *
+ * Vyukov-style bounded queue: every cell carries a sequence number that tells
+ * producers whether it is free and the consumer whether it is published.
+ * Producers claim a position with one CAS; no locks, no allocation after construction.
+ *
+ * Capacity is rounded up to a power of two.
+ */
+template<typename ElementType>
+class TSuspenseCoreMpscRing
+{
+public:
+	explicit TSuspenseCoreMpscRing(uint32 InCapacity)
+	{
+		const uint32 Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(InCapacity, 2));
+		Mask = Capacity - 1;
+		Cells = MakeUnique<FCell[]>(Capacity);
+
+		for (uint32 Index = 0; Index < Capacity; ++Index)
+		{
+			Cells[Index].Sequence.store(Index, std::memory_order_relaxed);
+		}
+	}
+
+	~TSuspenseCoreMpscRing()
+	{
+		ElementType Discard;
+		while (TryDequeue(Discard))
+		{
+		}
+	}
+
+	// Non-copyable
+	TSuspenseCoreMpscRing(const TSuspenseCoreMpscRing&) = delete;
+	TSuspenseCoreMpscRing& operator=(const TSuspenseCoreMpscRing&) = delete;
+
+	/** Enqueue from any thread. Returns false if the ring is full (Value is left untouched). */
+	bool TryEnqueue(ElementType&& Value)
+	{
+		uint64 Position = EnqueuePosition.load(std::memory_order_relaxed);
+		FCell* Cell = nullptr;
+
+		for (;;)
+		{
+			Cell = &Cells[Position & Mask];
+			const uint64 Sequence = Cell->Sequence.load(std::memory_order_acquire);
+			const int64 Diff = static_cast<int64>(Sequence) - static_cast<int64>(Position);
+
+			if (Diff == 0)
+			{
+				if (EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (Diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				Position = EnqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+
+		new (Cell->Storage.GetTypedPtr()) ElementType(MoveTemp(Value));
+		Cell->Sequence.store(Position + 1, std::memory_order_release);
+		return true;
+	}
+
+	/** Dequeue on the single consumer thread. Returns false if nothing is published yet. */
+	bool TryDequeue(ElementType& OutValue)
+	{
+		const uint64 Position = DequeuePosition.load(std::memory_order_relaxed);
+		FCell& Cell = Cells[Position & Mask];
+		const uint64 Sequence = Cell.Sequence.load(std::memory_order_acquire);
+
+		if (static_cast<int64>(Sequence) - static_cast<int64>(Position + 1) < 0)
+		{
+			return false;
+		}
+
+		ElementType* Element = Cell.Storage.GetTypedPtr();
+		OutValue = MoveTemp(*Element);
+		Element->~ElementType();
+
+		Cell.Sequence.store(Position + Mask + 1, std::memory_order_release);
+		DequeuePosition.store(Position + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	/** Approximate number of queued elements (exact when called from the consumer with no producers active) */
+	int32 Num() const
+	{
+		const uint64 Enqueued = EnqueuePosition.load(std::memory_order_relaxed);
+		const uint64 Dequeued = DequeuePosition.load(std::memory_order_relaxed);
+		return Enqueued > Dequeued ? static_cast<int32>(Enqueued - Dequeued) : 0;
+	}
+
+	int32 Capacity() const { return static_cast<int32>(Mask + 1); }
+
+private:
+	struct FCell
+	{
+		std::atomic<uint64> Sequence{0};
+		TTypeCompatibleBytes<ElementType> Storage;
+	};
+
+	TUniquePtr<FCell[]> Cells;
+	uint64 Mask = 0;
+
+	/** Producers contend here; keep it off the consumer's cache line */
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> EnqueuePosition{0};
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> DequeuePosition{0};
+};
@@ -30,6 +30,16 @@
  * - 25 far:  25 * 0.33 = 8.3 per frame
  * - 25 very far: 25 * 0.2 = 5 per frame
  * Total: ~50 per frame (80% reduction!)
+ *
+ * GATHER COST:
+ * ═══════════════════════════════════════════════════════════════════════════
+ * Pawn locations are packed into SoA float arrays once per frame (PrepareForReplication).
+ * Per connection:
+ * - Every bucket due this frame  -> all players, no distance tests
+ * - No bucket due this frame     -> own PlayerState only
+ * - Otherwise                    -> ClassifyPlayers, 4 players per SIMD step
+ * Bucket membership is the same per frame for every connection, so the
+ * per-connection work is a branch-free sweep over contiguous floats.
  */
 UCLASS()
 class BRIDGESYSTEM_API USuspenseCoreRepNode_PlayerStateFrequency : public UReplicationGraphNode
@@ -72,6 +82,36 @@ public:
 	/** Get tracked PlayerState count */
 	int32 GetPlayerStateCount() const { return AllPlayerStates.Num(); }
 
+	// ═══════════════════════════════════════════════════════════════════════════
+	// Classification (headless)
+	// ═══════════════════════════════════════════════════════════════════════════
+
+	/** FireMask bits: one per bucket, set if the bucket replicates this frame */
+	static constexpr uint32 NearBit = 1 << 0;
+	static constexpr uint32 MidBit = 1 << 1;
+	static constexpr uint32 FarBit = 1 << 2;
+	static constexpr uint32 VeryFarBit = 1 << 3;
+	static constexpr uint32 AllBuckets = NearBit | MidBit | FarBit | VeryFarBit;
+
+	/**
+	 * Append indices of players whose bucket is due this frame.
+	 * Bucket = number of thresholds the squared distance exceeds (0 = Near .. 3 = VeryFar).
+	 * @param X/Y/Z Player positions, Num floats each
+	 * @param ThresholdsSq Near/Mid/Far squared distances
+	 * @param FireMask Buckets due this frame (NearBit..VeryFarBit)
+	 */
+	static void ClassifyPlayers(
+		const float* X, const float* Y, const float* Z, int32 Num,
+		const FVector3f& Viewer, const FVector3f& ThresholdsSq, uint32 FireMask,
+		TArray<int32>& OutIndices);
+
+	/**
+	 * Headless gather benchmark: per-connection pointer-chasing scan vs packed SoA sweep,
+	 * one player per connection, default thresholds and periods.
+	 * @return Human readable report
+	 */
+	static FString RunBenchmark(const TArray<int32>& ConnectionCounts, int32 NumFrames);
+
 protected:
 	/** All tracked PlayerStates */
 	UPROPERTY()
@@ -94,12 +134,40 @@ protected:
 	/** Frame counter for frequency buckets */
 	uint32 FrameCounter;
 
+	/** Buckets due this frame (computed once in PrepareForReplication) */
+	uint32 FrameFireMask;
+
+	/**
+	 * Packed view of valid PlayerStates, positions refreshed once per frame.
+	 * Kept in step with AllPlayerStates by Notify Add/Remove (swap-removed, order not stable).
+	 * Float precision is ample for the 20-100m thresholds.
+	 */
+	TArray<APlayerState*> PackedPlayerStates;
+	TArray<float> PackedX;
+	TArray<float> PackedY;
+	TArray<float> PackedZ;
+
+	/** PlayerState -> index in the packed arrays */
+	TMap<APlayerState*, int32> PackedIndexByState;
+
+	/** Per-gather index scratch */
+	TArray<int32> GatherScratch;
+
 	/** Check if should replicate this frame for bucket */
 	bool ShouldReplicateNear() const { return (FrameCounter % NearPeriod) == 0; }
 	bool ShouldReplicateMid() const { return (FrameCounter % MidPeriod) == 0; }
 	bool ShouldReplicateFar() const { return (FrameCounter % FarPeriod) == 0; }
 	bool ShouldReplicateVeryFar() const { return (FrameCounter % VeryFarPeriod) == 0; }
 
+	/** Bucket bits due at FrameCounter */
+	uint32 ComputeFireMask() const;
+
+	/** Drop invalid PlayerStates and re-read every pawn location into the packed arrays */
+	void RefreshPackedPositions();
+
+	/** Append one PlayerState to the packed arrays */
+	void AddPacked(APlayerState* PlayerState);
+
 	/** Get viewer location for connection */
 	FVector GetViewerLocation(const FConnectionGatherActorListParameters& Params) const;
 
@@ -85,11 +85,11 @@ namespace SuspenseCoreTags
 			BRIDGESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Equipped);
 			BRIDGESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Unequipped);
 			BRIDGESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Reloaded);
-			BRIDGESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(AmmoChanged);
+			BRIDGESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(AmmoChanged);  // Deferred, one per source and AmmoKind (Magazine/Reserve) per frame
 			BRIDGESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(FireModeChanged);
 			BRIDGESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(ReloadStarted);
 			BRIDGESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(ReloadCompleted);
-			BRIDGESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(SpreadChanged);
+			BRIDGESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(SpreadChanged);  // Deferred, last value per source per frame
 			BRIDGESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(RecoilImpulse);  // Recoil impulse for convergence
 			BRIDGESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(StanceChangeRequested);  // Request stance change (grenade equip)
 			BRIDGESYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(StanceRestoreRequested); // Request stance restore (grenade unequip)
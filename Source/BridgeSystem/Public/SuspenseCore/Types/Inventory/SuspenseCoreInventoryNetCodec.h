@@ -0,0 +1,74 @@
+// SuspenseCoreInventoryNetCodec.h
+// Quantized, bit-packed delta serialization for FSuspenseCoreReplicatedInventory
+// Copyright Suspense Team. All Rights Reserved.
+//
+// WIRE FORMAT (one NetDeltaSerialize call):
+//   bit     bReset   - no base state; the client drops items missing from this message
+//   bit     bConfig  - grid config follows: GridWidth, GridHeight (packed), MaxWeight (float)
+//   packed  NumRemoved, then a handle per removed item
+//   packed  NumWritten, then per item:
+//           packed  Handle (FFastArraySerializerItem::ReplicationID - never reused)
+//           bit     bNew -> FGuid, all fields follow
+//           else    FieldMask (NumFieldBits), only the masked fields follow
+//
+// FIELDS:
+//   ItemID     - per-connection name table index; the FName goes inline on first use only.
+//                Indices are never reused on a connection (a reverted base forgets definitions
+//                the client may already hold); a full reset starts the table over
+//   Slot       - packed slot + 1 (0 = not placed), readable without knowing the grid size;
+//                GridPosition is derived from it on the client, never sent
+//   Rotation   - 2 bits (quarter turns)
+//   Quantity   - packed (one byte below 128)
+//   Ammo       - flag bit + two packed round counts
+//   Properties - count + (name, float) pairs, whole array when its hash changed
+//
+// Diffs are computed against a per-connection INetDeltaBaseState. A NAK reverts the
+// base to the last acked state, so the next send repeats everything since then; every
+// field carries an absolute value, which makes a replayed diff harmless. Records for
+// handles or name indices the client has not seen yet are read and dropped - the
+// resend after the NAK carries them in full.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FNetDeltaSerializeInfo;
+struct FSuspenseCoreReplicatedItem;
+struct FSuspenseCoreReplicatedInventory;
+
+/**
+ * FSuspenseCoreInventoryNetCodec
+ *
+ * Stateless; per-connection state lives in the base state and
+ * FSuspenseCoreReplicatedInventory::NextItemIDIndices (server)
+ * and in FSuspenseCoreReplicatedInventory::ReceivedItemIDs (client).
+ */
+class BRIDGESYSTEM_API FSuspenseCoreInventoryNetCodec
+{
+public:
+	/** Per-item change mask bits */
+	enum EField : uint8
+	{
+		Field_ItemID     = 1 << 0,
+		Field_Slot       = 1 << 1,
+		Field_Rotation   = 1 << 2,
+		Field_Quantity   = 1 << 3,
+		Field_Ammo       = 1 << 4,
+		Field_Properties = 1 << 5,
+
+		Field_All        = 0x3F,
+		NumFieldBits     = 6
+	};
+
+	/** NetDeltaSerialize body for FSuspenseCoreReplicatedInventory */
+	static bool NetDeltaSerialize(FSuspenseCoreReplicatedInventory& Inventory, FNetDeltaSerializeInfo& DeltaParams);
+
+	/**
+	 * Bytes per operation: the quantized delta vs the FastArray property layout
+	 * (full item + ReplicationID + array header) for add / move / rotate / stack /
+	 * ammo / property / remove on an inventory of NumItems, plus the initial sync.
+	 * Every delta is decoded into a client copy and compared.
+	 * @return Human readable report
+	 */
+	static FString RunBenchmark(int32 NumItems);
+};
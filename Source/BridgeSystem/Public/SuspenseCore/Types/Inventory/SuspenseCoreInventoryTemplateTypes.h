@@ -274,14 +274,14 @@ struct BRIDGESYSTEM_API FSuspenseCoreTemplateLoadout : public FTableRowBase
 	// Inventory Configuration (Direct - Single Source of Truth)
 	//========================================================================
 
-	/** Inventory grid width */
+	/** Inventory grid width (USuspenseCoreInventoryStorage::MaxGridWidth) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory",
-		meta = (ClampMin = "1", ClampMax = "20"))
+		meta = (ClampMin = "1", ClampMax = "64"))
 	int32 InventoryWidth = 10;
 
-	/** Inventory grid height */
+	/** Inventory grid height (USuspenseCoreInventoryStorage::MaxGridHeight) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory",
-		meta = (ClampMin = "1", ClampMax = "20"))
+		meta = (ClampMin = "1", ClampMax = "256"))
 	int32 InventoryHeight = 6;
 
 	/** Maximum inventory weight */
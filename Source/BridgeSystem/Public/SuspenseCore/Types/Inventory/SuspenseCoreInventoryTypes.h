@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 #include "Net/Serialization/FastArraySerializer.h"
+#include "UObject/ObjectKey.h"
 #include "SuspenseCore/Types/Items/SuspenseCoreItemTypes.h"
 #include "SuspenseCore/Types/Inventory/SuspenseCoreInventoryBaseTypes.h"
 #include "SuspenseCoreInventoryTypes.generated.h"
@@ -126,14 +127,14 @@ struct BRIDGESYSTEM_API FSuspenseCoreInventoryConfig
 {
 	GENERATED_BODY()
 
-	/** Grid width */
+	/** Grid width (USuspenseCoreInventoryStorage::MaxGridWidth) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid",
-		meta = (ClampMin = "1", ClampMax = "20"))
+		meta = (ClampMin = "1", ClampMax = "64"))
 	int32 GridWidth;
 
-	/** Grid height */
+	/** Grid height (USuspenseCoreInventoryStorage::MaxGridHeight) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid",
-		meta = (ClampMin = "1", ClampMax = "20"))
+		meta = (ClampMin = "1", ClampMax = "256"))
 	int32 GridHeight;
 
 	/** Maximum weight capacity */
@@ -356,6 +357,10 @@ struct BRIDGESYSTEM_API FSuspenseCoreReplicatedItem : public FFastArraySerialize
  *
  * FFastArraySerializer for inventory replication.
  * Provides efficient delta replication of inventory state.
+ *
+ * Items keep the FastArray bookkeeping (MarkItemDirty / MarkArrayDirty) and the
+ * Pre/Post replication callbacks, but the wire format is the quantized per-field
+ * delta of FSuspenseCoreInventoryNetCodec; grid config travels in the same stream.
  */
 USTRUCT(BlueprintType)
 struct BRIDGESYSTEM_API FSuspenseCoreReplicatedInventory : public FFastArraySerializer
@@ -380,6 +385,12 @@ struct BRIDGESYSTEM_API FSuspenseCoreReplicatedInventory : public FFastArraySeri
 	UPROPERTY(NotReplicated)
 	TWeakObjectPtr<UActorComponent> OwnerComponent;
 
+	/** Client: ItemID name table received on this connection (see FSuspenseCoreInventoryNetCodec) */
+	TArray<FName> ReceivedItemIDs;
+
+	/** Server: next unused name table index per connection (package map); outlives base state reverts */
+	TMap<TObjectKey<UPackageMap>, int32> NextItemIDIndices;
+
 	//==================================================================
 	// Delta Replication Delegates
 	// Bound by InventoryComponent to handle replication events
@@ -401,10 +412,8 @@ struct BRIDGESYSTEM_API FSuspenseCoreReplicatedInventory : public FFastArraySeri
 	{
 	}
 
-	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParams)
-	{
-		return FFastArraySerializer::FastArrayDeltaSerialize<FSuspenseCoreReplicatedItem, FSuspenseCoreReplicatedInventory>(Items, DeltaParams, *this);
-	}
+	/** Quantized delta path, @see SuspenseCoreInventoryNetCodec.h */
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParams);
 
 	/** Add item to replicated array */
 	void AddItem(const FSuspenseCoreItemInstance& Instance)
@@ -302,8 +302,89 @@ struct BRIDGESYSTEM_API FNetworkOperationResponse
     float Latency = 0.0f;
 };
 
+/**
+ * Bit-packing helpers for the equipment RPC serializers.
+ * Written for FNetBitWriter / FNetBitReader; byte archives work too (just less tightly).
+ */
+namespace SuspenseCoreNetPacking
+{
+    /** Bits needed for values in [0, MaxValue] */
+    inline int32 BitsFor(uint32 MaxValue)
+    {
+        return MaxValue == 0 ? 0 : static_cast<int32>(FMath::FloorLog2(MaxValue)) + 1;
+    }
+
+    /** Fixed-width unsigned field, 0..32 bits */
+    inline void SerializeBits(FArchive& Ar, uint32& Value, int32 NumBits)
+    {
+        if (Ar.IsLoading())
+        {
+            Value = 0;
+        }
+        if (NumBits <= 0)
+        {
+            return;
+        }
+        Ar.SerializeBits(&Value, NumBits);
+        if (NumBits < 32)
+        {
+            Value &= (1u << NumBits) - 1;
+        }
+    }
+
+    /** Signed varint: zig-zag, then SerializeIntPacked (small deltas of either sign stay 1 byte) */
+    inline void SerializeZigZag(FArchive& Ar, int32& Value)
+    {
+        uint32 Encoded = (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+        Ar.SerializeIntPacked(Encoded);
+        if (Ar.IsLoading())
+        {
+            Value = static_cast<int32>((Encoded >> 1) ^ (0u - (Encoded & 1u)));
+        }
+    }
+
+    /** Timestamps travel as whole milliseconds */
+    inline uint32 ToMilliseconds(float Seconds)
+    {
+        return static_cast<uint32>(FMath::Clamp(FMath::RoundToDouble(static_cast<double>(Seconds) * 1000.0), 0.0, static_cast<double>(MAX_uint32)));
+    }
+
+    inline float FromMilliseconds(uint32 Milliseconds)
+    {
+        return static_cast<float>(Milliseconds / 1000.0);
+    }
+
+    /** Raw byte payload: packed length + one bulk copy */
+    inline bool SerializePayload(FArchive& Ar, TArray<uint8>& Bytes, uint32 MaxBytes = 0xFFFF)
+    {
+        uint32 Num = static_cast<uint32>(FMath::Min<int32>(Bytes.Num(), static_cast<int32>(MaxBytes)));
+        Ar.SerializeIntPacked(Num);
+        if (Ar.IsLoading())
+        {
+            if (Num > MaxBytes || Ar.IsError())
+            {
+                Ar.SetError();
+                return false;
+            }
+            Bytes.SetNumUninitialized(static_cast<int32>(Num));
+        }
+        if (Num > 0)
+        {
+            Ar.Serialize(Bytes.GetData(), static_cast<int64>(Num));
+        }
+        return !Ar.IsError();
+    }
+}
+
 /**
  * Network RPC data packet
+ *
+ * Bit-packed wire layout (NetSerialize):
+ * - PacketId (128), OperationType (4 bits)
+ * - SlotBits (4 bits), then SourceSlot / TargetSlot in SlotBits each
+ *   (255 = none is encoded as 0, slot N as N + 1; typical loadouts need 5 bits)
+ * - Timestamp as packed milliseconds, SequenceNumber packed
+ * - Payload: packed length + bulk bytes, Checksum (16)
  */
 USTRUCT()
 struct FEquipmentRPCPacket
@@ -334,57 +415,75 @@ struct FEquipmentRPCPacket
     UPROPERTY()
     uint16 Checksum = 0;
 
+    /** Bits for ENetworkOperationType (11 values) */
+    static constexpr int32 OperationBits = 4;
+
+    /** Bits for the slot width header; widths go up to MaxSlotBits */
+    static constexpr int32 SlotWidthBits = 4;
+    static constexpr uint32 MaxSlotBits = 8;
+
+    /** Slot width that covers this packet's slots */
+    int32 GetSlotBits() const
+    {
+        return FMath::Max(SuspenseCoreNetPacking::BitsFor(EncodeSlot(SourceSlot)), SuspenseCoreNetPacking::BitsFor(EncodeSlot(TargetSlot)));
+    }
+
     /** Custom net serializer to minimize bandwidth. */
     bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
     {
-        bOutSuccess = true;
+        uint32 SlotBits = static_cast<uint32>(GetSlotBits());
+        SuspenseCoreNetPacking::SerializeBits(Ar, SlotBits, SlotWidthBits);
+        if (SlotBits > MaxSlotBits)
+        {
+            Ar.SetError();
+            bOutSuccess = false;
+            return false;
+        }
 
         Ar << PacketId;
 
-        // Enum as uint8 for stability
-        if (Ar.IsSaving())
+        uint32 Op = static_cast<uint32>(OperationType);
+        SuspenseCoreNetPacking::SerializeBits(Ar, Op, OperationBits);
+        if (Ar.IsLoading())
         {
-            uint8 Op = static_cast<uint8>(OperationType);
-            Ar << Op;
-        }
-        else
-        {
-            uint8 Op = 0;
-            Ar << Op;
             OperationType = static_cast<ENetworkOperationType>(Op);
         }
 
-        Ar << SourceSlot;
-        Ar << TargetSlot;
-        Ar << Timestamp;
-        Ar << SequenceNumber;
-
-        // Serialize compressed data payload
-        if (Ar.IsSaving())
+        uint32 Source = EncodeSlot(SourceSlot);
+        uint32 Target = EncodeSlot(TargetSlot);
+        SuspenseCoreNetPacking::SerializeBits(Ar, Source, SlotBits);
+        SuspenseCoreNetPacking::SerializeBits(Ar, Target, SlotBits);
+        if (Ar.IsLoading())
         {
-            const uint16 DataSize = static_cast<uint16>(FMath::Min(ItemData.CompressedProperties.Num(), 0xFFFF));
-            Ar << const_cast<uint16&>(DataSize);
-            for (int32 i = 0; i < DataSize; ++i)
-            {
-                uint8 Byte = ItemData.CompressedProperties[i];
-                Ar << Byte;
-            }
-        }
-        else
-        {
-            uint16 DataSize = 0;
-            Ar << DataSize;
-            ItemData.CompressedProperties.SetNum(DataSize);
-            for (int32 i = 0; i < DataSize; ++i)
-            {
-                Ar << ItemData.CompressedProperties[i];
-            }
+            SourceSlot = DecodeSlot(Source);
+            TargetSlot = DecodeSlot(Target);
         }
 
+        SuspenseCoreNetPacking::SerializePayload(Ar, ItemData.CompressedProperties);
         Ar << Checksum;
 
+        uint32 TimeMs = SuspenseCoreNetPacking::ToMilliseconds(Timestamp);
+        Ar.SerializeIntPacked(TimeMs);
+        Ar.SerializeIntPacked(SequenceNumber);
+        if (Ar.IsLoading())
+        {
+            Timestamp = SuspenseCoreNetPacking::FromMilliseconds(TimeMs);
+        }
+
+        bOutSuccess = !Ar.IsError();
         return bOutSuccess;
     }
+
+    /** 255 (none) -> 0, slot N -> N + 1 */
+    static uint32 EncodeSlot(uint8 Slot)
+    {
+        return Slot == 255 ? 0u : static_cast<uint32>(Slot) + 1u;
+    }
+
+    static uint8 DecodeSlot(uint32 Encoded)
+    {
+        return Encoded == 0 ? 255 : static_cast<uint8>(Encoded - 1);
+    }
 };
 
 template<>
@@ -6,6 +6,8 @@
 
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
+#include "Misc/TVariant.h"
+#include "UObject/WeakObjectPtr.h"
 #include "SuspenseCoreTypes.generated.h"
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -53,6 +55,24 @@ enum class ESuspenseCoreEventPriority : uint8
 	Lowest = 200	UMETA(DisplayName = "Lowest")
 };
 
+/**
+ * ESuspenseCoreEventCoalescePolicy
+ *
+ * Как отложенные события одного тега и источника объединяются в пределах кадра.
+ */
+UENUM(BlueprintType)
+enum class ESuspenseCoreEventCoalescePolicy : uint8
+{
+	/** Каждое событие доставляется отдельно (по умолчанию) */
+	KeepAll = 0			UMETA(DisplayName = "Keep All"),
+
+	/** Доставляется только последнее событие для Tag+Source */
+	LastValueWins		UMETA(DisplayName = "Last Value Wins"),
+
+	/** Одно событие для Tag+Source; значения из AccumulateKeys суммируются */
+	Accumulate			UMETA(DisplayName = "Accumulate")
+};
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // STRUCTS - SUBSCRIPTION
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -97,10 +117,152 @@ private:
 // STRUCTS - EVENT DATA
 // ═══════════════════════════════════════════════════════════════════════════════
 
+/**
+ * FSuspenseCoreEventPayload
+ *
+ * Compact typed key/value store for event payloads.
+ * Entries live in an inline buffer, so events with up to InlineCapacity values
+ * are built, copied and queued without touching the heap (FString values
+ * still own their characters - prefer typed values on hot events).
+ *
+ * Each value type has its own key space, matching the former per-type maps:
+ * SetInt("Slot") and SetString("Slot") are two distinct entries.
+ */
+class FSuspenseCoreEventPayload
+{
+public:
+	/** Values stored inline before spilling to the heap */
+	static constexpr int32 InlineCapacity = 8;
+
+	using FValue = TVariant<float, int32, bool, FVector, FWeakObjectPtr, FGameplayTag, FName, FGuid, FString>;
+
+	struct FEntry
+	{
+		FName Key;
+		FValue Value;
+	};
+
+	template<typename T>
+	const T* Find(FName Key) const
+	{
+		for (const FEntry& Entry : Entries)
+		{
+			if (Entry.Key == Key && Entry.Value.IsType<T>())
+			{
+				return &Entry.Value.Get<T>();
+			}
+		}
+		return nullptr;
+	}
+
+	template<typename T, typename ValueType>
+	void Set(FName Key, ValueType&& Value)
+	{
+		for (FEntry& Entry : Entries)
+		{
+			if (Entry.Key == Key && Entry.Value.IsType<T>())
+			{
+				Entry.Value.Get<T>() = Forward<ValueType>(Value);
+				return;
+			}
+		}
+
+		FEntry& NewEntry = Entries.AddDefaulted_GetRef();
+		NewEntry.Key = Key;
+		NewEntry.Value.Set<T>(Forward<ValueType>(Value));
+	}
+
+	bool Contains(FName Key) const
+	{
+		return Entries.ContainsByPredicate([Key](const FEntry& Entry) { return Entry.Key == Key; });
+	}
+
+	int32 Num() const { return Entries.Num(); }
+
+	void Reset() { Entries.Reset(); }
+
+	/**
+	 * Fold Other into this payload: values overwrite (last value wins), except
+	 * float/int values whose key is in SumKeys, which are added to the existing value.
+	 */
+	void MergeFrom(const FSuspenseCoreEventPayload& Other, TConstArrayView<FName> SumKeys = TConstArrayView<FName>())
+	{
+		for (const FEntry& OtherEntry : Other.Entries)
+		{
+			FEntry* Existing = Entries.FindByPredicate([&OtherEntry](const FEntry& Entry)
+			{
+				return Entry.Key == OtherEntry.Key && Entry.Value.GetIndex() == OtherEntry.Value.GetIndex();
+			});
+
+			if (!Existing)
+			{
+				Entries.Add(OtherEntry);
+				continue;
+			}
+
+			if (SumKeys.Contains(OtherEntry.Key))
+			{
+				if (const float* OtherFloat = OtherEntry.Value.TryGet<float>())
+				{
+					Existing->Value.Get<float>() += *OtherFloat;
+					continue;
+				}
+				if (const int32* OtherInt = OtherEntry.Value.TryGet<int32>())
+				{
+					Existing->Value.Get<int32>() += *OtherInt;
+					continue;
+				}
+			}
+
+			Existing->Value = OtherEntry.Value;
+		}
+	}
+
+	/** First value stored under Key, whatever its type (nullptr if absent) */
+	const FValue* FindValue(FName Key) const
+	{
+		const FEntry* Entry = Entries.FindByPredicate([Key](const FEntry& Candidate) { return Candidate.Key == Key; });
+		return Entry ? &Entry->Value : nullptr;
+	}
+
+	/** Value hash, type-aware; used to bucket coalescing keys */
+	static uint32 HashValue(const FValue& Value)
+	{
+		return HashCombine(::GetTypeHash(static_cast<uint32>(Value.GetIndex())), Visit([](const auto& Typed) -> uint32
+		{
+			return ::GetTypeHash(Typed);
+		}, Value));
+	}
+
+	/** Same type and equal value */
+	static bool ValuesEqual(const FValue& A, const FValue& B)
+	{
+		if (A.GetIndex() != B.GetIndex())
+		{
+			return false;
+		}
+		return Visit([&B](const auto& Typed) -> bool
+		{
+			return Typed == B.template Get<std::decay_t<decltype(Typed)>>();
+		}, A);
+	}
+
+	const TArray<FEntry, TInlineAllocator<InlineCapacity>>& GetEntries() const { return Entries; }
+
+private:
+	TArray<FEntry, TInlineAllocator<InlineCapacity>> Entries;
+};
+
 /**
  * FSuspenseCoreEventData
  *
  * Данные события. Содержит источник, временную метку и гибкий payload.
+ * Payload хранится в FSuspenseCoreEventPayload (inline, без аллокаций для горячих событий);
+ * доступ через Get/Set/Find API ниже. Blueprint: USuspenseCoreEventDataLibrary.
+ *
+ * Старые карты *Payload оставлены для Blueprint графов и ассетов (Break/Make/Set Members).
+ * C++ в них не пишет (пустой TMap не аллоцирует); геттеры читают Payload, затем карты,
+ * а перед вызовом Blueprint подписчика шина зеркалит Payload в карты (SyncBlueprintPayload).
  */
 USTRUCT(BlueprintType)
 struct BRIDGESYSTEM_API FSuspenseCoreEventData
@@ -133,6 +295,13 @@ struct BRIDGESYSTEM_API FSuspenseCoreEventData
 	// PAYLOAD
 	// ═══════════════════════════════════════════════════════════════════════════
 
+	/** Типизированные данные (String/Float/Int/Bool/Vector/Object/Tag/Name/Guid) */
+	FSuspenseCoreEventPayload Payload;
+
+	// ═══════════════════════════════════════════════════════════════════════════
+	// BLUEPRINT PAYLOAD (legacy maps)
+	// ═══════════════════════════════════════════════════════════════════════════
+
 	/** Строковые данные */
 	UPROPERTY(BlueprintReadWrite, Category = "Payload")
 	TMap<FName, FString> StringPayload;
@@ -167,44 +336,123 @@ struct BRIDGESYSTEM_API FSuspenseCoreEventData
 
 	FString GetString(FName Key, const FString& Default = TEXT("")) const
 	{
-		const FString* Value = StringPayload.Find(Key);
-		return Value ? *Value : Default;
+		if (const FString* Value = FindString(Key))
+		{
+			return *Value;
+		}
+		// Typed ID values read back as strings for consumers still using the string form
+		if (const FName* NameValue = Payload.Find<FName>(Key))
+		{
+			return NameValue->ToString();
+		}
+		if (const FGuid* GuidValue = Payload.Find<FGuid>(Key))
+		{
+			return GuidValue->ToString();
+		}
+		if (const FGameplayTag* TagValue = Payload.Find<FGameplayTag>(Key))
+		{
+			return TagValue->ToString();
+		}
+		return Default;
 	}
 
 	float GetFloat(FName Key, float Default = 0.0f) const
 	{
-		const float* Value = FloatPayload.Find(Key);
+		const float* Value = FindFloat(Key);
 		return Value ? *Value : Default;
 	}
 
 	int32 GetInt(FName Key, int32 Default = 0) const
 	{
-		const int32* Value = IntPayload.Find(Key);
+		const int32* Value = FindInt(Key);
 		return Value ? *Value : Default;
 	}
 
 	bool GetBool(FName Key, bool Default = false) const
 	{
-		const bool* Value = BoolPayload.Find(Key);
+		const bool* Value = FindBool(Key);
 		return Value ? *Value : Default;
 	}
 
 	FVector GetVector(FName Key, const FVector& Default = FVector::ZeroVector) const
 	{
-		const FVector* Value = VectorPayload.Find(Key);
+		const FVector* Value = FindVector(Key);
 		return Value ? *Value : Default;
 	}
 
+	FGameplayTag GetGameplayTag(FName Key, const FGameplayTag& Default = FGameplayTag()) const
+	{
+		if (const FGameplayTag* Value = Payload.Find<FGameplayTag>(Key))
+		{
+			return *Value;
+		}
+		// Events built by Blueprint or older producers carry tags as strings
+		if (const FString* StringValue = FindString(Key))
+		{
+			const FGameplayTag Parsed = FGameplayTag::RequestGameplayTag(FName(**StringValue), false);
+			if (Parsed.IsValid())
+			{
+				return Parsed;
+			}
+		}
+		return Default;
+	}
+
+	FName GetName(FName Key, FName Default = NAME_None) const
+	{
+		if (const FName* Value = Payload.Find<FName>(Key))
+		{
+			return *Value;
+		}
+		if (const FString* StringValue = FindString(Key))
+		{
+			return FName(**StringValue);
+		}
+		return Default;
+	}
+
+	FGuid GetGuid(FName Key, const FGuid& Default = FGuid()) const
+	{
+		if (const FGuid* Value = Payload.Find<FGuid>(Key))
+		{
+			return *Value;
+		}
+		if (const FString* StringValue = FindString(Key))
+		{
+			FGuid Parsed;
+			if (FGuid::Parse(*StringValue, Parsed))
+			{
+				return Parsed;
+			}
+		}
+		return Default;
+	}
+
 	template<typename T>
 	T* GetObject(FName Key) const
 	{
-		const TObjectPtr<UObject>* Value = ObjectPayload.Find(Key);
-		return Value ? Cast<T>(Value->Get()) : nullptr;
+		if (const FWeakObjectPtr* Value = Payload.Find<FWeakObjectPtr>(Key))
+		{
+			return Cast<T>(Value->Get());
+		}
+		const TObjectPtr<UObject>* MapValue = ObjectPayload.Num() > 0 ? ObjectPayload.Find(Key) : nullptr;
+		return MapValue ? Cast<T>(MapValue->Get()) : nullptr;
 	}
 
+	/** Pointer lookups - nullptr when the key is absent (Blueprint maps are checked after Payload) */
+	const FString* FindString(FName Key) const { return FindValue(Key, StringPayload); }
+	const float* FindFloat(FName Key) const { return FindValue(Key, FloatPayload); }
+	const int32* FindInt(FName Key) const { return FindValue(Key, IntPayload); }
+	const bool* FindBool(FName Key) const { return FindValue(Key, BoolPayload); }
+	const FVector* FindVector(FName Key) const { return FindValue(Key, VectorPayload); }
+	const FGameplayTag* FindGameplayTag(FName Key) const { return Payload.Find<FGameplayTag>(Key); }
+	const FName* FindName(FName Key) const { return Payload.Find<FName>(Key); }
+	const FGuid* FindGuid(FName Key) const { return Payload.Find<FGuid>(Key); }
+
 	bool HasKey(FName Key) const
 	{
-		return StringPayload.Contains(Key)
+		return Payload.Contains(Key)
+			|| StringPayload.Contains(Key)
 			|| FloatPayload.Contains(Key)
 			|| IntPayload.Contains(Key)
 			|| BoolPayload.Contains(Key)
@@ -218,37 +466,58 @@ struct BRIDGESYSTEM_API FSuspenseCoreEventData
 
 	FSuspenseCoreEventData& SetString(FName Key, const FString& Value)
 	{
-		StringPayload.Add(Key, Value);
+		Payload.Set<FString>(Key, Value);
 		return *this;
 	}
 
 	FSuspenseCoreEventData& SetFloat(FName Key, float Value)
 	{
-		FloatPayload.Add(Key, Value);
+		Payload.Set<float>(Key, Value);
 		return *this;
 	}
 
 	FSuspenseCoreEventData& SetInt(FName Key, int32 Value)
 	{
-		IntPayload.Add(Key, Value);
+		Payload.Set<int32>(Key, Value);
 		return *this;
 	}
 
 	FSuspenseCoreEventData& SetBool(FName Key, bool Value)
 	{
-		BoolPayload.Add(Key, Value);
+		Payload.Set<bool>(Key, Value);
 		return *this;
 	}
 
 	FSuspenseCoreEventData& SetVector(FName Key, const FVector& Value)
 	{
-		VectorPayload.Add(Key, Value);
+		Payload.Set<FVector>(Key, Value);
 		return *this;
 	}
 
 	FSuspenseCoreEventData& SetObject(FName Key, UObject* Value)
 	{
-		ObjectPayload.Add(Key, Value);
+		Payload.Set<FWeakObjectPtr>(Key, FWeakObjectPtr(Value));
+		return *this;
+	}
+
+	/** Typed tag value - avoids the ToString/RequestGameplayTag round trip */
+	FSuspenseCoreEventData& SetGameplayTag(FName Key, const FGameplayTag& Value)
+	{
+		Payload.Set<FGameplayTag>(Key, Value);
+		return *this;
+	}
+
+	/** Typed item/definition ID - no string built on publish */
+	FSuspenseCoreEventData& SetName(FName Key, FName Value)
+	{
+		Payload.Set<FName>(Key, Value);
+		return *this;
+	}
+
+	/** Typed instance ID - no string built on publish */
+	FSuspenseCoreEventData& SetGuid(FName Key, const FGuid& Value)
+	{
+		Payload.Set<FGuid>(Key, Value);
 		return *this;
 	}
 
@@ -279,12 +548,62 @@ struct BRIDGESYSTEM_API FSuspenseCoreEventData
 		return Data;
 	}
 
+	/**
+	 * Mirror Payload into the Blueprint maps. Called by the event bus on a copy of the
+	 * event before it reaches a Blueprint subscriber; Name/Guid/Tag values are exposed
+	 * in StringPayload, as they were before the typed payload.
+	 */
+	void SyncBlueprintPayload()
+	{
+		for (const FSuspenseCoreEventPayload::FEntry& Entry : Payload.GetEntries())
+		{
+			const FSuspenseCoreEventPayload::FValue& Value = Entry.Value;
+			if (const FString* StringValue = Value.TryGet<FString>())
+			{
+				StringPayload.Add(Entry.Key, *StringValue);
+			}
+			else if (const float* FloatValue = Value.TryGet<float>())
+			{
+				FloatPayload.Add(Entry.Key, *FloatValue);
+			}
+			else if (const int32* IntValue = Value.TryGet<int32>())
+			{
+				IntPayload.Add(Entry.Key, *IntValue);
+			}
+			else if (const bool* BoolValue = Value.TryGet<bool>())
+			{
+				BoolPayload.Add(Entry.Key, *BoolValue);
+			}
+			else if (const FVector* VectorValue = Value.TryGet<FVector>())
+			{
+				VectorPayload.Add(Entry.Key, *VectorValue);
+			}
+			else if (const FWeakObjectPtr* ObjectValue = Value.TryGet<FWeakObjectPtr>())
+			{
+				ObjectPayload.Add(Entry.Key, ObjectValue->Get());
+			}
+			else if (const FName* NameValue = Value.TryGet<FName>())
+			{
+				StringPayload.FindOrAdd(Entry.Key, NameValue->ToString());
+			}
+			else if (const FGuid* GuidValue = Value.TryGet<FGuid>())
+			{
+				StringPayload.FindOrAdd(Entry.Key, GuidValue->ToString());
+			}
+			else if (const FGameplayTag* TagValue = Value.TryGet<FGameplayTag>())
+			{
+				StringPayload.FindOrAdd(Entry.Key, TagValue->ToString());
+			}
+		}
+	}
+
 	/** Reset all fields for pool reuse */
 	void Reset()
 	{
 		Source = nullptr;
 		Timestamp = 0.0;
 		Priority = ESuspenseCoreEventPriority::Normal;
+		Payload.Reset();
 		StringPayload.Reset();
 		FloatPayload.Reset();
 		IntPayload.Reset();
@@ -293,6 +612,17 @@ struct BRIDGESYSTEM_API FSuspenseCoreEventData
 		VectorPayload.Reset();
 		Tags.Reset();
 	}
+
+private:
+	template<typename T>
+	const T* FindValue(FName Key, const TMap<FName, T>& BlueprintMap) const
+	{
+		if (const T* Value = Payload.Find<T>(Key))
+		{
+			return Value;
+		}
+		return BlueprintMap.Num() > 0 ? BlueprintMap.Find(Key) : nullptr;
+	}
 };
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -525,6 +855,32 @@ struct FSuspenseCoreQueuedEvent
 	FSuspenseCoreEventData EventData;
 
 	double QueuedTime = 0.0;
+
+	/** Number of later events folded into this one by a coalescing rule */
+	int32 CoalescedCount = 0;
+};
+
+/**
+ * FSuspenseCoreEventCoalesceRule
+ *
+ * Правило объединения отложенных событий для тега (USuspenseCoreEventBus::SetCoalesceRule).
+ * Ключ объединения: Tag + Source (+ значение DiscriminatorKey, если задан).
+ */
+USTRUCT(BlueprintType)
+struct BRIDGESYSTEM_API FSuspenseCoreEventCoalesceRule
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Coalescing")
+	ESuspenseCoreEventCoalescePolicy Policy = ESuspenseCoreEventCoalescePolicy::KeepAll;
+
+	/** Payload key that is part of the coalescing key (e.g. DoTType); None = Tag + Source only */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Coalescing")
+	FName DiscriminatorKey;
+
+	/** Accumulate only: float/int payload values summed across merged events */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Coalescing")
+	TArray<FName> AccumulateKeys;
 };
 
 /**
@@ -543,11 +899,56 @@ struct BRIDGESYSTEM_API FSuspenseCoreEventBusStats
 	UPROPERTY(BlueprintReadOnly, Category = "Stats")
 	int32 UniqueEventTags = 0;
 
+	/** Concrete tags with a cached hierarchical dispatch table */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 ResolvedEventTags = 0;
+
 	UPROPERTY(BlueprintReadOnly, Category = "Stats")
 	int64 TotalEventsPublished = 0;
 
 	UPROPERTY(BlueprintReadOnly, Category = "Stats")
 	int32 DeferredEventsQueued = 0;
+
+	/** Deferred events superseded by a newer one (LastValueWins) */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int64 DeferredEventsDropped = 0;
+
+	/** Deferred events folded into an earlier one (Accumulate) */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int64 DeferredEventsMerged = 0;
+
+	/** Deferred events carried over to the next frame by the time budget */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int64 DeferredEventsSpilled = 0;
+
+	/** Time spent dispatching deferred events last frame */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float LastDeferredProcessMs = 0.0f;
+
+	/** PublishAsync ring: events waiting for the game thread */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 AsyncQueueDepth = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 AsyncQueuePeakDepth = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 AsyncQueueCapacity = 0;
+
+	/** PublishAsync calls that found the ring full (handled per suspensecore.eventbus.async_overflow) */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int64 AsyncEventsOverflowed = 0;
+
+	/** Events drained from the ring last frame */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 LastAsyncDrainCount = 0;
+
+	/** Enqueue-to-dispatch latency of the last drain */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float LastAsyncDrainAvgLatencyMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float LastAsyncDrainMaxLatencyMs = 0.0f;
 };
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -0,0 +1,20 @@
+using UnrealBuildTool;
+
+public class BridgeSystemTests : ModuleRules
+{
+	public BridgeSystemTests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine",
+				"GameplayTags",
+				"BridgeSystem"
+			}
+		);
+	}
+}
@@ -0,0 +1,9 @@
+// BridgeSystemTests.cpp
+// SuspenseCore - EventBus Architecture
+// Copyright Suspense Team. All Rights Reserved.
+//
+// Headless automation tests for BridgeSystem (Session Frontend / -ExecCmds="Automation RunTests SuspenseCore.Events").
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, BridgeSystemTests)
@@ -0,0 +1,125 @@
+// SuspenseCoreEventCoalesceSpec.cpp
+// SuspenseCore - EventBus Architecture
+// Copyright Suspense Team. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "SuspenseCore/Events/SuspenseCoreEventBus.h"
+#include "SuspenseCore/Events/SuspenseCoreEventManager.h"
+#include "SuspenseCore/Tags/SuspenseCoreGameplayTags.h"
+#include "UObject/Package.h"
+
+BEGIN_DEFINE_SPEC(FSuspenseCoreEventCoalesceSpec, "SuspenseCore.Events.Coalesce",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+	USuspenseCoreEventBus* Bus = nullptr;
+	TArray<FSuspenseCoreEventData> Received;
+
+	void Listen(FGameplayTag Tag)
+	{
+		// The bus is its own subscriber: subscriptions only need a live UObject
+		Bus->SubscribeNative(Tag, Bus, FSuspenseCoreNativeEventCallback::CreateLambda(
+			[this](FGameplayTag, const FSuspenseCoreEventData& Data)
+			{
+				Received.Add(Data);
+			}));
+	}
+
+	static FSuspenseCoreEventData Ammo(UObject* Source, FName Kind, int32 Rounds)
+	{
+		FSuspenseCoreEventData Data = FSuspenseCoreEventData::Create(Source);
+		Data.SetName(TEXT("AmmoKind"), Kind);
+		Data.SetInt(TEXT("CurrentRounds"), Rounds);
+		return Data;
+	}
+
+	const FSuspenseCoreEventData* FindKind(FName Kind) const
+	{
+		return Received.FindByPredicate([Kind](const FSuspenseCoreEventData& Data)
+		{
+			return Data.GetName(TEXT("AmmoKind")) == Kind;
+		});
+	}
+END_DEFINE_SPEC(FSuspenseCoreEventCoalesceSpec)
+
+void FSuspenseCoreEventCoalesceSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		Bus = NewObject<USuspenseCoreEventBus>(GetTransientPackage());
+		USuspenseCoreEventManager::RegisterDefaultCoalesceRules(Bus);
+		Received.Reset();
+	});
+
+	AfterEach([this]()
+	{
+		Bus->UnsubscribeAll(Bus);
+		Bus = nullptr;
+	});
+
+	Describe("Weapon.AmmoChanged", [this]()
+	{
+		BeforeEach([this]()
+		{
+			Listen(SuspenseCoreTags::Event::Weapon::AmmoChanged);
+		});
+
+		It("should be delivered at ProcessDeferredEvents, not on publish", [this]()
+		{
+			Bus->PublishDeferred(SuspenseCoreTags::Event::Weapon::AmmoChanged, Ammo(Bus, TEXT("Magazine"), 29));
+			TestEqual(TEXT("Before the frame flush"), Received.Num(), 0);
+
+			Bus->ProcessDeferredEvents();
+			TestEqual(TEXT("After the frame flush"), Received.Num(), 1);
+		});
+
+		It("should keep the last magazine update per source", [this]()
+		{
+			for (int32 Rounds = 30; Rounds > 20; --Rounds)
+			{
+				Bus->PublishDeferred(SuspenseCoreTags::Event::Weapon::AmmoChanged, Ammo(Bus, TEXT("Magazine"), Rounds));
+			}
+			Bus->ProcessDeferredEvents();
+
+			if (TestEqual(TEXT("Events"), Received.Num(), 1))
+			{
+				TestEqual(TEXT("Last value"), Received[0].GetInt(TEXT("CurrentRounds")), 21);
+			}
+		});
+
+		It("should not let reserve and magazine updates replace each other", [this]()
+		{
+			Bus->PublishDeferred(SuspenseCoreTags::Event::Weapon::AmmoChanged, Ammo(Bus, TEXT("Magazine"), 29));
+			Bus->PublishDeferred(SuspenseCoreTags::Event::Weapon::AmmoChanged, Ammo(Bus, TEXT("Reserve"), 90));
+			Bus->PublishDeferred(SuspenseCoreTags::Event::Weapon::AmmoChanged, Ammo(Bus, TEXT("Magazine"), 28));
+			Bus->ProcessDeferredEvents();
+
+			TestEqual(TEXT("Events"), Received.Num(), 2);
+			const FSuspenseCoreEventData* Magazine = FindKind(TEXT("Magazine"));
+			const FSuspenseCoreEventData* Reserve = FindKind(TEXT("Reserve"));
+			if (TestNotNull(TEXT("Magazine"), Magazine) && TestNotNull(TEXT("Reserve"), Reserve))
+			{
+				TestEqual(TEXT("Magazine rounds"), Magazine->GetInt(TEXT("CurrentRounds")), 28);
+				TestEqual(TEXT("Reserve rounds"), Reserve->GetInt(TEXT("CurrentRounds")), 90);
+			}
+		});
+
+		It("should not merge different sources", [this]()
+		{
+			Bus->PublishDeferred(SuspenseCoreTags::Event::Weapon::AmmoChanged, Ammo(Bus, TEXT("Magazine"), 29));
+			Bus->PublishDeferred(SuspenseCoreTags::Event::Weapon::AmmoChanged, Ammo(GetTransientPackage(), TEXT("Magazine"), 5));
+			Bus->ProcessDeferredEvents();
+
+			TestEqual(TEXT("Events"), Received.Num(), 2);
+		});
+
+		It("should still dispatch immediate publishes synchronously", [this]()
+		{
+			Bus->Publish(SuspenseCoreTags::Event::Weapon::AmmoChanged, Ammo(Bus, TEXT("Magazine"), 29));
+			TestEqual(TEXT("Same call"), Received.Num(), 1);
+		});
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
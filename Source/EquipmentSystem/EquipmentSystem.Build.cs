@@ -33,6 +33,7 @@ public class EquipmentSystem : ModuleRules
                 "SlateCore",
                 "InputCore",
                 "NetCore",
+                "Sockets",
                 "Niagara",
                 "Json",
                 "JsonUtilities",
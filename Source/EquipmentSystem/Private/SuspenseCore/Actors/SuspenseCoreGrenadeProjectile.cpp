@@ -4,6 +4,7 @@
 
 #include "SuspenseCore/Actors/SuspenseCoreGrenadeProjectile.h"
 #include "SuspenseCore/Subsystems/SuspenseCoreThrowableAssetPreloader.h"
+#include "SuspenseCore/Subsystems/SuspenseCoreGrenadeSubsystem.h"
 #include "SuspenseCore/Events/SuspenseCoreEventBus.h"
 #include "SuspenseCore/Events/SuspenseCoreEventManager.h"
 #include "SuspenseCore/Tags/SuspenseCoreGameplayTags.h"
@@ -40,9 +41,9 @@ DEFINE_LOG_CATEGORY_STATIC(LogGrenadeProjectile, Log, All);
 
 ASuspenseCoreGrenadeProjectile::ASuspenseCoreGrenadeProjectile()
 {
-    // Enable ticking for fuse countdown
-    PrimaryActorTick.bCanEverTick = true;
-    PrimaryActorTick.bStartWithTickEnabled = true;
+    // No tick: the fuse lives in USuspenseCoreGrenadeSubsystem
+    PrimaryActorTick.bCanEverTick = false;
+    PrimaryActorTick.bStartWithTickEnabled = false;
 
     // Replication setup
     bReplicates = true;
@@ -132,21 +133,11 @@ void ASuspenseCoreGrenadeProjectile::BeginPlay()
         static_cast<int32>(GrenadeType), FuseTime);
 }
 
-void ASuspenseCoreGrenadeProjectile::Tick(float DeltaTime)
+void ASuspenseCoreGrenadeProjectile::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    Super::Tick(DeltaTime);
+    CancelFuse();
 
-    // Fuse countdown (server only for authority)
-    if (HasAuthority() && bIsArmed && !bHasExploded)
-    {
-        float RemainingTime = GetRemainingFuseTime();
-
-        if (RemainingTime <= 0.0f)
-        {
-            GRENADE_PROJECTILE_LOG(Log, TEXT("Fuse expired - exploding"));
-            Explode();
-        }
-    }
+    Super::EndPlay(EndPlayReason);
 }
 
 void ASuspenseCoreGrenadeProjectile::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -478,6 +469,7 @@ void ASuspenseCoreGrenadeProjectile::Defuse()
     if (!bHasExploded)
     {
         bIsArmed = false;
+        CancelFuse();
         GRENADE_PROJECTILE_LOG(Log, TEXT("Grenade defused"));
 
         // Stop trail effect
@@ -489,6 +481,24 @@ void ASuspenseCoreGrenadeProjectile::Defuse()
     }
 }
 
+void ASuspenseCoreGrenadeProjectile::OnFuseExpired(uint32 ExpiredFuseId)
+{
+    // Stale fuse (re-armed or cancelled after it was popped)
+    if (ExpiredFuseId != FuseId)
+    {
+        return;
+    }
+
+    FuseId = 0;
+    FuseTimerHandle.Invalidate();
+
+    if (HasAuthority() && bIsArmed && !bHasExploded)
+    {
+        GRENADE_PROJECTILE_LOG(Log, TEXT("Fuse expired - exploding"));
+        Explode();
+    }
+}
+
 //==================================================================
 // Physics Callbacks
 //==================================================================
@@ -537,6 +547,9 @@ void ASuspenseCoreGrenadeProjectile::Explode_Implementation()
 
     bHasExploded = true;
 
+    // ForceExplode / impact before the fuse ran out
+    CancelFuse();
+
     // Notify pre-explosion
     OnPreExplosion();
 
@@ -577,7 +590,8 @@ void ASuspenseCoreGrenadeProjectile::Explode_Implementation()
     GRENADE_PROJECTILE_LOG(Log, TEXT("Exploded at %s"), *GetActorLocation().ToString());
 
     // Destroy after short delay (allows effects to play)
-    SetLifeSpan(0.1f);
+    // Batched damage still needs this actor: OnExplosionResolved shortens the life span again
+    SetLifeSpan(bExplosionDamagePending ? 2.0f : 0.1f);
 }
 
 void ASuspenseCoreGrenadeProjectile::ApplyExplosionDamage()
@@ -595,6 +609,24 @@ void ASuspenseCoreGrenadeProjectile::ApplyExplosionDamage()
 
     FVector ExplosionLocation = GetActorLocation();
 
+    // Batched path: overlap, target dedupe and occlusion run on the subsystem tick
+    if (USuspenseCoreGrenadeSubsystem* GrenadeSubsystem = USuspenseCoreGrenadeSubsystem::Get(this))
+    {
+        FSuspenseCoreExplosionRequest Request;
+        Request.Grenade = this;
+        Request.Location = ExplosionLocation;
+        Request.Radius = OuterRadius;
+        Request.bCheckOcclusion = !bIgnoreWalls;
+        if (!bDamageInstigator && InstigatorActor.IsValid())
+        {
+            Request.IgnoreActors.Add(InstigatorActor);
+        }
+
+        GrenadeSubsystem->QueueExplosion(MoveTemp(Request));
+        bExplosionDamagePending = true;
+        return;
+    }
+
     // Find all actors in radius
     TArray<FOverlapResult> Overlaps;
     FCollisionShape CollisionShape;
@@ -617,15 +649,19 @@ void ASuspenseCoreGrenadeProjectile::ApplyExplosionDamage()
 
     GRENADE_PROJECTILE_LOG(Log, TEXT("ApplyExplosionDamage: Found %d potential targets"), Overlaps.Num());
 
-    // Process each target
+    // One entry per actor (an actor overlaps once per component)
+    TArray<AActor*, TInlineAllocator<16>> Targets;
     for (const FOverlapResult& Overlap : Overlaps)
     {
-        AActor* TargetActor = Overlap.GetActor();
-        if (!TargetActor)
+        if (AActor* TargetActor = Overlap.GetActor())
         {
-            continue;
+            Targets.AddUnique(TargetActor);
         }
+    }
 
+    // Process each target
+    for (AActor* TargetActor : Targets)
+    {
         // Check visibility (not blocked by wall)
         if (!bIgnoreWalls && !IsTargetVisible(TargetActor))
         {
@@ -633,101 +669,120 @@ void ASuspenseCoreGrenadeProjectile::ApplyExplosionDamage()
             continue;
         }
 
-        // Calculate distance
-        float Distance = FVector::Dist(ExplosionLocation, TargetActor->GetActorLocation());
+        ApplyExplosionToTarget(TargetActor, FVector::Dist(ExplosionLocation, TargetActor->GetActorLocation()));
+    }
+}
 
-        // Calculate damage
-        float Damage = CalculateDamageForTarget(TargetActor, Distance);
-        if (Damage <= 0.0f)
-        {
-            continue;
-        }
+bool ASuspenseCoreGrenadeProjectile::ApplyExplosionToTarget(AActor* TargetActor, float Distance)
+{
+    if (!TargetActor)
+    {
+        return false;
+    }
+
+    // Calculate damage
+    float Damage = CalculateDamageForTarget(TargetActor, Distance);
+    if (Damage <= 0.0f)
+    {
+        return false;
+    }
 
-        // Apply damage via GAS if available
-        UAbilitySystemComponent* TargetASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(TargetActor);
-        if (TargetASC)
+    // Apply damage via GAS if available
+    UAbilitySystemComponent* TargetASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(TargetActor);
+    if (TargetASC)
+    {
+        // Use configured damage effect or default to USuspenseCoreDamageEffect
+        TSubclassOf<UGameplayEffect> EffectToApply = DamageEffectClass;
+        if (!EffectToApply)
         {
-            // Use configured damage effect or default to USuspenseCoreDamageEffect
-            TSubclassOf<UGameplayEffect> EffectToApply = DamageEffectClass;
-            if (!EffectToApply)
-            {
-                EffectToApply = USuspenseCoreDamageEffect::StaticClass();
-            }
+            EffectToApply = USuspenseCoreDamageEffect::StaticClass();
+        }
 
-            // Create effect context
-            FGameplayEffectContextHandle EffectContext = TargetASC->MakeEffectContext();
-            EffectContext.AddSourceObject(this);
-            EffectContext.AddInstigator(InstigatorActor.Get(), this);
-            EffectContext.AddHitResult(FHitResult());
+        // Create effect context
+        FGameplayEffectContextHandle EffectContext = TargetASC->MakeEffectContext();
+        EffectContext.AddSourceObject(this);
+        EffectContext.AddInstigator(InstigatorActor.Get(), this);
+        EffectContext.AddHitResult(FHitResult());
 
-            // Create effect spec
-            FGameplayEffectSpecHandle SpecHandle = TargetASC->MakeOutgoingSpec(
-                EffectToApply, 1.0f, EffectContext);
+        // Create effect spec
+        FGameplayEffectSpecHandle SpecHandle = TargetASC->MakeOutgoingSpec(
+            EffectToApply, 1.0f, EffectContext);
 
-            if (SpecHandle.IsValid())
-            {
-                // Set damage value via SetByCaller (POSITIVE - PostGameplayEffectExecute handles IncomingDamage)
-                SpecHandle.Data->SetSetByCallerMagnitude(
-                    SuspenseCoreTags::Data::Damage, Damage);
+        if (SpecHandle.IsValid())
+        {
+            // Set damage value via SetByCaller (POSITIVE - PostGameplayEffectExecute handles IncomingDamage)
+            SpecHandle.Data->SetSetByCallerMagnitude(
+                SuspenseCoreTags::Data::Damage, Damage);
 
-                // Apply effect
-                TargetASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
+            // Apply effect
+            TargetASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
 
-                GRENADE_PROJECTILE_LOG(Log, TEXT("  Applied %.0f damage to %s (Distance=%.0f)"),
-                    Damage, *TargetActor->GetName(), Distance);
-            }
+            GRENADE_PROJECTILE_LOG(Log, TEXT("  Applied %.0f damage to %s (Distance=%.0f)"),
+                Damage, *TargetActor->GetName(), Distance);
         }
-        else
-        {
-            // Fallback: Apply damage via standard AActor::TakeDamage
-            FDamageEvent DamageEvent;
-            TargetActor->TakeDamage(Damage, DamageEvent, nullptr, InstigatorActor.Get());
+    }
+    else
+    {
+        // Fallback: Apply damage via standard AActor::TakeDamage
+        FDamageEvent DamageEvent;
+        TargetActor->TakeDamage(Damage, DamageEvent, nullptr, InstigatorActor.Get());
 
-            GRENADE_PROJECTILE_LOG(Log, TEXT("  Applied %.0f damage to %s (via TakeDamage)"),
-                Damage, *TargetActor->GetName());
-        }
+        GRENADE_PROJECTILE_LOG(Log, TEXT("  Applied %.0f damage to %s (via TakeDamage)"),
+            Damage, *TargetActor->GetName());
+    }
 
-        // Apply special effects based on grenade type
-        if (TargetASC)
+    // Apply special effects based on grenade type
+    if (TargetASC)
+    {
+        switch (GrenadeType)
         {
-            switch (GrenadeType)
-            {
-                case ESuspenseCoreGrenadeType::Flashbang:
-                    if (FlashbangEffectClass)
+            case ESuspenseCoreGrenadeType::Flashbang:
+                if (FlashbangEffectClass)
+                {
+                    FGameplayEffectContextHandle FlashContext = TargetASC->MakeEffectContext();
+                    FlashContext.AddSourceObject(this);
+                    FGameplayEffectSpecHandle FlashSpec = TargetASC->MakeOutgoingSpec(
+                        FlashbangEffectClass, 1.0f, FlashContext);
+                    if (FlashSpec.IsValid())
                     {
-                        FGameplayEffectContextHandle FlashContext = TargetASC->MakeEffectContext();
-                        FlashContext.AddSourceObject(this);
-                        FGameplayEffectSpecHandle FlashSpec = TargetASC->MakeOutgoingSpec(
-                            FlashbangEffectClass, 1.0f, FlashContext);
-                        if (FlashSpec.IsValid())
-                        {
-                            TargetASC->ApplyGameplayEffectSpecToSelf(*FlashSpec.Data.Get());
-                        }
+                        TargetASC->ApplyGameplayEffectSpecToSelf(*FlashSpec.Data.Get());
                     }
-                    break;
+                }
+                break;
 
-                case ESuspenseCoreGrenadeType::Incendiary:
-                    // Legacy instant effect (kept for backwards compatibility)
-                    if (IncendiaryEffectClass)
+            case ESuspenseCoreGrenadeType::Incendiary:
+                // Legacy instant effect (kept for backwards compatibility)
+                if (IncendiaryEffectClass)
+                {
+                    FGameplayEffectContextHandle FireContext = TargetASC->MakeEffectContext();
+                    FireContext.AddSourceObject(this);
+                    FGameplayEffectSpecHandle FireSpec = TargetASC->MakeOutgoingSpec(
+                        IncendiaryEffectClass, 1.0f, FireContext);
+                    if (FireSpec.IsValid())
                     {
-                        FGameplayEffectContextHandle FireContext = TargetASC->MakeEffectContext();
-                        FireContext.AddSourceObject(this);
-                        FGameplayEffectSpecHandle FireSpec = TargetASC->MakeOutgoingSpec(
-                            IncendiaryEffectClass, 1.0f, FireContext);
-                        if (FireSpec.IsValid())
-                        {
-                            TargetASC->ApplyGameplayEffectSpecToSelf(*FireSpec.Data.Get());
-                        }
+                        TargetASC->ApplyGameplayEffectSpecToSelf(*FireSpec.Data.Get());
                     }
-                    break;
-
-                default:
-                    break;
-            }
+                }
+                break;
 
-            // Apply DoT effects (Bleeding for Fragmentation, Burning for Incendiary)
-            ApplyDoTEffects(TargetActor, TargetASC, Distance);
+            default:
+                break;
         }
+
+        // Apply DoT effects (Bleeding for Fragmentation, Burning for Incendiary)
+        ApplyDoTEffects(TargetActor, TargetASC, Distance);
+    }
+
+    return true;
+}
+
+void ASuspenseCoreGrenadeProjectile::OnExplosionResolved()
+{
+    bExplosionDamagePending = false;
+
+    if (bHasExploded)
+    {
+        SetLifeSpan(0.1f);
     }
 }
 
@@ -868,9 +923,46 @@ void ASuspenseCoreGrenadeProjectile::ArmGrenade()
     bIsArmed = true;
     OnGrenadeArmed();
 
+    // Fuse is server-side; clients only show the armed state
+    if (HasAuthority())
+    {
+        CancelFuse();
+
+        if (USuspenseCoreGrenadeSubsystem* GrenadeSubsystem = USuspenseCoreGrenadeSubsystem::Get(this))
+        {
+            FuseId = GrenadeSubsystem->ScheduleFuse(this, ThrowTime + EffectiveFuseTime);
+        }
+        else
+        {
+            GetWorldTimerManager().SetTimer(FuseTimerHandle, FTimerDelegate::CreateUObject(
+                this, &ASuspenseCoreGrenadeProjectile::OnFuseExpired, 0u), EffectiveFuseTime, false);
+        }
+    }
+
     GRENADE_PROJECTILE_LOG(Log, TEXT("Grenade armed, EffectiveFuseTime=%.2f"), EffectiveFuseTime);
 }
 
+void ASuspenseCoreGrenadeProjectile::CancelFuse()
+{
+    if (FuseId != 0)
+    {
+        if (USuspenseCoreGrenadeSubsystem* GrenadeSubsystem = USuspenseCoreGrenadeSubsystem::Get(this))
+        {
+            GrenadeSubsystem->CancelFuse(FuseId);
+        }
+        FuseId = 0;
+    }
+
+    if (FuseTimerHandle.IsValid())
+    {
+        if (UWorld* World = GetWorld())
+        {
+            World->GetTimerManager().ClearTimer(FuseTimerHandle);
+        }
+        FuseTimerHandle.Invalidate();
+    }
+}
+
 void ASuspenseCoreGrenadeProjectile::PlayGrenadeSound(USoundBase* Sound)
 {
     if (!Sound)
@@ -950,12 +1042,12 @@ void ASuspenseCoreGrenadeProjectile::PublishExplosionEvent()
     EventData.Source = InstigatorActor.Get();
     EventData.Timestamp = FPlatformTime::Seconds();
 
-    EventData.StringPayload.Add(TEXT("GrenadeID"), GrenadeID.ToString());
-    EventData.VectorPayload.Add(TEXT("ExplosionLocation"), GetActorLocation());
-    EventData.FloatPayload.Add(TEXT("Damage"), BaseDamage);
-    EventData.FloatPayload.Add(TEXT("InnerRadius"), InnerRadius);
-    EventData.FloatPayload.Add(TEXT("OuterRadius"), OuterRadius);
-    EventData.IntPayload.Add(TEXT("GrenadeType"), static_cast<int32>(GrenadeType));
+    EventData.SetString(TEXT("GrenadeID"), GrenadeID.ToString());
+    EventData.SetVector(TEXT("ExplosionLocation"), GetActorLocation());
+    EventData.SetFloat(TEXT("Damage"), BaseDamage);
+    EventData.SetFloat(TEXT("InnerRadius"), InnerRadius);
+    EventData.SetFloat(TEXT("OuterRadius"), OuterRadius);
+    EventData.SetInt(TEXT("GrenadeType"), static_cast<int32>(GrenadeType));
 
     // Note: Using a generic tag here - you may want to add a specific tag
     // for grenade explosions in SuspenseCoreGameplayTags.h
@@ -11,6 +11,7 @@
 #include "SuspenseCore/Interfaces/Core/ISuspenseCoreLoadout.h"
 #include "SuspenseCore/Types/Inventory/SuspenseCoreInventoryTypes.h"
 #include "SuspenseCore/Services/SuspenseCoreLoadoutManager.h"
+#include "SuspenseCore/Tags/SuspenseCoreEquipmentNativeTags.h"
 
 // Define logging category
 DEFINE_LOG_CATEGORY(LogEquipmentDataStore);
@@ -97,8 +98,7 @@ void USuspenseCoreEquipmentDataStore::BeginPlay()
         if (USuspenseCoreEventBus* EventBus = EDM->GetEventBus())
         {
             // Subscribe to QuickSlot.Cleared - clear DataStore slot when QuickSlot is cleared
-            FGameplayTag QuickSlotClearedTag = FGameplayTag::RequestGameplayTag(
-                FName(TEXT("SuspenseCore.Event.Equipment.QuickSlot.Cleared")), false);
+            FGameplayTag QuickSlotClearedTag = SuspenseCoreEquipmentTags::QuickSlot::TAG_Equipment_Event_QuickSlot_Cleared;
 
             if (QuickSlotClearedTag.IsValid())
             {
@@ -121,8 +121,7 @@ void USuspenseCoreEquipmentDataStore::BeginPlay()
             }
 
             // Subscribe to QuickSlot.Assigned - update DataStore slot when item is assigned to QuickSlot
-            FGameplayTag QuickSlotAssignedTag = FGameplayTag::RequestGameplayTag(
-                FName(TEXT("SuspenseCore.Event.Equipment.QuickSlot.Assigned")), false);
+            FGameplayTag QuickSlotAssignedTag = SuspenseCoreEquipmentTags::QuickSlot::TAG_Equipment_Event_QuickSlot_Assigned;
 
             if (QuickSlotAssignedTag.IsValid())
             {
@@ -509,11 +508,11 @@ bool USuspenseCoreEquipmentDataStore::SetSlotItem(int32 SlotIndex, const FSuspen
 
             // Create delta event
             FEquipmentDelta Delta = CreateDelta(
-                FGameplayTag::RequestGameplayTag(TEXT("Equipment.Delta.ItemSet")),
+                SuspenseCoreEquipmentTags::Delta::TAG_Equipment_Delta_ItemSet,
                 SlotIndex,
                 PreviousItem,
                 ItemInstance,
-                FGameplayTag::RequestGameplayTag(TEXT("Equipment.Reason.DirectSet"))
+                SuspenseCoreEquipmentTags::Reason::TAG_Equipment_Reason_DirectSet
             );
             Delta.SourceTransactionId = Data.ActiveTransactionId;
 
@@ -570,11 +569,11 @@ FSuspenseCoreInventoryItemInstance USuspenseCoreEquipmentDataStore::ClearSlot(in
 
             // Create delta event
             FEquipmentDelta Delta = CreateDelta(
-                FGameplayTag::RequestGameplayTag(TEXT("Equipment.Delta.ItemClear")),
+                SuspenseCoreEquipmentTags::Delta::TAG_Equipment_Delta_ItemClear,
                 SlotIndex,
                 RemovedItem,
                 FSuspenseCoreInventoryItemInstance(),
-                FGameplayTag::RequestGameplayTag(TEXT("Equipment.Reason.DirectClear"))
+                SuspenseCoreEquipmentTags::Reason::TAG_Equipment_Reason_DirectClear
             );
             Delta.SourceTransactionId = Data.ActiveTransactionId;
 
@@ -622,11 +621,11 @@ bool USuspenseCoreEquipmentDataStore::InitializeSlots(const TArray<FEquipmentSlo
 
             // Create delta for reset
             FEquipmentDelta Delta = CreateDelta(
-                FGameplayTag::RequestGameplayTag(TEXT("Equipment.Delta.Initialize")),
+                SuspenseCoreEquipmentTags::Delta::TAG_Equipment_Delta_Initialize,
                 INDEX_NONE,
                 FSuspenseCoreInventoryItemInstance(),
                 FSuspenseCoreInventoryItemInstance(),
-                FGameplayTag::RequestGameplayTag(TEXT("Equipment.Reason.Initialize"))
+                SuspenseCoreEquipmentTags::Reason::TAG_Equipment_Reason_Initialize
             );
             Delta.Metadata.Add(TEXT("SlotCount"), FString::FromInt(Configurations.Num()));
             Delta.Metadata.Add(TEXT("PreviousCount"), FString::FromInt(PreviousSlotCount));
@@ -696,11 +695,11 @@ bool USuspenseCoreEquipmentDataStore::SetActiveWeaponSlot(int32 SlotIndex)
 
             // Create delta for active weapon change
             FEquipmentDelta Delta = CreateDelta(
-                FGameplayTag::RequestGameplayTag(TEXT("Equipment.Delta.ActiveWeapon")),
+                SuspenseCoreEquipmentTags::Delta::TAG_Equipment_Delta_ActiveWeapon,
                 SlotIndex,
                 FSuspenseCoreInventoryItemInstance(),
                 FSuspenseCoreInventoryItemInstance(),
-                FGameplayTag::RequestGameplayTag(TEXT("Equipment.Reason.ActiveChange"))
+                SuspenseCoreEquipmentTags::Reason::TAG_Equipment_Reason_ActiveChange
             );
             Delta.Metadata.Add(TEXT("PreviousSlot"), FString::FromInt(PreviousSlot));
             Delta.Metadata.Add(TEXT("NewSlot"), FString::FromInt(SlotIndex));
@@ -750,11 +749,11 @@ bool USuspenseCoreEquipmentDataStore::SetEquipmentState(const FGameplayTag& NewS
 
             // Create delta for state change
             FEquipmentDelta Delta = CreateDelta(
-                FGameplayTag::RequestGameplayTag(TEXT("Equipment.Delta.StateChange")),
+                SuspenseCoreEquipmentTags::Delta::TAG_Equipment_Delta_StateChange,
                 INDEX_NONE,
                 FSuspenseCoreInventoryItemInstance(),
                 FSuspenseCoreInventoryItemInstance(),
-                FGameplayTag::RequestGameplayTag(TEXT("Equipment.Reason.StateTransition"))
+                SuspenseCoreEquipmentTags::Reason::TAG_Equipment_Reason_StateTransition
             );
             Delta.Metadata.Add(TEXT("PreviousState"), PreviousState.ToString());
             Delta.Metadata.Add(TEXT("NewState"), NewState.ToString());
@@ -857,11 +856,11 @@ bool USuspenseCoreEquipmentDataStore::RestoreSnapshot(const FEquipmentStateSnaps
 
                         // Create delta for each changed slot
                         FEquipmentDelta Delta = CreateDelta(
-                            FGameplayTag::RequestGameplayTag(TEXT("Equipment.Delta.SnapshotRestore")),
+                            SuspenseCoreEquipmentTags::Delta::TAG_Equipment_Delta_SnapshotRestore,
                             SlotSnapshot.SlotIndex,
                             OldItem,
                             SlotSnapshot.ItemInstance,
-                            FGameplayTag::RequestGameplayTag(TEXT("Equipment.Reason.SnapshotRestore"))
+                            SuspenseCoreEquipmentTags::Reason::TAG_Equipment_Reason_SnapshotRestore
                         );
                         Delta.Metadata.Add(TEXT("SnapshotId"), Snapshot.SnapshotId.ToString());
 
@@ -930,25 +929,25 @@ bool USuspenseCoreEquipmentDataStore::RestoreSnapshot(const FEquipmentStateSnaps
 EEquipmentState USuspenseCoreEquipmentDataStore::ConvertTagToEquipmentState(const FGameplayTag& StateTag) const
 {
     // Маппинг тегов на enum значения
-    if (StateTag.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Idle"))))
+    if (StateTag.MatchesTag(SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Idle))
         return EEquipmentState::Idle;
-    else if (StateTag.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Equipping"))))
+    else if (StateTag.MatchesTag(SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Equipping))
         return EEquipmentState::Equipping;
-    else if (StateTag.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Unequipping"))))
+    else if (StateTag.MatchesTag(SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Unequipping))
         return EEquipmentState::Unequipping;
-    else if (StateTag.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Switching"))))
+    else if (StateTag.MatchesTag(SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Switching))
         return EEquipmentState::Switching;
-    else if (StateTag.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Reloading"))))
+    else if (StateTag.MatchesTag(SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Reloading))
         return EEquipmentState::Reloading;
-    else if (StateTag.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Inspecting"))))
+    else if (StateTag.MatchesTag(SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Inspecting))
         return EEquipmentState::Inspecting;
-    else if (StateTag.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Repairing"))))
+    else if (StateTag.MatchesTag(SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Repairing))
         return EEquipmentState::Repairing;
-    else if (StateTag.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Upgrading"))))
+    else if (StateTag.MatchesTag(SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Upgrading))
         return EEquipmentState::Upgrading;
-    else if (StateTag.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Locked"))))
+    else if (StateTag.MatchesTag(SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Locked))
         return EEquipmentState::Locked;
-    else if (StateTag.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Error"))))
+    else if (StateTag.MatchesTag(SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Error))
         return EEquipmentState::Error;
     else
         return EEquipmentState::Idle; // Default
@@ -960,27 +959,27 @@ FGameplayTag USuspenseCoreEquipmentDataStore::ConvertEquipmentStateToTag(EEquipm
     switch (State)
     {
         case EEquipmentState::Idle:
-            return FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Idle"));
+            return SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Idle;
         case EEquipmentState::Equipping:
-            return FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Equipping"));
+            return SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Equipping;
         case EEquipmentState::Unequipping:
-            return FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Unequipping"));
+            return SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Unequipping;
         case EEquipmentState::Switching:
-            return FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Switching"));
+            return SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Switching;
         case EEquipmentState::Reloading:
-            return FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Reloading"));
+            return SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Reloading;
         case EEquipmentState::Inspecting:
-            return FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Inspecting"));
+            return SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Inspecting;
         case EEquipmentState::Repairing:
-            return FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Repairing"));
+            return SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Repairing;
         case EEquipmentState::Upgrading:
-            return FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Upgrading"));
+            return SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Upgrading;
         case EEquipmentState::Locked:
-            return FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Locked"));
+            return SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Locked;
         case EEquipmentState::Error:
-            return FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Error"));
+            return SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Error;
         default:
-            return FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Idle"));
+            return SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Idle;
     }
 }
 
@@ -1128,11 +1127,11 @@ void USuspenseCoreEquipmentDataStore::ResetToDefault()
                 {
                     // Create delta for each cleared item
                     FEquipmentDelta Delta = CreateDelta(
-                        FGameplayTag::RequestGameplayTag(TEXT("Equipment.Delta.Reset")),
+                        SuspenseCoreEquipmentTags::Delta::TAG_Equipment_Delta_Reset,
                         i,
                         Data.SlotItems[i],
                         FSuspenseCoreInventoryItemInstance(),
-                        FGameplayTag::RequestGameplayTag(TEXT("Equipment.Reason.ResetToDefault"))
+                        SuspenseCoreEquipmentTags::Reason::TAG_Equipment_Reason_ResetToDefault
                     );
 
                     FSuspenseCorePendingEventData DeltaEvent;
@@ -1146,7 +1145,7 @@ void USuspenseCoreEquipmentDataStore::ResetToDefault()
 
             // Reset state
             Data.ActiveWeaponSlot = INDEX_NONE;
-            Data.CurrentState = FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Idle"));
+            Data.CurrentState = SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Idle;
             Data.DataVersion = 0;
             Data.LastModified = FDateTime::Now();
             Data.ActiveTransactionId.Invalidate();
@@ -1286,7 +1285,7 @@ void USuspenseCoreEquipmentDataStore::BroadcastPendingEvents(const TArray<FSuspe
                             // This will take the lock internally if needed
                             FEquipmentSlotConfig Config = GetSlotConfiguration(Event.SlotIndex);
 
-                            FGameplayTag SlotType = FGameplayTag::RequestGameplayTag(TEXT("Equipment.Slot.Unknown"));
+                            FGameplayTag SlotType = SuspenseCoreEquipmentTags::Slot::TAG_Equipment_Slot_Unknown;
                             if (Config.IsValid())
                             {
                                 SlotType = Config.SlotTag;
@@ -1324,13 +1323,13 @@ void USuspenseCoreEquipmentDataStore::BroadcastPendingEvents(const TArray<FSuspe
                                 }
 
                                 EventBus->Publish(
-                                    FGameplayTag::RequestGameplayTag(TEXT("Equipment.Event.SlotUpdated")),
+                                    SuspenseCoreEquipmentTags::Event::TAG_Equipment_Event_SlotUpdated,
                                     SlotEventData
                                 );
 
                                 FSuspenseCoreEventData UpdateEventData = FSuspenseCoreEventData::Create(this);
                                 EventBus->Publish(
-                                    FGameplayTag::RequestGameplayTag(TEXT("Equipment.Event.Updated")),
+                                    SuspenseCoreEquipmentTags::Event::TAG_Equipment_Event_Updated,
                                     UpdateEventData
                                 );
                             }
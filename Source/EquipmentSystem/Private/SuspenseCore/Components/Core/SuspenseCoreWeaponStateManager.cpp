@@ -8,6 +8,7 @@
 #include "Modules/ModuleManager.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
+#include "SuspenseCore/Tags/SuspenseCoreEquipmentNativeTags.h"
 
 USuspenseCoreWeaponStateManager::USuspenseCoreWeaponStateManager()
 {
@@ -30,62 +31,62 @@ void USuspenseCoreWeaponStateManager::InitializeDefaultTransitions()
     }
 
     // Initialize default states (deferred from constructor)
-    DefaultIdleState = FGameplayTag::RequestGameplayTag(FName(TEXT("Weapon.State.Ready")), false);
-    DefaultHolsteredState = FGameplayTag::RequestGameplayTag(FName(TEXT("Weapon.State.Holstered")), false);
+    DefaultIdleState = SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Ready;
+    DefaultHolsteredState = SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Holstered;
 
     // Setup default transitions (deferred from constructor to avoid static init order issues)
     FSuspenseCoreStateTransitionDef DrawTransition;
-    DrawTransition.FromState = FGameplayTag::RequestGameplayTag(FName(TEXT("Weapon.State.Holstered")), false);
-    DrawTransition.ToState = FGameplayTag::RequestGameplayTag(FName(TEXT("Weapon.State.Drawing")), false);
+    DrawTransition.FromState = SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Holstered;
+    DrawTransition.ToState = SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Drawing;
     DrawTransition.Duration = 0.5f;
     DrawTransition.bInterruptible = false;
     TransitionDefinitions.Add(DrawTransition);
 
     FSuspenseCoreStateTransitionDef DrawCompleteTransition;
-    DrawCompleteTransition.FromState = FGameplayTag::RequestGameplayTag(FName(TEXT("Weapon.State.Drawing")), false);
-    DrawCompleteTransition.ToState = FGameplayTag::RequestGameplayTag(FName(TEXT("Weapon.State.Ready")), false);
+    DrawCompleteTransition.FromState = SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Drawing;
+    DrawCompleteTransition.ToState = SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Ready;
     DrawCompleteTransition.Duration = 0.1f;
     DrawCompleteTransition.bInterruptible = false;
     TransitionDefinitions.Add(DrawCompleteTransition);
 
     FSuspenseCoreStateTransitionDef HolsterTransition;
-    HolsterTransition.FromState = FGameplayTag::RequestGameplayTag(FName(TEXT("Weapon.State.Ready")), false);
-    HolsterTransition.ToState = FGameplayTag::RequestGameplayTag(FName(TEXT("Weapon.State.Holstering")), false);
+    HolsterTransition.FromState = SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Ready;
+    HolsterTransition.ToState = SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Holstering;
     HolsterTransition.Duration = 0.4f;
     HolsterTransition.bInterruptible = true;
     TransitionDefinitions.Add(HolsterTransition);
 
     FSuspenseCoreStateTransitionDef HolsterCompleteTransition;
-    HolsterCompleteTransition.FromState = FGameplayTag::RequestGameplayTag(FName(TEXT("Weapon.State.Holstering")), false);
-    HolsterCompleteTransition.ToState = FGameplayTag::RequestGameplayTag(FName(TEXT("Weapon.State.Holstered")), false);
+    HolsterCompleteTransition.FromState = SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Holstering;
+    HolsterCompleteTransition.ToState = SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Holstered;
     HolsterCompleteTransition.Duration = 0.1f;
     HolsterCompleteTransition.bInterruptible = false;
     TransitionDefinitions.Add(HolsterCompleteTransition);
 
     FSuspenseCoreStateTransitionDef FireTransition;
-    FireTransition.FromState = FGameplayTag::RequestGameplayTag(FName(TEXT("Weapon.State.Ready")), false);
-    FireTransition.ToState = FGameplayTag::RequestGameplayTag(FName(TEXT("Weapon.State.Firing")), false);
+    FireTransition.FromState = SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Ready;
+    FireTransition.ToState = SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Firing;
     FireTransition.Duration = 0.0f; // Instant
     FireTransition.bInterruptible = true;
     TransitionDefinitions.Add(FireTransition);
 
     FSuspenseCoreStateTransitionDef FireEndTransition;
-    FireEndTransition.FromState = FGameplayTag::RequestGameplayTag(FName(TEXT("Weapon.State.Firing")), false);
-    FireEndTransition.ToState = FGameplayTag::RequestGameplayTag(FName(TEXT("Weapon.State.Ready")), false);
+    FireEndTransition.FromState = SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Firing;
+    FireEndTransition.ToState = SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Ready;
     FireEndTransition.Duration = 0.1f;
     FireEndTransition.bInterruptible = true;
     TransitionDefinitions.Add(FireEndTransition);
 
     FSuspenseCoreStateTransitionDef ReloadTransition;
-    ReloadTransition.FromState = FGameplayTag::RequestGameplayTag(FName(TEXT("Weapon.State.Ready")), false);
-    ReloadTransition.ToState = FGameplayTag::RequestGameplayTag(FName(TEXT("Weapon.State.Reloading")), false);
+    ReloadTransition.FromState = SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Ready;
+    ReloadTransition.ToState = SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Reloading;
     ReloadTransition.Duration = 2.0f;
     ReloadTransition.bInterruptible = false;
     TransitionDefinitions.Add(ReloadTransition);
 
     FSuspenseCoreStateTransitionDef ReloadCompleteTransition;
-    ReloadCompleteTransition.FromState = FGameplayTag::RequestGameplayTag(FName(TEXT("Weapon.State.Reloading")), false);
-    ReloadCompleteTransition.ToState = FGameplayTag::RequestGameplayTag(FName(TEXT("Weapon.State.Ready")), false);
+    ReloadCompleteTransition.FromState = SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Reloading;
+    ReloadCompleteTransition.ToState = SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Ready;
     ReloadCompleteTransition.Duration = 0.2f;
     ReloadCompleteTransition.bInterruptible = false;
     TransitionDefinitions.Add(ReloadCompleteTransition);
@@ -170,7 +171,7 @@ FGameplayTag USuspenseCoreWeaponStateManager::GetWeaponState(int32 SlotIndex) co
 
     if (SlotIndex == INDEX_NONE)
     {
-        return FGameplayTag::RequestGameplayTag(TEXT("Weapon.State.None"));
+        return SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_None;
     }
 
     const FSuspenseCoreWeaponStateMachine* StateMachine = StateMachines.FindByPredicate(
@@ -181,7 +182,7 @@ FGameplayTag USuspenseCoreWeaponStateManager::GetWeaponState(int32 SlotIndex) co
         return StateMachine->CurrentState;
     }
 
-    return FGameplayTag::RequestGameplayTag(TEXT("Weapon.State.None"));
+    return SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_None;
 }
 
 FSuspenseCoreWeaponStateTransitionResult USuspenseCoreWeaponStateManager::RequestStateTransition(const FSuspenseCoreWeaponStateTransitionRequest& Request)
@@ -327,24 +328,24 @@ float USuspenseCoreWeaponStateManager::GetTransitionDuration(const FGameplayTag&
     }
 
     // Default durations for common transitions
-    if (FromState == FGameplayTag::RequestGameplayTag(TEXT("Weapon.State.Holstered")))
+    if (FromState == SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Holstered)
     {
-        if (ToState == FGameplayTag::RequestGameplayTag(TEXT("Weapon.State.Drawing")))
+        if (ToState == SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Drawing)
         {
             return 0.5f;
         }
     }
-    else if (FromState == FGameplayTag::RequestGameplayTag(TEXT("Weapon.State.Ready")))
+    else if (FromState == SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Ready)
     {
-        if (ToState == FGameplayTag::RequestGameplayTag(TEXT("Weapon.State.Holstering")))
+        if (ToState == SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Holstering)
         {
             return 0.4f;
         }
-        else if (ToState == FGameplayTag::RequestGameplayTag(TEXT("Weapon.State.Reloading")))
+        else if (ToState == SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Reloading)
         {
             return 2.0f;
         }
-        else if (ToState == FGameplayTag::RequestGameplayTag(TEXT("Weapon.State.Firing")))
+        else if (ToState == SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Firing)
         {
             return 0.0f; // Instant
         }
@@ -553,17 +554,17 @@ void USuspenseCoreWeaponStateManager::CompleteTransition(int32 SlotIndex)
     TArray<FGameplayTag> ValidNextStates = GetValidTransitions(StateMachine->CurrentState);
 
     // Auto-transition for intermediate states
-    if (StateMachine->CurrentState == FGameplayTag::RequestGameplayTag(TEXT("Weapon.State.Drawing")))
+    if (StateMachine->CurrentState == SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Drawing)
     {
         FSuspenseCoreWeaponStateTransitionRequest AutoTransition;
-        AutoTransition.ToState = FGameplayTag::RequestGameplayTag(TEXT("Weapon.State.Ready"));
+        AutoTransition.ToState = SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Ready;
         AutoTransition.WeaponSlotIndex = SlotIndex;
         RequestStateTransition(AutoTransition);
     }
-    else if (StateMachine->CurrentState == FGameplayTag::RequestGameplayTag(TEXT("Weapon.State.Holstering")))
+    else if (StateMachine->CurrentState == SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Holstering)
     {
         FSuspenseCoreWeaponStateTransitionRequest AutoTransition;
-        AutoTransition.ToState = FGameplayTag::RequestGameplayTag(TEXT("Weapon.State.Holstered"));
+        AutoTransition.ToState = SuspenseCoreEquipmentTags::WeaponState::TAG_Weapon_State_Holstered;
         AutoTransition.WeaponSlotIndex = SlotIndex;
         RequestStateTransition(AutoTransition);
     }
@@ -629,7 +630,7 @@ void USuspenseCoreWeaponStateManager::BroadcastStateChange(int32 SlotIndex, cons
     Ev.SetString(FName("From"), OldState.ToString());
     Ev.SetString(FName("To"), NewState.ToString());
 
-    EventDispatcher->Publish(FGameplayTag::RequestGameplayTag(TEXT("SuspenseCore.Event.Weapon.StateChanged")), Ev);
+    EventDispatcher->Publish(SuspenseCoreEquipmentTags::Event::TAG_Equipment_Event_Weapon_StateChanged, Ev);
 }
 
 //==================================================================
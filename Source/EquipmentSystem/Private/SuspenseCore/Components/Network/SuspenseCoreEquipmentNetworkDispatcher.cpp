@@ -5,6 +5,8 @@
 #include "SuspenseCore/Services/SuspenseCoreEquipmentNetworkService.h"
 #include "Engine/World.h"
 #include "Engine/NetDriver.h"
+#include "Engine/NetConnection.h"
+#include "Engine/ActorChannel.h"
 #include "GameFramework/PlayerController.h"
 #include "TimerManager.h"
 #include "Misc/SecureHash.h"
@@ -91,6 +93,311 @@ FNetworkOperationRequest USuspenseCoreEquipmentNetworkDispatcher::FromNet(const
 	return Out;
 }
 
+// ----------------------------------------------------
+// FSuspenseCoreNetworkBatchNet: bit-packed батч
+// ----------------------------------------------------
+
+namespace
+{
+	constexpr int32 BatchSlotWidthBits = 6;   // ширина слота 0..32
+	constexpr int32 BatchOperationBits = 4;   // EEquipmentOperationType (15 значений)
+	constexpr int32 BatchPriorityBits  = 2;   // ENetworkOperationPriority
+
+	/** INDEX_NONE -> 0, слот N -> N + 1 */
+	uint32 EncodeSlotIndex(int32 Slot)
+	{
+		return Slot < 0 ? 0u : static_cast<uint32>(Slot) + 1u;
+	}
+
+	int32 DecodeSlotIndex(uint32 Encoded)
+	{
+		return Encoded == 0 ? INDEX_NONE : static_cast<int32>(Encoded - 1u);
+	}
+
+	void SerializeEnumBits(FArchive& Ar, uint8& Value, int32 NumBits)
+	{
+		uint32 Bits = Value;
+		SuspenseCoreNetPacking::SerializeBits(Ar, Bits, NumBits);
+		Value = static_cast<uint8>(Bits);
+	}
+}
+
+bool FSuspenseCoreNetworkBatchNet::NetSerialize(FArchive& Ar, UPackageMap* /*Map*/, bool& bOutSuccess)
+{
+	using namespace SuspenseCoreNetPacking;
+
+	Ar << BatchId;
+
+	uint32 Count = static_cast<uint32>(FMath::Min(Requests.Num(), MaxRequests));
+	Ar.SerializeIntPacked(Count);
+	if (Ar.IsLoading())
+	{
+		if (Count > static_cast<uint32>(MaxRequests) || Ar.IsError())
+		{
+			Ar.SetError();
+			bOutSuccess = false;
+			return false;
+		}
+		Requests.SetNum(static_cast<int32>(Count));
+	}
+
+	// Заголовок: ширина слотов и поля, одинаковые для всего батча
+	uint32 SlotBits = 0;
+	uint32 bSharedOperation = Count > 0 ? 1 : 0;
+	uint32 bSharedPriority  = Count > 0 ? 1 : 0;
+	uint32 bSharedItemID    = Count > 0 ? 1 : 0;
+	if (Ar.IsSaving())
+	{
+		const FSuspenseCoreNetworkOperationRequestNet* First = Count > 0 ? &Requests[0] : nullptr;
+		for (uint32 Index = 0; Index < Count; ++Index)
+		{
+			const FSuspenseCoreEquipmentOperationNet& Op = Requests[Index].Operation;
+			SlotBits = FMath::Max(SlotBits, static_cast<uint32>(FMath::Max(
+				BitsFor(EncodeSlotIndex(Op.SourceSlotIndex)), BitsFor(EncodeSlotIndex(Op.TargetSlotIndex)))));
+			bSharedOperation &= Op.OperationType == First->Operation.OperationType ? 1 : 0;
+			bSharedPriority  &= Op.Priority == First->Operation.Priority ? 1 : 0;
+			bSharedItemID    &= Op.ItemInstance.ItemID == First->Operation.ItemInstance.ItemID ? 1 : 0;
+		}
+	}
+
+	SerializeBits(Ar, SlotBits, BatchSlotWidthBits);
+	SerializeBits(Ar, bSharedOperation, 1);
+	SerializeBits(Ar, bSharedPriority, 1);
+	SerializeBits(Ar, bSharedItemID, 1);
+	if (SlotBits > 32)
+	{
+		Ar.SetError();
+	}
+
+	uint8 SharedOperation = Count > 0 ? static_cast<uint8>(Requests[0].Operation.OperationType) : 0;
+	uint8 SharedPriority  = Count > 0 ? static_cast<uint8>(Requests[0].Operation.Priority) : 0;
+	FName SharedItemID    = Count > 0 ? Requests[0].Operation.ItemInstance.ItemID : NAME_None;
+	if (bSharedOperation) { SerializeEnumBits(Ar, SharedOperation, BatchOperationBits); }
+	if (bSharedPriority)  { SerializeEnumBits(Ar, SharedPriority, BatchPriorityBits); }
+	if (bSharedItemID)    { UPackageMap::StaticSerializeName(Ar, SharedItemID); }
+
+	uint32 PrevTimeMs = 0;
+	for (uint32 Index = 0; Index < Count && !Ar.IsError(); ++Index)
+	{
+		FSuspenseCoreNetworkOperationRequestNet& Request = Requests[Index];
+		FSuspenseCoreEquipmentOperationNet& Op = Request.Operation;
+		FSuspenseCoreInventoryItemInstanceNet& Item = Op.ItemInstance;
+
+		Ar << Request.RequestId;
+
+		uint8 OperationType = bSharedOperation ? SharedOperation : static_cast<uint8>(Op.OperationType);
+		uint8 Priority      = bSharedPriority ? SharedPriority : static_cast<uint8>(Op.Priority);
+		if (!bSharedOperation) { SerializeEnumBits(Ar, OperationType, BatchOperationBits); }
+		if (!bSharedPriority)  { SerializeEnumBits(Ar, Priority, BatchPriorityBits); }
+
+		uint32 Source = EncodeSlotIndex(Op.SourceSlotIndex);
+		uint32 Target = EncodeSlotIndex(Op.TargetSlotIndex);
+		SerializeBits(Ar, Source, static_cast<int32>(SlotBits));
+		SerializeBits(Ar, Target, static_cast<int32>(SlotBits));
+
+		// Время: первая запись целиком, дальше дельта от предыдущей
+		uint32 TimeMs = ToMilliseconds(Request.Timestamp);
+		if (Index == 0)
+		{
+			Ar.SerializeIntPacked(TimeMs);
+		}
+		else
+		{
+			int32 TimeDelta = static_cast<int32>(TimeMs - PrevTimeMs);
+			SerializeZigZag(Ar, TimeDelta);
+			TimeMs = PrevTimeMs + static_cast<uint32>(TimeDelta);
+		}
+		PrevTimeMs = TimeMs;
+
+		// Предмет: флаги присутствия, затем поля
+		uint32 bHasInstance = Item.InstanceID.IsValid() ? 1 : 0;
+		uint32 bRotated     = Item.bIsRotated ? 1 : 0;
+		uint32 bHasUseTime  = Item.LastUsedTime > 0.f ? 1 : 0;
+		SerializeBits(Ar, bHasInstance, 1);
+		SerializeBits(Ar, bRotated, 1);
+		SerializeBits(Ar, bHasUseTime, 1);
+
+		FName ItemID = bSharedItemID ? SharedItemID : Item.ItemID;
+		if (!bSharedItemID) { UPackageMap::StaticSerializeName(Ar, ItemID); }
+
+		FGuid InstanceID = Item.InstanceID;
+		if (bHasInstance) { Ar << InstanceID; }
+
+		int32 Quantity = Item.Quantity;
+		SerializeZigZag(Ar, Quantity);
+
+		uint32 Anchor = EncodeSlotIndex(Item.AnchorIndex);
+		Ar.SerializeIntPacked(Anchor);
+
+		uint32 UseTimeMs = ToMilliseconds(Item.LastUsedTime);
+		if (bHasUseTime) { Ar.SerializeIntPacked(UseTimeMs); }
+
+		if (Ar.IsLoading())
+		{
+			Request.Timestamp    = FromMilliseconds(TimeMs);
+			Op.OperationType     = static_cast<EEquipmentOperationType>(OperationType);
+			Op.Priority          = static_cast<ENetworkOperationPriority>(Priority);
+			Op.SourceSlotIndex   = DecodeSlotIndex(Source);
+			Op.TargetSlotIndex   = DecodeSlotIndex(Target);
+			Item.ItemID          = ItemID;
+			Item.InstanceID      = bHasInstance ? InstanceID : FGuid();
+			Item.Quantity        = Quantity;
+			Item.AnchorIndex     = DecodeSlotIndex(Anchor);
+			Item.bIsRotated      = bRotated != 0;
+			Item.LastUsedTime    = bHasUseTime ? FromMilliseconds(UseTimeMs) : 0.f;
+		}
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return bOutSuccess;
+}
+
+// ----------------------------------------------------
+// FSuspenseCoreIdempotencyCache
+// ----------------------------------------------------
+
+void FSuspenseCoreIdempotencyCache::Reset(int32 InCapacity)
+{
+	Capacity = FMath::Max(1, InCapacity);
+
+	// Load factor <= 0.5: короткие цепочки проб даже на тысячах записей
+	const uint32 NumSlots = FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(16, Capacity * 2)));
+	Slots.Reset();
+	Slots.SetNum(static_cast<int32>(NumSlots));
+	SlotMask = NumSlots - 1;
+
+	Ring.Reset();
+	Head    = 0;
+	Count   = 0;
+	NumLive = 0;
+}
+
+uint32 FSuspenseCoreIdempotencyCache::HashId(const FGuid& Id)
+{
+	// RequestId случайный (FGuid::NewGuid), достаточно перемешать 64 бита
+	uint64 H = (static_cast<uint64>(Id.A ^ Id.C) << 32) | static_cast<uint64>(Id.B ^ Id.D);
+	H ^= H >> 33;
+	H *= 0xff51afd7ed558ccdULL;
+	H ^= H >> 33;
+	return static_cast<uint32>(H);
+}
+
+int32 FSuspenseCoreIdempotencyCache::FindSlot(const FGuid& Id, uint32 Hash) const
+{
+	if (Slots.Num() == 0) { return INDEX_NONE; }
+
+	for (uint32 Slot = Hash & SlotMask; ; Slot = (Slot + 1) & SlotMask)
+	{
+		const FSlot& S = Slots[Slot];
+		if (S.RingIndex == INDEX_NONE)
+		{
+			return INDEX_NONE;
+		}
+		if (S.Hash == Hash && Ring[S.RingIndex].RequestId == Id)
+		{
+			return static_cast<int32>(Slot);
+		}
+	}
+}
+
+void FSuspenseCoreIdempotencyCache::RemoveSlot(int32 SlotIndex)
+{
+	uint32 Hole = static_cast<uint32>(SlotIndex);
+	for (uint32 Next = (Hole + 1) & SlotMask; Slots[Next].RingIndex != INDEX_NONE; Next = (Next + 1) & SlotMask)
+	{
+		// Запись может занять дыру, если её домашний слот не лежит в (Hole, Next]
+		const uint32 Home = Slots[Next].Hash & SlotMask;
+		if (((Next - Home) & SlotMask) >= ((Next - Hole) & SlotMask))
+		{
+			Slots[Hole] = Slots[Next];
+			Hole = Next;
+		}
+	}
+	Slots[Hole] = FSlot();
+}
+
+void FSuspenseCoreIdempotencyCache::PopHead()
+{
+	FSuspenseCoreIdempotencyEntry& Oldest = Ring[Head];
+	if (Oldest.RequestId.IsValid())
+	{
+		const int32 Slot = FindSlot(Oldest.RequestId, HashId(Oldest.RequestId));
+		if (Slot != INDEX_NONE)
+		{
+			RemoveSlot(Slot);
+		}
+		--NumLive;
+	}
+
+	Oldest = FSuspenseCoreIdempotencyEntry();
+	Head = (Head + 1) % Capacity;
+	--Count;
+}
+
+const FSuspenseCoreIdempotencyEntry* FSuspenseCoreIdempotencyCache::Find(const FGuid& RequestId) const
+{
+	const int32 Slot = FindSlot(RequestId, HashId(RequestId));
+	return Slot != INDEX_NONE ? &Ring[Slots[Slot].RingIndex] : nullptr;
+}
+
+void FSuspenseCoreIdempotencyCache::Add(const FSuspenseCoreIdempotencyEntry& Entry)
+{
+	if (!Entry.RequestId.IsValid()) { return; }
+	if (Slots.Num() == 0) { Reset(Capacity); }
+
+	const uint32 Hash = HashId(Entry.RequestId);
+
+	// Повтор: гасим старую позицию, иначе кольцо перестанет быть упорядоченным по времени
+	const int32 Existing = FindSlot(Entry.RequestId, Hash);
+	if (Existing != INDEX_NONE)
+	{
+		Ring[Slots[Existing].RingIndex].RequestId.Invalidate();
+		RemoveSlot(Existing);
+		--NumLive;
+	}
+
+	if (Count == Capacity)
+	{
+		PopHead();
+	}
+
+	const int32 Tail = (Head + Count) % Capacity;
+	if (Tail == Ring.Num())
+	{
+		Ring.Add(Entry);
+	}
+	else
+	{
+		Ring[Tail] = Entry;
+	}
+	++Count;
+	++NumLive;
+
+	uint32 Slot = Hash & SlotMask;
+	while (Slots[Slot].RingIndex != INDEX_NONE)
+	{
+		Slot = (Slot + 1) & SlotMask;
+	}
+	Slots[Slot].Hash      = Hash;
+	Slots[Slot].RingIndex = Tail;
+}
+
+int32 FSuspenseCoreIdempotencyCache::RemoveExpired(float Now, float Lifetime)
+{
+	int32 Removed = 0;
+	while (Count > 0)
+	{
+		const FSuspenseCoreIdempotencyEntry& Oldest = Ring[Head];
+		if (Oldest.RequestId.IsValid() && (Now - Oldest.Timestamp) <= Lifetime)
+		{
+			break;
+		}
+		Removed += Oldest.RequestId.IsValid() ? 1 : 0;
+		PopHead();
+	}
+	return Removed;
+}
+
 // ----------------------------------------------------
 
 USuspenseCoreEquipmentNetworkDispatcher::USuspenseCoreEquipmentNetworkDispatcher()
@@ -105,6 +412,14 @@ void USuspenseCoreEquipmentNetworkDispatcher::BeginPlay()
 {
 	Super::BeginPlay();
 
+	CurrentBatchSize = FMath::Clamp(MaxBatchSize, 1, FSuspenseCoreNetworkBatchNet::MaxRequests);
+	Statistics.CurrentBatchSize = CurrentBatchSize;
+
+	{
+		FScopeLock Lock(&IdempotencyLock);
+		IdempotencyCache.Reset(MaxIdempotencyCacheSize);
+	}
+
 	UE_LOG(LogSuspenseCoreEquipmentNetwork, Log, TEXT("NetworkDispatcher: Initialized for %s with role %s"),
 		*GetNameSafe(GetOwner()),
 		*UEnum::GetValueAsString(GetOwnerRole()));
@@ -116,9 +431,11 @@ void USuspenseCoreEquipmentNetworkDispatcher::EndPlay(const EEndPlayReason::Type
 		FScopeLock Lock(&QueueLock);
 		for (const FSuspenseCoreOperationQueueEntry& Entry : OperationQueue)
 		{
-			OnOperationTimeout.Broadcast(Entry.Request.RequestId);
+			if (!Entry.bRemoved) { OnOperationTimeout.Broadcast(Entry.Request.RequestId); }
 		}
 		OperationQueue.Empty();
+		QueueIndex.Empty();
+		NumRemovedQueueEntries = 0;
 		ActiveBatches.Empty();
 	}
 	{
@@ -150,10 +467,11 @@ void USuspenseCoreEquipmentNetworkDispatcher::TickComponent(float DeltaTime, ELe
 			LastIdempotencyCleanup = CurrentTime;
 		}
 
+		// HandleTimeout только помечает записи bRemoved, массив не двигается
 		FScopeLock Lock(&QueueLock);
 		for (FSuspenseCoreOperationQueueEntry& Entry : OperationQueue)
 		{
-			if (Entry.bInProgress && CurrentTime - Entry.LastAttemptTime > CurrentTimeout)
+			if (!Entry.bRemoved && Entry.bInProgress && CurrentTime - Entry.LastAttemptTime > CurrentTimeout)
 			{
 				HandleTimeout(Entry.Request.RequestId);
 			}
@@ -183,7 +501,7 @@ FGuid USuspenseCoreEquipmentNetworkDispatcher::SendOperationToServer(const FNetw
 	{
 		FScopeLock Lock(&QueueLock);
 
-		if (OperationQueue.Num() >= MaxQueueSize)
+		if (QueueIndex.Num() >= MaxQueueSize)
 		{
 			UE_LOG(LogSuspenseCoreEquipmentNetwork, Warning, TEXT("SendOperationToServer: Queue is full"));
 			return FGuid();
@@ -194,8 +512,7 @@ FGuid USuspenseCoreEquipmentNetworkDispatcher::SendOperationToServer(const FNetw
 		Entry.QueueTime   = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
 		Entry.RequestHash = CalculateRequestHash(Request);
 
-		OperationQueue.Add(Entry);
-		Statistics.CurrentQueueSize = OperationQueue.Num();
+		AddQueueEntry(Entry);
 	}
 
 	return Request.RequestId;
@@ -218,6 +535,14 @@ void USuspenseCoreEquipmentNetworkDispatcher::HandleServerResponse(const FNetwor
 		return;
 	}
 
+	// RTT от фактической отправки (для батчей LastAttemptTime ставит SendBatch)
+	if (Entry->bInProgress && Entry->LastAttemptTime > 0.0f && GetWorld())
+	{
+		const float Rtt = GetWorld()->GetTimeSeconds() - Entry->LastAttemptTime;
+		RecordRttSample(Rtt);
+		if (Response.Latency <= 0.0f) { UpdateResponseTimeStats(Rtt); }
+	}
+
 	Entry->bInProgress = false;
 
 	if (Response.bSuccess)
@@ -227,8 +552,7 @@ void USuspenseCoreEquipmentNetworkDispatcher::HandleServerResponse(const FNetwor
 		OnServerResponse.Broadcast(Response.RequestId, Response.Result);
 
 		FScopeLock Lock(&QueueLock);
-		OperationQueue.RemoveAll([&](const FSuspenseCoreOperationQueueEntry& E){ return E.Request.RequestId == Response.RequestId; });
-		Statistics.CurrentQueueSize = OperationQueue.Num();
+		RemoveQueueEntry(Response.RequestId);
 	}
 	else
 	{
@@ -252,8 +576,7 @@ void USuspenseCoreEquipmentNetworkDispatcher::HandleServerResponse(const FNetwor
 				Response.RequestId, Response.Result.ErrorMessage, Response.Result.FailureType));
 
 			FScopeLock Lock(&QueueLock);
-			OperationQueue.RemoveAll([&](const FSuspenseCoreOperationQueueEntry& E){ return E.Request.RequestId == Response.RequestId; });
-			Statistics.CurrentQueueSize = OperationQueue.Num();
+			RemoveQueueEntry(Response.RequestId);
 		}
 	}
 }
@@ -277,7 +600,7 @@ FGuid USuspenseCoreEquipmentNetworkDispatcher::BatchOperations(const TArray<FNet
 				UE_LOG(LogSuspenseCoreEquipmentNetwork, Warning, TEXT("BatchOperations: security failed for %s"), *R.RequestId.ToString());
 				continue;
 			}
-			if (OperationQueue.Num() >= MaxQueueSize)
+			if (QueueIndex.Num() >= MaxQueueSize)
 			{
 				UE_LOG(LogSuspenseCoreEquipmentNetwork, Warning, TEXT("BatchOperations: queue full"));
 				break;
@@ -288,12 +611,11 @@ FGuid USuspenseCoreEquipmentNetworkDispatcher::BatchOperations(const TArray<FNet
 			Entry.QueueTime   = Batch.CreationTime;
 			Entry.RequestHash = CalculateRequestHash(R);
 
-			OperationQueue.Add(Entry);
+			AddQueueEntry(Entry);
 			Batch.Operations.Add(R);
 		}
 
 		if (Batch.Operations.Num() > 0) { ActiveBatches.Add(Batch); }
-		Statistics.CurrentQueueSize = OperationQueue.Num();
 	}
 	return BatchId;
 }
@@ -301,13 +623,9 @@ FGuid USuspenseCoreEquipmentNetworkDispatcher::BatchOperations(const TArray<FNet
 bool USuspenseCoreEquipmentNetworkDispatcher::CancelOperation(const FGuid& RequestId)
 {
 	FScopeLock Lock(&QueueLock);
-	const int32 Removed = OperationQueue.RemoveAll([&](const FSuspenseCoreOperationQueueEntry& E){ return E.Request.RequestId == RequestId && !E.bInProgress; });
-	if (Removed > 0)
-	{
-		Statistics.CurrentQueueSize = OperationQueue.Num();
-		return true;
-	}
-	return false;
+	const int32* Index = QueueIndex.Find(RequestId);
+	if (!Index || OperationQueue[*Index].bInProgress) { return false; }
+	return RemoveQueueEntry(RequestId);
 }
 
 bool USuspenseCoreEquipmentNetworkDispatcher::RetryOperation(const FGuid& RequestId)
@@ -323,8 +641,11 @@ TArray<FNetworkOperationRequest> USuspenseCoreEquipmentNetworkDispatcher::GetPen
 {
 	FScopeLock Lock(&QueueLock);
 	TArray<FNetworkOperationRequest> Out;
-	Out.Reserve(OperationQueue.Num());
-	for (const FSuspenseCoreOperationQueueEntry& E : OperationQueue) { Out.Add(E.Request); }
+	Out.Reserve(QueueIndex.Num());
+	for (const FSuspenseCoreOperationQueueEntry& E : OperationQueue)
+	{
+		if (!E.bRemoved) { Out.Add(E.Request); }
+	}
 	return Out;
 }
 
@@ -341,7 +662,7 @@ void USuspenseCoreEquipmentNetworkDispatcher::SetOperationTimeout(float Seconds)
 FString USuspenseCoreEquipmentNetworkDispatcher::GetNetworkStatistics() const
 {
 	FScopeLock Lock(&StatsLock);
-	return FString::Printf(TEXT("Sent=%d Received=%d Failed=%d Retries=%d AvgRT=%.2fms Queue=%d SecurityRejects=%d IdemHits=%d"),
+	return FString::Printf(TEXT("Sent=%d Received=%d Failed=%d Retries=%d AvgRT=%.2fms Queue=%d SecurityRejects=%d IdemHits=%d Batch=%d SRTT=%.1fms Reliable=%.0f%%"),
 		Statistics.TotalSent,
 		Statistics.TotalReceived,
 		Statistics.TotalFailed,
@@ -349,13 +670,16 @@ FString USuspenseCoreEquipmentNetworkDispatcher::GetNetworkStatistics() const
 		Statistics.AverageResponseTime * 1000.0f,
 		Statistics.CurrentQueueSize,
 		Statistics.SecurityRejects,
-		Statistics.IdempotentHits);
+		Statistics.IdempotentHits,
+		Statistics.CurrentBatchSize,
+		Statistics.SmoothedRTT * 1000.0f,
+		Statistics.ReliablePressure * 100.0f);
 }
 
 bool USuspenseCoreEquipmentNetworkDispatcher::IsOperationPending(const FGuid& RequestId) const
 {
 	FScopeLock Lock(&QueueLock);
-	return OperationQueue.ContainsByPredicate([&](const FSuspenseCoreOperationQueueEntry& E){ return E.Request.RequestId == RequestId; });
+	return QueueIndex.Contains(RequestId);
 }
 
 // ============================
@@ -382,14 +706,21 @@ void USuspenseCoreEquipmentNetworkDispatcher::ConfigureRetryPolicy(int32 MaxRetr
 
 void USuspenseCoreEquipmentNetworkDispatcher::ConfigureBatching(int32 BatchSize, float BatchInterval)
 {
-	MaxBatchSize  = FMath::Max(1, BatchSize);
+	MaxBatchSize  = FMath::Clamp(BatchSize, 1, FSuspenseCoreNetworkBatchNet::MaxRequests);
 	BatchWaitTime = FMath::Max(0.0f, BatchInterval);
+	UpdateAdaptiveBatchSize();
 }
 
 void USuspenseCoreEquipmentNetworkDispatcher::ConfigureIdempotency(int32 CacheSize, float EntryLifetime)
 {
 	MaxIdempotencyCacheSize = FMath::Max(1, CacheSize);
 	IdempotencyLifetime     = FMath::Max(1.0f, EntryLifetime);
+
+	FScopeLock Lock(&IdempotencyLock);
+	if (IdempotencyCache.GetCapacity() != MaxIdempotencyCacheSize)
+	{
+		IdempotencyCache.Reset(MaxIdempotencyCacheSize);
+	}
 }
 
 bool USuspenseCoreEquipmentNetworkDispatcher::ValidateRequestSecurity(const FNetworkOperationRequest& Request)
@@ -419,9 +750,13 @@ bool USuspenseCoreEquipmentNetworkDispatcher::VerifyServerSecurity(const FNetwor
 
 void USuspenseCoreEquipmentNetworkDispatcher::ProcessQueue()
 {
+	UpdateAdaptiveBatchSize();
+
 	TArray<FSuspenseCoreOperationQueueEntry*> Pending;
 	{
 		FScopeLock Lock(&QueueLock);
+		CompactQueue();
+
 		for (FSuspenseCoreOperationQueueEntry& Entry : OperationQueue)
 		{
 			if (!Entry.bInProgress)
@@ -431,9 +766,10 @@ void USuspenseCoreEquipmentNetworkDispatcher::ProcessQueue()
 		}
 	}
 
+	// Снятие с очереди до следующего CompactQueue() только помечает запись: указатели остаются валидными
 	for (FSuspenseCoreOperationQueueEntry* EntryPtr : Pending)
 	{
-		if (EntryPtr) { SendOperation(*EntryPtr); }
+		if (EntryPtr && !EntryPtr->bRemoved) { SendOperation(*EntryPtr); }
 	}
 
 	{
@@ -460,16 +796,7 @@ void USuspenseCoreEquipmentNetworkDispatcher::ProcessQueue()
 				}
 				if (!bAllValid) { continue; }
 
-				// Сбор net-DTO и отправка
-				TArray<FSuspenseCoreNetworkOperationRequestNet> NetList;
-				NetList.Reserve(Batch.Operations.Num());
-				for (const FNetworkOperationRequest& R : Batch.Operations)
-				{
-					NetList.Add(ToNet(R));
-				}
-
-				ServerExecuteBatch(Batch.BatchId, NetList);
-				Batch.bSent = true;
+				SendBatch(Batch);
 			}
 		}
 		ActiveBatches.RemoveAll([](const FSuspenseCoreOperationBatch& B){ return B.bSent; });
@@ -503,8 +830,7 @@ bool USuspenseCoreEquipmentNetworkDispatcher::SendOperation(FSuspenseCoreOperati
 		OnServerResponse.Broadcast(Entry.Request.RequestId, Cached);
 
 		FScopeLock Lock(&QueueLock);
-		OperationQueue.RemoveAll([&](const FSuspenseCoreOperationQueueEntry& E){ return E.Request.RequestId == Entry.Request.RequestId; });
-		Statistics.CurrentQueueSize = OperationQueue.Num();
+		RemoveQueueEntry(Entry.Request.RequestId);
 		return true;
 	}
 
@@ -543,14 +869,9 @@ void USuspenseCoreEquipmentNetworkDispatcher::SendWithPriority(ENetworkOperation
 				Existing = &ActiveBatches.Last();
 			}
 			Existing->Operations.Add(Request);
-			if (Existing->Operations.Num() >= MaxBatchSize)
+			if (Existing->Operations.Num() >= CurrentBatchSize)
 			{
-				TArray<FSuspenseCoreNetworkOperationRequestNet> NetList;
-				NetList.Reserve(Existing->Operations.Num());
-				for (const FNetworkOperationRequest& R : Existing->Operations) { NetList.Add(ToNet(R)); }
-
-				ServerExecuteBatch(Existing->BatchId, NetList);
-				Existing->bSent = true;
+				SendBatch(*Existing);
 			}
 		}
 		else
@@ -569,28 +890,26 @@ void USuspenseCoreEquipmentNetworkDispatcher::SendWithPriority(ENetworkOperation
 void USuspenseCoreEquipmentNetworkDispatcher::HandleTimeout(const FGuid& OperationId)
 {
 	FScopeLock Lock(&QueueLock);
-	for (FSuspenseCoreOperationQueueEntry& Entry : OperationQueue)
+	const int32* Index = QueueIndex.Find(OperationId);
+	if (!Index) { return; }
+
+	FSuspenseCoreOperationQueueEntry& Entry = OperationQueue[*Index];
+	if (!Entry.bInProgress) { return; }
+
+	if (Entry.RetryCount < MaxRetryAttempts)
 	{
-		if (Entry.Request.RequestId == OperationId && Entry.bInProgress)
-		{
-			if (Entry.RetryCount < MaxRetryAttempts)
-			{
-				Entry.RetryCount++;
-				Entry.bInProgress     = false;
-				Entry.LastAttemptTime = 0.0f;
-				Statistics.TotalRetries++;
-			}
-			else
-			{
-				Statistics.TotalFailed++;
-				OnOperationTimeout.Broadcast(OperationId);
-				OnOperationFailure.Broadcast(OperationId, NSLOCTEXT("EquipmentNetwork", "Timeout", "Operation timed out"));
+		Entry.RetryCount++;
+		Entry.bInProgress     = false;
+		Entry.LastAttemptTime = 0.0f;
+		Statistics.TotalRetries++;
+	}
+	else
+	{
+		Statistics.TotalFailed++;
+		OnOperationTimeout.Broadcast(OperationId);
+		OnOperationFailure.Broadcast(OperationId, NSLOCTEXT("EquipmentNetwork", "Timeout", "Operation timed out"));
 
-				OperationQueue.RemoveAll([&](const FSuspenseCoreOperationQueueEntry& E){ return E.Request.RequestId == OperationId; });
-				Statistics.CurrentQueueSize = OperationQueue.Num();
-			}
-			break;
-		}
+		RemoveQueueEntry(OperationId);
 	}
 }
 
@@ -612,14 +931,143 @@ bool USuspenseCoreEquipmentNetworkDispatcher::ShouldBatchOperation(ENetworkOpera
 	return Priority == ENetworkOperationPriority::Normal;
 }
 
+// ============================
+// Adaptive batching
+// ============================
+
+void USuspenseCoreEquipmentNetworkDispatcher::SendBatch(FSuspenseCoreOperationBatch& Batch)
+{
+	const float Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+
+	// BatchOperations() может собрать больше, чем текущий размер: режем на куски
+	const int32 ChunkSize = FMath::Clamp(CurrentBatchSize, 1, FSuspenseCoreNetworkBatchNet::MaxRequests);
+	for (int32 Start = 0; Start < Batch.Operations.Num(); Start += ChunkSize)
+	{
+		FSuspenseCoreNetworkBatchNet BatchNet;
+		BatchNet.BatchId = Start == 0 ? Batch.BatchId : FGuid::NewGuid();
+
+		const int32 End = FMath::Min(Start + ChunkSize, Batch.Operations.Num());
+		BatchNet.Requests.Reserve(End - Start);
+		for (int32 Index = Start; Index < End; ++Index)
+		{
+			const FNetworkOperationRequest& R = Batch.Operations[Index];
+			BatchNet.Requests.Add(ToNet(R));
+
+			// Таймаут и RTT считаются от фактической отправки, а не от постановки в батч
+			if (FSuspenseCoreOperationQueueEntry* Entry = FindQueueEntry(R.RequestId))
+			{
+				Entry->LastAttemptTime = Now;
+			}
+		}
+
+		ServerExecuteBatch(BatchNet);
+	}
+
+	Batch.bSent = true;
+}
+
+void USuspenseCoreEquipmentNetworkDispatcher::UpdateAdaptiveBatchSize()
+{
+	const int32 Ceiling = FSuspenseCoreNetworkBatchNet::MaxRequests;
+
+	if (!bAdaptiveBatching)
+	{
+		CurrentBatchSize = FMath::Clamp(MaxBatchSize, 1, Ceiling);
+
+		FScopeLock Lock(&StatsLock);
+		Statistics.CurrentBatchSize = CurrentBatchSize;
+		return;
+	}
+
+	float Rtt = SmoothedRtt;
+	if (Rtt <= 0.0f)
+	{
+		// Ещё нет своих замеров: берём оценку соединения
+		const UNetConnection* Connection = GetOwner() ? GetOwner()->GetNetConnection() : nullptr;
+		Rtt = Connection ? Connection->AvgLag : 0.0f;
+	}
+
+	const float Pressure = SampleReliablePressure();
+
+	// Длинный RTT держит больше reliable-бандлов в полёте при том же темпе операций,
+	// крупные батчи сокращают их число. Почти полный буфер: батчим ещё агрессивнее
+	// (переполнение RELIABLE_BUFFER закрывает соединение).
+	const float RttScale      = FMath::Clamp(Rtt / FMath::Max(BatchRttReference, KINDA_SMALL_NUMBER), 0.5f, 4.0f);
+	const float PressureScale = 1.0f + 3.0f * FMath::Clamp((Pressure - 0.25f) / 0.5f, 0.0f, 1.0f);
+	const int32 Floor         = FMath::Clamp(MinAdaptiveBatchSize, 1, Ceiling);
+	const int32 Target        = FMath::Clamp(FMath::RoundToInt(MaxBatchSize * RttScale * PressureScale), Floor, Ceiling);
+
+	// Растём сразу, сжимаемся по одному шагу за проход (одиночный всплеск RTT не раскачивает размер)
+	CurrentBatchSize = Target >= CurrentBatchSize ? Target : FMath::Max(Target, CurrentBatchSize - 1);
+
+	FScopeLock Lock(&StatsLock);
+	Statistics.CurrentBatchSize = CurrentBatchSize;
+	Statistics.SmoothedRTT      = Rtt;
+	Statistics.ReliablePressure = Pressure;
+}
+
+void USuspenseCoreEquipmentNetworkDispatcher::RecordRttSample(float Seconds)
+{
+	if (Seconds <= 0.0f) { return; }
+
+	// EWMA с весом 1/8, как SRTT в TCP
+	SmoothedRtt = SmoothedRtt > 0.0f ? SmoothedRtt + 0.125f * (Seconds - SmoothedRtt) : Seconds;
+}
+
+float USuspenseCoreEquipmentNetworkDispatcher::SampleReliablePressure() const
+{
+	AActor* Owner = GetOwner();
+	UNetConnection* Connection = Owner ? Owner->GetNetConnection() : nullptr;
+	if (!Connection) { return 0.0f; }
+
+	const UActorChannel* Channel = Connection->FindActorChannelRef(Owner);
+	if (!Channel) { return 0.0f; }
+
+	return FMath::Clamp(static_cast<float>(Channel->NumOutRec) / static_cast<float>(RELIABLE_BUFFER), 0.0f, 1.0f);
+}
+
 FSuspenseCoreOperationQueueEntry* USuspenseCoreEquipmentNetworkDispatcher::FindQueueEntry(const FGuid& OperationId)
 {
 	FScopeLock Lock(&QueueLock);
-	for (FSuspenseCoreOperationQueueEntry& E : OperationQueue)
+	const int32* Index = QueueIndex.Find(OperationId);
+	return Index ? &OperationQueue[*Index] : nullptr;
+}
+
+void USuspenseCoreEquipmentNetworkDispatcher::AddQueueEntry(const FSuspenseCoreOperationQueueEntry& Entry)
+{
+	// Тот же RequestId уже в очереди - это та же операция
+	if (QueueIndex.Contains(Entry.Request.RequestId)) { return; }
+
+	QueueIndex.Add(Entry.Request.RequestId, OperationQueue.Add(Entry));
+	Statistics.CurrentQueueSize = QueueIndex.Num();
+}
+
+bool USuspenseCoreEquipmentNetworkDispatcher::RemoveQueueEntry(const FGuid& OperationId)
+{
+	int32 Index = INDEX_NONE;
+	if (!QueueIndex.RemoveAndCopyValue(OperationId, Index)) { return false; }
+
+	// Порядок очереди важен (операции экипировки зависят друг от друга): не сдвигаем, а помечаем
+	FSuspenseCoreOperationQueueEntry& Entry = OperationQueue[Index];
+	Entry.bRemoved    = true;
+	Entry.bInProgress = false;
+	++NumRemovedQueueEntries;
+
+	Statistics.CurrentQueueSize = QueueIndex.Num();
+	return true;
+}
+
+void USuspenseCoreEquipmentNetworkDispatcher::CompactQueue()
+{
+	if (NumRemovedQueueEntries == 0) { return; }
+
+	OperationQueue.RemoveAll([](const FSuspenseCoreOperationQueueEntry& E){ return E.bRemoved; });
+	NumRemovedQueueEntries = 0;
+
+	for (int32 Index = 0; Index < OperationQueue.Num(); ++Index)
 	{
-		if (E.Request.RequestId == OperationId) { return &E; }
+		QueueIndex.FindChecked(OperationQueue[Index].Request.RequestId) = Index;
 	}
-	return nullptr;
 }
 
 FString USuspenseCoreEquipmentNetworkDispatcher::SerializeResult(const FEquipmentOperationResult& Result) const
@@ -659,15 +1107,12 @@ uint64 USuspenseCoreEquipmentNetworkDispatcher::CalculateRequestHash(const FNetw
 
 bool USuspenseCoreEquipmentNetworkDispatcher::CheckIdempotency(const FNetworkOperationRequest& Request, FEquipmentOperationResult& OutCachedResult)
 {
-	const uint64 H = CalculateRequestHash(Request);
+	// RequestHash включает RequestId, так что совпадение хэша без совпадения Id невозможно: ищем по Id
 	FScopeLock Lock(&IdempotencyLock);
-	for (const FSuspenseCoreIdempotencyEntry& E : IdempotencyCache)
+	if (const FSuspenseCoreIdempotencyEntry* Cached = IdempotencyCache.Find(Request.RequestId))
 	{
-		if (E.RequestId == Request.RequestId || E.RequestHash == H)
-		{
-			OutCachedResult = E.CachedResult;
-			return true;
-		}
+		OutCachedResult = Cached->CachedResult;
+		return true;
 	}
 	return false;
 }
@@ -682,21 +1127,18 @@ void USuspenseCoreEquipmentNetworkDispatcher::StoreIdempotentResult(const FNetwo
 	NewEntry.bProcessed  = true;
 
 	FScopeLock Lock(&IdempotencyLock);
-	IdempotencyCache.Add(NewEntry);
-	if (IdempotencyCache.Num() > MaxIdempotencyCacheSize)
+	if (IdempotencyCache.GetCapacity() != MaxIdempotencyCacheSize)
 	{
-		IdempotencyCache.RemoveAt(0);
+		IdempotencyCache.Reset(MaxIdempotencyCacheSize);
 	}
+	IdempotencyCache.Add(NewEntry);
 }
 
 void USuspenseCoreEquipmentNetworkDispatcher::CleanIdempotencyCache()
 {
 	FScopeLock Lock(&IdempotencyLock);
 	const float Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
-	IdempotencyCache.RemoveAll([&](const FSuspenseCoreIdempotencyEntry& E)
-	{
-		return (Now - E.Timestamp) > IdempotencyLifetime;
-	});
+	IdempotencyCache.RemoveExpired(Now, IdempotencyLifetime);
 }
 
 // ============================
@@ -730,13 +1172,17 @@ void USuspenseCoreEquipmentNetworkDispatcher::ServerExecuteOperation_Implementat
 	}
 }
 
-bool USuspenseCoreEquipmentNetworkDispatcher::ServerExecuteBatch_Validate(const FGuid& /*BatchId*/, const TArray<FSuspenseCoreNetworkOperationRequestNet>& RequestsNet)
+bool USuspenseCoreEquipmentNetworkDispatcher::ServerExecuteBatch_Validate(const FSuspenseCoreNetworkBatchNet& BatchNet)
 {
-	return RequestsNet.Num() > 0 && RequestsNet.Num() <= MaxBatchSize;
+	// Размер батча клиента адаптивный: проверяем по общему потолку, не по MaxBatchSize сервера
+	return BatchNet.Requests.Num() > 0 && BatchNet.Requests.Num() <= FSuspenseCoreNetworkBatchNet::MaxRequests;
 }
 
-void USuspenseCoreEquipmentNetworkDispatcher::ServerExecuteBatch_Implementation(const FGuid& BatchId, const TArray<FSuspenseCoreNetworkOperationRequestNet>& RequestsNet)
+void USuspenseCoreEquipmentNetworkDispatcher::ServerExecuteBatch_Implementation(const FSuspenseCoreNetworkBatchNet& BatchNet)
 {
+	const FGuid& BatchId = BatchNet.BatchId;
+	const TArray<FSuspenseCoreNetworkOperationRequestNet>& RequestsNet = BatchNet.Requests;
+
 	APlayerController* Sender = Cast<APlayerController>(GetOwner());
 
 	TArray<FGuid> OpIds;
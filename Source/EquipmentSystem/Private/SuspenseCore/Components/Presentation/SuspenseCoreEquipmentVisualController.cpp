@@ -640,9 +640,8 @@ void USuspenseCoreEquipmentVisualController::OnEquipmentStateChanged(FGameplayTa
 {
 	if (AActor* Eq = EventData.GetObject<AActor>(FName("Target")))
 	{
-		const FString NewStateStr = EventData.GetString(FName("NewState"));
-		const FGameplayTag StateTag = FGameplayTag::RequestGameplayTag(
-			NewStateStr.IsEmpty() ? TEXT("Equipment.State.Idle") : *NewStateStr);
+		const FGameplayTag StateTag = EventData.GetGameplayTag(FName("NewState"),
+			FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Idle")));
 		ApplyVisualProfile(Eq, StateTag, true);
 	}
 }
@@ -7,6 +7,7 @@
 #include "Algo/Transform.h"
 #include "SuspenseCore/Types/Inventory/SuspenseCoreInventoryTypes.h"
 #include "SuspenseCore/Types/Rules/SuspenseCoreRulesTypes.h"
+#include "SuspenseCore/Tags/SuspenseCoreEquipmentNativeTags.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogConflictRules, Log, All);
 
@@ -38,13 +39,13 @@ void USuspenseCoreConflictRulesEngine::InitializeDefaultRules()
 {
     // Настройка общих взаимоисключающих типов
     RegisterMutualExclusion(
-        FGameplayTag::RequestGameplayTag(TEXT("Item.Armor.Heavy")),
-        FGameplayTag::RequestGameplayTag(TEXT("Item.Armor.Light"))
+        SuspenseCoreEquipmentTags::Item::TAG_Item_Armor_Heavy,
+        SuspenseCoreEquipmentTags::Item::TAG_Item_Armor_Light
     );
 
     RegisterMutualExclusion(
-        FGameplayTag::RequestGameplayTag(TEXT("Item.Weapon.TwoHanded")),
-        FGameplayTag::RequestGameplayTag(TEXT("Item.Shield"))
+        SuspenseCoreEquipmentTags::Item::TAG_Item_Weapon_TwoHanded,
+        SuspenseCoreEquipmentTags::Item::TAG_Item_Shield
     );
 
     // Настройка общих наборов предметов
@@ -54,7 +55,7 @@ void USuspenseCoreConflictRulesEngine::InitializeDefaultRules()
     KnightSetItems.Add(TEXT("Knight_Gauntlets"));
     KnightSetItems.Add(TEXT("Knight_Boots"));
     RegisterItemSet(
-        FGameplayTag::RequestGameplayTag(TEXT("Set.Knight")),
+        SuspenseCoreEquipmentTags::Conflict::TAG_Set_Knight,
         KnightSetItems,
         4
     );
@@ -67,7 +68,7 @@ FSuspenseCoreRuleCheckResult USuspenseCoreConflictRulesEngine::CheckItemConflict
     const TArray<FSuspenseCoreInventoryItemInstance>& ExistingItems) const
 {
     FSuspenseCoreRuleCheckResult Result = FSuspenseCoreRuleCheckResult::Success();
-    Result.RuleTag = FGameplayTag::RequestGameplayTag(TEXT("Rule.Conflict.ItemCheck"));
+    Result.RuleTag = SuspenseCoreEquipmentTags::Conflict::TAG_Rule_Conflict_ItemCheck;
     Result.RuleType = ESuspenseRuleType::Conflict;
 
     // Проверка инициализации движка
@@ -189,7 +190,7 @@ FSuspenseCoreRuleCheckResult USuspenseCoreConflictRulesEngine::CheckSlotConflict
     const TArray<FEquipmentSlotSnapshot>& Slots) const
 {
     FSuspenseCoreRuleCheckResult Result = FSuspenseCoreRuleCheckResult::Success();
-    Result.RuleTag = FGameplayTag::RequestGameplayTag(TEXT("Rule.Conflict.SlotCheck"));
+    Result.RuleTag = SuspenseCoreEquipmentTags::Conflict::TAG_Rule_Conflict_SlotCheck;
     Result.RuleType = ESuspenseRuleType::Conflict;
 
     // Критическая разница: теперь работаем с реальными снапшотами слотов из координатора,
@@ -208,8 +209,8 @@ FSuspenseCoreRuleCheckResult USuspenseCoreConflictRulesEngine::CheckSlotConflict
         FGameplayTag ExistingType = GetItemType(TargetSlotSnapshot->ItemInstance);
 
         // Пример проверки: два основных оружия не могут находиться в одном слоте
-        if (NewType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Weapon.Primary"))) &&
-            ExistingType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Weapon.Primary"))))
+        if (NewType.MatchesTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Weapon_Primary) &&
+            ExistingType.MatchesTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Weapon_Primary))
         {
             Result.bPassed = false;
             Result.Severity = ESuspenseRuleSeverity::Error;
@@ -226,9 +227,9 @@ FSuspenseCoreRuleCheckResult USuspenseCoreConflictRulesEngine::CheckSlotConflict
     if (GetItemData(NewItem.ItemID, NewItemData))
     {
         // Кэшируем часто используемые теги для производительности
-        static const FGameplayTag TagRequiresBothHands = FGameplayTag::RequestGameplayTag(TEXT("Item.RequiresBothHands"));
-        static const FGameplayTag TagHandMain          = FGameplayTag::RequestGameplayTag(TEXT("Equipment.Slot.Hand.Main"));
-        static const FGameplayTag TagHandOff           = FGameplayTag::RequestGameplayTag(TEXT("Equipment.Slot.Hand.Off"));
+        static const FGameplayTag TagRequiresBothHands = SuspenseCoreEquipmentTags::Item::TAG_Item_RequiresBothHands;
+        static const FGameplayTag TagHandMain          = SuspenseCoreEquipmentTags::Slot::TAG_Equipment_Slot_Hand_Main;
+        static const FGameplayTag TagHandOff           = SuspenseCoreEquipmentTags::Slot::TAG_Equipment_Slot_Hand_Off;
 
         if (NewItemData.ItemTags.HasTag(TagRequiresBothHands))
         {
@@ -451,17 +452,17 @@ ESuspenseCoreConflictType USuspenseCoreConflictRulesEngine::GetConflictType(
     if (GetItemData(Item1.ItemID, Data1) && GetItemData(Item2.ItemID, Data2))
     {
         // Двуручное оружие со щитом
-        if ((Data1.ItemTags.HasTag(FGameplayTag::RequestGameplayTag(TEXT("Item.RequiresBothHands"))) &&
-             Data2.ItemTags.HasTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Shield")))) ||
-            (Data2.ItemTags.HasTag(FGameplayTag::RequestGameplayTag(TEXT("Item.RequiresBothHands"))) &&
-             Data1.ItemTags.HasTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Shield")))))
+        if ((Data1.ItemTags.HasTag(SuspenseCoreEquipmentTags::Item::TAG_Item_RequiresBothHands) &&
+             Data2.ItemTags.HasTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Shield)) ||
+            (Data2.ItemTags.HasTag(SuspenseCoreEquipmentTags::Item::TAG_Item_RequiresBothHands) &&
+             Data1.ItemTags.HasTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Shield)))
         {
             return ESuspenseCoreConflictType::TypeIncompatibility;
         }
 
         // Несколько предметов в одном уникальном слоте
         if (Data1.EquipmentSlot == Data2.EquipmentSlot &&
-            Data1.EquipmentSlot.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Slot.Unique"))))
+            Data1.EquipmentSlot.MatchesTag(SuspenseCoreEquipmentTags::Slot::TAG_Equipment_Slot_Unique))
         {
             return ESuspenseCoreConflictType::SlotConflict;
         }
@@ -532,15 +533,15 @@ float USuspenseCoreConflictRulesEngine::CalculateCompatibilityScore(
             }
 
             // Дополняющие типы (например, меч и щит)
-            if (NewItemData.ItemType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Weapon.Melee"))) &&
-                ExistingData.ItemType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Shield"))))
+            if (NewItemData.ItemType.MatchesTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Weapon_Melee) &&
+                ExistingData.ItemType.MatchesTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Shield))
             {
                 PairScore = 1.3f;
             }
 
             // Соответствующие типы брони
-            if (NewItemData.ItemType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Armor"))) &&
-                ExistingData.ItemType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Armor"))))
+            if (NewItemData.ItemType.MatchesTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Armor) &&
+                ExistingData.ItemType.MatchesTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Armor))
             {
                 // Проверка принадлежности к одному классу брони (тяжелая, средняя, легкая)
                 FGameplayTag NewArmorClass = GetArmorClass(NewItemData);
@@ -565,7 +566,7 @@ FSuspenseCoreRuleCheckResult USuspenseCoreConflictRulesEngine::CheckTypeExclusiv
     const TArray<FGameplayTag>& ExistingTypes) const
 {
     FSuspenseCoreRuleCheckResult Result = FSuspenseCoreRuleCheckResult::Success();
-    Result.RuleTag = FGameplayTag::RequestGameplayTag(TEXT("Rule.Conflict.TypeExclusivity"));
+    Result.RuleTag = SuspenseCoreEquipmentTags::Conflict::TAG_Rule_Conflict_TypeExclusivity;
     Result.RuleType = ESuspenseRuleType::Conflict;
 
     for (const FGameplayTag& ExistingType : ExistingTypes)
@@ -737,7 +738,7 @@ bool USuspenseCoreConflictRulesEngine::SuggestResolutions(
             case ESuspenseConflictResolution::Reject:
             {
                 FSuspenseCoreResolutionAction A;
-                A.ActionTag = FGameplayTag::RequestGameplayTag(TEXT("Resolution.Action.Reject"));
+                A.ActionTag = SuspenseCoreEquipmentTags::Conflict::TAG_Resolution_Action_Reject;
                 A.bBlocking = true;
                 A.Reason    = NSLOCTEXT("ConflictRules", "RejectReason", "Operation rejected due to conflicts");
                 OutActions.Add(MoveTemp(A));
@@ -749,7 +750,7 @@ bool USuspenseCoreConflictRulesEngine::SuggestResolutions(
                 for (const FSuspenseCoreInventoryItemInstance& It : C.ConflictingItems)
                 {
                     FSuspenseCoreResolutionAction A;
-                    A.ActionTag    = FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Unequip"));
+                    A.ActionTag    = SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Unequip;
                     A.ItemInstance = It;
                     A.bBlocking    = false;
                     OutActions.Add(MoveTemp(A));
@@ -762,7 +763,7 @@ bool USuspenseCoreConflictRulesEngine::SuggestResolutions(
                 if (C.ConflictingItems.Num() > 0)
                 {
                     FSuspenseCoreResolutionAction A;
-                    A.ActionTag    = FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Set")); // «свести»
+                    A.ActionTag    = SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Set; // «свести»
                     A.ItemInstance = C.ConflictingItems[0];
                     A.bBlocking    = false;
                     OutActions.Add(MoveTemp(A));
@@ -773,7 +774,7 @@ bool USuspenseCoreConflictRulesEngine::SuggestResolutions(
             case ESuspenseConflictResolution::Prompt:
             {
                 FSuspenseCoreResolutionAction A;
-                A.ActionTag = FGameplayTag::RequestGameplayTag(TEXT("Resolution.Action.Prompt"));
+                A.ActionTag = SuspenseCoreEquipmentTags::Conflict::TAG_Resolution_Action_Prompt;
                 A.bBlocking = true;
                 A.Reason    = NSLOCTEXT("ConflictRules", "PromptRequired", "User input required to resolve conflict");
                 OutActions.Add(MoveTemp(A));
@@ -991,17 +992,17 @@ FGameplayTag USuspenseCoreConflictRulesEngine::GetItemType(const FSuspenseCoreIn
 
 FGameplayTag USuspenseCoreConflictRulesEngine::GetArmorClass(const FSuspenseCoreUnifiedItemData& ItemData) const
 {
-    if (ItemData.ItemTags.HasTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Armor.Heavy"))))
+    if (ItemData.ItemTags.HasTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Armor_Heavy))
     {
-        return FGameplayTag::RequestGameplayTag(TEXT("Item.Armor.Heavy"));
+        return SuspenseCoreEquipmentTags::Item::TAG_Item_Armor_Heavy;
     }
-    else if (ItemData.ItemTags.HasTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Armor.Medium"))))
+    else if (ItemData.ItemTags.HasTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Armor_Medium))
     {
-        return FGameplayTag::RequestGameplayTag(TEXT("Item.Armor.Medium"));
+        return SuspenseCoreEquipmentTags::Item::TAG_Item_Armor_Medium;
     }
-    else if (ItemData.ItemTags.HasTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Armor.Light"))))
+    else if (ItemData.ItemTags.HasTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Armor_Light))
     {
-        return FGameplayTag::RequestGameplayTag(TEXT("Item.Armor.Light"));
+        return SuspenseCoreEquipmentTags::Item::TAG_Item_Armor_Light;
     }
 
     return FGameplayTag::EmptyTag;
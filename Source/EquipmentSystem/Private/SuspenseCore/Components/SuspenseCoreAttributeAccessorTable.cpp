@@ -0,0 +1,497 @@
+// SuspenseCoreAttributeAccessorTable.cpp
+// Copyright Suspense Team. All Rights Reserved.
+
+#include "SuspenseCore/Components/SuspenseCoreAttributeAccessorTable.h"
+#include "SuspenseCore/Attributes/SuspenseCoreWeaponAttributeSet.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/Package.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAttributeAccessorTable, Log, All);
+
+namespace SuspenseCoreAttributeAccessorTable
+{
+    /** Seeds tried per bucket before the slot table is doubled */
+    static constexpr uint32 MaxSeedsPerBucket = 4096;
+
+    /** Slot table doublings before giving up on a collision-free layout */
+    static constexpr int32 MaxGrowths = 4;
+
+    static FRWLock RegistryLock;
+
+    /** Tables are never freed; a reloaded class gets a new key and a new table */
+    static TMap<TObjectKey<UClass>, TUniquePtr<FSuspenseCoreAttributeAccessorTable>>& GetRegistry()
+    {
+        static TMap<TObjectKey<UClass>, TUniquePtr<FSuspenseCoreAttributeAccessorTable>> Registry;
+        return Registry;
+    }
+
+    static bool GetAccessorKind(const FProperty* Property, FSuspenseCoreAttributeAccessor::EKind& OutKind)
+    {
+        if (CastField<FFloatProperty>(Property))
+        {
+            OutKind = FSuspenseCoreAttributeAccessor::EKind::Float;
+            return true;
+        }
+        if (CastField<FDoubleProperty>(Property))
+        {
+            OutKind = FSuspenseCoreAttributeAccessor::EKind::Double;
+            return true;
+        }
+        if (CastField<FIntProperty>(Property))
+        {
+            OutKind = FSuspenseCoreAttributeAccessor::EKind::Int;
+            return true;
+        }
+        if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+        {
+            if (StructProp->Struct == FGameplayAttributeData::StaticStruct())
+            {
+                OutKind = FSuspenseCoreAttributeAccessor::EKind::AttributeData;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** Per-call reflection read, the path the table replaces (benchmark baseline) */
+    static float ReadByReflection(const UAttributeSet* AttributeSet, const FProperty* Property)
+    {
+        if (const FFloatProperty* FloatProp = CastField<FFloatProperty>(Property))
+        {
+            return *FloatProp->ContainerPtrToValuePtr<float>(AttributeSet);
+        }
+        if (const FStructProperty* StructProp = CastField<FStructProperty>(Property))
+        {
+            if (StructProp->Struct == FGameplayAttributeData::StaticStruct())
+            {
+                return StructProp->ContainerPtrToValuePtr<FGameplayAttributeData>(AttributeSet)->GetCurrentValue();
+            }
+        }
+        return 0.0f;
+    }
+}
+
+//================================================
+// Registry
+//================================================
+
+const FSuspenseCoreAttributeAccessorTable& FSuspenseCoreAttributeAccessorTable::Get(const UClass* AttributeSetClass)
+{
+    using namespace SuspenseCoreAttributeAccessorTable;
+
+    {
+        FReadScopeLock ReadLock(RegistryLock);
+        if (const TUniquePtr<FSuspenseCoreAttributeAccessorTable>* Found = GetRegistry().Find(TObjectKey<UClass>(AttributeSetClass)))
+        {
+            return **Found;
+        }
+    }
+
+    FWriteScopeLock WriteLock(RegistryLock);
+    TUniquePtr<FSuspenseCoreAttributeAccessorTable>& Table = GetRegistry().FindOrAdd(TObjectKey<UClass>(AttributeSetClass));
+    if (!Table.IsValid())
+    {
+        Table = MakeUnique<FSuspenseCoreAttributeAccessorTable>();
+        Table->Build(AttributeSetClass);
+    }
+    return *Table;
+}
+
+//================================================
+// Build
+//================================================
+
+void FSuspenseCoreAttributeAccessorTable::Build(const UClass* AttributeSetClass)
+{
+    using namespace SuspenseCoreAttributeAccessorTable;
+
+    if (!AttributeSetClass)
+    {
+        return;
+    }
+
+    TArray<FSuspenseCoreAttributeAccessor> Hidden;
+
+    // Same walk order as the old reflection lookup, so the first match still wins
+    for (TFieldIterator<FProperty> It(AttributeSetClass); It; ++It)
+    {
+        FProperty* Property = *It;
+
+        FSuspenseCoreAttributeAccessor::EKind Kind;
+        if (!Property || !GetAccessorKind(Property, Kind))
+        {
+            continue;
+        }
+
+        FSuspenseCoreAttributeAccessor Accessor;
+        Accessor.Name = Property->GetName();
+        Accessor.Attribute = FGameplayAttribute(Property);
+        Accessor.Property = Property;
+        Accessor.Offset = Property->GetOffset_ForInternal();
+        Accessor.Kind = Kind;
+        Accessor.bVisible = Property->HasAnyPropertyFlags(CPF_BlueprintVisible);
+
+        if (Accessor.bVisible)
+        {
+            Accessors.Add(MoveTemp(Accessor));
+        }
+        else
+        {
+            Hidden.Add(MoveTemp(Accessor));
+        }
+    }
+
+    NumVisibleAccessors = Accessors.Num();
+    Accessors.Append(MoveTemp(Hidden));
+
+    BuildPerfectHash();
+
+    UE_LOG(LogAttributeAccessorTable, Verbose, TEXT("Built accessor table for %s: %d attributes (%d visible), %d slots"),
+        *AttributeSetClass->GetName(), Accessors.Num(), NumVisibleAccessors, HashSlots.Num());
+}
+
+void FSuspenseCoreAttributeAccessorTable::BuildPerfectHash()
+{
+    using namespace SuspenseCoreAttributeAccessorTable;
+
+    BucketSeeds.Reset();
+    HashSlots.Reset();
+    BucketMask = 0;
+    SlotMask = 0;
+
+    if (Accessors.Num() == 0)
+    {
+        return;
+    }
+
+    // Names that differ only by case resolve to the first one, like the reflection walk did
+    TArray<int32> Keys;
+    TArray<uint64> Hashes;
+    for (int32 Index = 0; Index < Accessors.Num(); ++Index)
+    {
+        bool bDuplicate = false;
+        for (const int32 Key : Keys)
+        {
+            bDuplicate |= Accessors[Key].Name.Equals(Accessors[Index].Name, ESearchCase::IgnoreCase);
+        }
+        if (!bDuplicate)
+        {
+            Keys.Add(Index);
+            Hashes.Add(HashName(Accessors[Index].Name));
+        }
+    }
+
+    const int32 NumBuckets = FMath::RoundUpToPowerOfTwo(FMath::Max(Keys.Num() / 2, 1));
+    BucketMask = NumBuckets - 1;
+
+    TArray<TArray<int32, TInlineAllocator<4>>> Buckets;
+    Buckets.SetNum(NumBuckets);
+    for (int32 KeyIndex = 0; KeyIndex < Keys.Num(); ++KeyIndex)
+    {
+        Buckets[static_cast<uint32>(Hashes[KeyIndex]) & BucketMask].Add(KeyIndex);
+    }
+
+    // Largest buckets first: they are the hardest to place
+    TArray<int32> BucketOrder;
+    for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+    {
+        if (Buckets[Bucket].Num() > 0)
+        {
+            BucketOrder.Add(Bucket);
+        }
+    }
+    BucketOrder.StableSort([&Buckets](int32 A, int32 B) { return Buckets[A].Num() > Buckets[B].Num(); });
+
+    int32 NumSlots = FMath::RoundUpToPowerOfTwo(FMath::Max(Keys.Num() * 2, 2));
+    for (int32 Growth = 0; Growth <= MaxGrowths; ++Growth, NumSlots *= 2)
+    {
+        SlotMask = NumSlots - 1;
+        HashSlots.Init(INDEX_NONE, NumSlots);
+        BucketSeeds.Init(0, NumBuckets);
+
+        bool bPlacedAll = true;
+        for (const int32 Bucket : BucketOrder)
+        {
+            TArray<uint32, TInlineAllocator<4>> BucketSlots;
+            bool bPlaced = false;
+
+            for (uint32 Seed = 0; Seed < MaxSeedsPerBucket && !bPlaced; ++Seed)
+            {
+                BucketSlots.Reset();
+                bPlaced = true;
+                for (const int32 KeyIndex : Buckets[Bucket])
+                {
+                    const uint32 Slot = SlotFor(Hashes[KeyIndex], Seed, SlotMask);
+                    if (HashSlots[Slot] != INDEX_NONE || BucketSlots.Contains(Slot))
+                    {
+                        bPlaced = false;
+                        break;
+                    }
+                    BucketSlots.Add(Slot);
+                }
+
+                if (bPlaced)
+                {
+                    BucketSeeds[Bucket] = Seed;
+                    for (int32 Member = 0; Member < Buckets[Bucket].Num(); ++Member)
+                    {
+                        HashSlots[BucketSlots[Member]] = Keys[Buckets[Bucket][Member]];
+                    }
+                }
+            }
+
+            if (!bPlaced)
+            {
+                bPlacedAll = false;
+                break;
+            }
+        }
+
+        if (bPlacedAll)
+        {
+            return;
+        }
+    }
+
+    // Practically unreachable (needs a 64-bit hash collision); lookups fall back to a linear scan
+    UE_LOG(LogAttributeAccessorTable, Warning, TEXT("No collision-free layout for %d attribute names, using linear lookup"), Keys.Num());
+    BucketSeeds.Reset();
+    HashSlots.Reset();
+}
+
+uint64 FSuspenseCoreAttributeAccessorTable::HashName(FStringView Name)
+{
+    uint64 Hash = 0xcbf29ce484222325ull;
+    for (const TCHAR Char : Name)
+    {
+        Hash ^= static_cast<uint64>(FChar::ToLower(Char));
+        Hash *= 0x100000001b3ull;
+    }
+    return Hash;
+}
+
+uint32 FSuspenseCoreAttributeAccessorTable::SlotFor(uint64 Hash, uint32 Seed, uint32 Mask)
+{
+    // High half of the name hash, remixed per seed (murmur3 finalizer)
+    uint32 X = static_cast<uint32>(Hash >> 32) ^ (Seed * 0x9E3779B1u);
+    X ^= X >> 16;
+    X *= 0x85EBCA6Bu;
+    X ^= X >> 13;
+    X *= 0xC2B2AE35u;
+    X ^= X >> 16;
+    return X & Mask;
+}
+
+//================================================
+// Lookup
+//================================================
+
+int32 FSuspenseCoreAttributeAccessorTable::FindIndex(FStringView Name) const
+{
+    if (HashSlots.Num() == 0)
+    {
+        for (int32 Index = 0; Index < Accessors.Num(); ++Index)
+        {
+            if (Name.Equals(Accessors[Index].Name, ESearchCase::IgnoreCase))
+            {
+                return Index;
+            }
+        }
+        return INDEX_NONE;
+    }
+
+    const uint64 Hash = HashName(Name);
+    const uint32 Seed = BucketSeeds[static_cast<uint32>(Hash) & BucketMask];
+    const int32 Index = HashSlots[SlotFor(Hash, Seed, SlotMask)];
+
+    return Index != INDEX_NONE && Name.Equals(Accessors[Index].Name, ESearchCase::IgnoreCase) ? Index : INDEX_NONE;
+}
+
+float FSuspenseCoreAttributeAccessorTable::GetValue(const UAttributeSet* AttributeSet, int32 Index) const
+{
+    if (!AttributeSet || !Accessors.IsValidIndex(Index))
+    {
+        return 0.0f;
+    }
+
+    const FSuspenseCoreAttributeAccessor& Accessor = Accessors[Index];
+    const uint8* Value = reinterpret_cast<const uint8*>(AttributeSet) + Accessor.Offset;
+
+    switch (Accessor.Kind)
+    {
+    case FSuspenseCoreAttributeAccessor::EKind::AttributeData:
+        return reinterpret_cast<const FGameplayAttributeData*>(Value)->GetCurrentValue();
+    case FSuspenseCoreAttributeAccessor::EKind::Float:
+        return *reinterpret_cast<const float*>(Value);
+    case FSuspenseCoreAttributeAccessor::EKind::Double:
+        return static_cast<float>(*reinterpret_cast<const double*>(Value));
+    case FSuspenseCoreAttributeAccessor::EKind::Int:
+        return static_cast<float>(*reinterpret_cast<const int32*>(Value));
+    }
+    return 0.0f;
+}
+
+void FSuspenseCoreAttributeAccessorTable::SetValue(UAttributeSet* AttributeSet, int32 Index, float Value) const
+{
+    if (!AttributeSet || !Accessors.IsValidIndex(Index))
+    {
+        return;
+    }
+
+    const FSuspenseCoreAttributeAccessor& Accessor = Accessors[Index];
+    uint8* Target = reinterpret_cast<uint8*>(AttributeSet) + Accessor.Offset;
+
+    switch (Accessor.Kind)
+    {
+    case FSuspenseCoreAttributeAccessor::EKind::AttributeData:
+        {
+            FGameplayAttributeData* AttributeData = reinterpret_cast<FGameplayAttributeData*>(Target);
+            AttributeData->SetBaseValue(Value);
+            AttributeData->SetCurrentValue(Value);
+        }
+        break;
+    case FSuspenseCoreAttributeAccessor::EKind::Float:
+        *reinterpret_cast<float*>(Target) = Value;
+        break;
+    case FSuspenseCoreAttributeAccessor::EKind::Double:
+        *reinterpret_cast<double*>(Target) = static_cast<double>(Value);
+        break;
+    case FSuspenseCoreAttributeAccessor::EKind::Int:
+        *reinterpret_cast<int32*>(Target) = FMath::RoundToInt(Value);
+        break;
+    }
+}
+
+void FSuspenseCoreAttributeAccessorTable::ReadVisibleValues(const UAttributeSet* AttributeSet, TArrayView<float> OutValues) const
+{
+    check(OutValues.Num() >= NumVisibleAccessors);
+
+    for (int32 Index = 0; Index < NumVisibleAccessors; ++Index)
+    {
+        OutValues[Index] = GetValue(AttributeSet, Index);
+    }
+}
+
+//================================================
+// Benchmark
+//================================================
+
+FString FSuspenseCoreAttributeAccessorTable::RunBenchmark(int32 Iterations)
+{
+    using namespace SuspenseCoreAttributeAccessorTable;
+
+    Iterations = FMath::Clamp(Iterations, 1, 1000000);
+
+    USuspenseCoreWeaponAttributeSet* AttributeSet = NewObject<USuspenseCoreWeaponAttributeSet>(GetTransientPackage());
+    const UClass* AttributeSetClass = AttributeSet->GetClass();
+
+    const double BuildStart = FPlatformTime::Seconds();
+    FSuspenseCoreAttributeAccessorTable FreshTable;
+    FreshTable.Build(AttributeSetClass);
+    const double BuildMs = (FPlatformTime::Seconds() - BuildStart) * 1000.0;
+
+    const FSuspenseCoreAttributeAccessorTable& Table = Get(AttributeSetClass);
+
+    TArray<FString> Names;
+    for (int32 Index = 0; Index < Table.NumVisible(); ++Index)
+    {
+        Names.Add(Table.GetAccessor(Index).Name);
+    }
+    Names.Add(TEXT("NotAnAttribute"));
+
+    // Reflection: field walk + name compare per lookup, as the component did before
+    double ReflectionSum = 0.0;
+    const double ReflectionStart = FPlatformTime::Seconds();
+    for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+    {
+        for (const FString& Name : Names)
+        {
+            for (TFieldIterator<FProperty> It(AttributeSetClass); It; ++It)
+            {
+                if (It->GetName() == Name)
+                {
+                    ReflectionSum += ReadByReflection(AttributeSet, *It);
+                    break;
+                }
+            }
+        }
+    }
+    const double ReflectionMs = (FPlatformTime::Seconds() - ReflectionStart) * 1000.0;
+
+    // Table: registry lookup + perfect hash per name
+    double TableSum = 0.0;
+    const double TableStart = FPlatformTime::Seconds();
+    for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+    {
+        for (const FString& Name : Names)
+        {
+            const FSuspenseCoreAttributeAccessorTable& Lookup = Get(AttributeSetClass);
+            const int32 Index = Lookup.FindIndex(Name);
+            if (Index != INDEX_NONE)
+            {
+                TableSum += Lookup.GetValue(AttributeSet, Index);
+            }
+        }
+    }
+    const double TableMs = (FPlatformTime::Seconds() - TableStart) * 1000.0;
+
+    // Bulk: name -> value map via reflection vs flat array via table
+    int32 MapEntries = 0;
+    const double MapStart = FPlatformTime::Seconds();
+    for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+    {
+        TMap<FString, float> Values;
+        for (TFieldIterator<FProperty> It(AttributeSetClass); It; ++It)
+        {
+            if (It->HasAnyPropertyFlags(CPF_BlueprintVisible))
+            {
+                Values.Add(It->GetName(), ReadByReflection(AttributeSet, *It));
+            }
+        }
+        MapEntries += Values.Num();
+    }
+    const double MapMs = (FPlatformTime::Seconds() - MapStart) * 1000.0;
+
+    TArray<float> Flat;
+    Flat.SetNumUninitialized(Table.NumVisible());
+    double FlatSum = 0.0;
+    const double FlatStart = FPlatformTime::Seconds();
+    for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+    {
+        Table.ReadVisibleValues(AttributeSet, Flat);
+        FlatSum += Flat.Num() > 0 ? Flat[0] : 0.0f;
+    }
+    const double FlatMs = (FPlatformTime::Seconds() - FlatStart) * 1000.0;
+
+    AttributeSet->MarkAsGarbage();
+
+    const double NumLookups = double(Iterations) * Names.Num();
+    return FString::Printf(
+        TEXT("AttributeAccessorTable bench: %s, %d attributes (%d visible), %d slots, %d iterations\n")
+        TEXT("  Build:       %.3f ms\n")
+        TEXT("  Lookup:      reflection %.1f ns, table %.1f ns per name (x%.1f)\n")
+        TEXT("  Bulk read:   map %.3f us, flat %.3f us per set (x%.1f)\n")
+        TEXT("  Checksums:   %.1f / %.1f, %d / %.1f"),
+        *AttributeSetClass->GetName(), Table.Num(), Table.NumVisible(), Table.HashSlots.Num(), Iterations,
+        BuildMs,
+        ReflectionMs * 1e6 / NumLookups, TableMs * 1e6 / NumLookups, ReflectionMs / FMath::Max(TableMs, 1e-6),
+        MapMs * 1e3 / Iterations, FlatMs * 1e3 / Iterations, MapMs / FMath::Max(FlatMs, 1e-6),
+        ReflectionSum, TableSum, MapEntries, FlatSum);
+}
+
+#if !UE_BUILD_SHIPPING
+static void HandleAttributeAccessBenchCommand(const TArray<FString>& Args)
+{
+    const int32 Iterations = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 10000;
+
+    const FString Report = FSuspenseCoreAttributeAccessorTable::RunBenchmark(Iterations);
+    UE_LOG(LogAttributeAccessorTable, Log, TEXT("%s"), *Report);
+}
+
+static FAutoConsoleCommand GSuspenseCoreAttributeAccessBenchCommand(
+    TEXT("SuspenseCore.Equipment.BenchAttributeAccess"),
+    TEXT("Benchmark reflection attribute lookup vs the compiled accessor table. Args: [Iterations=10000]"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&HandleAttributeAccessBenchCommand)
+);
+#endif
@@ -5,6 +5,7 @@
 #include "GameplayEffect.h"
 #include "GameplayEffectExtension.h"
 #include "AttributeSet.h"
+#include "SuspenseCore/Components/SuspenseCoreAttributeAccessorTable.h"
 #include "SuspenseCore/Events/SuspenseCoreEventManager.h"
 #include "SuspenseCore/Data/SuspenseCoreDataManager.h"
 #include "SuspenseCore/Attributes/SuspenseCoreWeaponAttributeSet.h"
@@ -113,7 +114,6 @@ void USuspenseCoreEquipmentAttributeComponent::Cleanup()
     ReplicatedAttributes.Empty();
     ReplicatedAttributeSetClasses.Empty();
     ActiveAttributePredictions.Empty();
-    AttributePropertyCache.Empty();
 
     // Call base cleanup last - this sets CachedASC = nullptr
     Super::Cleanup();
@@ -457,7 +457,6 @@ void USuspenseCoreEquipmentAttributeComponent::CleanupAttributeSets()
     }
 
     AttributeSetsByType.Empty();
-    AttributePropertyCache.Empty();
 
     UE_LOG(LogTemp, Warning, TEXT("[AttributeComponent] CleanupAttributeSets: Removed %d AttributeSets from ASC %s"),
         RemovedCount, *CachedASC->GetName());
@@ -694,33 +693,15 @@ bool USuspenseCoreEquipmentAttributeComponent::GetAttributeValue(const FString&
         }
     }
 
-    // Check cache
-    if (AttributePropertyCache.Contains(AttributeName))
+    UAttributeSet* Set = nullptr;
+    int32 Index = INDEX_NONE;
+    if (!FindAttributeAccessor(AttributeName, Set, Index))
     {
-        const TPair<UAttributeSet*, FProperty*>& CachedPair = AttributePropertyCache[AttributeName];
-        if (CachedPair.Key && CachedPair.Value)
-        {
-            OutValue = GetAttributeValueFromProperty(CachedPair.Key, CachedPair.Value);
-            return true;
-        }
-    }
-
-    // Search all attribute sets
-    TArray<UAttributeSet*> AllSets = { CurrentAttributeSet, WeaponAttributeSet, ArmorAttributeSet, AmmoAttributeSet };
-
-    for (UAttributeSet* Set : AllSets)
-    {
-        if (!Set) continue;
-
-        if (FProperty* Property = FindAttributeProperty(Set, AttributeName))
-        {
-            AttributePropertyCache.Add(AttributeName, TPair<UAttributeSet*, FProperty*>(Set, Property));
-            OutValue = GetAttributeValueFromProperty(Set, Property);
-            return true;
-        }
+        return false;
     }
 
-    return false;
+    OutValue = FSuspenseCoreAttributeAccessorTable::Get(Set->GetClass()).GetValue(Set, Index);
+    return true;
 }
 
 void USuspenseCoreEquipmentAttributeComponent::SetAttributeValue(const FString& AttributeName, float NewValue, bool bForceReplication)
@@ -729,48 +710,22 @@ void USuspenseCoreEquipmentAttributeComponent::SetAttributeValue(const FString&
 
     // Find attribute
     UAttributeSet* TargetSet = nullptr;
-    FProperty* Property = nullptr;
-
-    // Check cache
-    if (AttributePropertyCache.Contains(AttributeName))
-    {
-        const TPair<UAttributeSet*, FProperty*>& CachedPair = AttributePropertyCache[AttributeName];
-        TargetSet = CachedPair.Key;
-        Property = CachedPair.Value;
-    }
-    else
-    {
-        // Search all attribute sets
-        TArray<UAttributeSet*> AllSets = { CurrentAttributeSet, WeaponAttributeSet, ArmorAttributeSet, AmmoAttributeSet };
-
-        for (UAttributeSet* Set : AllSets)
-        {
-            if (!Set) continue;
-
-            if (FProperty* FoundProperty = FindAttributeProperty(Set, AttributeName))
-            {
-                TargetSet = Set;
-                Property = FoundProperty;
-                AttributePropertyCache.Add(AttributeName, TPair<UAttributeSet*, FProperty*>(Set, FoundProperty));
-                break;
-            }
-        }
-    }
-
-    if (!TargetSet || !Property)
+    int32 Index = INDEX_NONE;
+    if (!FindAttributeAccessor(AttributeName, TargetSet, Index))
     {
         EQUIPMENT_LOG(Warning, TEXT("Attribute not found: %s"), *AttributeName);
         return;
     }
 
+    const FSuspenseCoreAttributeAccessorTable& Table = FSuspenseCoreAttributeAccessorTable::Get(TargetSet->GetClass());
+
     // Get old value for broadcast
-    float OldValue = GetAttributeValueFromProperty(TargetSet, Property);
+    float OldValue = Table.GetValue(TargetSet, Index);
 
     // Set new value through GAS for proper validation
     if (CachedASC)
     {
-        // Create a gameplay effect to modify the attribute
-        FGameplayAttribute Attribute = GetGameplayAttributeFromProperty(TargetSet, Property);
+        const FGameplayAttribute& Attribute = Table.GetAccessor(Index).Attribute;
         if (Attribute.IsValid())
         {
             CachedASC->SetNumericAttributeBase(Attribute, NewValue);
@@ -779,7 +734,7 @@ void USuspenseCoreEquipmentAttributeComponent::SetAttributeValue(const FString&
     else
     {
         // Fallback to direct set
-        SetAttributeValueToProperty(TargetSet, Property, NewValue);
+        Table.SetValue(TargetSet, Index, NewValue);
     }
 
     // Broadcast change
@@ -798,25 +753,37 @@ TMap<FString, float> USuspenseCoreEquipmentAttributeComponent::GetAllAttributeVa
 
     TArray<UAttributeSet*> AllSets = { CurrentAttributeSet, WeaponAttributeSet, ArmorAttributeSet, AmmoAttributeSet };
 
+    TArray<float> Values;
     for (UAttributeSet* Set : AllSets)
     {
         if (!Set) continue;
 
-        for (TFieldIterator<FProperty> It(Set->GetClass()); It; ++It)
+        const FSuspenseCoreAttributeAccessorTable& Table = FSuspenseCoreAttributeAccessorTable::Get(Set->GetClass());
+        ReadAttributeValues(Set, Values);
+
+        for (int32 Index = 0; Index < Values.Num(); ++Index)
         {
-            FProperty* Property = *It;
-            if (Property && Property->HasAnyPropertyFlags(CPF_BlueprintVisible))
-            {
-                FString PropertyName = Property->GetName();
-                float Value = GetAttributeValueFromProperty(Set, Property);
-                Result.Add(PropertyName, Value);
-            }
+            Result.Add(Table.GetAccessor(Index).Name, Values[Index]);
         }
     }
 
     return Result;
 }
 
+int32 USuspenseCoreEquipmentAttributeComponent::ReadAttributeValues(const UAttributeSet* AttributeSet, TArray<float>& OutValues) const
+{
+    if (!AttributeSet)
+    {
+        OutValues.Reset();
+        return 0;
+    }
+
+    const FSuspenseCoreAttributeAccessorTable& Table = FSuspenseCoreAttributeAccessorTable::Get(AttributeSet->GetClass());
+    OutValues.SetNumUninitialized(Table.NumVisible(), EAllowShrinking::No);
+    Table.ReadVisibleValues(AttributeSet, OutValues);
+    return OutValues.Num();
+}
+
 bool USuspenseCoreEquipmentAttributeComponent::HasAttribute(const FString& AttributeName) const
 {
     float DummyValue;
@@ -887,22 +854,22 @@ void USuspenseCoreEquipmentAttributeComponent::CollectReplicatedAttributes()
 
     TArray<UAttributeSet*> AllSets = { CurrentAttributeSet, WeaponAttributeSet, ArmorAttributeSet, AmmoAttributeSet };
 
+    TArray<float> Values;
     for (UAttributeSet* Set : AllSets)
     {
         if (!Set) continue;
 
-        for (TFieldIterator<FProperty> It(Set->GetClass()); It; ++It)
+        const FSuspenseCoreAttributeAccessorTable& Table = FSuspenseCoreAttributeAccessorTable::Get(Set->GetClass());
+        ReadAttributeValues(Set, Values);
+
+        for (int32 Index = 0; Index < Values.Num(); ++Index)
         {
-            FProperty* Property = *It;
-            if (Property && Property->HasAnyPropertyFlags(CPF_BlueprintVisible))
-            {
-                FSuspenseCoreReplicatedAttributeData Data;
-                Data.AttributeName = Property->GetName();
-                Data.CurrentValue = GetAttributeValueFromProperty(Set, Property);
-                Data.BaseValue = Data.CurrentValue; // Could be enhanced to track base vs current
+            FSuspenseCoreReplicatedAttributeData Data;
+            Data.AttributeName = Table.GetAccessor(Index).Name;
+            Data.CurrentValue = Values[Index];
+            Data.BaseValue = Data.CurrentValue; // Could be enhanced to track base vs current
 
-                ReplicatedAttributes.Add(Data);
-            }
+            ReplicatedAttributes.Add(Data);
         }
     }
 }
@@ -1028,16 +995,29 @@ FProperty* USuspenseCoreEquipmentAttributeComponent::FindAttributeProperty(UAttr
         return nullptr;
     }
 
-    for (TFieldIterator<FProperty> It(AttributeSet->GetClass()); It; ++It)
+    const FSuspenseCoreAttributeAccessorTable& Table = FSuspenseCoreAttributeAccessorTable::Get(AttributeSet->GetClass());
+    const int32 Index = Table.FindIndex(AttributeName);
+    return Index != INDEX_NONE ? Table.GetAccessor(Index).Property : nullptr;
+}
+
+bool USuspenseCoreEquipmentAttributeComponent::FindAttributeAccessor(const FString& AttributeName, UAttributeSet*& OutSet, int32& OutIndex) const
+{
+    UAttributeSet* AllSets[] = { CurrentAttributeSet, WeaponAttributeSet, ArmorAttributeSet, AmmoAttributeSet };
+
+    for (UAttributeSet* Set : AllSets)
     {
-        FProperty* Property = *It;
-        if (Property && Property->GetName() == AttributeName)
+        if (!Set) continue;
+
+        const int32 Index = FSuspenseCoreAttributeAccessorTable::Get(Set->GetClass()).FindIndex(AttributeName);
+        if (Index != INDEX_NONE)
         {
-            return Property;
+            OutSet = Set;
+            OutIndex = Index;
+            return true;
         }
     }
 
-    return nullptr;
+    return false;
 }
 
 float USuspenseCoreEquipmentAttributeComponent::GetAttributeValueFromProperty(UAttributeSet* AttributeSet, FProperty* Property) const
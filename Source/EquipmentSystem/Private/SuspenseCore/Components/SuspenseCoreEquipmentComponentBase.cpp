@@ -579,10 +579,10 @@ void USuspenseCoreEquipmentComponentBase::BroadcastItemEquipped(const FSuspenseC
     const int32 SlotIndex = GetSlotIndexFromTag(SlotType);
 
     FSuspenseCoreEventData EventData = FSuspenseCoreEventData::Create(GetOwner())
-        .SetString(TEXT("ItemID"), ItemInstance.ItemID.ToString())
+        .SetName(TEXT("ItemID"), ItemInstance.ItemID)
         .SetInt(TEXT("Quantity"), ItemInstance.Quantity)
-        .SetString(TEXT("SlotType"), SlotType.ToString())
-        .SetString(TEXT("InstanceID"), ItemInstance.InstanceID.ToString())
+        .SetGameplayTag(TEXT("SlotType"), SlotType)
+        .SetGuid(TEXT("InstanceID"), ItemInstance.InstanceID)
         .SetInt(TEXT("Slot"), SlotIndex);  // Slot index for VisualizationService
 
     // Set Target actor for VisualizationService (GetOwner() is the character)
@@ -611,10 +611,10 @@ void USuspenseCoreEquipmentComponentBase::BroadcastItemUnequipped(const FSuspens
     const int32 SlotIndex = GetSlotIndexFromTag(SlotType);
 
     FSuspenseCoreEventData EventData = FSuspenseCoreEventData::Create(GetOwner())
-        .SetString(TEXT("ItemID"), ItemInstance.ItemID.ToString())
+        .SetName(TEXT("ItemID"), ItemInstance.ItemID)
         .SetInt(TEXT("Quantity"), ItemInstance.Quantity)
-        .SetString(TEXT("SlotType"), SlotType.ToString())
-        .SetString(TEXT("InstanceID"), ItemInstance.InstanceID.ToString())
+        .SetGameplayTag(TEXT("SlotType"), SlotType)
+        .SetGuid(TEXT("InstanceID"), ItemInstance.InstanceID)
         .SetInt(TEXT("Slot"), SlotIndex);
 
     // Set Target actor for VisualizationService
@@ -660,8 +660,8 @@ void USuspenseCoreEquipmentComponentBase::BroadcastEquipmentStateChanged(const F
     }
 
     FSuspenseCoreEventData EventData = FSuspenseCoreEventData::Create(GetOwner())
-        .SetString(TEXT("OldState"), OldState.ToString())
-        .SetString(TEXT("NewState"), NewState.ToString())
+        .SetGameplayTag(TEXT("OldState"), OldState)
+        .SetGameplayTag(TEXT("NewState"), NewState)
         .SetBool(TEXT("Interrupted"), bInterrupted);
 
     Manager->GetEventBus()->Publish(
@@ -743,7 +743,7 @@ void USuspenseCoreEquipmentComponentBase::BroadcastWeaponFired(const FVector& Or
         .SetVector(TEXT("Origin"), Origin)
         .SetVector(TEXT("Impact"), Impact)
         .SetBool(TEXT("Success"), bSuccess)
-        .SetString(TEXT("FireMode"), FireMode.ToString());
+        .SetGameplayTag(TEXT("FireMode"), FireMode);
 
     Manager->GetEventBus()->Publish(
         SuspenseCoreEquipmentTags::Event::TAG_Equipment_Event_Weapon_Fired,
@@ -770,7 +770,7 @@ void USuspenseCoreEquipmentComponentBase::BroadcastFireModeChanged(const FGamepl
     }
 
     FSuspenseCoreEventData EventData = FSuspenseCoreEventData::Create(GetOwner())
-        .SetString(TEXT("FireMode"), NewFireMode.ToString())
+        .SetGameplayTag(TEXT("FireMode"), NewFireMode)
         .SetString(TEXT("DisplayName"), FireModeDisplayName.ToString())
         .SetFloat(TEXT("Spread"), CurrentSpread);
 
@@ -218,8 +218,8 @@ bool USuspenseCoreMagazineComponent::InsertMagazineInternal(const FSuspenseCoreM
                 FSuspenseCoreEventData EventData;
                 EventData.SetInt(TEXT("CurrentRounds"), WeaponAmmoState.InsertedMagazine.CurrentRoundCount);
                 EventData.SetInt(TEXT("MaxCapacity"), WeaponAmmoState.InsertedMagazine.MaxCapacity);
-                EventData.SetString(TEXT("LoadedAmmoType"), WeaponAmmoState.InsertedMagazine.LoadedAmmoID.ToString());
-                EventData.SetString(TEXT("MagazineID"), WeaponAmmoState.InsertedMagazine.MagazineID.ToString());
+                EventData.SetName(TEXT("LoadedAmmoType"), WeaponAmmoState.InsertedMagazine.LoadedAmmoID);
+                EventData.SetName(TEXT("MagazineID"), WeaponAmmoState.InsertedMagazine.MagazineID);
                 EventData.SetBool(TEXT("HasChamberedRound"), WeaponAmmoState.ChamberedRound.IsChambered());
                 EventBus->Publish(SuspenseCoreEquipmentTags::Magazine::TAG_Equipment_Event_Magazine_Inserted, EventData);
             }
@@ -276,7 +276,7 @@ FSuspenseCoreMagazineInstance USuspenseCoreMagazineComponent::EjectMagazineInter
         if (USuspenseCoreEventBus* EventBus = EventManager->GetEventBus())
         {
             FSuspenseCoreEventData EventData;
-            EventData.SetString(TEXT("EjectedMagazineID"), EjectedMag.MagazineID.ToString());
+            EventData.SetName(TEXT("EjectedMagazineID"), EjectedMag.MagazineID);
             EventData.SetInt(TEXT("EjectedRounds"), EjectedMag.CurrentRoundCount);
             EventData.SetBool(TEXT("DroppedToGround"), bDropToGround);
             EventBus->Publish(SuspenseCoreEquipmentTags::Magazine::TAG_Equipment_Event_Magazine_Ejected, EventData);
@@ -436,7 +436,7 @@ bool USuspenseCoreMagazineComponent::SwapMagazineFromQuickSlot(int32 QuickSlotIn
         {
             FSuspenseCoreEventData EventData;
             EventData.SetInt(TEXT("QuickSlotIndex"), QuickSlotIndex);
-            EventData.SetString(TEXT("NewMagazineID"), NewMagazine.MagazineID.ToString());
+            EventData.SetName(TEXT("NewMagazineID"), NewMagazine.MagazineID);
             EventData.SetInt(TEXT("NewMagazineRounds"), NewMagazine.CurrentRoundCount);
             // Include fields for UI widgets compatibility
             EventData.SetInt(TEXT("CurrentRounds"), WeaponAmmoState.InsertedMagazine.CurrentRoundCount);
@@ -445,7 +445,7 @@ bool USuspenseCoreMagazineComponent::SwapMagazineFromQuickSlot(int32 QuickSlotIn
             EventData.SetBool(TEXT("EmergencyDrop"), bEmergencyDrop);
             if (bHadMagazine)
             {
-                EventData.SetString(TEXT("OldMagazineID"), OldMagazine.MagazineID.ToString());
+                EventData.SetName(TEXT("OldMagazineID"), OldMagazine.MagazineID);
                 EventData.SetInt(TEXT("OldMagazineRounds"), OldMagazine.CurrentRoundCount);
             }
             EventBus->Publish(SuspenseCoreEquipmentTags::Magazine::TAG_Equipment_Event_Magazine_Swapped, EventData);
@@ -496,7 +496,7 @@ bool USuspenseCoreMagazineComponent::ChamberRoundInternal()
                 static const FGameplayTag ChamberTag = FGameplayTag::RequestGameplayTag(FName("SuspenseCore.Event.Equipment.Chamber.Chambered"));
 
                 FSuspenseCoreEventData EventData;
-                EventData.SetString(TEXT("AmmoID"), WeaponAmmoState.ChamberedRound.AmmoID.ToString());
+                EventData.SetName(TEXT("AmmoID"), WeaponAmmoState.ChamberedRound.AmmoID);
                 EventBus->Publish(ChamberTag, EventData);
             }
         }
@@ -1133,7 +1133,7 @@ bool USuspenseCoreMagazineComponent::ReturnMagazineToOwner(const FSuspenseCoreMa
             if (USuspenseCoreEventBus* EventBus = EventManager->GetEventBus())
             {
                 FSuspenseCoreEventData EventData;
-                EventData.SetString(TEXT("MagazineID"), EjectedMagazine.MagazineID.ToString());
+                EventData.SetName(TEXT("MagazineID"), EjectedMagazine.MagazineID);
                 EventData.SetInt(TEXT("Rounds"), EjectedMagazine.CurrentRoundCount);
                 EventData.SetInt(TEXT("SlotIndex"), StoredSlotIndex);
                 EventData.SetInt(TEXT("SourceSlotIndex"), EjectedMagazine.SourceQuickSlotIndex);
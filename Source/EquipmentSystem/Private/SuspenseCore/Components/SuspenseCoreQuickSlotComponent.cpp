@@ -871,10 +871,10 @@ void USuspenseCoreQuickSlotComponent::NotifySlotChanged(int32 SlotIndex, const F
         // Slot assigned - publish with item data
         FSuspenseCoreEventData EventData;
         EventData.SetInt(TEXT("SlotIndex"), SlotIndex);
-        EventData.SetString(TEXT("ItemID"), QuickSlots[SlotIndex].AssignedItemID.ToString());
+        EventData.SetName(TEXT("ItemID"), QuickSlots[SlotIndex].AssignedItemID);
         // CRITICAL: Include InstanceID so UIProvider can properly cache the item
         // Without this, OnQuickSlotAssigned in UIProvider cannot create a valid cache entry
-        EventData.SetString(TEXT("InstanceID"), QuickSlots[SlotIndex].AssignedItemInstanceID.ToString());
+        EventData.SetGuid(TEXT("InstanceID"), QuickSlots[SlotIndex].AssignedItemInstanceID);
 
         // Check if it's a magazine
         bool bIsMagazine = StoredMagazines.IsValidIndex(SlotIndex) && StoredMagazines[SlotIndex].IsValid();
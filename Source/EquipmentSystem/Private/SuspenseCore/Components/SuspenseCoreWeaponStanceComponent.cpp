@@ -745,10 +745,10 @@ void USuspenseCoreWeaponStanceComponent::OnStanceChangeRequested(FGameplayTag Ev
 	UE_LOG(LogTemp, Warning, TEXT("[StanceComp] OnStanceChangeRequested received"));
 
 	// Extract event data
-	const FString* WeaponTypeStr = EventData.StringPayload.Find(TEXT("WeaponType"));
-	const bool* bIsDrawn = EventData.BoolPayload.Find(TEXT("IsDrawn"));
-	const bool* bIsGrenade = EventData.BoolPayload.Find(TEXT("IsGrenade"));
-	const bool* bIsMedical = EventData.BoolPayload.Find(TEXT("IsMedical"));
+	const FString* WeaponTypeStr = EventData.FindString(TEXT("WeaponType"));
+	const bool* bIsDrawn = EventData.FindBool(TEXT("IsDrawn"));
+	const bool* bIsGrenade = EventData.FindBool(TEXT("IsGrenade"));
+	const bool* bIsMedical = EventData.FindBool(TEXT("IsMedical"));
 
 	// Store current state for restoration
 	StoredPreviousWeaponType = CurrentWeaponType;
@@ -9,6 +9,7 @@
 #include "TimerManager.h"
 #include "GameFramework/Actor.h"
 #include "Engine/Engine.h"
+#include "SuspenseCore/Tags/SuspenseCoreEquipmentNativeTags.h"
 
 //========================================
 // Helper: Convert FSuspenseCoreInventoryItemInstance to FSuspenseCoreItemInstance
@@ -450,8 +451,8 @@ bool USuspenseCoreEquipmentTransactionProcessor::RollbackTransaction(const FGuid
                 FEquipmentDelta Delta = CreateDeltaFromOperation(Op, TransactionId);
                 
                 // Mark as revert and swap before/after
-                Delta.ChangeType = FGameplayTag::RequestGameplayTag(TEXT("Equipment.Delta.Revert"));
-                Delta.ReasonTag = FGameplayTag::RequestGameplayTag(TEXT("Equipment.Reason.Rollback"));
+                Delta.ChangeType = SuspenseCoreEquipmentTags::Delta::TAG_Equipment_Delta_Revert;
+                Delta.ReasonTag = SuspenseCoreEquipmentTags::Reason::TAG_Equipment_Reason_Rollback;
                 FSuspenseCoreInventoryItemInstance Temp = Delta.ItemBefore;
                 Delta.ItemBefore = Delta.ItemAfter;
                 Delta.ItemAfter = Temp;
@@ -1398,7 +1399,7 @@ FTransactionValidationResult USuspenseCoreEquipmentTransactionProcessor::Validat
         }
         
         // Handle global operations
-        if (!bCanApply && Op.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Global"))))
+        if (!bCanApply && Op.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Global))
         {
             TestSnapshot.Version++;
             TestSnapshot.Timestamp = FDateTime::Now();
@@ -1796,20 +1797,20 @@ bool USuspenseCoreEquipmentTransactionProcessor::ExecuteCommit(FTransactionExecu
     for (const FTransactionOperation& Op : Context.Operations)
     {
         const bool bIsSetLike =
-            Op.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Set"))) ||
-            Op.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Equip"))) ||
-            Op.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.MoveTarget"))) ||
-            Op.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Upgrade"))) ||
-            Op.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Modify")));
+            Op.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Set) ||
+            Op.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Equip) ||
+            Op.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_MoveTarget) ||
+            Op.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Upgrade) ||
+            Op.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Modify);
 
         const bool bIsClearLike =
-            Op.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Clear"))) ||
-            Op.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Unequip"))) ||
-            Op.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Drop"))) ||
-            Op.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.MoveSource")));
+            Op.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Clear) ||
+            Op.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Unequip) ||
+            Op.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Drop) ||
+            Op.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_MoveSource);
 
         const bool bIsSwap =
-            Op.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Swap")));
+            Op.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Swap);
 
         if (bIsSetLike)
         {
@@ -1853,7 +1854,7 @@ bool USuspenseCoreEquipmentTransactionProcessor::ExecuteCommit(FTransactionExecu
         }
 
         // Глобальные/прочие
-        if (Op.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Global"))))
+        if (Op.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Global))
         {
             // При необходимости — обрабатывайте специфические глобальные действия
             continue;
@@ -1908,20 +1909,20 @@ bool USuspenseCoreEquipmentTransactionProcessor::ApplyOperation(
     };
 
     const bool bIsSetLike =
-        Operation.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Set")))   ||
-        Operation.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Equip"))) ||
-        Operation.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.MoveTarget"))) ||
-        Operation.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Upgrade"))) ||
-        Operation.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Modify")));
+        Operation.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Set)   ||
+        Operation.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Equip) ||
+        Operation.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_MoveTarget) ||
+        Operation.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Upgrade) ||
+        Operation.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Modify);
 
     const bool bIsClearLike =
-        Operation.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Clear")))   ||
-        Operation.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Unequip"))) ||
-        Operation.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Drop")))    ||
-        Operation.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.MoveSource")));
+        Operation.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Clear)   ||
+        Operation.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Unequip) ||
+        Operation.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Drop)    ||
+        Operation.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_MoveSource);
 
     const bool bIsSwap =
-        Operation.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Swap")));
+        Operation.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Swap);
 
     // SET/Equip/MoveTarget
     if (bIsSetLike && Operation.SlotIndex >= 0)
@@ -1983,7 +1984,7 @@ bool USuspenseCoreEquipmentTransactionProcessor::ApplyOperation(
         return false;
     }
 
-    if (Operation.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Global"))))
+    if (Operation.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Global))
     {
         // Глобальный «touch»
         TouchSnapshot();
@@ -2199,9 +2200,9 @@ void USuspenseCoreEquipmentTransactionProcessor::NotifyTransactionStateChange(
     if (bGenerateDeltas && OnTransactionDelta.IsBound())
     {
         FEquipmentDelta StateDelta;
-        StateDelta.ChangeType = FGameplayTag::RequestGameplayTag(TEXT("Equipment.Delta.StateChange"));
+        StateDelta.ChangeType = SuspenseCoreEquipmentTags::Delta::TAG_Equipment_Delta_StateChange;
         StateDelta.SlotIndex = INDEX_NONE; // Global change
-        StateDelta.ReasonTag = FGameplayTag::RequestGameplayTag(TEXT("Equipment.Reason.StateTransition"));
+        StateDelta.ReasonTag = SuspenseCoreEquipmentTags::Reason::TAG_Equipment_Reason_StateTransition;
         StateDelta.SourceTransactionId = TransactionId;
         StateDelta.Timestamp = FDateTime::Now();
         StateDelta.Metadata.Add(TEXT("OldState"), UEnum::GetValueAsString(OldState));
@@ -2230,15 +2231,15 @@ FEquipmentTransaction USuspenseCoreEquipmentTransactionProcessor::ConvertToTrans
         Request.Parameters = Op.Metadata;
         
         // Determine operation type from tag
-        if (Op.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Set"))))
+        if (Op.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Set))
         {
             Request.OperationType = EEquipmentOperationType::Equip;
         }
-        else if (Op.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Clear"))))
+        else if (Op.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Clear))
         {
             Request.OperationType = EEquipmentOperationType::Unequip;
         }
-        else if (Op.OperationType.MatchesTag(FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Swap"))))
+        else if (Op.OperationType.MatchesTag(SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Swap))
         {
             Request.OperationType = EEquipmentOperationType::Swap;
         }
@@ -2434,8 +2435,8 @@ bool USuspenseCoreEquipmentTransactionProcessor::CommitTransaction(const FGuid&
         }
         
         // Record metrics
-        // ServiceMetrics.AddDurationMs(TEXT("DeltaPublishMs"), DeltaPublishMs);
-        // ServiceMetrics.RecordValue(TEXT("DeltasPerTransaction"), Deltas.Num());
+        // ServiceMetrics.AddDurationMs(SUSPENSECORE_METRIC_ID("DeltaPublishMs"), DeltaPublishMs);
+        // ServiceMetrics.RecordValue(SUSPENSECORE_METRIC_ID("DeltasPerTransaction"), Deltas.Num());
     }
     
     return bSuccess;
@@ -2480,7 +2481,7 @@ FEquipmentDelta USuspenseCoreEquipmentTransactionProcessor::CreateDeltaFromOpera
     else
     {
         // Default reason based on operation type
-        Delta.ReasonTag = FGameplayTag::RequestGameplayTag(TEXT("Equipment.Reason.Transaction"));
+        Delta.ReasonTag = SuspenseCoreEquipmentTags::Reason::TAG_Equipment_Reason_Transaction;
     }
     
     Delta.SourceTransactionId = TransactionId;
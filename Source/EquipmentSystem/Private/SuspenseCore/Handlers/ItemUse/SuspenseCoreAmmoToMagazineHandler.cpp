@@ -359,15 +359,15 @@ void USuspenseCoreAmmoToMagazineHandler::PublishLoadEvent(
 	FSuspenseCoreEventData EventData;
 	EventData.Source = OwnerActor;
 	EventData.Timestamp = FPlatformTime::Seconds();
-	EventData.StringPayload.Add(TEXT("RequestID"), Request.RequestID.ToString());
-	EventData.StringPayload.Add(TEXT("SourceItemID"), Request.SourceItem.ItemID.ToString());
-	EventData.StringPayload.Add(TEXT("TargetItemID"), Request.TargetItem.ItemID.ToString());
-	EventData.IntPayload.Add(TEXT("Result"), static_cast<int32>(Response.Result));
-	EventData.FloatPayload.Add(TEXT("Duration"), Response.Duration);
+	EventData.SetString(TEXT("RequestID"), Request.RequestID.ToString());
+	EventData.SetString(TEXT("SourceItemID"), Request.SourceItem.ItemID.ToString());
+	EventData.SetString(TEXT("TargetItemID"), Request.TargetItem.ItemID.ToString());
+	EventData.SetInt(TEXT("Result"), static_cast<int32>(Response.Result));
+	EventData.SetFloat(TEXT("Duration"), Response.Duration);
 
 	if (Response.Metadata.Contains(TEXT("RoundsLoaded")))
 	{
-		EventData.IntPayload.Add(TEXT("RoundsLoaded"),
+		EventData.SetInt(TEXT("RoundsLoaded"),
 			FCString::Atoi(*Response.Metadata[TEXT("RoundsLoaded")]));
 	}
 
@@ -1019,14 +1019,14 @@ void USuspenseCoreGrenadeHandler::PublishGrenadeEvent(
 	FSuspenseCoreEventData EventData;
 	EventData.Source = OwnerActor;
 	EventData.Timestamp = FPlatformTime::Seconds();
-	EventData.StringPayload.Add(TEXT("RequestID"), Request.RequestID.ToString());
-	EventData.StringPayload.Add(TEXT("GrenadeID"), Request.SourceItem.ItemID.ToString());
-	EventData.IntPayload.Add(TEXT("Result"), static_cast<int32>(Response.Result));
-	EventData.FloatPayload.Add(TEXT("Duration"), Response.Duration);
+	EventData.SetString(TEXT("RequestID"), Request.RequestID.ToString());
+	EventData.SetString(TEXT("GrenadeID"), Request.SourceItem.ItemID.ToString());
+	EventData.SetInt(TEXT("Result"), static_cast<int32>(Response.Result));
+	EventData.SetFloat(TEXT("Duration"), Response.Duration);
 
 	if (Response.Metadata.Contains(TEXT("GrenadeType")))
 	{
-		EventData.IntPayload.Add(TEXT("GrenadeType"),
+		EventData.SetInt(TEXT("GrenadeType"),
 			FCString::Atoi(*Response.Metadata[TEXT("GrenadeType")]));
 	}
 
@@ -1063,7 +1063,7 @@ void USuspenseCoreGrenadeHandler::OnSpawnRequested(FGameplayTag EventTag, const
 
 	// Get grenade ID
 	FName GrenadeID = NAME_None;
-	if (const FString* GrenadeIDStr = EventData.StringPayload.Find(TEXT("GrenadeID")))
+	if (const FString* GrenadeIDStr = EventData.FindString(TEXT("GrenadeID")))
 	{
 		GrenadeID = FName(**GrenadeIDStr);
 	}
@@ -1076,7 +1076,7 @@ void USuspenseCoreGrenadeHandler::OnSpawnRequested(FGameplayTag EventTag, const
 
 	// Get throw parameters
 	FVector ThrowLocation = FVector::ZeroVector;
-	if (const FVector* Location = EventData.VectorPayload.Find(TEXT("ThrowLocation")))
+	if (const FVector* Location = EventData.FindVector(TEXT("ThrowLocation")))
 	{
 		ThrowLocation = *Location;
 	}
@@ -1087,19 +1087,19 @@ void USuspenseCoreGrenadeHandler::OnSpawnRequested(FGameplayTag EventTag, const
 	}
 
 	FVector ThrowDirection = OwnerActor->GetActorForwardVector();
-	if (const FVector* Direction = EventData.VectorPayload.Find(TEXT("ThrowDirection")))
+	if (const FVector* Direction = EventData.FindVector(TEXT("ThrowDirection")))
 	{
 		ThrowDirection = *Direction;
 	}
 
 	float ThrowForce = DefaultThrowForce;
-	if (const float* Force = EventData.FloatPayload.Find(TEXT("ThrowForce")))
+	if (const float* Force = EventData.FindFloat(TEXT("ThrowForce")))
 	{
 		ThrowForce = *Force;
 	}
 
 	float CookTime = 0.0f;
-	if (const float* Cook = EventData.FloatPayload.Find(TEXT("CookTime")))
+	if (const float* Cook = EventData.FindFloat(TEXT("CookTime")))
 	{
 		CookTime = *Cook;
 	}
@@ -1239,7 +1239,7 @@ void USuspenseCoreGrenadeHandler::OnGrenadeEquipped(FGameplayTag EventTag, const
 
 	// Get grenade ID from event
 	FName GrenadeID = NAME_None;
-	if (const FString* GrenadeIDStr = EventData.StringPayload.Find(TEXT("GrenadeID")))
+	if (const FString* GrenadeIDStr = EventData.FindString(TEXT("GrenadeID")))
 	{
 		GrenadeID = FName(**GrenadeIDStr);
 		HANDLER_LOG(Verbose, TEXT("OnGrenadeEquipped: GrenadeID from event = '%s'"), **GrenadeIDStr);
@@ -1260,7 +1260,7 @@ void USuspenseCoreGrenadeHandler::OnGrenadeEquipped(FGameplayTag EventTag, const
 	else
 	{
 		// Try to get GrenadeType tag and use default ID
-		if (const FString* GrenadeTypeStr = EventData.StringPayload.Find(TEXT("GrenadeType")))
+		if (const FString* GrenadeTypeStr = EventData.FindString(TEXT("GrenadeType")))
 		{
 			HANDLER_LOG(Verbose, TEXT("OnGrenadeEquipped: GrenadeID is None, GrenadeType: %s"), **GrenadeTypeStr);
 			// TODO: Map GrenadeType tag to ItemID via DataManager
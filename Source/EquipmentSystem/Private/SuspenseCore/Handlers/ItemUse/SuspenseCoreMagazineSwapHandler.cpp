@@ -301,10 +301,10 @@ void USuspenseCoreMagazineSwapHandler::PublishSwapEvent(
 	FSuspenseCoreEventData EventData;
 	EventData.Source = OwnerActor;
 	EventData.Timestamp = FPlatformTime::Seconds();
-	EventData.StringPayload.Add(TEXT("RequestID"), Request.RequestID.ToString());
-	EventData.StringPayload.Add(TEXT("MagazineID"), Request.SourceItem.ItemID.ToString());
-	EventData.IntPayload.Add(TEXT("QuickSlotIndex"), Request.QuickSlotIndex);
-	EventData.IntPayload.Add(TEXT("Result"), static_cast<int32>(Response.Result));
+	EventData.SetString(TEXT("RequestID"), Request.RequestID.ToString());
+	EventData.SetString(TEXT("MagazineID"), Request.SourceItem.ItemID.ToString());
+	EventData.SetInt(TEXT("QuickSlotIndex"), Request.QuickSlotIndex);
+	EventData.SetInt(TEXT("Result"), static_cast<int32>(Response.Result));
 
 	FGameplayTag EventTag = Response.IsSuccess()
 		? SuspenseCoreItemUseTags::Event::TAG_ItemUse_Event_Completed
@@ -637,8 +637,8 @@ bool USuspenseCoreMedicalUseHandler::ApplyHealOverTime(AActor* Actor, float Heal
 			FSuspenseCoreEventData EventData;
 			EventData.Source = Actor;
 			EventData.Timestamp = FPlatformTime::Seconds();
-			EventData.FloatPayload.Add(TEXT("HealPerTick"), HealPerTick);
-			EventData.FloatPayload.Add(TEXT("Duration"), Duration);
+			EventData.SetFloat(TEXT("HealPerTick"), HealPerTick);
+			EventData.SetFloat(TEXT("Duration"), Duration);
 			EventBus->Publish(SuspenseCoreMedicalTags::Event::TAG_Event_Medical_HoTStarted, EventData);
 		}
 
@@ -689,7 +689,7 @@ int32 USuspenseCoreMedicalUseHandler::CureBleedingEffect(AActor* Actor, bool bCa
 
 		TotalRemoved += Removed;
 
-		// CRITICAL: Notify DoTService to clear ManualDoTCache and publish DoT.Removed event
+		// CRITICAL: Notify DoTService to drop its manual DoT entry and publish DoT.Removed event
 		// ASC delegate OnAnyGameplayEffectRemovedDelegate does NOT fire when effects are removed
 		// via RemoveActiveEffectsWithGrantedTags (UE5 GAS limitation).
 		// We must manually notify DoTService so it clears internal state + publishes events.
@@ -726,7 +726,7 @@ int32 USuspenseCoreMedicalUseHandler::CureBleedingEffect(AActor* Actor, bool bCa
 
 		TotalRemoved += Removed;
 
-		// CRITICAL: Notify DoTService to clear ManualDoTCache and publish DoT.Removed event
+		// CRITICAL: Notify DoTService to drop its manual DoT entry and publish DoT.Removed event
 		// ASC delegate OnAnyGameplayEffectRemovedDelegate does NOT fire when effects are removed
 		// via RemoveActiveEffectsWithGrantedTags (UE5 GAS limitation).
 		// We must manually notify DoTService so it clears internal state + publishes events.
@@ -749,9 +749,9 @@ int32 USuspenseCoreMedicalUseHandler::CureBleedingEffect(AActor* Actor, bool bCa
 		FSuspenseCoreEventData EventData;
 		EventData.Source = Actor;
 		EventData.Timestamp = FPlatformTime::Seconds();
-		EventData.IntPayload.Add(TEXT("BleedingsCured"), TotalRemoved);
-		EventData.BoolPayload.Add(TEXT("LightBleed"), bCanCureLightBleed);
-		EventData.BoolPayload.Add(TEXT("HeavyBleed"), bCanCureHeavyBleed);
+		EventData.SetInt(TEXT("BleedingsCured"), TotalRemoved);
+		EventData.SetBool(TEXT("LightBleed"), bCanCureLightBleed);
+		EventData.SetBool(TEXT("HeavyBleed"), bCanCureHeavyBleed);
 		EventBus->Publish(SuspenseCoreMedicalTags::Event::TAG_Event_Medical_BleedingCured, EventData);
 	}
 
@@ -792,7 +792,7 @@ int32 USuspenseCoreMedicalUseHandler::CureFractureEffect(AActor* Actor) const
 			FSuspenseCoreEventData EventData;
 			EventData.Source = Actor;
 			EventData.Timestamp = FPlatformTime::Seconds();
-			EventData.IntPayload.Add(TEXT("FracturesCured"), TotalRemoved);
+			EventData.SetInt(TEXT("FracturesCured"), TotalRemoved);
 			EventBus->Publish(SuspenseCoreMedicalTags::Event::TAG_Event_Medical_StatusCured, EventData);
 		}
 	}
@@ -914,14 +914,14 @@ void USuspenseCoreMedicalUseHandler::PublishMedicalEvent(
 	FSuspenseCoreEventData EventData;
 	EventData.Source = OwnerActor;
 	EventData.Timestamp = FPlatformTime::Seconds();
-	EventData.StringPayload.Add(TEXT("RequestID"), Request.RequestID.ToString());
-	EventData.StringPayload.Add(TEXT("ItemID"), Request.SourceItem.ItemID.ToString());
-	EventData.IntPayload.Add(TEXT("Result"), static_cast<int32>(Response.Result));
-	EventData.FloatPayload.Add(TEXT("Duration"), Response.Duration);
+	EventData.SetString(TEXT("RequestID"), Request.RequestID.ToString());
+	EventData.SetString(TEXT("ItemID"), Request.SourceItem.ItemID.ToString());
+	EventData.SetInt(TEXT("Result"), static_cast<int32>(Response.Result));
+	EventData.SetFloat(TEXT("Duration"), Response.Duration);
 
 	if (Response.Metadata.Contains(TEXT("HealAmount")))
 	{
-		EventData.FloatPayload.Add(TEXT("HealAmount"),
+		EventData.SetFloat(TEXT("HealAmount"),
 			FCString::Atof(*Response.Metadata[TEXT("HealAmount")]));
 	}
 
@@ -981,7 +981,7 @@ void USuspenseCoreMedicalUseHandler::OnAnimationApplyEffect(FGameplayTag EventTa
 
 	// Extract medical item ID from event data
 	FName MedicalItemID = NAME_None;
-	if (const FString* ItemIDStr = EventData.StringPayload.Find(TEXT("MedicalItemID")))
+	if (const FString* ItemIDStr = EventData.FindString(TEXT("MedicalItemID")))
 	{
 		MedicalItemID = FName(**ItemIDStr);
 	}
@@ -1076,13 +1076,13 @@ void USuspenseCoreMedicalUseHandler::ApplyMedicalEffectsFromAnimation(AActor* Ac
 		FSuspenseCoreEventData HealEvent;
 		HealEvent.Source = Actor;
 		HealEvent.Timestamp = FPlatformTime::Seconds();
-		HealEvent.StringPayload.Add(TEXT("MedicalItemID"), ItemID.ToString());
-		HealEvent.FloatPayload.Add(TEXT("HoTAmount"), HoTAmount);
-		HealEvent.FloatPayload.Add(TEXT("HoTDuration"), HoTDuration);
-		HealEvent.FloatPayload.Add(TEXT("TotalHeal"), HoTAmount * HoTDuration);
-		HealEvent.BoolPayload.Add(TEXT("CuredLightBleed"), bCanCureLightBleed);
-		HealEvent.BoolPayload.Add(TEXT("CuredHeavyBleed"), bCanCureHeavyBleed);
-		HealEvent.BoolPayload.Add(TEXT("CuredFracture"), bCanCureFracture);
+		HealEvent.SetString(TEXT("MedicalItemID"), ItemID.ToString());
+		HealEvent.SetFloat(TEXT("HoTAmount"), HoTAmount);
+		HealEvent.SetFloat(TEXT("HoTDuration"), HoTDuration);
+		HealEvent.SetFloat(TEXT("TotalHeal"), HoTAmount * HoTDuration);
+		HealEvent.SetBool(TEXT("CuredLightBleed"), bCanCureLightBleed);
+		HealEvent.SetBool(TEXT("CuredHeavyBleed"), bCanCureHeavyBleed);
+		HealEvent.SetBool(TEXT("CuredFracture"), bCanCureFracture);
 		EventBus->Publish(SuspenseCoreMedicalTags::Event::TAG_Event_Medical_HealApplied, HealEvent);
 	}
 }
@@ -239,7 +239,7 @@ void USuspenseCoreMedicalVisualHandler::OnMedicalEquipped(
 
 	// Get medical item ID from event
 	FName MedicalItemID = NAME_None;
-	if (const FString* ItemIDStr = EventData.StringPayload.Find(TEXT("MedicalItemID")))
+	if (const FString* ItemIDStr = EventData.FindString(TEXT("MedicalItemID")))
 	{
 		MedicalItemID = FName(**ItemIDStr);
 	}
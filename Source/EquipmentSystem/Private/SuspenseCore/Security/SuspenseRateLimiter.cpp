@@ -0,0 +1,331 @@
+// SuspenseRateLimiter.cpp
+// Copyright SuspenseCore Team. All Rights Reserved.
+
+#include "SuspenseCore/Security/SuspenseRateLimiter.h"
+#include "Hash/CityHash.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogRateLimiter, Log, All);
+
+//========================================
+// FSuspenseRateLimiter
+//========================================
+
+FSuspenseRateLimiter::FSuspenseRateLimiter(int32 InMaxPerSecond, int32 InMaxPerMinute)
+{
+    SetLimits(InMaxPerSecond, InMaxPerMinute);
+}
+
+void FSuspenseRateLimiter::SetLimits(int32 InMaxPerSecond, int32 InMaxPerMinute)
+{
+    // N requests per window W: one request every W/N, and a burst of N
+    // (tolerance W - W/N) is accepted from a full bucket
+    FLimits Limits;
+    Limits.SecondInterval  = InMaxPerSecond > 0 ? 1.0 / InMaxPerSecond : 0.0;
+    Limits.SecondTolerance = InMaxPerSecond > 0 ? 1.0 - Limits.SecondInterval : 0.0;
+    Limits.MinuteInterval  = InMaxPerMinute > 0 ? 60.0 / InMaxPerMinute : 0.0;
+    Limits.MinuteTolerance = InMaxPerMinute > 0 ? 60.0 - Limits.MinuteInterval : 0.0;
+
+    for (FShard& Shard : Shards)
+    {
+        FScopeLock Lock(&Shard.Lock);
+        Shard.Limits = Limits;
+    }
+}
+
+bool FSuspenseRateLimiter::Conforms(double TAT, double Now, double Interval, double Tolerance)
+{
+    return Interval <= 0.0 || (TAT - Now) <= Tolerance;
+}
+
+bool FSuspenseRateLimiter::IsAllowedLocked(const FLimits& Limits, const FSuspenseRateLimitState& State, double Now)
+{
+    if (State.BanExpiryTime > Now)
+    {
+        return false;
+    }
+
+    return Conforms(State.SecondTAT, Now, Limits.SecondInterval, Limits.SecondTolerance)
+        && Conforms(State.MinuteTAT, Now, Limits.MinuteInterval, Limits.MinuteTolerance);
+}
+
+bool FSuspenseRateLimiter::TryAcquire(uint64 Key, double Now)
+{
+    FShard& Shard = GetShard(Key);
+    FScopeLock Lock(&Shard.Lock);
+
+    FSuspenseRateLimitState& State = Shard.States.FindOrAdd(Key);
+    const FLimits& Limits = Shard.Limits;
+    if (!IsAllowedLocked(Limits, State, Now))
+    {
+        // Non-conforming requests do not move the TAT: flooding past the limit
+        // does not push the principal's recovery further out
+        return false;
+    }
+
+    if (State.BanExpiryTime > 0.0)
+    {
+        // Ban expired
+        State.BanExpiryTime = 0.0;
+    }
+
+    if (Limits.SecondInterval > 0.0)
+    {
+        State.SecondTAT = FMath::Max(State.SecondTAT, Now) + Limits.SecondInterval;
+    }
+    if (Limits.MinuteInterval > 0.0)
+    {
+        State.MinuteTAT = FMath::Max(State.MinuteTAT, Now) + Limits.MinuteInterval;
+    }
+    return true;
+}
+
+bool FSuspenseRateLimiter::IsAllowed(uint64 Key, double Now) const
+{
+    const FShard& Shard = GetShard(Key);
+    FScopeLock Lock(&Shard.Lock);
+
+    const FSuspenseRateLimitState* State = Shard.States.Find(Key);
+    return !State || IsAllowedLocked(Shard.Limits, *State, Now);
+}
+
+bool FSuspenseRateLimiter::Ban(uint64 Key, double Until)
+{
+    FShard& Shard = GetShard(Key);
+    FScopeLock Lock(&Shard.Lock);
+
+    FSuspenseRateLimitState* State = Shard.States.Find(Key);
+    if (!State)
+    {
+        return false;
+    }
+
+    State->BanExpiryTime = FMath::Max(State->BanExpiryTime, Until);
+    return true;
+}
+
+int32 FSuspenseRateLimiter::CleanupIdle(double Now)
+{
+    int32 Removed = 0;
+    for (FShard& Shard : Shards)
+    {
+        FScopeLock Lock(&Shard.Lock);
+
+        for (auto It = Shard.States.CreateIterator(); It; ++It)
+        {
+            const FSuspenseRateLimitState& State = It.Value();
+            if (State.SecondTAT <= Now && State.MinuteTAT <= Now && State.BanExpiryTime <= Now)
+            {
+                It.RemoveCurrent();
+                ++Removed;
+            }
+        }
+
+        // Shrink after a flood of one-shot principals
+        if (Shard.States.Num() * 4 < Shard.States.GetMaxIndex())
+        {
+            Shard.States.Compact();
+            Shard.States.Shrink();
+        }
+    }
+    return Removed;
+}
+
+void FSuspenseRateLimiter::Clear()
+{
+    for (FShard& Shard : Shards)
+    {
+        FScopeLock Lock(&Shard.Lock);
+        Shard.States.Empty();
+    }
+}
+
+int32 FSuspenseRateLimiter::Num() const
+{
+    int32 Total = 0;
+    for (const FShard& Shard : Shards)
+    {
+        FScopeLock Lock(&Shard.Lock);
+        Total += Shard.States.Num();
+    }
+    return Total;
+}
+
+uint64 FSuspenseRateLimiter::MakeKey(const FGuid& Guid)
+{
+    const uint64 High = (static_cast<uint64>(Guid.A) << 32) | Guid.B;
+    const uint64 Low  = (static_cast<uint64>(Guid.C) << 32) | Guid.D;
+    return High ^ ((Low << 29) | (Low >> 35)) ^ (Low * 0x9E3779B97F4A7C15ULL);
+}
+
+uint64 FSuspenseRateLimiter::MakeKey(TArrayView<const uint8> AddressBytes)
+{
+    // IPv4 fits as is; longer addresses are hashed
+    if (AddressBytes.Num() <= 8)
+    {
+        uint64 Key = 0;
+        FMemory::Memcpy(&Key, AddressBytes.GetData(), AddressBytes.Num());
+        return Key ^ (static_cast<uint64>(AddressBytes.Num()) << 56);
+    }
+    return CityHash64(reinterpret_cast<const char*>(AddressBytes.GetData()), AddressBytes.Num());
+}
+
+int32 FSuspenseRateLimiter::ShardIndex(uint64 Key)
+{
+    // Top bits of a multiplicative hash: IPv4 keys differ mostly in low bytes
+    return static_cast<int32>((Key * 0x9E3779B97F4A7C15ULL) >> 60) & (NumShards - 1);
+}
+
+//========================================
+// Benchmark
+//========================================
+
+namespace SuspenseRateLimiterBench
+{
+    /** The previous limiter: timestamp array per principal, pruned on every check */
+    struct FLegacyEntry
+    {
+        TArray<float> OperationTimestamps;
+
+        bool IsOperationAllowed(float CurrentTime, int32 MaxPerSecond, int32 MaxPerMinute)
+        {
+            OperationTimestamps.RemoveAll([CurrentTime](float Time) { return (CurrentTime - Time) > 60.0f; });
+
+            int32 OpsInLastSecond = 0;
+            for (float Time : OperationTimestamps)
+            {
+                if ((CurrentTime - Time) <= 1.0f)
+                {
+                    OpsInLastSecond++;
+                }
+            }
+            return OpsInLastSecond < MaxPerSecond && OperationTimestamps.Num() < MaxPerMinute;
+        }
+    };
+}
+
+FString FSuspenseRateLimiter::RunBenchmark(int32 NumPrincipals, int32 RequestsPerSecond, float Seconds)
+{
+    using namespace SuspenseRateLimiterBench;
+
+    NumPrincipals     = FMath::Clamp(NumPrincipals, 1, 100000);
+    RequestsPerSecond = FMath::Clamp(RequestsPerSecond, 1, 1000000);
+    Seconds           = FMath::Clamp(Seconds, 1.0f, 600.0f);
+
+    constexpr int32 MaxPerSecond = 10;
+    constexpr int32 MaxPerMinute = 200;
+
+    // Request stream: 5% of principals send 10x their share
+    const int32 NumAbusers = FMath::Max(1, NumPrincipals / 20);
+    const float AbuserShare = (10.0f * NumAbusers) / (10.0f * NumAbusers + (NumPrincipals - NumAbusers));
+    const int32 NumRequests = FMath::Max(1, FMath::RoundToInt(RequestsPerSecond * Seconds));
+
+    FRandomStream Random(0x5EC0);
+    TArray<int32> Stream;
+    Stream.SetNumUninitialized(NumRequests);
+    for (int32& Principal : Stream)
+    {
+        Principal = Random.FRand() < AbuserShare || NumAbusers == NumPrincipals
+            ? Random.RandHelper(NumAbusers)
+            : NumAbusers + Random.RandHelper(NumPrincipals - NumAbusers);
+    }
+
+    TArray<FString> StringKeys;
+    TArray<uint64> IntKeys;
+    for (int32 Index = 0; Index < NumPrincipals; ++Index)
+    {
+        const uint8 Address[4] = { 10, 0, static_cast<uint8>(Index >> 8), static_cast<uint8>(Index) };
+        StringKeys.Add(FString::Printf(TEXT("10.0.%d.%d:7777"), Address[2], Address[3]));
+        IntKeys.Add(MakeKey(MakeArrayView(Address, 4)));
+    }
+
+    const double Step = 1.0 / RequestsPerSecond;
+
+    // Legacy: FString map, check on a copy of the entry, then record
+    TMap<FString, FLegacyEntry> Legacy;
+    int32 LegacyAllowed = 0;
+    SIZE_T LegacyPeakBytes = 0;
+    const double LegacyStart = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < NumRequests; ++Index)
+    {
+        const float Now = static_cast<float>(Index * Step);
+        const FString& Key = StringKeys[Stream[Index]];
+
+        bool bAllowed = true;
+        if (const FLegacyEntry* Entry = Legacy.Find(Key))
+        {
+            FLegacyEntry EntryCopy = *Entry;
+            bAllowed = EntryCopy.IsOperationAllowed(Now, MaxPerSecond, MaxPerMinute);
+        }
+        if (bAllowed)
+        {
+            Legacy.FindOrAdd(Key).OperationTimestamps.Add(Now);
+            ++LegacyAllowed;
+        }
+
+        // Sample memory once per simulated second
+        if (Index % RequestsPerSecond == 0)
+        {
+            SIZE_T Bytes = Legacy.GetAllocatedSize();
+            for (const TPair<FString, FLegacyEntry>& Pair : Legacy)
+            {
+                Bytes += Pair.Key.GetAllocatedSize() + Pair.Value.OperationTimestamps.GetAllocatedSize();
+            }
+            LegacyPeakBytes = FMath::Max(LegacyPeakBytes, Bytes);
+        }
+    }
+    const double LegacyMs = (FPlatformTime::Seconds() - LegacyStart) * 1000.0;
+
+    // GCRA
+    FSuspenseRateLimiter Limiter(MaxPerSecond, MaxPerMinute);
+    int32 Allowed = 0;
+    SIZE_T PeakBytes = 0;
+    const double Start = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < NumRequests; ++Index)
+    {
+        Allowed += Limiter.TryAcquire(IntKeys[Stream[Index]], Index * Step) ? 1 : 0;
+
+        if (Index % RequestsPerSecond == 0)
+        {
+            SIZE_T Bytes = 0;
+            for (const FShard& Shard : Limiter.Shards)
+            {
+                Bytes += Shard.States.GetAllocatedSize();
+            }
+            PeakBytes = FMath::Max(PeakBytes, Bytes);
+        }
+    }
+    const double GcraMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+    const int32 Evicted = Limiter.CleanupIdle(NumRequests * Step + 60.0);
+
+    return FString::Printf(
+        TEXT("RateLimiter bench: %d principals (%d flooding), %d req/s for %.0f s (%d requests), limits %d/s %d/min\n")
+        TEXT("  Sliding window: %.1f ns/request, %d allowed, peak %llu bytes\n")
+        TEXT("  GCRA:           %.1f ns/request, %d allowed, peak %llu bytes (x%.1f)\n")
+        TEXT("  Idle eviction:  %d of %d principals after 60 s of silence"),
+        NumPrincipals, NumAbusers, RequestsPerSecond, Seconds, NumRequests, MaxPerSecond, MaxPerMinute,
+        LegacyMs * 1e6 / NumRequests, LegacyAllowed, static_cast<uint64>(LegacyPeakBytes),
+        GcraMs * 1e6 / NumRequests, Allowed, static_cast<uint64>(PeakBytes), LegacyMs / FMath::Max(GcraMs, 1e-6),
+        Evicted, NumPrincipals);
+}
+
+#if !UE_BUILD_SHIPPING
+static void HandleRateLimiterBenchCommand(const TArray<FString>& Args)
+{
+    const int32 NumPrincipals     = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 200;
+    const int32 RequestsPerSecond = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 10000;
+    const float Seconds           = Args.Num() > 2 ? FCString::Atof(*Args[2]) : 10.0f;
+
+    const FString Report = FSuspenseRateLimiter::RunBenchmark(NumPrincipals, RequestsPerSecond, Seconds);
+    UE_LOG(LogRateLimiter, Log, TEXT("%s"), *Report);
+}
+
+static FAutoConsoleCommand GSuspenseRateLimiterBenchCommand(
+    TEXT("SuspenseCore.Security.BenchRateLimiter"),
+    TEXT("Benchmark the sliding-window rate limiter vs GCRA. Args: [Principals=200] [RequestsPerSecond=10000] [Seconds=10]"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&HandleRateLimiterBenchCommand)
+);
+#endif
@@ -453,9 +453,9 @@ void USuspenseCoreAmmoLoadingService::CancelOperationWithReason(const FGuid& Mag
     if (USuspenseCoreEventBus* Bus = EventBus.Get())
     {
         FSuspenseCoreEventData EventData;
-        EventData.SetString(TEXT("MagazineInstanceID"), MagazineInstanceID.ToString());
-        EventData.SetString(TEXT("SourceContainerID"), Operation->Request.SourceContainerID.ToString());
-        EventData.SetString(TEXT("AmmoID"), Operation->Request.AmmoID.ToString());
+        EventData.SetGuid(TEXT("MagazineInstanceID"), MagazineInstanceID);
+        EventData.SetGuid(TEXT("SourceContainerID"), Operation->Request.SourceContainerID);
+        EventData.SetName(TEXT("AmmoID"), Operation->Request.AmmoID);
         EventData.SetInt(TEXT("RoundsProcessed"), Operation->RoundsProcessed);
         EventData.SetInt(TEXT("RoundsRemaining"), Operation->RoundsRemaining);
         EventData.SetFloat(TEXT("Progress"), GetLoadingProgress(MagazineInstanceID));
@@ -789,9 +789,9 @@ void USuspenseCoreAmmoLoadingService::ProcessLoadingTick(FSuspenseCoreActiveLoad
             if (USuspenseCoreEventBus* Bus = EventBus.Get())
             {
                 FSuspenseCoreEventData RoundLoadedData;
-                RoundLoadedData.SetString(TEXT("MagazineInstanceID"), Operation.Request.MagazineInstanceID.ToString());
-                RoundLoadedData.SetString(TEXT("SourceContainerID"), Operation.Request.SourceContainerID.ToString());
-                RoundLoadedData.SetString(TEXT("AmmoID"), Operation.Request.AmmoID.ToString());
+                RoundLoadedData.SetGuid(TEXT("MagazineInstanceID"), Operation.Request.MagazineInstanceID);
+                RoundLoadedData.SetGuid(TEXT("SourceContainerID"), Operation.Request.SourceContainerID);
+                RoundLoadedData.SetName(TEXT("AmmoID"), Operation.Request.AmmoID);
                 RoundLoadedData.SetInt(TEXT("SourceInventorySlot"), Operation.Request.SourceInventorySlot);
                 RoundLoadedData.SetInt(TEXT("NewRoundCount"), Mag->CurrentRoundCount);
                 RoundLoadedData.SetInt(TEXT("MaxCapacity"), Mag->MaxCapacity);
@@ -854,9 +854,9 @@ void USuspenseCoreAmmoLoadingService::ProcessLoadingTick(FSuspenseCoreActiveLoad
                 if (USuspenseCoreEventBus* Bus = EventBus.Get())
                 {
                     FSuspenseCoreEventData RoundLoadedData;
-                    RoundLoadedData.SetString(TEXT("MagazineInstanceID"), Operation.Request.MagazineInstanceID.ToString());
-                    RoundLoadedData.SetString(TEXT("SourceContainerID"), Operation.Request.SourceContainerID.ToString());
-                    RoundLoadedData.SetString(TEXT("AmmoID"), Operation.Request.AmmoID.ToString());
+                    RoundLoadedData.SetGuid(TEXT("MagazineInstanceID"), Operation.Request.MagazineInstanceID);
+                    RoundLoadedData.SetGuid(TEXT("SourceContainerID"), Operation.Request.SourceContainerID);
+                    RoundLoadedData.SetName(TEXT("AmmoID"), Operation.Request.AmmoID);
                     RoundLoadedData.SetInt(TEXT("SourceInventorySlot"), Operation.Request.SourceInventorySlot);
                     RoundLoadedData.SetInt(TEXT("NewRoundCount"), Mag->CurrentRoundCount);
                     RoundLoadedData.SetInt(TEXT("MaxCapacity"), Mag->MaxCapacity);
@@ -883,9 +883,9 @@ void USuspenseCoreAmmoLoadingService::ProcessLoadingTick(FSuspenseCoreActiveLoad
                 if (USuspenseCoreEventBus* Bus = EventBus.Get())
                 {
                     FSuspenseCoreEventData RoundUnloadedData;
-                    RoundUnloadedData.SetString(TEXT("MagazineInstanceID"), Operation.Request.MagazineInstanceID.ToString());
-                    RoundUnloadedData.SetString(TEXT("SourceContainerID"), Operation.Request.SourceContainerID.ToString());
-                    RoundUnloadedData.SetString(TEXT("AmmoID"), Operation.Request.AmmoID.ToString());
+                    RoundUnloadedData.SetGuid(TEXT("MagazineInstanceID"), Operation.Request.MagazineInstanceID);
+                    RoundUnloadedData.SetGuid(TEXT("SourceContainerID"), Operation.Request.SourceContainerID);
+                    RoundUnloadedData.SetName(TEXT("AmmoID"), Operation.Request.AmmoID);
                     RoundUnloadedData.SetInt(TEXT("NewRoundCount"), Mag->CurrentRoundCount);
                     RoundUnloadedData.SetInt(TEXT("RoundsProcessed"), Operation.RoundsProcessed);
 
@@ -948,9 +948,9 @@ void USuspenseCoreAmmoLoadingService::PublishLoadingEvent(const FGameplayTag& Ev
     }
 
     FSuspenseCoreEventData EventData;
-    EventData.SetString(TEXT("MagazineInstanceID"), MagazineInstanceID.ToString());
-    EventData.SetString(TEXT("SourceContainerID"), Operation.Request.SourceContainerID.ToString());
-    EventData.SetString(TEXT("AmmoID"), Operation.Request.AmmoID.ToString());
+    EventData.SetGuid(TEXT("MagazineInstanceID"), MagazineInstanceID);
+    EventData.SetGuid(TEXT("SourceContainerID"), Operation.Request.SourceContainerID);
+    EventData.SetName(TEXT("AmmoID"), Operation.Request.AmmoID);
     EventData.SetInt(TEXT("RoundsProcessed"), Operation.RoundsProcessed);
     EventData.SetInt(TEXT("RoundsRemaining"), Operation.RoundsRemaining);
     EventData.SetFloat(TEXT("Progress"), GetLoadingProgress(MagazineInstanceID));
@@ -1124,8 +1124,7 @@ void USuspenseCoreAmmoLoadingService::OnInventoryItemMoved(FGameplayTag EventTag
         if (Op.IsActive() && Op.Request.SourceInventorySlot == SourceSlot)
         {
             // Check if the moved item was our ammo source
-            FString ItemIDStr = EventData.GetString(TEXT("ItemID"));
-            if (ItemIDStr == Op.Request.AmmoID.ToString())
+            if (EventData.GetName(TEXT("ItemID")) == Op.Request.AmmoID)
             {
                 AMMO_LOG(Log, TEXT("OnInventoryItemMoved: Ammo source moved during loading magazine %s - cancelling"),
                     *Pair.Key.ToString().Left(8));
@@ -1161,8 +1160,7 @@ void USuspenseCoreAmmoLoadingService::OnInventoryItemRemoved(FGameplayTag EventT
         FSuspenseCoreActiveLoadOperation& Op = Pair.Value;
         if (Op.IsActive() || Op.IsPaused())
         {
-            FString ItemIDStr = EventData.GetString(TEXT("ItemID"));
-            if (ItemIDStr == Op.Request.AmmoID.ToString())
+            if (EventData.GetName(TEXT("ItemID")) == Op.Request.AmmoID)
             {
                 int32 RemovedSlot = EventData.GetInt(TEXT("SlotIndex"));
                 if (RemovedSlot == Op.Request.SourceInventorySlot)
@@ -56,6 +56,7 @@ bool USuspenseCoreEquipmentAbilityService::InitializeService(const FSuspenseCore
     }
 
     ServiceState = ESuspenseCoreServiceLifecycleState::Initializing;
+    ServiceMetrics.SetServiceName(TEXT("EquipmentAbilityService"));
 
     // Ensure valid configuration
     EnsureValidConfig();
@@ -417,8 +418,8 @@ int32 USuspenseCoreEquipmentAbilityService::LoadAbilityMappings(UDataTable* Mapp
         }
     }
 
-    ServiceMetrics.RecordValue(FName("Ability.Mappings.Loaded"), LoadedCount);
-    ServiceMetrics.RecordValue(FName("Ability.Mappings.Invalid"), InvalidCount);
+    ServiceMetrics.RecordValue(SUSPENSECORE_METRIC_ID("Ability.Mappings.Loaded"), LoadedCount);
+    ServiceMetrics.RecordValue(SUSPENSECORE_METRIC_ID("Ability.Mappings.Invalid"), InvalidCount);
 
     if (InvalidCount > 0)
     {
@@ -471,7 +472,7 @@ USuspenseCoreEquipmentAbilityConnector* USuspenseCoreEquipmentAbilityService::Ge
     USuspenseCoreEquipmentAbilityConnector** ExistingConnector = EquipmentConnectors.Find(EquipmentActor);
     if (ExistingConnector && IsValid(*ExistingConnector))
     {
-        ServiceMetrics.Inc(FName("Ability.Connectors.Reused"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Connectors.Reused"));
         return *ExistingConnector;
     }
 
@@ -481,7 +482,7 @@ USuspenseCoreEquipmentAbilityConnector* USuspenseCoreEquipmentAbilityService::Ge
     {
         EquipmentConnectors.Add(EquipmentActor, NewConnector);
         EquipmentToOwnerMap.Add(EquipmentActor, OwnerActor);
-        ServiceMetrics.Inc(FName("Ability.Connectors.Created"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Connectors.Created"));
 
         // Subscribe to equipment destruction
         EquipmentActor->OnDestroyed.AddDynamic(this, &USuspenseCoreEquipmentAbilityService::OnEquipmentActorDestroyed);
@@ -532,7 +533,7 @@ bool USuspenseCoreEquipmentAbilityService::RemoveConnectorForEquipment(AActor* E
         // Remove from owner map
         EquipmentToOwnerMap.Remove(EquipmentActor);
 
-        ServiceMetrics.Inc(FName("Ability.Connectors.Destroyed"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Connectors.Destroyed"));
 
         // Unsubscribe from destruction (safe to call even if not subscribed)
         EquipmentActor->OnDestroyed.RemoveDynamic(this, &USuspenseCoreEquipmentAbilityService::OnEquipmentActorDestroyed);
@@ -575,7 +576,7 @@ bool USuspenseCoreEquipmentAbilityService::GetAbilityMapping(
     if (MappingCache->Get(ItemID, OutMapping))
     {
         CacheHits++;
-        ServiceMetrics.Inc(FName("Ability.Cache.Hit"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Cache.Hit"));
         return true;
     }
 
@@ -590,12 +591,12 @@ bool USuspenseCoreEquipmentAbilityService::GetAbilityMapping(
             ItemID, *Mapping, MappingCacheTTL);
 
         CacheMisses++;
-        ServiceMetrics.Inc(FName("Ability.Cache.Miss"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Cache.Miss"));
         return true;
     }
 
     CacheMisses++;
-    ServiceMetrics.Inc(FName("Ability.Cache.Miss"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Cache.Miss"));
     return false;
 }
 
@@ -681,7 +682,7 @@ void USuspenseCoreEquipmentAbilityService::ProcessEquipmentSpawn(
                 *ItemInstance.ItemID.ToString(),
                 *Mapping.RequiredTags.ToString(),
                 *EquipmentTags.ToString());
-            ServiceMetrics.Inc(FName("Ability.Spawn.BlockedByTags"));
+            ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Spawn.BlockedByTags"));
             return;
         }
 
@@ -695,7 +696,7 @@ void USuspenseCoreEquipmentAbilityService::ProcessEquipmentSpawn(
                 *ItemInstance.ItemID.ToString(),
                 *Mapping.BlockedTags.ToString(),
                 *EquipmentTags.ToString());
-            ServiceMetrics.Inc(FName("Ability.Spawn.BlockedByTags"));
+            ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Spawn.BlockedByTags"));
             return;
         }
     }
@@ -713,7 +714,7 @@ void USuspenseCoreEquipmentAbilityService::ProcessEquipmentSpawn(
         SlotIndex,
         bHasMapping ? TEXT("YES") : TEXT("NO"));
 
-    ServiceMetrics.Inc(FName("Ability.Spawn.Processed"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Spawn.Processed"));
 
     ServiceMetrics.RecordSuccess();
 }
@@ -738,7 +739,7 @@ void USuspenseCoreEquipmentAbilityService::ProcessEquipmentDestroy(AActor* Equip
     // Remove connector and clean up abilities
     if (RemoveConnectorForEquipment(EquipmentActor))
     {
-        ServiceMetrics.Inc(FName("Ability.Destroy.Processed"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Destroy.Processed"));
         ServiceMetrics.RecordSuccess();
     }
     else
@@ -797,7 +798,7 @@ void USuspenseCoreEquipmentAbilityService::UpdateEquipmentAbilities(
                 *GetNameSafe(EquipmentActor),
                 *UpdatedItemInstance.ItemID.ToString());
 
-            ServiceMetrics.Inc(FName("Ability.Updates.Processed"));
+            ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Updates.Processed"));
         }
 
         ServiceMetrics.RecordSuccess();
@@ -853,7 +854,7 @@ int32 USuspenseCoreEquipmentAbilityService::CleanupInvalidConnectors()
         UE_LOG(LogSuspenseCoreEquipmentAbility, Log,
             TEXT("Cleaned up %d invalid equipment connectors"),
             CleanedCount);
-        ServiceMetrics.RecordValue(FName("Ability.Connectors.Cleaned"), CleanedCount);
+        ServiceMetrics.RecordValue(SUSPENSECORE_METRIC_ID("Ability.Connectors.Cleaned"), CleanedCount);
     }
 
     return CleanedCount;
@@ -1042,7 +1043,7 @@ void USuspenseCoreEquipmentAbilityService::OnEquipmentSpawned(FGameplayTag Event
         UE_LOG(LogTemp, Error, TEXT("[ADS DEBUG] AbilityService: ParseSuspenseCoreEventData FAILED!"));
         UE_LOG(LogSuspenseCoreEquipmentAbility, Warning,
             TEXT("Failed to parse equipment spawned event [%s]"), *EventTag.ToString());
-        ServiceMetrics.Inc(FName("Ability.Events.ParseFailed"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Events.ParseFailed"));
         return;
     }
 
@@ -1052,7 +1053,7 @@ void USuspenseCoreEquipmentAbilityService::OnEquipmentSpawned(FGameplayTag Event
         *ItemInstance.ItemID.ToString());
 
     ProcessEquipmentSpawn(EquipmentActor, OwnerActor, ItemInstance);
-    ServiceMetrics.Inc(FName("Ability.Events.Spawned"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Events.Spawned"));
 }
 
 void USuspenseCoreEquipmentAbilityService::OnEquipmentDestroyed(FGameplayTag EventTag, const FSuspenseCoreEventData& EventData)
@@ -1060,12 +1061,12 @@ void USuspenseCoreEquipmentAbilityService::OnEquipmentDestroyed(FGameplayTag Eve
     AActor* EquipmentActor = Cast<AActor>(EventData.GetObject<UObject>(FName("Source")));
     if (!EquipmentActor)
     {
-        ServiceMetrics.Inc(FName("Ability.Events.InvalidSource"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Events.InvalidSource"));
         return;
     }
 
     ProcessEquipmentDestroy(EquipmentActor);
-    ServiceMetrics.Inc(FName("Ability.Events.Destroyed"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Events.Destroyed"));
 }
 
 // === S7 Handlers (SuspenseCore Event format) ===
@@ -1078,11 +1079,11 @@ void USuspenseCoreEquipmentAbilityService::OnEquipped(FGameplayTag EventTag, con
     if (!ParseSuspenseCoreEventData(EventData, ItemInstance, EquipmentActor, OwnerActor))
     {
         UE_LOG(LogSuspenseCoreEquipmentAbility, Warning, TEXT("OnEquipped [%s]: parse failed"), *EventTag.ToString());
-        ServiceMetrics.Inc(FName("Ability.Events.ParseFailed"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Events.ParseFailed"));
         return;
     }
     ProcessEquipmentSpawn(EquipmentActor, OwnerActor, ItemInstance);
-    ServiceMetrics.Inc(FName("Ability.Events.Equipped"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Events.Equipped"));
 }
 
 void USuspenseCoreEquipmentAbilityService::OnUnequipped(FGameplayTag EventTag, const FSuspenseCoreEventData& EventData)
@@ -1096,12 +1097,12 @@ void USuspenseCoreEquipmentAbilityService::OnUnequipped(FGameplayTag EventTag, c
         if (!ParseSuspenseCoreEventData(EventData, Item, EquipmentActor, Owner) || !EquipmentActor)
         {
             UE_LOG(LogSuspenseCoreEquipmentAbility, Warning, TEXT("OnUnequipped [%s]: invalid source"), *EventTag.ToString());
-            ServiceMetrics.Inc(FName("Ability.Events.InvalidSource"));
+            ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Events.InvalidSource"));
             return;
         }
     }
     ProcessEquipmentDestroy(EquipmentActor);
-    ServiceMetrics.Inc(FName("Ability.Events.Unequipped"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Events.Unequipped"));
 }
 
 void USuspenseCoreEquipmentAbilityService::OnAbilitiesRefresh(FGameplayTag EventTag, const FSuspenseCoreEventData& EventData)
@@ -1112,11 +1113,11 @@ void USuspenseCoreEquipmentAbilityService::OnAbilitiesRefresh(FGameplayTag Event
     if (!ParseSuspenseCoreEventData(EventData, ItemInstance, EquipmentActor, OwnerActor))
     {
         UE_LOG(LogSuspenseCoreEquipmentAbility, Warning, TEXT("OnAbilitiesRefresh [%s]: parse failed"), *EventTag.ToString());
-        ServiceMetrics.Inc(FName("Ability.Events.ParseFailed"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Events.ParseFailed"));
         return;
     }
     UpdateEquipmentAbilities(EquipmentActor, ItemInstance);
-    ServiceMetrics.Inc(FName("Ability.Events.Refresh"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Events.Refresh"));
 }
 
 void USuspenseCoreEquipmentAbilityService::OnCommit(FGameplayTag EventTag, const FSuspenseCoreEventData& EventData)
@@ -1127,11 +1128,11 @@ void USuspenseCoreEquipmentAbilityService::OnCommit(FGameplayTag EventTag, const
     if (!ParseSuspenseCoreEventData(EventData, ItemInstance, EquipmentActor, OwnerActor))
     {
         UE_LOG(LogSuspenseCoreEquipmentAbility, Warning, TEXT("OnCommit [%s]: parse failed"), *EventTag.ToString());
-        ServiceMetrics.Inc(FName("Ability.Events.ParseFailed"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Events.ParseFailed"));
         return;
     }
     UpdateEquipmentAbilities(EquipmentActor, ItemInstance);
-    ServiceMetrics.Inc(FName("Ability.Events.Commit"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Ability.Events.Commit"));
 }
 
 void USuspenseCoreEquipmentAbilityService::OnEquipmentActorDestroyed(AActor* DestroyedActor)
@@ -1325,17 +1326,12 @@ bool USuspenseCoreEquipmentAbilityService::ParseSuspenseCoreEventData(
         return false;
     }
 
-    // Parse item data from FSuspenseCoreEventData (uses TMap<FName, FString> for strings)
-    FString ItemIDStr = EventData.GetString(FName("ItemID"));
-    if (!ItemIDStr.IsEmpty())
+    // Parse item data from FSuspenseCoreEventData (typed Name/Guid; string values are parsed by the getters)
+    const FName ItemID = EventData.GetName(FName("ItemID"));
+    if (!ItemID.IsNone())
     {
-        OutItem.ItemID = *ItemIDStr;
-
-        FString InstanceIDStr = EventData.GetString(FName("InstanceID"));
-        if (!InstanceIDStr.IsEmpty())
-        {
-            FGuid::Parse(InstanceIDStr, OutItem.InstanceID);
-        }
+        OutItem.ItemID = ItemID;
+        OutItem.InstanceID = EventData.GetGuid(FName("InstanceID"), OutItem.InstanceID);
 
         // Quantity can be stored as int or string
         int32 Quantity = EventData.GetInt(FName("Quantity"));
@@ -192,6 +192,7 @@ bool USuspenseCoreEquipmentDataService::InitializeService(const FSuspenseCoreSer
         }
 
         ServiceState = ESuspenseCoreServiceLifecycleState::Initializing;
+        ServiceMetrics.SetServiceName(TEXT("EquipmentDataService"));
 
         // ✅ STATELESS MODE: Per-player components are optional
         // Auto-resolve: если инъекции ещё не было — попробуем достать компоненты с Owner (обычно PlayerState/Actor).
@@ -558,7 +559,7 @@ bool USuspenseCoreEquipmentDataService::ShutdownService(bool bForce)
 FGameplayTag USuspenseCoreEquipmentDataService::GetServiceTag() const
 {
     SCOPED_SERVICE_TIMER("Data.GetServiceTag");
-    return FGameplayTag::RequestGameplayTag(TEXT("Service.Equipment.Data"));
+    return FGameplayTag::RequestGameplayTag(TEXT("Service.Equipment.Data")); // tag-lookup-ok: legacy service id, not hot
 }
 
 FGameplayTagContainer USuspenseCoreEquipmentDataService::GetRequiredDependencies() const
@@ -1076,7 +1077,7 @@ FGuid USuspenseCoreEquipmentDataService::SwapSlotItems(int32 SlotA, int32 SlotB)
         // Record BOTH operations for complete DIFF tracking
         // Operation 1: SlotA gets ItemB
         FTransactionOperation OpA;
-        OpA.OperationType = FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Set"));
+        OpA.OperationType = SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Set;
         OpA.SlotIndex = SlotA;
         OpA.ItemBefore = ItemA;
         OpA.ItemAfter = ItemB;
@@ -1087,7 +1088,7 @@ FGuid USuspenseCoreEquipmentDataService::SwapSlotItems(int32 SlotA, int32 SlotB)
 
         // Operation 2: SlotB gets ItemA
         FTransactionOperation OpB;
-        OpB.OperationType = FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Set"));
+        OpB.OperationType = SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Set;
         OpB.SlotIndex = SlotB;
         OpB.ItemBefore = ItemB;
         OpB.ItemAfter = ItemA;
@@ -1210,7 +1211,7 @@ FGuid USuspenseCoreEquipmentDataService::BatchUpdateSlots(const TMap<int32, FSus
             const FSuspenseCoreInventoryItemInstance& NewItem = UpdatePair.Value;
 
             FTransactionOperation UpdateOp;
-            UpdateOp.OperationType = FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Set"));
+            UpdateOp.OperationType = SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Set;
             UpdateOp.SlotIndex = SlotIdx;
             UpdateOp.ItemBefore = DataStore->GetSlotItem(SlotIdx);
             UpdateOp.ItemAfter = NewItem;
@@ -1596,7 +1597,7 @@ void USuspenseCoreEquipmentDataService::SetupEventSubscriptions()
             Service->InvalidateCache(SlotIndex);
 
             // Записываем метрику
-            Service->ServiceMetrics.RecordEvent("Data.SlotChanged", 1);
+            Service->ServiceMetrics.RecordEvent(SUSPENSECORE_METRIC_ID("Data.SlotChanged"), 1);
 
             if (Service->bEnableDetailedLogging)
             {
@@ -1634,7 +1635,7 @@ void USuspenseCoreEquipmentDataService::SetupEventSubscriptions()
                 Service->ConfigCache->Remove(SlotIndex);
             }
 
-            Service->ServiceMetrics.RecordEvent("Data.ConfigChanged", 1);
+            Service->ServiceMetrics.RecordEvent(SUSPENSECORE_METRIC_ID("Data.ConfigChanged"), 1);
 
             if (Service->bEnableDetailedLogging)
             {
@@ -1662,7 +1663,7 @@ void USuspenseCoreEquipmentDataService::SetupEventSubscriptions()
             // При сбросе очищаем все кэши
             Service->InvalidateCache(-1); // -1 означает очистить всё
 
-            Service->ServiceMetrics.RecordEvent("Data.StoreReset", 1);
+            Service->ServiceMetrics.RecordEvent(SUSPENSECORE_METRIC_ID("Data.StoreReset"), 1);
 
             UE_LOG(LogSuspenseCoreEquipmentData, Log,
                 TEXT("OnDataStoreReset: DataStore was reset, all caches cleared"));
@@ -1683,7 +1684,7 @@ void USuspenseCoreEquipmentDataService::SetupEventSubscriptions()
     {
         // Подписываемся на запросы инвалидации кэша от других систем
         EventHandles.Add(EventBus->SubscribeNative(
-            FGameplayTag::RequestGameplayTag(TEXT("SuspenseCore.Event.Cache.Invalidate.Equipment"), false),
+            SuspenseCoreEquipmentTags::Event::TAG_Equipment_Event_Cache_Invalidate,
             this,
             FSuspenseCoreNativeEventCallback::CreateUObject(this, &USuspenseCoreEquipmentDataService::OnCacheInvalidation),
             ESuspenseCoreEventPriority::Normal
@@ -1691,7 +1692,7 @@ void USuspenseCoreEquipmentDataService::SetupEventSubscriptions()
 
         // S8: Subscribe to resend requests (state refresh)
         EventHandles.Add(EventBus->SubscribeNative(
-            FGameplayTag::RequestGameplayTag(TEXT("SuspenseCore.Event.Equipment.RequestResend"), false),
+            SuspenseCoreEquipmentTags::Event::TAG_Equipment_Event_RequestResend,
             this,
             FSuspenseCoreNativeEventCallback::CreateUObject(this, &USuspenseCoreEquipmentDataService::OnResendRequested),
             ESuspenseCoreEventPriority::Normal
@@ -1902,10 +1903,10 @@ void USuspenseCoreEquipmentDataService::BroadcastDelta(const FEquipmentDelta& De
     }
 
     // Determine event type based on operation type in delta
-    const FGameplayTag OperationEquip = FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Equip"));
-    const FGameplayTag OperationSet = FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Set"));
-    const FGameplayTag OperationUnequip = FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Unequip"));
-    const FGameplayTag OperationClear = FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Clear"));
+    const FGameplayTag OperationEquip = SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Equip;
+    const FGameplayTag OperationSet = SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Set;
+    const FGameplayTag OperationUnequip = SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Unequip;
+    const FGameplayTag OperationClear = SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Clear;
 
     FGameplayTag EventTag;
 
@@ -1913,7 +1914,7 @@ void USuspenseCoreEquipmentDataService::BroadcastDelta(const FEquipmentDelta& De
     if (Delta.ChangeType.MatchesTag(OperationEquip) || Delta.ChangeType.MatchesTag(OperationSet))
     {
         // This event triggers visual actor spawn!
-        EventTag = FGameplayTag::RequestGameplayTag(TEXT("SuspenseCore.Event.Equipment.Equipped"));
+        EventTag = SuspenseCoreEquipmentTags::Event::TAG_Equipment_Event_Equipped;
 
         // Add critical metadata for VisualizationService
         EventData.SetInt(FName("Slot"), Delta.SlotIndex);
@@ -1926,7 +1927,7 @@ void USuspenseCoreEquipmentDataService::BroadcastDelta(const FEquipmentDelta& De
     }
     else if (Delta.ChangeType.MatchesTag(OperationUnequip) || Delta.ChangeType.MatchesTag(OperationClear))
     {
-        EventTag = FGameplayTag::RequestGameplayTag(TEXT("SuspenseCore.Event.Equipment.Unequipped"));
+        EventTag = SuspenseCoreEquipmentTags::Event::TAG_Equipment_Event_Unequipped;
         EventData.SetInt(FName("Slot"), Delta.SlotIndex);
 
         UE_LOG(LogSuspenseCoreEquipmentData, Log,
@@ -1935,7 +1936,7 @@ void USuspenseCoreEquipmentDataService::BroadcastDelta(const FEquipmentDelta& De
     else
     {
         // For other operation types use general delta tag
-        EventTag = FGameplayTag::RequestGameplayTag(TEXT("SuspenseCore.Event.Equipment.Delta"));
+        EventTag = SuspenseCoreEquipmentTags::Event::TAG_Equipment_Event_Delta;
         EventData.SetString(FName("Payload"), Delta.ToString());
         EventData.SetString(FName("DeltaType"), Delta.ChangeType.ToString());
         EventData.SetInt(FName("SlotIndex"), Delta.SlotIndex);
@@ -1969,10 +1970,10 @@ void USuspenseCoreEquipmentDataService::BroadcastBatchDeltas(const TArray<FEquip
         return;
     }
 
-    const FGameplayTag OperationEquip = FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Equip"));
-    const FGameplayTag OperationSet = FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Set"));
-    const FGameplayTag OperationUnequip = FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Unequip"));
-    const FGameplayTag OperationClear = FGameplayTag::RequestGameplayTag(TEXT("Equipment.Operation.Clear"));
+    const FGameplayTag OperationEquip = SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Equip;
+    const FGameplayTag OperationSet = SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Set;
+    const FGameplayTag OperationUnequip = SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Unequip;
+    const FGameplayTag OperationClear = SuspenseCoreEquipmentTags::Operation::TAG_Equipment_Operation_Clear;
 
     for (const FEquipmentDelta& Delta : Deltas)
     {
@@ -1990,7 +1991,7 @@ void USuspenseCoreEquipmentDataService::BroadcastBatchDeltas(const TArray<FEquip
 
         if (Delta.ChangeType.MatchesTag(OperationEquip) || Delta.ChangeType.MatchesTag(OperationSet))
         {
-            EventTag = FGameplayTag::RequestGameplayTag(TEXT("SuspenseCore.Event.Equipment.Equipped"));
+            EventTag = SuspenseCoreEquipmentTags::Event::TAG_Equipment_Event_Equipped;
             EventData.SetInt(FName("Slot"), Delta.SlotIndex);
             EventData.SetString(FName("ItemID"), Delta.ItemAfter.ItemID.ToString());
             EventData.SetString(FName("InstanceID"), Delta.ItemAfter.InstanceID.ToString());
@@ -2001,13 +2002,13 @@ void USuspenseCoreEquipmentDataService::BroadcastBatchDeltas(const TArray<FEquip
         }
         else if (Delta.ChangeType.MatchesTag(OperationUnequip) || Delta.ChangeType.MatchesTag(OperationClear))
         {
-            EventTag = FGameplayTag::RequestGameplayTag(TEXT("SuspenseCore.Event.Equipment.Unequipped"));
+            EventTag = SuspenseCoreEquipmentTags::Event::TAG_Equipment_Event_Unequipped;
             EventData.SetInt(FName("Slot"), Delta.SlotIndex);
         }
         else
         {
             // For other operations use general BatchDelta tag
-            EventTag = FGameplayTag::RequestGameplayTag(TEXT("SuspenseCore.Event.Equipment.Delta.Batch"));
+            EventTag = SuspenseCoreEquipmentTags::Event::TAG_Equipment_Event_Delta_Batch;
             EventData.SetString(FName("Payload"), Delta.ToString());
             EventData.SetString(FName("DeltaType"), Delta.ChangeType.ToString());
             EventData.SetInt(FName("SlotIndex"), Delta.SlotIndex);
@@ -2134,13 +2135,13 @@ TArray<FSuspenseCoreEquipmentSlotConfig> USuspenseCoreEquipmentDataService::Crea
     {
         FSuspenseCoreEquipmentSlotConfig Slot(
             ESuspenseCoreEquipmentSlotType::PrimaryWeapon,
-            FGameplayTag::RequestGameplayTag(TEXT("Equipment.Slot.PrimaryWeapon")));
+            SuspenseCoreEquipmentTags::Slot::TAG_Equipment_Slot_PrimaryWeapon);
         Slot.AttachmentSocket = TEXT("weapon_r");
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Weapon.AR")));
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Weapon.DMR")));
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Weapon.SR")));
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Weapon.Shotgun")));
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Weapon.LMG")));
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Weapon_AR);
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Weapon_DMR);
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Weapon_SR);
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Weapon_Shotgun);
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Weapon_LMG);
         EquipmentSlots.Add(Slot);
     }
 
@@ -2148,11 +2149,11 @@ TArray<FSuspenseCoreEquipmentSlotConfig> USuspenseCoreEquipmentDataService::Crea
     {
         FSuspenseCoreEquipmentSlotConfig Slot(
             ESuspenseCoreEquipmentSlotType::SecondaryWeapon,
-            FGameplayTag::RequestGameplayTag(TEXT("Equipment.Slot.SecondaryWeapon")));
+            SuspenseCoreEquipmentTags::Slot::TAG_Equipment_Slot_SecondaryWeapon);
         Slot.AttachmentSocket = TEXT("spine_03");
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Weapon.SMG")));
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Weapon.Shotgun")));
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Weapon.PDW")));
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Weapon_SMG);
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Weapon_Shotgun);
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Weapon_PDW);
         EquipmentSlots.Add(Slot);
     }
 
@@ -2160,10 +2161,10 @@ TArray<FSuspenseCoreEquipmentSlotConfig> USuspenseCoreEquipmentDataService::Crea
     {
         FSuspenseCoreEquipmentSlotConfig Slot(
             ESuspenseCoreEquipmentSlotType::Holster,
-            FGameplayTag::RequestGameplayTag(TEXT("Equipment.Slot.Holster")));
+            SuspenseCoreEquipmentTags::Slot::TAG_Equipment_Slot_Holster);
         Slot.AttachmentSocket = TEXT("thigh_r");
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Weapon.Pistol")));
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Weapon.Revolver")));
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Weapon_Pistol);
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Weapon_Revolver);
         EquipmentSlots.Add(Slot);
     }
 
@@ -2171,9 +2172,9 @@ TArray<FSuspenseCoreEquipmentSlotConfig> USuspenseCoreEquipmentDataService::Crea
     {
         FSuspenseCoreEquipmentSlotConfig Slot(
             ESuspenseCoreEquipmentSlotType::Scabbard,
-            FGameplayTag::RequestGameplayTag(TEXT("Equipment.Slot.Scabbard")));
+            SuspenseCoreEquipmentTags::Slot::TAG_Equipment_Slot_Scabbard);
         Slot.AttachmentSocket = TEXT("spine_02");
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Weapon.Melee.Knife")));
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Weapon_Melee_Knife);
         EquipmentSlots.Add(Slot);
     }
 
@@ -2181,37 +2182,37 @@ TArray<FSuspenseCoreEquipmentSlotConfig> USuspenseCoreEquipmentDataService::Crea
     {
         FSuspenseCoreEquipmentSlotConfig Slot(
             ESuspenseCoreEquipmentSlotType::Headwear,
-            FGameplayTag::RequestGameplayTag(TEXT("Equipment.Slot.Headwear")));
+            SuspenseCoreEquipmentTags::Slot::TAG_Equipment_Slot_Headwear);
         Slot.AttachmentSocket = TEXT("head");
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Armor.Helmet")));
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Gear.Headwear")));
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Armor_Helmet);
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Gear_Headwear);
         EquipmentSlots.Add(Slot);
     }
 
     {
         FSuspenseCoreEquipmentSlotConfig Slot(
             ESuspenseCoreEquipmentSlotType::Earpiece,
-            FGameplayTag::RequestGameplayTag(TEXT("Equipment.Slot.Earpiece")));
+            SuspenseCoreEquipmentTags::Slot::TAG_Equipment_Slot_Earpiece);
         Slot.AttachmentSocket = TEXT("head");
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Gear.Earpiece")));
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Gear_Earpiece);
         EquipmentSlots.Add(Slot);
     }
 
     {
         FSuspenseCoreEquipmentSlotConfig Slot(
             ESuspenseCoreEquipmentSlotType::Eyewear,
-            FGameplayTag::RequestGameplayTag(TEXT("Equipment.Slot.Eyewear")));
+            SuspenseCoreEquipmentTags::Slot::TAG_Equipment_Slot_Eyewear);
         Slot.AttachmentSocket = TEXT("head");
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Gear.Eyewear")));
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Gear_Eyewear);
         EquipmentSlots.Add(Slot);
     }
 
     {
         FSuspenseCoreEquipmentSlotConfig Slot(
             ESuspenseCoreEquipmentSlotType::FaceCover,
-            FGameplayTag::RequestGameplayTag(TEXT("Equipment.Slot.FaceCover")));
+            SuspenseCoreEquipmentTags::Slot::TAG_Equipment_Slot_FaceCover);
         Slot.AttachmentSocket = TEXT("head");
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Gear.FaceCover")));
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Gear_FaceCover);
         EquipmentSlots.Add(Slot);
     }
 
@@ -2219,18 +2220,18 @@ TArray<FSuspenseCoreEquipmentSlotConfig> USuspenseCoreEquipmentDataService::Crea
     {
         FSuspenseCoreEquipmentSlotConfig Slot(
             ESuspenseCoreEquipmentSlotType::BodyArmor,
-            FGameplayTag::RequestGameplayTag(TEXT("Equipment.Slot.BodyArmor")));
+            SuspenseCoreEquipmentTags::Slot::TAG_Equipment_Slot_BodyArmor);
         Slot.AttachmentSocket = TEXT("spine_03");
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Armor.BodyArmor")));
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Armor_BodyArmor);
         EquipmentSlots.Add(Slot);
     }
 
     {
         FSuspenseCoreEquipmentSlotConfig Slot(
             ESuspenseCoreEquipmentSlotType::TacticalRig,
-            FGameplayTag::RequestGameplayTag(TEXT("Equipment.Slot.TacticalRig")));
+            SuspenseCoreEquipmentTags::Slot::TAG_Equipment_Slot_TacticalRig);
         Slot.AttachmentSocket = TEXT("spine_03");
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Gear.TacticalRig")));
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Gear_TacticalRig);
         EquipmentSlots.Add(Slot);
     }
 
@@ -2238,17 +2239,17 @@ TArray<FSuspenseCoreEquipmentSlotConfig> USuspenseCoreEquipmentDataService::Crea
     {
         FSuspenseCoreEquipmentSlotConfig Slot(
             ESuspenseCoreEquipmentSlotType::Backpack,
-            FGameplayTag::RequestGameplayTag(TEXT("Equipment.Slot.Backpack")));
+            SuspenseCoreEquipmentTags::Slot::TAG_Equipment_Slot_Backpack);
         Slot.AttachmentSocket = TEXT("spine_02");
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Gear.Backpack")));
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Gear_Backpack);
         EquipmentSlots.Add(Slot);
     }
 
     {
         FSuspenseCoreEquipmentSlotConfig Slot(
             ESuspenseCoreEquipmentSlotType::SecureContainer,
-            FGameplayTag::RequestGameplayTag(TEXT("Equipment.Slot.SecureContainer")));
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Gear.SecureContainer")));
+            SuspenseCoreEquipmentTags::Slot::TAG_Equipment_Slot_SecureContainer);
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Gear_SecureContainer);
         EquipmentSlots.Add(Slot);
     }
 
@@ -2261,10 +2262,10 @@ TArray<FSuspenseCoreEquipmentSlotConfig> USuspenseCoreEquipmentDataService::Crea
         const FString TagName = FString::Printf(TEXT("Equipment.Slot.QuickSlot%d"), i);
 
         FSuspenseCoreEquipmentSlotConfig Slot(QuickType, FGameplayTag::RequestGameplayTag(*TagName));
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Consumable")));
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Medical")));
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Throwable")));
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Ammo")));
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Consumable);
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Medical);
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Throwable);
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Ammo);
         EquipmentSlots.Add(Slot);
     }
 
@@ -2272,9 +2273,9 @@ TArray<FSuspenseCoreEquipmentSlotConfig> USuspenseCoreEquipmentDataService::Crea
     {
         FSuspenseCoreEquipmentSlotConfig Slot(
             ESuspenseCoreEquipmentSlotType::Armband,
-            FGameplayTag::RequestGameplayTag(TEXT("Equipment.Slot.Armband")));
+            SuspenseCoreEquipmentTags::Slot::TAG_Equipment_Slot_Armband);
         Slot.AttachmentSocket = TEXT("upperarm_l");
-        Slot.AllowedItemTypes.AddTag(FGameplayTag::RequestGameplayTag(TEXT("Item.Gear.Armband")));
+        Slot.AllowedItemTypes.AddTag(SuspenseCoreEquipmentTags::Item::TAG_Item_Gear_Armband);
         EquipmentSlots.Add(Slot);
     }
 
@@ -2402,7 +2403,7 @@ void USuspenseCoreEquipmentDataService::ResetDataStore()
     DataStore->SetActiveWeaponSlot(INDEX_NONE);
 
     // Reset equipment state
-    DataStore->SetEquipmentState(FGameplayTag::RequestGameplayTag(TEXT("Equipment.State.Default")));
+    DataStore->SetEquipmentState(SuspenseCoreEquipmentTags::State::TAG_Equipment_State_Default);
 
     // Reinitialize with default configuration
     InitializeDataStorage();
@@ -430,6 +430,7 @@ bool USuspenseCoreEquipmentNetworkService::InitializeService(const FSuspenseCore
 
     ServiceState  = ESuspenseCoreServiceLifecycleState::Initializing;
     ServiceParams = Params;
+    ServiceMetrics.SetServiceName(TEXT("NetworkService"));
 
     // Create and initialize SecurityService (delegated security responsibility)
     SecurityService = NewObject<USuspenseCoreEquipmentSecurityService>(this);
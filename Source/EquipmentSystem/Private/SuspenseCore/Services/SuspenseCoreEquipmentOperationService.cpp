@@ -41,6 +41,32 @@ static FSuspenseCoreItemInstance ConvertToItemInstance(const FSuspenseCoreInvent
     return Result;
 }
 
+// ===== Queue lock instrumentation =====
+namespace
+{
+    // Время удержания QueueLock: гистограмма в микросекундах (миллисекунды прячут короткие захваты),
+    // p50/p95/p99 видны в ToString/CSV как "QueueLockHold".
+    // Объявлять сразу после FRWScopeLock - разрушается перед освобождением блокировки.
+    class FQueueLockHoldTimer
+    {
+    public:
+        explicit FQueueLockHoldTimer(FSuspenseCoreServiceMetrics& InMetrics)
+            : Metrics(InMetrics)
+            , StartCycles(FPlatformTime::Cycles64())
+        {}
+
+        ~FQueueLockHoldTimer()
+        {
+            const int64 Us = (int64)(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0);
+            Metrics.AddDurationUs(SUSPENSECORE_METRIC_ID("QueueLockHold"), Us);
+        }
+
+    private:
+        FSuspenseCoreServiceMetrics& Metrics;
+        uint64 StartCycles = 0;
+    };
+}
+
 // Service identification tags - using native compile-time tags
 namespace ServiceTags
 {
@@ -97,6 +123,7 @@ bool USuspenseCoreEquipmentOperationService::InitializeService(const FSuspenseCo
     }
 
     ServiceState = ESuspenseCoreServiceLifecycleState::Initializing;
+    ServiceMetrics.SetServiceName(TEXT("OperationService"));
     InitializationTime = FDateTime::Now();
 
     // CRITICAL FIX: Store ServiceLocator reference from params
@@ -115,6 +142,7 @@ bool USuspenseCoreEquipmentOperationService::InitializeService(const FSuspenseCo
 
     // Validate and sanitize configuration
     EnsureValidConfig();
+    PruneHistory();
 
     // Initialize object pools for memory optimization
     if (bEnableObjectPooling)
@@ -135,10 +163,11 @@ bool USuspenseCoreEquipmentOperationService::InitializeService(const FSuspenseCo
     }
 
     // Initialize caching systems with proper constructor signature
-    // Format: FEquipmentCacheManager(float DefaultTTL, int32 MaxEntries)
+    // Format: FEquipmentCacheManager(float DefaultTTL, int32 MaxEntries [, int32 NumShards])
     ValidationCache = MakeShared<FSuspenseCoreEquipmentCacheManager<uint32, FSlotValidationResult>>(
         ValidationCacheTTL,  // Default TTL: 5.0s
-        1000);               // Max entries: 1000
+        1000,                // Max entries: 1000
+        4);                  // Lock stripes: hottest cache in the service
 
     ResultCache = MakeShared<FSuspenseCoreEquipmentCacheManager<FGuid, FEquipmentOperationResult>>(
         ResultCacheTTL,      // Default TTL: 2.0s
@@ -215,11 +244,7 @@ bool USuspenseCoreEquipmentOperationService::ShutdownService(bool bForce)
     {
         FRWScopeLock Lock(QueueLock, SLT_Write);
 
-        for (FSuspenseCoreQueuedOperation* Op : OperationQueue)
-        {
-            ReleaseOperation(Op);
-        }
-        OperationQueue.Empty();
+        ReleaseAllQueuedOperations();
 
         for (auto& BatchPair : ActiveBatches)
         {
@@ -233,8 +258,8 @@ bool USuspenseCoreEquipmentOperationService::ShutdownService(bool bForce)
 
     {
         FRWScopeLock Lock(HistoryLock, SLT_Write);
-        OperationHistory.Empty();
-        RedoStack.Empty();
+        OperationHistory.Reset();
+        RedoStack.Reset();
     }
 
     ValidationCache->Clear();
@@ -369,7 +394,7 @@ bool USuspenseCoreEquipmentOperationService::ValidateService(TArray<FText>& OutE
         }
     }
 
-    ServiceMetrics.Inc(TEXT("ValidateServiceCalls"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("ValidateServiceCalls"));
     return bIsValid;
 }
 
@@ -382,11 +407,7 @@ void USuspenseCoreEquipmentOperationService::ResetService()
         FRWScopeLock Lock(QueueLock, SLT_Write);
 
         // Release all queued operations back to pool
-        for (FSuspenseCoreQueuedOperation* Op : OperationQueue)
-        {
-            ReleaseOperation(Op);
-        }
-        OperationQueue.Empty();
+        ReleaseAllQueuedOperations();
 
         // Release all active batch operations
         for (auto& BatchPair : ActiveBatches)
@@ -406,8 +427,8 @@ void USuspenseCoreEquipmentOperationService::ResetService()
     // Clear operation history and redo stack
     {
         FRWScopeLock Lock(HistoryLock, SLT_Write);
-        OperationHistory.Empty();
-        RedoStack.Empty();
+        OperationHistory.Reset();
+        RedoStack.Reset();
     }
 
     // Clear validation and result caches
@@ -580,47 +601,32 @@ void USuspenseCoreEquipmentOperationService::ProcessOperationQueue()
 
     bIsProcessingQueue = true;
 
-    TArray<FSuspenseCoreQueuedOperation*> BatchToProcess;
+    TArray<FSuspenseCoreQueuedOperation*, TInlineAllocator<16>> BatchToProcess;
     {
         FRWScopeLock Lock(QueueLock, SLT_Write);
+        FQueueLockHoldTimer LockHoldTimer(ServiceMetrics);
 
         if (bClearQueueAfterProcessing)
         {
-            for (FSuspenseCoreQueuedOperation* Op : OperationQueue)
-            {
-                ReleaseOperation(Op);
-            }
-            OperationQueue.Empty();
+            ReleaseAllQueuedOperations();
             bClearQueueAfterProcessing = false;
             bIsProcessingQueue = false;
             return;
         }
 
-        // ВАЖНО: для TArray<T*> предикат принимает (const T&, const T&)
-        OperationQueue.Sort([](const FSuspenseCoreQueuedOperation& A, const FSuspenseCoreQueuedOperation& B)
-        {
-            if (A.Priority != B.Priority)
-            {
-                // выше приоритет — раньше в очереди
-                return A.Priority > B.Priority;
-            }
-            // более раннее время постановки — раньше
-            return A.QueueTime < B.QueueTime;
-        });
-
+        // Куча уже упорядочена по (Priority desc, QueueTime asc) - берём верх, O(log N) на операцию
         const int32 BatchCount = FMath::Min(BatchSize, OperationQueue.Num());
         for (int32 i = 0; i < BatchCount; i++)
         {
-            BatchToProcess.Add(OperationQueue[0]);
-            OperationQueue.RemoveAt(0);
+            BatchToProcess.Add(QueueHeapPop());
         }
     }
 
     for (FSuspenseCoreQueuedOperation* QueuedOp : BatchToProcess)
     {
-        const float QueueTimeSec = FPlatformTime::Seconds() - QueuedOp->QueueTime;
+        const float QueueTimeSec = (float)(FPlatformTime::Seconds() - QueuedOp->QueueTime);
         AverageQueueTime = AverageQueueTime * 0.9f + QueueTimeSec * 0.1f;
-        ServiceMetrics.AddDurationMs(TEXT("QueueLatency"), QueueTimeSec * 1000.0f);
+        ServiceMetrics.AddDurationUs(SUSPENSECORE_METRIC_ID("QueueLatency"), (int64)(QueueTimeSec * 1000000.0f));
 
         const FEquipmentOperationResult Result = ProcessSingleOperation(QueuedOp);
         UpdateStatistics(Result);
@@ -629,7 +635,7 @@ void USuspenseCoreEquipmentOperationService::ProcessOperationQueue()
     }
 
     bIsProcessingQueue = false;
-    ServiceMetrics.Inc(TEXT("QueueProcessingCycles"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("QueueProcessingCycles"));
 }
 
 //========================================
@@ -660,7 +666,7 @@ FEquipmentOperationResult USuspenseCoreEquipmentOperationService::ExecuteImmedia
     // Check if should delegate to server
     if (ShouldDelegateToServer(LocalRequest))
     {
-        ServiceMetrics.Inc(TEXT("DelegatedToServer"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("DelegatedToServer"));
         return DelegateOperationToServer(LocalRequest);
     }
 
@@ -703,13 +709,14 @@ int32 USuspenseCoreEquipmentOperationService::QueueOperationWithPriority(const F
     }
 
     FRWScopeLock Lock(QueueLock, SLT_Write);
+    FQueueLockHoldTimer LockHoldTimer(ServiceMetrics);
 
     if (OperationQueue.Num() >= MaxQueueSize)
     {
         UE_LOG(LogSuspenseCoreEquipmentOperations, Warning,
             TEXT("Queue full - rejecting operation %s"),
             *LocalRequest.OperationId.ToString());
-        ServiceMetrics.Inc(TEXT("QueueRejections"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("QueueRejections"));
         ServiceMetrics.RecordError();
         return INDEX_NONE;
     }
@@ -726,16 +733,17 @@ int32 USuspenseCoreEquipmentOperationService::QueueOperationWithPriority(const F
         if (CoalescedIndex != INDEX_NONE)
         {
             ReleaseOperation(QueuedOp);
-            ServiceMetrics.Inc(TEXT("OperationsCoalesced"));
-            return CoalescedIndex; // Возвращаем реальный индекс объединённой операции
+            ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("OperationsCoalesced"));
+            return CoalescedIndex; // Возвращаем текущую позицию объединённой операции в куче
         }
     }
 
-    int32 Position = OperationQueue.Add(QueuedOp);
+    QueueHeapPush(QueuedOp);
+    const int32 Position = QueuedOp->HeapIndex;
 
     TotalOperationsQueued.fetch_add(1);
     PeakQueueSize = FMath::Max(PeakQueueSize, OperationQueue.Num());
-    ServiceMetrics.Inc(TEXT("OperationsQueued"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("OperationsQueued"));
 
     OnOperationQueued.Broadcast(LocalRequest.OperationId);
 
@@ -802,7 +810,7 @@ FGuid USuspenseCoreEquipmentOperationService::BatchOperations(const TArray<FEqui
     }
 
     OnBatchCompleted.Broadcast(BatchId, bSuccess);
-    ServiceMetrics.Inc(TEXT("BatchesProcessed"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("BatchesProcessed"));
 
     if (bSuccess)
     {
@@ -871,7 +879,7 @@ FGuid USuspenseCoreEquipmentOperationService::BatchOperationsEx(const TArray<FEq
     }
 
     OnBatchCompleted.Broadcast(BatchId, bSuccess);
-    ServiceMetrics.Inc(TEXT("BatchesProcessedEx"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("BatchesProcessedEx"));
 
     return BatchId;
 }
@@ -885,28 +893,27 @@ bool USuspenseCoreEquipmentOperationService::CancelQueuedOperation(const FGuid&
     SCOPED_SERVICE_TIMER("CancelQueuedOperation");
 
     FRWScopeLock Lock(QueueLock, SLT_Write);
+    FQueueLockHoldTimer LockHoldTimer(ServiceMetrics);
 
-    for (int32 i = 0; i < OperationQueue.Num(); i++)
+    FSuspenseCoreQueuedOperation* const* Found = QueuedOperationsById.Find(OperationId);
+    if (!Found)
     {
-        if (OperationQueue[i]->Request.OperationId == OperationId)
-        {
-            FSuspenseCoreQueuedOperation* Op = OperationQueue[i];
-            OperationQueue.RemoveAt(i);
+        return false;
+    }
 
-            ReleaseOperation(Op);
+    FSuspenseCoreQueuedOperation* Op = *Found;
+    QueueHeapRemoveAt(Op->HeapIndex);
 
-            CancelledOperations.fetch_add(1);
-            ServiceMetrics.Inc(TEXT("OperationsCancelled"));
+    ReleaseOperation(Op);
 
-            UE_LOG(LogSuspenseCoreEquipmentOperations, Log,
-                TEXT("Cancelled operation %s"),
-                *OperationId.ToString());
+    CancelledOperations.fetch_add(1);
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("OperationsCancelled"));
 
-            return true;
-        }
-    }
+    UE_LOG(LogSuspenseCoreEquipmentOperations, Log,
+        TEXT("Cancelled operation %s"),
+        *OperationId.ToString());
 
-    return false;
+    return true;
 }
 
 int32 USuspenseCoreEquipmentOperationService::GetQueueSize() const
@@ -932,16 +939,11 @@ void USuspenseCoreEquipmentOperationService::ClearQueue(bool bForce)
 
     int32 ClearedCount = OperationQueue.Num();
 
-    for (FSuspenseCoreQueuedOperation* Op : OperationQueue)
-    {
-        ReleaseOperation(Op);
-    }
-
-    OperationQueue.Empty();
+    ReleaseAllQueuedOperations();
     bClearQueueAfterProcessing = false;
 
     CancelledOperations.fetch_add(ClearedCount);
-    ServiceMetrics.Inc(TEXT("QueueClears"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("QueueClears"));
 
     // Усадка пулов после очистки очереди
     TrimPools(InitialPoolSize);
@@ -998,15 +1000,16 @@ FEquipmentOperationResult USuspenseCoreEquipmentOperationService::UndoLastOperat
                 DataProvider->RestoreSnapshot(Entry.StateBefore);
             }
 
-            RedoStack.Add(Entry);
-            OperationHistory.RemoveAt(i);
-
             FEquipmentOperationResult Result;
             Result.bSuccess = true;
             Result.OperationId = Entry.Request.OperationId;
 
+            // Обычно это последний элемент - сдвиг хвоста кольца пустой
+            RedoStack.Push(MoveTemp(Entry));
+            OperationHistory.RemoveAt(i);
+
             OnOperationCompleted.Broadcast(Result);
-            ServiceMetrics.Inc(TEXT("UndoOperations"));
+            ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("UndoOperations"));
             ServiceMetrics.RecordSuccess();
 
             return Result;
@@ -1044,14 +1047,14 @@ FEquipmentOperationResult USuspenseCoreEquipmentOperationService::RedoLastOperat
         DataProvider->RestoreSnapshot(Entry.StateAfter);
     }
 
-    OperationHistory.Add(Entry);
-
     FEquipmentOperationResult Result;
     Result.bSuccess = true;
     Result.OperationId = Entry.Request.OperationId;
 
+    OperationHistory.Push(MoveTemp(Entry));
+
     OnOperationCompleted.Broadcast(Result);
-    ServiceMetrics.Inc(TEXT("RedoOperations"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("RedoOperations"));
     ServiceMetrics.RecordSuccess();
 
     return Result;
@@ -1065,6 +1068,7 @@ TArray<FSuspenseCoreOperationHistoryEntry> USuspenseCoreEquipmentOperationServic
 
     TArray<FSuspenseCoreOperationHistoryEntry> Result;
     int32 StartIndex = FMath::Max(0, OperationHistory.Num() - MaxCount);
+    Result.Reserve(OperationHistory.Num() - StartIndex);
 
     for (int32 i = StartIndex; i < OperationHistory.Num(); i++)
     {
@@ -1079,10 +1083,10 @@ void USuspenseCoreEquipmentOperationService::ClearHistory()
     SCOPED_SERVICE_TIMER("ClearHistory");
 
     FRWScopeLock Lock(HistoryLock, SLT_Write);
-    OperationHistory.Empty();
-    RedoStack.Empty();
+    OperationHistory.Reset();
+    RedoStack.Reset();
 
-    ServiceMetrics.Inc(TEXT("HistoryClears"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("HistoryClears"));
     UE_LOG(LogSuspenseCoreEquipmentOperations, Log, TEXT("Operation history cleared"));
 }
 
@@ -1092,9 +1096,9 @@ bool USuspenseCoreEquipmentOperationService::CanUndo() const
 
     FRWScopeLock Lock(HistoryLock, SLT_ReadOnly);
 
-    for (const FSuspenseCoreOperationHistoryEntry& Entry : OperationHistory)
+    for (int32 i = OperationHistory.Num() - 1; i >= 0; i--)
     {
-        if (Entry.bCanUndo)
+        if (OperationHistory[i].bCanUndo)
         {
             return true;
         }
@@ -1355,7 +1359,7 @@ bool USuspenseCoreEquipmentOperationService::ExecutePlanTransactional(
                 }
             }
 
-            ServiceMetrics.Inc(TEXT("TransactionsCommitted"));
+            ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("TransactionsCommitted"));
         }
 
         if (bEnableDetailedLogging)
@@ -1540,7 +1544,7 @@ bool USuspenseCoreEquipmentOperationService::ExecutePlanTransactional(
                 return false;
             }
         }
-        ServiceMetrics.Inc(TEXT("TransactionsCommitted"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("TransactionsCommitted"));
     }
 
     if (bEnableDetailedLogging)
@@ -1811,12 +1815,12 @@ bool USuspenseCoreEquipmentOperationService::ProcessBatchUsingPlans(
             return false;
         }
 
-        ServiceMetrics.Inc(TEXT("BatchTransactionsCommitted"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("BatchTransactionsCommitted"));
     }
     else
     {
         TransactionManager->RollbackTransaction(BatchTxnId);
-        ServiceMetrics.Inc(TEXT("BatchTransactionsRolledBack"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("BatchTransactionsRolledBack"));
     }
 
     // Generate per-operation results
@@ -2252,10 +2256,10 @@ FEquipmentOperationResult USuspenseCoreEquipmentOperationService::DelegateOperat
                     );
                 }
 
-                ServiceMetrics.Inc(TEXT("OperationsDelegated"));
+                ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("OperationsDelegated"));
                 if (!PC)
                 {
-                    ServiceMetrics.Inc(TEXT("OperationsDelegatedWithoutPC"));
+                    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("OperationsDelegatedWithoutPC"));
                 }
 
                 UE_LOG(LogSuspenseCoreEquipmentOperations, Verbose,
@@ -2303,7 +2307,7 @@ void USuspenseCoreEquipmentOperationService::StartPrediction(const FEquipmentOpe
     PredictionManager->ApplyPrediction(PredictionId);
 
     OperationToPredictionMap.Add(Request.OperationId, PredictionId);
-    ServiceMetrics.Inc(TEXT("PredictionsStarted"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("PredictionsStarted"));
 }
 
 void USuspenseCoreEquipmentOperationService::ConfirmPrediction(const FGuid& OperationId, const FEquipmentOperationResult& ServerResult)
@@ -2322,56 +2326,180 @@ void USuspenseCoreEquipmentOperationService::ConfirmPrediction(const FGuid& Oper
     if (ServerResult.bSuccess)
     {
         PredictionManager->ConfirmPrediction(*PredictionId, ServerResult);
-        ServiceMetrics.Inc(TEXT("PredictionsConfirmed"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("PredictionsConfirmed"));
     }
     else
     {
         PredictionManager->RollbackPrediction(*PredictionId, ServerResult.ErrorMessage);
-        ServiceMetrics.Inc(TEXT("PredictionsRolledBack"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("PredictionsRolledBack"));
     }
 
     OperationToPredictionMap.Remove(OperationId);
 }
 
-int32 USuspenseCoreEquipmentOperationService::TryCoalesceOperation(FSuspenseCoreQueuedOperation* NewOp)
+bool USuspenseCoreEquipmentOperationService::QueueHeapBefore(const FSuspenseCoreQueuedOperation& A, const FSuspenseCoreQueuedOperation& B)
 {
-    if (!NewOp)
+    if (A.Priority != B.Priority)
     {
-        return INDEX_NONE;
+        // выше приоритет — раньше в очереди
+        return A.Priority > B.Priority;
+    }
+    if (A.QueueTime != B.QueueTime)
+    {
+        // более раннее время постановки — раньше
+        return A.QueueTime < B.QueueTime;
     }
+    // FIFO при равных ключах
+    return A.Sequence < B.Sequence;
+}
+
+USuspenseCoreEquipmentOperationService::FCoalesceKey USuspenseCoreEquipmentOperationService::MakeCoalesceKey(const FSuspenseCoreQueuedOperation& Op)
+{
+    return FCoalesceKey(
+        static_cast<uint8>(Op.Request.OperationType),
+        Op.Request.ItemInstance.ItemID,
+        Op.Request.SourceSlotIndex);
+}
 
-    // Смотрим хвост очереди — только свежие операции
-    const int32 StartIdx = FMath::Max(0, OperationQueue.Num() - CoalescingLookback);
+void USuspenseCoreEquipmentOperationService::QueueHeapSet(int32 HeapIndex, FSuspenseCoreQueuedOperation* Op)
+{
+    OperationQueue[HeapIndex] = Op;
+    Op->HeapIndex = HeapIndex;
+}
 
-    for (int32 i = OperationQueue.Num() - 1; i >= StartIdx; --i)
+void USuspenseCoreEquipmentOperationService::QueueHeapSiftUp(int32 HeapIndex)
+{
+    FSuspenseCoreQueuedOperation* Op = OperationQueue[HeapIndex];
+    while (HeapIndex > 0)
     {
-        FSuspenseCoreQueuedOperation* ExistingOp = OperationQueue[i];
-        if (!ExistingOp)
+        const int32 Parent = (HeapIndex - 1) / 2;
+        if (!QueueHeapBefore(*Op, *OperationQueue[Parent]))
         {
-            continue;
+            break;
         }
+        QueueHeapSet(HeapIndex, OperationQueue[Parent]);
+        HeapIndex = Parent;
+    }
+    QueueHeapSet(HeapIndex, Op);
+}
 
-        // Условие коалесинга: тот же тип, тот же предмет, тот же источник
-        if (ExistingOp->Request.OperationType      == NewOp->Request.OperationType &&
-            ExistingOp->Request.ItemInstance.ItemID == NewOp->Request.ItemInstance.ItemID &&
-            ExistingOp->Request.SourceSlotIndex     == NewOp->Request.SourceSlotIndex)
+void USuspenseCoreEquipmentOperationService::QueueHeapSiftDown(int32 HeapIndex)
+{
+    const int32 Count = OperationQueue.Num();
+    FSuspenseCoreQueuedOperation* Op = OperationQueue[HeapIndex];
+    for (;;)
+    {
+        int32 Child = HeapIndex * 2 + 1;
+        if (Child >= Count)
+        {
+            break;
+        }
+        if (Child + 1 < Count && QueueHeapBefore(*OperationQueue[Child + 1], *OperationQueue[Child]))
+        {
+            ++Child;
+        }
+        if (!QueueHeapBefore(*OperationQueue[Child], *Op))
         {
-            // Обновляем целевой слот/приоритет у существующей операции
-            ExistingOp->Request.TargetSlotIndex = NewOp->Request.TargetSlotIndex;
-            ExistingOp->Priority = FMath::Max(ExistingOp->Priority, NewOp->Priority);
+            break;
+        }
+        QueueHeapSet(HeapIndex, OperationQueue[Child]);
+        HeapIndex = Child;
+    }
+    QueueHeapSet(HeapIndex, Op);
+}
 
-            if (bEnableDetailedLogging)
-            {
-                UE_LOG(LogSuspenseCoreEquipmentOperations, Verbose,
-                    TEXT("Coalesced op %s into existing op at index %d"),
-                    *NewOp->Request.OperationId.ToString(), i);
-            }
+void USuspenseCoreEquipmentOperationService::QueueHeapPush(FSuspenseCoreQueuedOperation* Op)
+{
+    Op->Sequence = NextQueueSequence++;
+    QueueHeapSet(OperationQueue.Add(Op), Op);
+    QueueHeapSiftUp(Op->HeapIndex);
 
-            return i;
-        }
+    // Новейшая операция с этим ключом - кандидат для коалесинга
+    CoalesceIndex.Add(MakeCoalesceKey(*Op), Op);
+    QueuedOperationsById.Add(Op->Request.OperationId, Op);
+}
+
+void USuspenseCoreEquipmentOperationService::QueueHeapRemoveAt(int32 HeapIndex)
+{
+    FSuspenseCoreQueuedOperation* Removed = OperationQueue[HeapIndex];
+
+    const FCoalesceKey Key = MakeCoalesceKey(*Removed);
+    if (FSuspenseCoreQueuedOperation** Indexed = CoalesceIndex.Find(Key); Indexed && *Indexed == Removed)
+    {
+        CoalesceIndex.Remove(Key);
+    }
+    if (FSuspenseCoreQueuedOperation** Indexed = QueuedOperationsById.Find(Removed->Request.OperationId); Indexed && *Indexed == Removed)
+    {
+        QueuedOperationsById.Remove(Removed->Request.OperationId);
+    }
+
+    FSuspenseCoreQueuedOperation* LastOp = OperationQueue.Pop(EAllowShrinking::No);
+    if (LastOp != Removed)
+    {
+        QueueHeapSet(HeapIndex, LastOp);
+        QueueHeapSiftDown(HeapIndex);
+        QueueHeapSiftUp(LastOp->HeapIndex);
     }
 
-    return INDEX_NONE;
+    Removed->HeapIndex = INDEX_NONE;
+}
+
+FSuspenseCoreQueuedOperation* USuspenseCoreEquipmentOperationService::QueueHeapPop()
+{
+    FSuspenseCoreQueuedOperation* Top = OperationQueue[0];
+    QueueHeapRemoveAt(0);
+    return Top;
+}
+
+void USuspenseCoreEquipmentOperationService::ReleaseAllQueuedOperations()
+{
+    for (FSuspenseCoreQueuedOperation* Op : OperationQueue)
+    {
+        Op->HeapIndex = INDEX_NONE;
+        ReleaseOperation(Op);
+    }
+    OperationQueue.Empty();
+    CoalesceIndex.Empty();
+    QueuedOperationsById.Empty();
+}
+
+int32 USuspenseCoreEquipmentOperationService::TryCoalesceOperation(FSuspenseCoreQueuedOperation* NewOp)
+{
+    if (!NewOp || CoalescingLookback <= 0)
+    {
+        return INDEX_NONE;
+    }
+
+    FSuspenseCoreQueuedOperation** Found = CoalesceIndex.Find(MakeCoalesceKey(*NewOp));
+    if (!Found)
+    {
+        return INDEX_NONE;
+    }
+
+    // Только свежие операции: не старше CoalescingLookback постановок
+    FSuspenseCoreQueuedOperation* ExistingOp = *Found;
+    if (NextQueueSequence - ExistingOp->Sequence > static_cast<uint64>(CoalescingLookback))
+    {
+        return INDEX_NONE;
+    }
+
+    // Обновляем целевой слот/приоритет у существующей операции
+    ExistingOp->Request.TargetSlotIndex = NewOp->Request.TargetSlotIndex;
+    if (NewOp->Priority > ExistingOp->Priority)
+    {
+        // Приоритет только растёт - достаточно поднять узел
+        ExistingOp->Priority = NewOp->Priority;
+        QueueHeapSiftUp(ExistingOp->HeapIndex);
+    }
+
+    if (bEnableDetailedLogging)
+    {
+        UE_LOG(LogSuspenseCoreEquipmentOperations, Verbose,
+            TEXT("Coalesced op %s into existing op at index %d"),
+            *NewOp->Request.OperationId.ToString(), ExistingOp->HeapIndex);
+    }
+
+    return ExistingOp->HeapIndex;
 }
 
 void USuspenseCoreEquipmentOperationService::OptimizeQueue()
@@ -2402,11 +2530,11 @@ FEquipmentOperationResult USuspenseCoreEquipmentOperationService::ProcessSingleO
     if (ResultCache->Get(QueuedOp->Request.OperationId, CachedResult))
     {
         CacheHitRate = CacheHitRate * 0.9f + 0.1f;
-        ServiceMetrics.Inc(TEXT("CacheHits"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("CacheHits"));
         return CachedResult;
     }
     CacheHitRate = CacheHitRate * 0.9f;
-    ServiceMetrics.Inc(TEXT("CacheMisses"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("CacheMisses"));
 
     // === Get Executor ===
     FRWScopeLock ExecLock(ExecutorLock, SLT_ReadOnly);
@@ -2520,7 +2648,7 @@ FEquipmentOperationResult USuspenseCoreEquipmentOperationService::ProcessSingleO
     const double ExecutionTime = FPlatformTime::Seconds() - StartTime;
     Success.ExecutionTime = static_cast<float>(ExecutionTime);
     AverageExecutionTime = AverageExecutionTime * 0.9f + static_cast<float>(ExecutionTime) * 0.1f;
-    ServiceMetrics.AddDurationMs(TEXT("OperationExecution"), static_cast<float>(ExecutionTime * 1000.0));
+    ServiceMetrics.AddDurationUs(SUSPENSECORE_METRIC_ID("OperationExecution"), (int64)(ExecutionTime * 1000000.0));
 
     // === 8) Cache/events/logging ===
     ResultCache->Set(QueuedOp->Request.OperationId, Success, ResultCacheTTL);
@@ -2686,16 +2814,16 @@ bool USuspenseCoreEquipmentOperationService::ProcessBatch(
 
         // Update metrics
         TotalBatchesProcessed.fetch_add(1);
-        ServiceMetrics.Inc(TEXT("BatchesCompleted"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("BatchesCompleted"));
         if (bOk)
         {
-            ServiceMetrics.Inc(TEXT("BatchesSucceeded"));
+            ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("BatchesSucceeded"));
         }
         else
         {
-            ServiceMetrics.Inc(TEXT("BatchesFailed"));
+            ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("BatchesFailed"));
         }
-        ServiceMetrics.RecordValue(TEXT("BatchSize"), BatchOps.Num());
+        ServiceMetrics.RecordValue(SUSPENSECORE_METRIC_ID("BatchSize"), BatchOps.Num());
 
         return bOk;
     }
@@ -2769,7 +2897,7 @@ bool USuspenseCoreEquipmentOperationService::ProcessBatch(
                 }
             }
 
-            ServiceMetrics.Inc(TEXT("BatchTransactionsCommitted"));
+            ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("BatchTransactionsCommitted"));
             UE_LOG(LogSuspenseCoreEquipmentOperations, Verbose, TEXT("Committed batch transaction %s - %d operations succeeded"),
                 *BatchTransactionId.ToString(), ProcessedCount);
         }
@@ -2788,18 +2916,18 @@ bool USuspenseCoreEquipmentOperationService::ProcessBatch(
 
     // Update metrics
     TotalBatchesProcessed.fetch_add(1);
-    ServiceMetrics.Inc(TEXT("BatchesCompleted"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("BatchesCompleted"));
 
     if (bAllSuccess)
     {
-        ServiceMetrics.Inc(TEXT("BatchesSucceeded"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("BatchesSucceeded"));
     }
     else
     {
-        ServiceMetrics.Inc(TEXT("BatchesFailed"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("BatchesFailed"));
     }
 
-    ServiceMetrics.RecordValue(TEXT("BatchSize"), BatchOps.Num());
+    ServiceMetrics.RecordValue(SUSPENSECORE_METRIC_ID("BatchSize"), BatchOps.Num());
 
     return bAllSuccess;
 }
@@ -2877,11 +3005,11 @@ FSlotValidationResult USuspenseCoreEquipmentOperationService::ValidateOperationC
     FSlotValidationResult CachedResult;
     if (ValidationCache->Get(CacheKey, CachedResult))
     {
-        ServiceMetrics.Inc(TEXT("ValidationCacheHits"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("ValidationCacheHits"));
         return CachedResult;
     }
 
-    ServiceMetrics.Inc(TEXT("ValidationCacheMisses"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("ValidationCacheMisses"));
 
     FSlotValidationResult Result;
 
@@ -2914,7 +3042,7 @@ FSlotValidationResult USuspenseCoreEquipmentOperationService::ValidateOperationC
 void USuspenseCoreEquipmentOperationService::InvalidateValidationCache()
 {
     ValidationCache->Clear();
-    ServiceMetrics.Inc(TEXT("ValidationCacheInvalidations"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("ValidationCacheInvalidations"));
 }
 
 FGuid USuspenseCoreEquipmentOperationService::BeginOperationTransaction(
@@ -2965,7 +3093,7 @@ void USuspenseCoreEquipmentOperationService::CompleteTransaction(
             {
                 UE_LOG(LogSuspenseCoreEquipmentOperations, Error, TEXT("Commit with deltas failed (%s)"), *TransactionId.ToString());
                 TransactionManager->RollbackTransaction(TransactionId);
-                ServiceMetrics.Inc(TEXT("TransactionsRolledBack"));
+                ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("TransactionsRolledBack"));
                 return;
             }
         }
@@ -2975,17 +3103,17 @@ void USuspenseCoreEquipmentOperationService::CompleteTransaction(
             {
                 UE_LOG(LogSuspenseCoreEquipmentOperations, Error, TEXT("Legacy commit failed (%s)"), *TransactionId.ToString());
                 TransactionManager->RollbackTransaction(TransactionId);
-                ServiceMetrics.Inc(TEXT("TransactionsRolledBack"));
+                ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("TransactionsRolledBack"));
                 return;
             }
         }
 
-        ServiceMetrics.Inc(TEXT("TransactionsCommitted"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("TransactionsCommitted"));
     }
     else
     {
         TransactionManager->RollbackTransaction(TransactionId);
-        ServiceMetrics.Inc(TEXT("TransactionsRolledBack"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("TransactionsRolledBack"));
     }
 }
 
@@ -2995,7 +3123,7 @@ void USuspenseCoreEquipmentOperationService::RecordOperation(const FEquipmentOpe
 {
     FRWScopeLock Lock(HistoryLock, SLT_Write);
 
-    RedoStack.Empty();
+    RedoStack.Reset();
 
     FSuspenseCoreOperationHistoryEntry Entry;
     Entry.Request = Request;
@@ -3013,22 +3141,21 @@ void USuspenseCoreEquipmentOperationService::RecordOperation(const FEquipmentOpe
                       Request.OperationType == EEquipmentOperationType::Swap ||
                       Request.OperationType == EEquipmentOperationType::Move);
 
-    OperationHistory.Add(Entry);
-
-    if (OperationHistory.Num() > MaxHistorySize)
+    // Полное кольцо перезаписывает самую старую запись - без сдвига массива
+    if (OperationHistory.Push(MoveTemp(Entry)))
     {
-        PruneHistory();
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("HistoryEvictions"));
     }
 
-    ServiceMetrics.Inc(TEXT("HistoryEntries"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("HistoryEntries"));
 }
 
 void USuspenseCoreEquipmentOperationService::PruneHistory()
 {
-    while (OperationHistory.Num() > MaxHistorySize)
-    {
-        OperationHistory.RemoveAt(0);
-    }
+    // Ёмкость колец = MaxHistorySize; при уменьшении сохраняются самые свежие записи
+    FRWScopeLock Lock(HistoryLock, SLT_Write);
+    OperationHistory.SetCapacity(MaxHistorySize);
+    RedoStack.SetCapacity(MaxHistorySize);
 }
 
 void USuspenseCoreEquipmentOperationService::PublishOperationEvent(const FEquipmentOperationResult& Result)
@@ -3065,7 +3192,7 @@ void USuspenseCoreEquipmentOperationService::OnValidationRulesChanged(FGameplayT
 void USuspenseCoreEquipmentOperationService::OnDataStateChanged(FGameplayTag EventTag, const FSuspenseCoreEventData& EventData)
 {
     ResultCache->Clear();
-    ServiceMetrics.Inc(TEXT("ResultCacheInvalidations"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("ResultCacheInvalidations"));
 
     UE_LOG(LogSuspenseCoreEquipmentOperations, Verbose,
         TEXT("Data state changed [%s] - result cache cleared"), *EventTag.ToString());
@@ -3126,7 +3253,7 @@ void USuspenseCoreEquipmentOperationService::OnNetworkOperationResult(FGameplayT
         ResultCache->Invalidate(OperationId);
     }
 
-    ServiceMetrics.Inc(TEXT("NetworkResultsProcessed"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("NetworkResultsProcessed"));
 }
 
 void USuspenseCoreEquipmentOperationService::UpdateStatistics(const FEquipmentOperationResult& Result)
@@ -3196,7 +3323,7 @@ void USuspenseCoreEquipmentOperationService::InitializeObjectPools()
         }
     }
 
-    ServiceMetrics.Inc(TEXT("PoolsInitialized"), InitialPoolSize * 2);
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("PoolsInitialized"), InitialPoolSize * 2);
 
     UE_LOG(LogSuspenseCoreEquipmentOperations, Log,
         TEXT("Initialized object pools: %d operations, %d results"),
@@ -3225,7 +3352,7 @@ void USuspenseCoreEquipmentOperationService::CleanupObjectPools()
         }
     }
 
-    ServiceMetrics.Inc(TEXT("PoolsCleaned"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("PoolsCleaned"));
 
     UE_LOG(LogSuspenseCoreEquipmentOperations, Log,
         TEXT("Cleaned up object pools - Total allocations avoided: Operation=%d, Result=%d"),
@@ -3248,12 +3375,12 @@ FSuspenseCoreQueuedOperation* USuspenseCoreEquipmentOperationService::AcquireOpe
         {
             OperationPoolHits.fetch_add(1);
             OperationPoolSize.fetch_sub(1);
-            ServiceMetrics.Inc(TEXT("OperationPoolHits"));
+            ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("OperationPoolHits"));
         }
         else
         {
             OperationPoolMisses.fetch_add(1);
-            ServiceMetrics.Inc(TEXT("OperationPoolMisses"));
+            ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("OperationPoolMisses"));
         }
     }
 
@@ -3296,7 +3423,7 @@ void USuspenseCoreEquipmentOperationService::ReleaseOperation(FSuspenseCoreQueue
     if (OperationPoolSize.load() >= MaxPoolSize)
     {
         PoolOverflows.fetch_add(1);
-        ServiceMetrics.Inc(TEXT("PoolOverflows"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("PoolOverflows"));
         delete Operation;
 
         if (bEnableDetailedLogging)
@@ -3331,12 +3458,12 @@ FEquipmentOperationResult* USuspenseCoreEquipmentOperationService::AcquireResult
         {
             ResultPoolHits.fetch_add(1);
             ResultPoolSize.fetch_sub(1);
-            ServiceMetrics.Inc(TEXT("ResultPoolHits"));
+            ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("ResultPoolHits"));
         }
         else
         {
             ResultPoolMisses.fetch_add(1);
-            ServiceMetrics.Inc(TEXT("ResultPoolMisses"));
+            ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("ResultPoolMisses"));
         }
     }
 
@@ -3377,7 +3504,7 @@ void USuspenseCoreEquipmentOperationService::ReleaseResult(FEquipmentOperationRe
     if (ResultPoolSize.load() >= MaxPoolSize)
     {
         PoolOverflows.fetch_add(1);
-        ServiceMetrics.Inc(TEXT("ResultPoolOverflows"));
+        ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("ResultPoolOverflows"));
         delete Result;
 
         if (bEnableDetailedLogging)
@@ -3461,7 +3588,7 @@ void USuspenseCoreEquipmentOperationService::TrimPools(int32 KeepPerPool)
         }
     }
 
-    ServiceMetrics.Inc(TEXT("PoolsTrimmed"));
+    ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("PoolsTrimmed"));
 
     if (bEnableDetailedLogging)
     {
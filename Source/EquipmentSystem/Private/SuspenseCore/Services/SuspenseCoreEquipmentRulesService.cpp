@@ -100,6 +100,7 @@ bool USuspenseCoreEquipmentRulesService::InitializeService(const FSuspenseCoreSe
     }
 
     ServiceState = ESuspenseCoreServiceLifecycleState::Initializing;
+    ServiceMetrics.SetServiceName(TEXT("RulesService"));
     ServiceParams = Params;
 
     UE_LOG(LogSuspenseCoreEquipmentRules, Log, TEXT(">>> RulesService: Initializing..."));
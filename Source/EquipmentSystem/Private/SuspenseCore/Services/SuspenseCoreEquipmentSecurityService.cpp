@@ -5,6 +5,7 @@
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/PlayerState.h"
 #include "Engine/NetConnection.h"
+#include "IPAddress.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "HAL/PlatformTime.h"
@@ -135,74 +136,6 @@ void FSecurityServiceMetrics::Reset()
     PeakProcessingTimeUs.Store(0);
 }
 
-//========================================
-// FRateLimitEntry
-//========================================
-
-bool FRateLimitEntry::IsOperationAllowed(float CurrentTime, int32 MaxPerSecond, int32 MaxPerMinute)
-{
-    // Check temporary ban
-    if (bIsTemporarilyBanned)
-    {
-        if (CurrentTime < BanExpiryTime)
-        {
-            return false;
-        }
-        // Ban expired
-        bIsTemporarilyBanned = false;
-        ViolationCount = 0;
-    }
-
-    // Clean expired timestamps
-    ClearExpiredTimestamps(CurrentTime);
-
-    // Count operations in last second
-    int32 OpsInLastSecond = 0;
-    for (float Time : OperationTimestamps)
-    {
-        if ((CurrentTime - Time) <= 1.0f)
-        {
-            OpsInLastSecond++;
-        }
-    }
-
-    if (OpsInLastSecond >= MaxPerSecond)
-    {
-        return false;
-    }
-
-    if (OperationTimestamps.Num() >= MaxPerMinute)
-    {
-        return false;
-    }
-
-    return true;
-}
-
-void FRateLimitEntry::RecordOperation(float CurrentTime)
-{
-    OperationTimestamps.Add(CurrentTime);
-    LastOperationTime = CurrentTime;
-}
-
-void FRateLimitEntry::RecordViolation(float CurrentTime, float BanDuration, int32 MaxViolations)
-{
-    ViolationCount++;
-    if (ViolationCount >= MaxViolations)
-    {
-        bIsTemporarilyBanned = true;
-        BanExpiryTime = CurrentTime + BanDuration;
-    }
-}
-
-void FRateLimitEntry::ClearExpiredTimestamps(float CurrentTime)
-{
-    OperationTimestamps.RemoveAll([CurrentTime](float Time)
-    {
-        return (CurrentTime - Time) > 60.0f;
-    });
-}
-
 //========================================
 // USuspenseCoreEquipmentSecurityService
 //========================================
@@ -210,6 +143,7 @@ void FRateLimitEntry::ClearExpiredTimestamps(float CurrentTime)
 USuspenseCoreEquipmentSecurityService::USuspenseCoreEquipmentSecurityService()
 {
     Config = FSecurityServiceConfig::LoadFromConfig();
+    ApplyRateLimitConfig();
 }
 
 USuspenseCoreEquipmentSecurityService::~USuspenseCoreEquipmentSecurityService()
@@ -232,12 +166,14 @@ bool USuspenseCoreEquipmentSecurityService::InitializeService(const FSuspenseCor
     }
 
     ServiceState = ESuspenseCoreServiceLifecycleState::Initializing;
+    ServiceMetrics.SetServiceName(TEXT("SecurityService"));
     ServiceParams = Params;
 
     UE_LOG(LogSuspenseCoreEquipmentSecurity, Log, TEXT(">>> SecurityService: Initializing..."));
 
     // Load configuration
     Config = FSecurityServiceConfig::LoadFromConfig();
+    ApplyRateLimitConfig();
 
     // Initialize secure storage (HMAC keys, nonce cache)
     if (!InitializeSecureStorage())
@@ -311,10 +247,10 @@ bool USuspenseCoreEquipmentSecurityService::ShutdownService(bool bForce)
     ShutdownSecureStorage();
 
     // Clear rate limit data
+    PlayerRateLimiter.Clear();
+    IPRateLimiter.Clear();
     {
         FRWScopeLock Lock(SecurityLock, SLT_Write);
-        RateLimitPerPlayer.Empty();
-        RateLimitPerIP.Empty();
         SuspiciousActivityCount.Empty();
     }
 
@@ -359,8 +295,8 @@ void USuspenseCoreEquipmentSecurityService::ResetService()
 {
     FRWScopeLock Lock(SecurityLock, SLT_Write);
 
-    RateLimitPerPlayer.Empty();
-    RateLimitPerIP.Empty();
+    PlayerRateLimiter.Clear();
+    IPRateLimiter.Clear();
     SuspiciousActivityCount.Empty();
     Metrics.Reset();
 
@@ -385,8 +321,8 @@ FString USuspenseCoreEquipmentSecurityService::GetServiceStats() const
         TEXT("  Suspicious Players: %d\n")
         TEXT("  Nonce Cache: %s\n")
         TEXT("%s"),
-        RateLimitPerPlayer.Num(),
-        RateLimitPerIP.Num(),
+        PlayerRateLimiter.Num(),
+        IPRateLimiter.Num(),
         SuspiciousActivityCount.Num(),
         *NonceCacheStats,
         *Metrics.ToString()
@@ -420,7 +356,7 @@ FSecurityValidationResponse USuspenseCoreEquipmentSecurityService::ValidateReque
 
     Metrics.TotalRequestsProcessed++;
 
-    // 1. Check player rate limit
+    // 1. Check player rate limit (consumes a slot; rejected requests consume nothing)
     if (!CheckPlayerRateLimit(PlayerGuid))
     {
         Response.Result = ESecurityValidationResult::RateLimitExceeded;
@@ -434,8 +370,7 @@ FSecurityValidationResponse USuspenseCoreEquipmentSecurityService::ValidateReque
     // 2. Check IP rate limit (if enabled)
     if (Config.bEnableIPRateLimit && PlayerController)
     {
-        const FString IPAddress = GetIPAddress(PlayerController);
-        if (!IPAddress.IsEmpty() && !CheckIPRateLimit(IPAddress))
+        if (!CheckIPRateLimit(PlayerController))
         {
             Response.Result = ESecurityValidationResult::IPRateLimitExceeded;
             Response.ErrorMessage = TEXT("IP rate limit exceeded");
@@ -472,25 +407,6 @@ FSecurityValidationResponse USuspenseCoreEquipmentSecurityService::ValidateReque
         Metrics.CriticalOperationsProcessed++;
     }
 
-    // Record successful operation in rate limiter
-    {
-        FRWScopeLock Lock(SecurityLock, SLT_Write);
-        const float CurrentTime = FPlatformTime::Seconds();
-
-        FRateLimitEntry& PlayerEntry = RateLimitPerPlayer.FindOrAdd(PlayerGuid);
-        PlayerEntry.RecordOperation(CurrentTime);
-
-        if (Config.bEnableIPRateLimit && PlayerController)
-        {
-            const FString IPAddress = GetIPAddress(PlayerController);
-            if (!IPAddress.IsEmpty())
-            {
-                FRateLimitEntry& IPEntry = RateLimitPerIP.FindOrAdd(IPAddress);
-                IPEntry.RecordOperation(CurrentTime);
-            }
-        }
-    }
-
     Response.Result = ESecurityValidationResult::Valid;
     UpdateMetrics(StartTime);
     return Response;
@@ -708,10 +624,8 @@ void USuspenseCoreEquipmentSecurityService::ReportSuspiciousActivity(
         if (ActivityCount >= Config.MaxSuspiciousActivities)
         {
             // Ban player
-            if (FRateLimitEntry* Entry = RateLimitPerPlayer.Find(FGuid())) // Need to get GUID
+            if (PlayerRateLimiter.Ban(FSuspenseRateLimiter::MakeKey(FGuid()), FPlatformTime::Seconds() + Config.TemporaryBanDuration)) // Need to get GUID
             {
-                Entry->bIsTemporarilyBanned = true;
-                Entry->BanExpiryTime = FPlatformTime::Seconds() + Config.TemporaryBanDuration;
                 Metrics.PlayersTemporarilyBanned++;
             }
         }
@@ -745,6 +659,7 @@ bool USuspenseCoreEquipmentSecurityService::ExportMetrics(const FString& FilePat
 void USuspenseCoreEquipmentSecurityService::ReloadConfiguration()
 {
     Config = FSecurityServiceConfig::LoadFromConfig();
+    ApplyRateLimitConfig();
 
     UE_LOG(LogSuspenseCoreEquipmentSecurity, Log,
         TEXT("SecurityService: Configuration reloaded (MaxOps/s=%d, StrictMode=%s)"),
@@ -758,33 +673,27 @@ void USuspenseCoreEquipmentSecurityService::ReloadConfiguration()
 
 bool USuspenseCoreEquipmentSecurityService::CheckPlayerRateLimit(const FGuid& PlayerGuid)
 {
-    FRWScopeLock Lock(SecurityLock, SLT_ReadOnly);
+    // Check and record in one step: two concurrent requests can no longer both pass a check
+    // made before either was recorded
+    return PlayerRateLimiter.TryAcquire(FSuspenseRateLimiter::MakeKey(PlayerGuid), FPlatformTime::Seconds());
+}
 
-    const FRateLimitEntry* Entry = RateLimitPerPlayer.Find(PlayerGuid);
-    if (!Entry)
+bool USuspenseCoreEquipmentSecurityService::CheckIPRateLimit(APlayerController* PlayerController)
+{
+    uint64 Key = 0;
+    if (!GetIPKey(PlayerController, Key))
     {
-        return true; // No history = allowed
+        return true; // No remote address (listen server host)
     }
-
-    const float CurrentTime = FPlatformTime::Seconds();
-    // Need to cast away const for the check (or make a copy)
-    FRateLimitEntry EntryCopy = *Entry;
-    return EntryCopy.IsOperationAllowed(CurrentTime, Config.MaxOperationsPerSecond, Config.MaxOperationsPerMinute);
+    return IPRateLimiter.TryAcquire(Key, FPlatformTime::Seconds());
 }
 
-bool USuspenseCoreEquipmentSecurityService::CheckIPRateLimit(const FString& IPAddress)
+void USuspenseCoreEquipmentSecurityService::ApplyRateLimitConfig()
 {
-    FRWScopeLock Lock(SecurityLock, SLT_ReadOnly);
+    PlayerRateLimiter.SetLimits(Config.MaxOperationsPerSecond, Config.MaxOperationsPerMinute);
 
-    const FRateLimitEntry* Entry = RateLimitPerIP.Find(IPAddress);
-    if (!Entry)
-    {
-        return true;
-    }
-
-    const float CurrentTime = FPlatformTime::Seconds();
-    FRateLimitEntry EntryCopy = *Entry;
-    return EntryCopy.IsOperationAllowed(CurrentTime, Config.MaxOperationsPerIPPerMinute, Config.MaxOperationsPerIPPerMinute * 10);
+    // Per-IP budget is per minute only; several players may share an address
+    IPRateLimiter.SetLimits(0, Config.MaxOperationsPerIPPerMinute);
 }
 
 bool USuspenseCoreEquipmentSecurityService::IsNonceUsed(uint64 Nonce) const
@@ -836,46 +745,39 @@ FString USuspenseCoreEquipmentSecurityService::GetPlayerIdentifier(APlayerContro
     return FString::Printf(TEXT("Controller_%p"), PlayerController);
 }
 
-FString USuspenseCoreEquipmentSecurityService::GetIPAddress(APlayerController* PlayerController) const
+bool USuspenseCoreEquipmentSecurityService::GetIPKey(APlayerController* PlayerController, uint64& OutKey) const
 {
-    if (!PlayerController)
+    UNetConnection* Connection = PlayerController ? PlayerController->GetNetConnection() : nullptr;
+    if (!Connection)
     {
-        return FString();
+        return false;
+    }
+
+    const TSharedPtr<const FInternetAddr> RemoteAddr = Connection->GetRemoteAddr();
+    if (!RemoteAddr.IsValid())
+    {
+        return false;
     }
 
-    if (UNetConnection* Connection = PlayerController->GetNetConnection())
+    const TArray<uint8> RawIp = RemoteAddr->GetRawIp();
+    if (RawIp.Num() == 0)
     {
-        return Connection->LowLevelGetRemoteAddress(true);
+        return false;
     }
 
-    return FString();
+    OutKey = FSuspenseRateLimiter::MakeKey(RawIp);
+    return true;
 }
 
 void USuspenseCoreEquipmentSecurityService::CleanupExpiredData()
 {
-    FRWScopeLock Lock(SecurityLock, SLT_Write);
+    const double CurrentTime = FPlatformTime::Seconds();
 
-    const float CurrentTime = FPlatformTime::Seconds();
+    // Evict idle principals (buckets refilled, not banned)
+    const int32 PlayersEvicted = PlayerRateLimiter.CleanupIdle(CurrentTime);
+    const int32 IPsEvicted = IPRateLimiter.CleanupIdle(CurrentTime);
 
-    // Cleanup player rate limits
-    for (auto It = RateLimitPerPlayer.CreateIterator(); It; ++It)
-    {
-        It.Value().ClearExpiredTimestamps(CurrentTime);
-        if (It.Value().OperationTimestamps.Num() == 0 && !It.Value().bIsTemporarilyBanned)
-        {
-            It.RemoveCurrent();
-        }
-    }
-
-    // Cleanup IP rate limits
-    for (auto It = RateLimitPerIP.CreateIterator(); It; ++It)
-    {
-        It.Value().ClearExpiredTimestamps(CurrentTime);
-        if (It.Value().OperationTimestamps.Num() == 0 && !It.Value().bIsTemporarilyBanned)
-        {
-            It.RemoveCurrent();
-        }
-    }
+    FRWScopeLock Lock(SecurityLock, SLT_Write);
 
     // Cleanup nonce cache (LRU handles TTL internally)
     if (NonceCache.IsValid())
@@ -884,8 +786,8 @@ void USuspenseCoreEquipmentSecurityService::CleanupExpiredData()
     }
 
     UE_LOG(LogSuspenseCoreEquipmentSecurity, Verbose,
-        TEXT("SecurityService: Cleanup complete (Players=%d, IPs=%d)"),
-        RateLimitPerPlayer.Num(), RateLimitPerIP.Num());
+        TEXT("SecurityService: Cleanup complete (Players=%d, IPs=%d, Evicted=%d/%d)"),
+        PlayerRateLimiter.Num(), IPRateLimiter.Num(), PlayersEvicted, IPsEvicted);
 }
 
 void USuspenseCoreEquipmentSecurityService::UpdateMetrics(double ProcessingStartTime)
@@ -0,0 +1,454 @@
+// SuspenseCoreEquipmentServiceMetrics.cpp
+// Copyright SuspenseCore Team. All Rights Reserved.
+
+#include "SuspenseCore/Services/SuspenseCoreEquipmentServiceMacros.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+static TAutoConsoleVariable<float> CVarSuspenseCoreMetricsPublishInterval(
+    TEXT("suspensecore.metrics.publish_interval"),
+    1.0f,
+    TEXT("How often named service metrics (counts, p50/p95/p99) are pushed to the CSV profiler and Insights counters, in seconds.\n")
+    TEXT("Only services that called SetServiceName are published.\n")
+    TEXT("0: Disabled"),
+    ECVF_Default
+);
+
+#if CSV_PROFILER
+CSV_DEFINE_CATEGORY(SuspenseCoreServices, true);
+#endif
+
+namespace SuspenseCoreServiceMetricsInternal
+{
+    struct FRegistryData
+    {
+        FRWLock Lock;
+        TMap<FName, int32> Ids;                                   // Protected by Lock
+        FName Names[FSuspenseCoreMetricRegistry::MaxMetrics];      // Written once before Count is published
+        std::atomic<int32> Count{0};
+        bool bOverflowReported = false;                           // Protected by Lock
+    };
+
+    static FRegistryData& GetRegistry()
+    {
+        static FRegistryData Registry;
+        return Registry;
+    }
+
+    /** Live named containers, walked by the publish ticker */
+    struct FPublisher
+    {
+        FCriticalSection Lock;
+        TArray<const FSuspenseCoreServiceMetrics*> Instances;    // Protected by Lock
+        FTSTicker::FDelegateHandle TickerHandle;                  // Protected by Lock
+        float SecondsSincePublish = 0.0f;
+
+#if COUNTERSTRACE_ENABLED
+        TMap<FString, uint16> TraceCounters;                      // Protected by Lock
+#endif
+    };
+
+    static FPublisher& GetPublisher()
+    {
+        static FPublisher Publisher;
+        return Publisher;
+    }
+
+    static bool TickPublisher(float DeltaTime)
+    {
+        const float Interval = CVarSuspenseCoreMetricsPublishInterval.GetValueOnGameThread();
+        if (Interval <= 0.0f)
+        {
+            return true;
+        }
+
+        FPublisher& Publisher = GetPublisher();
+        Publisher.SecondsSincePublish += DeltaTime;
+        if (Publisher.SecondsSincePublish < Interval)
+        {
+            return true;
+        }
+        Publisher.SecondsSincePublish = 0.0f;
+
+        FScopeLock L(&Publisher.Lock);
+        for (const FSuspenseCoreServiceMetrics* Metrics : Publisher.Instances)
+        {
+            Metrics->PublishToProfilers();
+        }
+        return true;
+    }
+
+    static void PublishValue(const FString& StatName, double Value)
+    {
+#if CSV_PROFILER
+        FCsvProfiler::RecordCustomStat(FName(*StatName), CSV_CATEGORY_INDEX(SuspenseCoreServices), Value, ECsvCustomStatOp::Set);
+#endif
+
+#if COUNTERSTRACE_ENABLED
+        FPublisher& Publisher = GetPublisher();
+        FScopeLock L(&Publisher.Lock);
+        uint16* CounterId = Publisher.TraceCounters.Find(StatName);
+        if (!CounterId)
+        {
+            CounterId = &Publisher.TraceCounters.Add(StatName,
+                FCountersTrace::OutputInitCounter(*StatName, TraceCounterType_Float, TraceCounterDisplayHint_None));
+        }
+        FCountersTrace::OutputSetValue(*CounterId, Value);
+#endif
+    }
+}
+
+//========================================
+// FSuspenseCoreMetricRegistry
+//========================================
+
+FSuspenseCoreMetricId FSuspenseCoreMetricRegistry::Register(const FName& Name)
+{
+    using namespace SuspenseCoreServiceMetricsInternal;
+    FRegistryData& Registry = GetRegistry();
+
+    FSuspenseCoreMetricId Id;
+    {
+        FRWScopeLock ReadLock(Registry.Lock, SLT_ReadOnly);
+        if (const int32* Existing = Registry.Ids.Find(Name))
+        {
+            Id.Index = *Existing;
+            return Id;
+        }
+    }
+
+    FRWScopeLock WriteLock(Registry.Lock, SLT_Write);
+    if (const int32* Existing = Registry.Ids.Find(Name))
+    {
+        Id.Index = *Existing;
+        return Id;
+    }
+
+    const int32 Index = Registry.Count.load(std::memory_order_relaxed);
+    if (Index >= MaxMetrics)
+    {
+        if (!Registry.bOverflowReported)
+        {
+            Registry.bOverflowReported = true;
+            UE_LOG(LogSuspenseCoreEquipmentOperation, Warning,
+                TEXT("FSuspenseCoreMetricRegistry: table full (%d names), '%s' and later metrics are dropped"),
+                MaxMetrics, *Name.ToString());
+        }
+        return Id;
+    }
+
+    Registry.Names[Index] = Name;
+    Registry.Ids.Add(Name, Index);
+    Registry.Count.store(Index + 1, std::memory_order_release);
+
+    Id.Index = Index;
+    return Id;
+}
+
+FName FSuspenseCoreMetricRegistry::GetName(FSuspenseCoreMetricId Id)
+{
+    const SuspenseCoreServiceMetricsInternal::FRegistryData& Registry = SuspenseCoreServiceMetricsInternal::GetRegistry();
+    if (Id.Index < 0 || Id.Index >= Registry.Count.load(std::memory_order_acquire))
+    {
+        return NAME_None;
+    }
+    return Registry.Names[Id.Index];
+}
+
+int32 FSuspenseCoreMetricRegistry::Num()
+{
+    return SuspenseCoreServiceMetricsInternal::GetRegistry().Count.load(std::memory_order_acquire);
+}
+
+uint32 FSuspenseCoreMetricRegistry::GetThreadShard()
+{
+    static std::atomic<uint32> NextShard{0};
+    thread_local const uint32 Shard = NextShard.fetch_add(1, std::memory_order_relaxed) % FSuspenseCoreServiceMetrics::NumShards;
+    return Shard;
+}
+
+//========================================
+// FSuspenseCoreServiceMetrics
+//========================================
+
+FSuspenseCoreServiceMetrics::FSuspenseCoreServiceMetrics()
+{
+    for (std::atomic<FShard*>& Shard : Shards)
+    {
+        Shard.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+FSuspenseCoreServiceMetrics::~FSuspenseCoreServiceMetrics()
+{
+    {
+        using namespace SuspenseCoreServiceMetricsInternal;
+        FPublisher& Publisher = GetPublisher();
+        FScopeLock L(&Publisher.Lock);
+        Publisher.Instances.RemoveSingleSwap(this);
+        if (Publisher.Instances.Num() == 0 && Publisher.TickerHandle.IsValid())
+        {
+            FTSTicker::GetCoreTicker().RemoveTicker(Publisher.TickerHandle);
+            Publisher.TickerHandle.Reset();
+        }
+    }
+
+    for (std::atomic<FShard*>& ShardPtr : Shards)
+    {
+        FShard* Shard = ShardPtr.exchange(nullptr);
+        if (!Shard)
+        {
+            continue;
+        }
+        for (std::atomic<FSlot*>& SlotPtr : Shard->Slots)
+        {
+            if (FSlot* Slot = SlotPtr.load(std::memory_order_relaxed))
+            {
+                delete Slot->Latency.load(std::memory_order_relaxed);
+                delete Slot;
+            }
+        }
+        delete Shard;
+    }
+}
+
+void FSuspenseCoreServiceMetrics::SetServiceName(const FString& InServiceName)
+{
+    {
+        FScopeLock L(&ServiceNameLock);
+        ServiceName = InServiceName;
+    }
+
+    using namespace SuspenseCoreServiceMetricsInternal;
+    FPublisher& Publisher = GetPublisher();
+    FScopeLock L(&Publisher.Lock);
+    Publisher.Instances.AddUnique(this);
+    if (!Publisher.TickerHandle.IsValid())
+    {
+        Publisher.TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateStatic(&SuspenseCoreServiceMetricsInternal::TickPublisher));
+    }
+}
+
+FString FSuspenseCoreServiceMetrics::GetServiceName() const
+{
+    FScopeLock L(&ServiceNameLock);
+    return ServiceName;
+}
+
+void FSuspenseCoreServiceMetrics::GatherNamed(TArray<FNamedSnapshot>& OutSnapshots) const
+{
+    OutSnapshots.Reset();
+
+    TArray<uint64> Merged;
+    const int32 NumIds = FSuspenseCoreMetricRegistry::Num();
+
+    for (int32 Index = 0; Index < NumIds; ++Index)
+    {
+        int64 Count = 0;
+        int64 Sum = 0;
+        int64 Min = LLONG_MAX;
+        int64 Max = LLONG_MIN;
+        bool bHasLatency = false;
+
+        for (const std::atomic<FShard*>& ShardPtr : Shards)
+        {
+            const FShard* Shard = ShardPtr.load(std::memory_order_acquire);
+            const FSlot* Slot = Shard ? Shard->Slots[Index].load(std::memory_order_acquire) : nullptr;
+            if (!Slot)
+            {
+                continue;
+            }
+
+            Count += Slot->Values.Count.load(std::memory_order_relaxed);
+            Sum += Slot->Values.Sum.load(std::memory_order_relaxed);
+            Min = FMath::Min(Min, Slot->Values.Min.load(std::memory_order_relaxed));
+            Max = FMath::Max(Max, Slot->Values.Max.load(std::memory_order_relaxed));
+
+            if (const FSuspenseCoreLatencyHistogram* Latency = Slot->Latency.load(std::memory_order_acquire))
+            {
+                if (!bHasLatency)
+                {
+                    Merged.Reset();
+                    Merged.SetNumZeroed(FSuspenseCoreLatencyHistogram::NumBuckets);
+                    bHasLatency = true;
+                }
+                for (int32 Bucket = 0; Bucket < FSuspenseCoreLatencyHistogram::NumBuckets; ++Bucket)
+                {
+                    Merged[Bucket] += Latency->Buckets[Bucket].load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        if (Count == 0)
+        {
+            continue;
+        }
+
+        FNamedSnapshot& Snapshot = OutSnapshots.AddDefaulted_GetRef();
+        Snapshot.Name = FSuspenseCoreMetricRegistry::GetName(FSuspenseCoreMetricId{Index});
+        Snapshot.Values.Count = Count;
+        Snapshot.Values.Sum = Sum;
+        Snapshot.Values.Min = (Min == LLONG_MAX) ? 0 : Min;
+        Snapshot.Values.Max = (Max == LLONG_MIN) ? 0 : Max;
+        Snapshot.Values.Avg = double(Sum) / double(Count);
+
+        if (bHasLatency)
+        {
+            uint64 Total = 0;
+            for (const uint64 BucketCount : Merged)
+            {
+                Total += BucketCount;
+            }
+            Snapshot.bHasLatency = true;
+            Snapshot.LatencyCount = int64(Total);
+            Snapshot.P50Ms = FSuspenseCoreLatencyHistogram::Percentile(Merged, Total, 0.50) / 1000.0;
+            Snapshot.P95Ms = FSuspenseCoreLatencyHistogram::Percentile(Merged, Total, 0.95) / 1000.0;
+            Snapshot.P99Ms = FSuspenseCoreLatencyHistogram::Percentile(Merged, Total, 0.99) / 1000.0;
+        }
+    }
+
+    OutSnapshots.Sort([](const FNamedSnapshot& A, const FNamedSnapshot& B)
+    {
+        return A.Name.LexicalLess(B.Name);
+    });
+}
+
+void FSuspenseCoreServiceMetrics::Reset()
+{
+    TotalCalls.store(0, std::memory_order_seq_cst);
+    TotalSuccess.store(0, std::memory_order_seq_cst);
+    TotalErrors.store(0, std::memory_order_seq_cst);
+    TotalDurationMs.store(0, std::memory_order_seq_cst);
+    MinDurationMs.store(LLONG_MAX, std::memory_order_seq_cst);
+    MaxDurationMs.store(LLONG_MIN, std::memory_order_seq_cst);
+
+    // Слоты не освобождаются: писатели могут держать указатель, обнуляем значения
+    for (std::atomic<FShard*>& ShardPtr : Shards)
+    {
+        FShard* Shard = ShardPtr.load(std::memory_order_acquire);
+        if (!Shard)
+        {
+            continue;
+        }
+        for (std::atomic<FSlot*>& SlotPtr : Shard->Slots)
+        {
+            if (FSlot* Slot = SlotPtr.load(std::memory_order_acquire))
+            {
+                Slot->Values.Reset();
+                if (FSuspenseCoreLatencyHistogram* Latency = Slot->Latency.load(std::memory_order_acquire))
+                {
+                    Latency->Reset();
+                }
+            }
+        }
+    }
+}
+
+bool FSuspenseCoreServiceMetrics::ExportToCSV(const FString& AbsoluteFilePath, const FString& InServiceName) const
+{
+    FString Csv;
+    Csv += TEXT("service,metric,count,sum,min,max,avg,p50_ms,p95_ms,p99_ms\n");
+
+    {
+        const int64 totalCalls = TotalCalls.load();
+        const int64 totalDur = TotalDurationMs.load();
+        const int64 minDur = (MinDurationMs.load() == LLONG_MAX) ? 0 : MinDurationMs.load();
+        const int64 maxDur = (MaxDurationMs.load() == LLONG_MIN) ? 0 : MaxDurationMs.load();
+        const double avgDur = (totalCalls > 0) ? double(totalDur) / double(totalCalls) : 0.0;
+
+        Csv += FString::Printf(TEXT("%s,%s,%lld,%lld,%lld,%lld,%.3f,,,\n"),
+            *InServiceName, TEXT("public_method_duration_ms"),
+            (long long)totalCalls, (long long)totalDur,
+            (long long)minDur, (long long)maxDur, avgDur);
+    }
+
+    {
+        Csv += FString::Printf(TEXT("%s,%s,%lld,%lld,%d,%d,%.3f,,,\n"),
+            *InServiceName, TEXT("success"),
+            (long long)TotalSuccess.load(), (long long)TotalSuccess.load(),
+            0, 0, 1.0);
+        Csv += FString::Printf(TEXT("%s,%s,%lld,%lld,%d,%d,%.3f,,,\n"),
+            *InServiceName, TEXT("errors"),
+            (long long)TotalErrors.load(), (long long)TotalErrors.load(),
+            0, 0, 1.0);
+    }
+
+    TArray<FNamedSnapshot> Snapshots;
+    GatherNamed(Snapshots);
+    for (const FNamedSnapshot& S : Snapshots)
+    {
+        Csv += FString::Printf(TEXT("%s,%s,%lld,%lld,%lld,%lld,%.3f,"),
+            *InServiceName, *S.Name.ToString(),
+            (long long)S.Values.Count, (long long)S.Values.Sum,
+            (long long)S.Values.Min, (long long)S.Values.Max, S.Values.Avg);
+        Csv += S.bHasLatency
+            ? FString::Printf(TEXT("%.3f,%.3f,%.3f\n"), S.P50Ms, S.P95Ms, S.P99Ms)
+            : FString(TEXT(",,\n"));
+    }
+
+    return FFileHelper::SaveStringToFile(Csv, *AbsoluteFilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+}
+
+FString FSuspenseCoreServiceMetrics::ToString(const FString& InServiceName) const
+{
+    FString Out;
+    const int64 Calls = TotalCalls.load();
+    const int64 Dur = TotalDurationMs.load();
+    const int64 Min = (MinDurationMs.load() == LLONG_MAX) ? 0 : MinDurationMs.load();
+    const int64 Max = (MaxDurationMs.load() == LLONG_MIN) ? 0 : MaxDurationMs.load();
+    const double Avg = (Calls > 0) ? double(Dur) / double(Calls) : 0.0;
+
+    Out += FString::Printf(TEXT("\n--- Metrics (%s) ---\n"), *InServiceName);
+    Out += FString::Printf(TEXT("Public calls: %lld | Success: %lld | Errors: %lld\n"),
+        (long long)Calls, (long long)TotalSuccess.load(), (long long)TotalErrors.load());
+    Out += FString::Printf(TEXT("Duration ms (sum/min/max/avg): %lld / %lld / %lld / %.3f\n"),
+        (long long)Dur, (long long)Min, (long long)Max, Avg);
+
+    TArray<FNamedSnapshot> Snapshots;
+    GatherNamed(Snapshots);
+    for (const FNamedSnapshot& S : Snapshots)
+    {
+        Out += FString::Printf(TEXT("%s => count=%lld, sum=%lld, min=%lld, max=%lld, avg=%.3f"),
+            *S.Name.ToString(), (long long)S.Values.Count, (long long)S.Values.Sum,
+            (long long)S.Values.Min, (long long)S.Values.Max, S.Values.Avg);
+        if (S.bHasLatency)
+        {
+            Out += FString::Printf(TEXT(", p50=%.3fms, p95=%.3fms, p99=%.3fms"), S.P50Ms, S.P95Ms, S.P99Ms);
+        }
+        Out += TEXT("\n");
+    }
+    return Out;
+}
+
+void FSuspenseCoreServiceMetrics::PublishToProfilers() const
+{
+#if CSV_PROFILER || COUNTERSTRACE_ENABLED
+    const FString Prefix = GetServiceName();
+    if (Prefix.IsEmpty())
+    {
+        return;
+    }
+
+    using SuspenseCoreServiceMetricsInternal::PublishValue;
+
+    PublishValue(Prefix + TEXT("/Calls"), double(TotalCalls.load(std::memory_order_relaxed)));
+    PublishValue(Prefix + TEXT("/Errors"), double(TotalErrors.load(std::memory_order_relaxed)));
+
+    TArray<FNamedSnapshot> Snapshots;
+    GatherNamed(Snapshots);
+    for (const FNamedSnapshot& S : Snapshots)
+    {
+        const FString MetricPrefix = Prefix + TEXT("/") + S.Name.ToString();
+        PublishValue(MetricPrefix + TEXT("/Count"), double(S.Values.Count));
+        if (S.bHasLatency)
+        {
+            PublishValue(MetricPrefix + TEXT("/P50Ms"), S.P50Ms);
+            PublishValue(MetricPrefix + TEXT("/P95Ms"), S.P95Ms);
+            PublishValue(MetricPrefix + TEXT("/P99Ms"), S.P99Ms);
+        }
+    }
+#endif
+}
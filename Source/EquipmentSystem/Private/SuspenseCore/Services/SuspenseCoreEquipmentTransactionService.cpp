@@ -107,6 +107,7 @@ bool USuspenseCoreEquipmentTransactionService::InitializeService(const FSuspense
     }
 
     ServiceState = ESuspenseCoreServiceLifecycleState::Initializing;
+    ServiceMetrics.SetServiceName(TEXT("TransactionService"));
     ServiceParams = Params;
 
     UE_LOG(LogSuspenseCoreEquipmentTransaction, Log, TEXT(">>> TransactionService: Initializing..."));
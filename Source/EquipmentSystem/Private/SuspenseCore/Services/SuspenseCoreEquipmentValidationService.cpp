@@ -213,6 +213,7 @@ bool USuspenseCoreEquipmentValidationService::InitializeService(const FSuspenseC
     }
 
     ServiceState = ESuspenseCoreServiceLifecycleState::Initializing;
+    ServiceMetrics.SetServiceName(TEXT("EquipmentValidationService"));
 
     if (!InitializeDependencies())
     {
@@ -2044,11 +2044,11 @@ bool USuspenseCoreEquipmentVisualizationService::RateLimit() const
 
 bool USuspenseCoreEquipmentVisualizationService::TryParseInt(const FSuspenseCoreEventData& EventData, const TCHAR* Key, int32& OutValue)
 {
-	// CRITICAL FIX: First check IntPayload (Bridge uses SetInt for Slot)
-	// EventData has separate containers: IntPayload for SetInt(), StringPayload for SetString()
+	// CRITICAL FIX: First check int values (Bridge uses SetInt for Slot)
+	// EventData keeps a separate key space per value type: SetInt() and SetString() never collide
 	const FName KeyName(Key);
 
-	// Try IntPayload first (this is where Bridge stores Slot via SetInt)
+	// Try int value first (this is where Bridge stores Slot via SetInt)
 	const int32 IntValue = EventData.GetInt(KeyName, INDEX_NONE);
 	if (IntValue != INDEX_NONE)
 	{
@@ -2056,7 +2056,7 @@ bool USuspenseCoreEquipmentVisualizationService::TryParseInt(const FSuspenseCore
 		return true;
 	}
 
-	// Fallback: try StringPayload and parse (for backward compatibility)
+	// Fallback: try string value and parse (for backward compatibility)
 	const FString S = EventData.GetString(KeyName);
 	if (!S.IsEmpty())
 	{
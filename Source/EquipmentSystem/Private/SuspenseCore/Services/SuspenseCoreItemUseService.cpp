@@ -728,33 +728,33 @@ void USuspenseCoreItemUseServiceImpl::PublishEvent(
 	EventData.Priority = ESuspenseCoreEventPriority::High;
 
 	// Core data
-	EventData.StringPayload.Add(TEXT("RequestID"), Request.RequestID.ToString());
-	EventData.StringPayload.Add(TEXT("SourceItemID"), Request.SourceItem.ItemID.ToString());
-	EventData.IntPayload.Add(TEXT("Context"), static_cast<int32>(Request.Context));
-	EventData.IntPayload.Add(TEXT("Result"), static_cast<int32>(Response.Result));
-	EventData.IntPayload.Add(TEXT("QuickSlotIndex"), Request.QuickSlotIndex);
+	EventData.SetString(TEXT("RequestID"), Request.RequestID.ToString());
+	EventData.SetString(TEXT("SourceItemID"), Request.SourceItem.ItemID.ToString());
+	EventData.SetInt(TEXT("Context"), static_cast<int32>(Request.Context));
+	EventData.SetInt(TEXT("Result"), static_cast<int32>(Response.Result));
+	EventData.SetInt(TEXT("QuickSlotIndex"), Request.QuickSlotIndex);
 
 	// Handler info
 	if (Response.HandlerTag.IsValid())
 	{
-		EventData.StringPayload.Add(TEXT("HandlerTag"), Response.HandlerTag.ToString());
+		EventData.SetString(TEXT("HandlerTag"), Response.HandlerTag.ToString());
 	}
 
 	// Time-based data
-	EventData.FloatPayload.Add(TEXT("Duration"), Response.Duration);
-	EventData.FloatPayload.Add(TEXT("Cooldown"), Response.Cooldown);
-	EventData.FloatPayload.Add(TEXT("Progress"), Response.Progress);
+	EventData.SetFloat(TEXT("Duration"), Response.Duration);
+	EventData.SetFloat(TEXT("Cooldown"), Response.Cooldown);
+	EventData.SetFloat(TEXT("Progress"), Response.Progress);
 
 	// Target (for DragDrop)
 	if (Request.HasTarget())
 	{
-		EventData.StringPayload.Add(TEXT("TargetItemID"), Request.TargetItem.ItemID.ToString());
+		EventData.SetString(TEXT("TargetItemID"), Request.TargetItem.ItemID.ToString());
 	}
 
 	// Message
 	if (!Response.Message.IsEmpty())
 	{
-		EventData.StringPayload.Add(TEXT("Message"), Response.Message.ToString());
+		EventData.SetString(TEXT("Message"), Response.Message.ToString());
 	}
 
 	EventBus->Publish(EventTag, EventData);
@@ -871,8 +871,8 @@ void USuspenseCoreItemUseServiceImpl::ConsumeQuickSlotUse(
 		FSuspenseCoreEventData EventData;
 		EventData.Source = OwnerActor;
 		EventData.Timestamp = FPlatformTime::Seconds();
-		EventData.StringPayload.Add(TEXT("ItemID"), ItemID.ToString());
-		EventData.IntPayload.Add(TEXT("SlotIndex"), Request.QuickSlotIndex);
+		EventData.SetString(TEXT("ItemID"), ItemID.ToString());
+		EventData.SetInt(TEXT("SlotIndex"), Request.QuickSlotIndex);
 		EventBus->Publish(SuspenseCoreItemUseTags::Event::TAG_ItemUse_Event_ItemDepleted, EventData);
 	}
 }
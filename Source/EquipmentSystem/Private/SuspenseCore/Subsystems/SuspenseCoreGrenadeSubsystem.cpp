@@ -0,0 +1,420 @@
+// SuspenseCoreGrenadeSubsystem.cpp
+// Fuse scheduling and batched explosion processing for grenade projectiles
+// Copyright Suspense Team. All Rights Reserved.
+
+#include "SuspenseCore/Subsystems/SuspenseCoreGrenadeSubsystem.h"
+#include "SuspenseCore/Actors/SuspenseCoreGrenadeProjectile.h"
+#include "Engine/World.h"
+#include "Engine/OverlapResult.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogGrenadeSubsystem, Log, All);
+
+CSV_DEFINE_CATEGORY(SuspenseCoreGrenade, true);
+
+static TAutoConsoleVariable<int32> CVarSuspenseCoreAsyncExplosions(
+	TEXT("suspensecore.grenade.async_explosions"),
+	1,
+	TEXT("How explosion occlusion traces are performed.\n")
+	TEXT("0: Synchronous traces on the subsystem tick, damage in the explosion frame\n")
+	TEXT("1: Async traces, damage applied next frame (default)"),
+	ECVF_Default
+);
+
+namespace SuspenseCoreGrenadeSubsystem
+{
+	/** Explosions are merged into one overlap only while the merged sphere stays this small (x largest radius) */
+	static constexpr float MaxClusterRadiusScale = 2.0f;
+}
+
+// ═══════════════════════════════════════════════════════════════════
+// SUBSYSTEM LIFECYCLE
+// ═══════════════════════════════════════════════════════════════════
+
+void USuspenseCoreGrenadeSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	OcclusionTraceDelegate.BindUObject(this, &USuspenseCoreGrenadeSubsystem::OnOcclusionTraceDone);
+}
+
+void USuspenseCoreGrenadeSubsystem::Deinitialize()
+{
+	OcclusionTraceDelegate.Unbind();
+	FuseHeap.Reset();
+	CancelledFuses.Reset();
+	QueuedExplosions.Reset();
+	PendingExplosions.Reset();
+	OcclusionChecks.Reset();
+	NumOcclusionTracesInFlight = 0;
+
+	Super::Deinitialize();
+}
+
+bool USuspenseCoreGrenadeSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+}
+
+TStatId USuspenseCoreGrenadeSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USuspenseCoreGrenadeSubsystem, STATGROUP_Tickables);
+}
+
+USuspenseCoreGrenadeSubsystem* USuspenseCoreGrenadeSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<USuspenseCoreGrenadeSubsystem>() : nullptr;
+}
+
+void USuspenseCoreGrenadeSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Last frame's traces first: their grenades are waiting to be released
+	ResolveOcclusion();
+
+	if (const UWorld* World = GetWorld())
+	{
+		ProcessFuses(World->GetTimeSeconds());
+	}
+
+	ProcessQueuedExplosions();
+
+	CSV_CUSTOM_STAT(SuspenseCoreGrenade, FusesExpired, FrameStats.FusesExpired, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SuspenseCoreGrenade, Explosions, FrameStats.Explosions, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SuspenseCoreGrenade, OverlapQueries, FrameStats.OverlapQueries, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SuspenseCoreGrenade, OcclusionTraces, FrameStats.OcclusionTraces, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SuspenseCoreGrenade, TargetsHit, FrameStats.TargetsHit, ECsvCustomStatOp::Set);
+
+	LastFrameStats = FrameStats;
+	FrameStats = FSuspenseCoreGrenadeFrameStats();
+}
+
+// ═══════════════════════════════════════════════════════════════════
+// FUSE API
+// ═══════════════════════════════════════════════════════════════════
+
+uint32 USuspenseCoreGrenadeSubsystem::ScheduleFuse(ASuspenseCoreGrenadeProjectile* Grenade, double ExplodeTime)
+{
+	const uint32 FuseId = NextFuseId++;
+	if (NextFuseId == 0)
+	{
+		NextFuseId = 1;
+	}
+
+	FFuse Fuse;
+	Fuse.ExplodeTime = ExplodeTime;
+	Fuse.FuseId = FuseId;
+	Fuse.Grenade = Grenade;
+	FuseHeap.HeapPush(MoveTemp(Fuse));
+
+	return FuseId;
+}
+
+void USuspenseCoreGrenadeSubsystem::CancelFuse(uint32 FuseId)
+{
+	if (FuseId == 0)
+	{
+		return;
+	}
+
+	// Only ids still in the heap count; expired ones must not linger in the set
+	for (const FFuse& Fuse : FuseHeap)
+	{
+		if (Fuse.FuseId == FuseId)
+		{
+			CancelledFuses.Add(FuseId);
+			return;
+		}
+	}
+}
+
+void USuspenseCoreGrenadeSubsystem::ProcessFuses(double Now)
+{
+	while (FuseHeap.Num() > 0 && FuseHeap.HeapTop().ExplodeTime <= Now)
+	{
+		FFuse Fuse;
+		FuseHeap.HeapPop(Fuse, EAllowShrinking::No);
+
+		if (CancelledFuses.Remove(Fuse.FuseId) > 0)
+		{
+			continue;
+		}
+
+		if (ASuspenseCoreGrenadeProjectile* Grenade = Fuse.Grenade.Get())
+		{
+			++FrameStats.FusesExpired;
+			Grenade->OnFuseExpired(Fuse.FuseId);
+		}
+	}
+}
+
+// ═══════════════════════════════════════════════════════════════════
+// EXPLOSION API
+// ═══════════════════════════════════════════════════════════════════
+
+void USuspenseCoreGrenadeSubsystem::QueueExplosion(FSuspenseCoreExplosionRequest&& Request)
+{
+	QueuedExplosions.Add(MoveTemp(Request));
+}
+
+void USuspenseCoreGrenadeSubsystem::ProcessQueuedExplosions()
+{
+	using namespace SuspenseCoreGrenadeSubsystem;
+
+	if (QueuedExplosions.Num() == 0)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	const bool bAsync = World && CVarSuspenseCoreAsyncExplosions.GetValueOnGameThread() != 0;
+
+	const int32 FirstExplosion = PendingExplosions.Num();
+	PendingExplosions.Append(MoveTemp(QueuedExplosions));
+	QueuedExplosions.Reset();
+	FrameStats.Explosions += PendingExplosions.Num() - FirstExplosion;
+
+	TArray<bool> Clustered;
+	Clustered.SetNumZeroed(PendingExplosions.Num());
+
+	TArray<int32, TInlineAllocator<8>> ClusterMembers;
+	TArray<FOverlapResult> Overlaps;
+	TArray<AActor*, TInlineAllocator<32>> Targets;
+
+	for (int32 Seed = FirstExplosion; Seed < PendingExplosions.Num(); ++Seed)
+	{
+		if (Clustered[Seed])
+		{
+			continue;
+		}
+
+		// Greedy cluster: absorb later explosions while the enclosing sphere stays compact
+		ClusterMembers.Reset();
+		ClusterMembers.Add(Seed);
+		Clustered[Seed] = true;
+
+		FVector ClusterCenter = PendingExplosions[Seed].Location;
+		float ClusterRadius = PendingExplosions[Seed].Radius;
+		float LargestRadius = ClusterRadius;
+
+		for (int32 Other = Seed + 1; Other < PendingExplosions.Num(); ++Other)
+		{
+			if (Clustered[Other])
+			{
+				continue;
+			}
+
+			const FSuspenseCoreExplosionRequest& Candidate = PendingExplosions[Other];
+			const FVector ToCandidate = Candidate.Location - ClusterCenter;
+			const float CenterDistance = ToCandidate.Size();
+
+			// Smallest sphere holding both spheres
+			float MergedRadius = ClusterRadius;
+			FVector MergedCenter = ClusterCenter;
+			if (CenterDistance + ClusterRadius <= Candidate.Radius)
+			{
+				MergedRadius = Candidate.Radius;
+				MergedCenter = Candidate.Location;
+			}
+			else if (CenterDistance + Candidate.Radius > ClusterRadius)
+			{
+				MergedRadius = (CenterDistance + ClusterRadius + Candidate.Radius) * 0.5f;
+				MergedCenter = ClusterCenter + ToCandidate * ((MergedRadius - ClusterRadius) / CenterDistance);
+			}
+
+			const float NewLargest = FMath::Max(LargestRadius, Candidate.Radius);
+			if (MergedRadius > NewLargest * MaxClusterRadiusScale)
+			{
+				continue;
+			}
+
+			ClusterMembers.Add(Other);
+			Clustered[Other] = true;
+			ClusterCenter = MergedCenter;
+			ClusterRadius = MergedRadius;
+			LargestRadius = NewLargest;
+		}
+
+		// One overlap for the whole cluster
+		Targets.Reset();
+		if (World)
+		{
+			FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SuspenseCoreGrenadeExplosion), false);
+			for (const int32 Member : ClusterMembers)
+			{
+				QueryParams.AddIgnoredActor(PendingExplosions[Member].Grenade.Get());
+			}
+
+			Overlaps.Reset();
+			World->OverlapMultiByChannel(
+				Overlaps,
+				ClusterCenter,
+				FQuat::Identity,
+				ECC_Pawn,
+				FCollisionShape::MakeSphere(ClusterRadius),
+				QueryParams);
+			++FrameStats.OverlapQueries;
+
+			// One entry per actor, not per overlapping component
+			for (const FOverlapResult& Overlap : Overlaps)
+			{
+				if (AActor* Actor = Overlap.GetActor())
+				{
+					Targets.AddUnique(Actor);
+				}
+			}
+		}
+
+		for (const int32 Member : ClusterMembers)
+		{
+			const FSuspenseCoreExplosionRequest& Explosion = PendingExplosions[Member];
+
+			FCollisionQueryParams TraceParams(SCENE_QUERY_STAT(SuspenseCoreGrenadeOcclusion), false);
+			TraceParams.AddIgnoredActor(Explosion.Grenade.Get());
+
+			for (AActor* Target : Targets)
+			{
+				bool bIgnored = false;
+				for (const TWeakObjectPtr<AActor>& Ignored : Explosion.IgnoreActors)
+				{
+					bIgnored |= Ignored.Get() == Target;
+				}
+				if (bIgnored)
+				{
+					continue;
+				}
+
+				const FVector TargetLocation = Target->GetActorLocation();
+				const float Distance = FVector::Dist(Explosion.Location, TargetLocation);
+				if (Distance > Explosion.Radius)
+				{
+					continue;
+				}
+
+				const int32 CheckIndex = OcclusionChecks.AddDefaulted();
+				FOcclusionCheck& Check = OcclusionChecks[CheckIndex];
+				Check.ExplosionIndex = Member;
+				Check.Target = Target;
+				Check.Distance = Distance;
+
+				if (!Explosion.bCheckOcclusion)
+				{
+					Check.bDone = true;
+					Check.bVisible = true;
+					continue;
+				}
+
+				FCollisionQueryParams PairParams = TraceParams;
+				PairParams.AddIgnoredActor(Target);
+				++FrameStats.OcclusionTraces;
+
+				if (bAsync)
+				{
+					World->AsyncLineTraceByChannel(
+						EAsyncTraceType::Single,
+						Explosion.Location,
+						TargetLocation,
+						ECC_Visibility,
+						PairParams,
+						FCollisionResponseParams::DefaultResponseParam,
+						&OcclusionTraceDelegate,
+						static_cast<uint32>(CheckIndex));
+					++NumOcclusionTracesInFlight;
+				}
+				else
+				{
+					FHitResult Blocker;
+					Check.bVisible = !World->LineTraceSingleByChannel(
+						Blocker, Explosion.Location, TargetLocation, ECC_Visibility, PairParams);
+					Check.bDone = true;
+				}
+			}
+		}
+	}
+
+	if (!bAsync)
+	{
+		ResolveOcclusion();
+	}
+}
+
+void USuspenseCoreGrenadeSubsystem::OnOcclusionTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	if (!OcclusionChecks.IsValidIndex(static_cast<int32>(Datum.UserData)))
+	{
+		return;
+	}
+
+	FOcclusionCheck& Check = OcclusionChecks[Datum.UserData];
+	if (Check.bDone)
+	{
+		return;
+	}
+
+	bool bBlocked = false;
+	for (const FHitResult& Hit : Datum.OutHits)
+	{
+		bBlocked |= Hit.bBlockingHit;
+	}
+
+	Check.bVisible = !bBlocked;
+	Check.bDone = true;
+	--NumOcclusionTracesInFlight;
+}
+
+void USuspenseCoreGrenadeSubsystem::ResolveOcclusion()
+{
+	// Check indices ride in trace UserData: the arrays may only be reset once nothing is in flight
+	if (PendingExplosions.Num() == 0 || NumOcclusionTracesInFlight > 0)
+	{
+		return;
+	}
+
+	// Checks were added explosion by explosion, so damage order follows explosion order
+	for (const FOcclusionCheck& Check : OcclusionChecks)
+	{
+		if (!Check.bVisible)
+		{
+			continue;
+		}
+
+		if (AActor* Target = Check.Target.Get())
+		{
+			ApplyToTarget(PendingExplosions[Check.ExplosionIndex], Target, Check.Distance);
+		}
+	}
+
+	for (const FSuspenseCoreExplosionRequest& Explosion : PendingExplosions)
+	{
+		if (ASuspenseCoreGrenadeProjectile* Grenade = Explosion.Grenade.Get())
+		{
+			Grenade->OnExplosionResolved();
+		}
+	}
+
+	UE_LOG(LogGrenadeSubsystem, Verbose, TEXT("Resolved %d explosions, %d target checks"),
+		PendingExplosions.Num(), OcclusionChecks.Num());
+
+	PendingExplosions.Reset();
+	OcclusionChecks.Reset();
+}
+
+void USuspenseCoreGrenadeSubsystem::ApplyToTarget(const FSuspenseCoreExplosionRequest& Explosion, AActor* Target, float Distance)
+{
+	ASuspenseCoreGrenadeProjectile* Grenade = Explosion.Grenade.Get();
+	if (!Grenade)
+	{
+		UE_LOG(LogGrenadeSubsystem, Warning, TEXT("Explosion at %s lost its grenade before damage was applied"),
+			*Explosion.Location.ToString());
+		return;
+	}
+
+	if (Grenade->ApplyExplosionToTarget(Target, Distance))
+	{
+		++FrameStats.TargetsHit;
+	}
+}
@@ -128,6 +128,15 @@ namespace SuspenseCoreEquipmentTags
         // Slot Events (used by DataStore for EventBus)
         UE_DEFINE_GAMEPLAY_TAG(TAG_Equipment_Event_SlotUpdated, "Equipment.Event.SlotUpdated");
         UE_DEFINE_GAMEPLAY_TAG(TAG_Equipment_Event_Updated, "Equipment.Event.Updated");
+
+        // DataService Events
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Equipment_Event_Delta, "SuspenseCore.Event.Equipment.Delta");
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Equipment_Event_Delta_Batch, "SuspenseCore.Event.Equipment.Delta.Batch");
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Equipment_Event_RequestResend, "SuspenseCore.Event.Equipment.RequestResend");
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Equipment_Event_Cache_Invalidate, "SuspenseCore.Event.Cache.Invalidate.Equipment");
+
+        // WeaponStateManager Events
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Equipment_Event_Weapon_StateChanged, "SuspenseCore.Event.Weapon.StateChanged");
     }
 
     //========================================
@@ -136,6 +145,7 @@ namespace SuspenseCoreEquipmentTags
     namespace WeaponState
     {
         UE_DEFINE_GAMEPLAY_TAG(TAG_Weapon_State, "Weapon.State");
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Weapon_State_None, "Weapon.State.None");
         UE_DEFINE_GAMEPLAY_TAG(TAG_Weapon_State_Ready, "Weapon.State.Ready");
         UE_DEFINE_GAMEPLAY_TAG(TAG_Weapon_State_Holstered, "Weapon.State.Holstered");
         UE_DEFINE_GAMEPLAY_TAG(TAG_Weapon_State_Drawing, "Weapon.State.Drawing");
@@ -238,6 +248,15 @@ namespace SuspenseCoreEquipmentTags
         UE_DEFINE_GAMEPLAY_TAG(TAG_Equipment_State_Cooldown, "Equipment.State.Cooldown");
         UE_DEFINE_GAMEPLAY_TAG(TAG_Equipment_State_Locked, "Equipment.State.Locked");
         UE_DEFINE_GAMEPLAY_TAG(TAG_Equipment_State_Disabled, "Equipment.State.Disabled");
+
+        // Extended states (used by DataStore state machine)
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Equipment_State_Default, "Equipment.State.Default");
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Equipment_State_Switching, "Equipment.State.Switching");
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Equipment_State_Reloading, "Equipment.State.Reloading");
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Equipment_State_Inspecting, "Equipment.State.Inspecting");
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Equipment_State_Repairing, "Equipment.State.Repairing");
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Equipment_State_Upgrading, "Equipment.State.Upgrading");
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Equipment_State_Error, "Equipment.State.Error");
     }
 
     //========================================
@@ -320,6 +339,11 @@ namespace SuspenseCoreEquipmentTags
 
         // Special
         UE_DEFINE_GAMEPLAY_TAG(TAG_Equipment_Slot_Armband, "Equipment.Slot.Armband");
+
+        // Hands / uniqueness (used by ConflictRulesEngine)
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Equipment_Slot_Hand_Main, "Equipment.Slot.Hand.Main");
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Equipment_Slot_Hand_Off, "Equipment.Slot.Hand.Off");
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Equipment_Slot_Unique, "Equipment.Slot.Unique");
     }
 
     //========================================
@@ -363,6 +387,23 @@ namespace SuspenseCoreEquipmentTags
         UE_DEFINE_GAMEPLAY_TAG(TAG_Validation_Error_UniqueGroup, "Validation.Error.UniqueGroup");
     }
 
+    //========================================
+    // CONFLICT RULE TAGS
+    //========================================
+    namespace Conflict
+    {
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Rule_Conflict_ItemCheck, "Rule.Conflict.ItemCheck");
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Rule_Conflict_SlotCheck, "Rule.Conflict.SlotCheck");
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Rule_Conflict_TypeExclusivity, "Rule.Conflict.TypeExclusivity");
+
+        // Resolution actions
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Resolution_Action_Prompt, "Resolution.Action.Prompt");
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Resolution_Action_Reject, "Resolution.Action.Reject");
+
+        // Built-in set bonus (default set definitions)
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Set_Knight, "Set.Knight");
+    }
+
     //========================================
     // ITEM TYPE TAGS
     //========================================
@@ -388,6 +429,11 @@ namespace SuspenseCoreEquipmentTags
         UE_DEFINE_GAMEPLAY_TAG(TAG_Item_Weapon_Melee, "Item.Weapon.Melee");
         UE_DEFINE_GAMEPLAY_TAG(TAG_Item_Weapon_Melee_Knife, "Item.Weapon.Melee.Knife");
 
+        // Handedness
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Item_Weapon_TwoHanded, "Item.Weapon.TwoHanded");
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Item_RequiresBothHands, "Item.RequiresBothHands");
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Item_Shield, "Item.Shield");
+
         // Gear tags (head, body, storage, special)
         UE_DEFINE_GAMEPLAY_TAG(TAG_Item_Gear, "Item.Gear");
         UE_DEFINE_GAMEPLAY_TAG(TAG_Item_Gear_Headwear, "Item.Gear.Headwear");
@@ -403,6 +449,9 @@ namespace SuspenseCoreEquipmentTags
         UE_DEFINE_GAMEPLAY_TAG(TAG_Item_Armor, "Item.Armor");
         UE_DEFINE_GAMEPLAY_TAG(TAG_Item_Armor_Helmet, "Item.Armor.Helmet");
         UE_DEFINE_GAMEPLAY_TAG(TAG_Item_Armor_BodyArmor, "Item.Armor.BodyArmor");
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Item_Armor_Light, "Item.Armor.Light");
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Item_Armor_Medium, "Item.Armor.Medium");
+        UE_DEFINE_GAMEPLAY_TAG(TAG_Item_Armor_Heavy, "Item.Armor.Heavy");
 
         // Consumable/utility tags
         UE_DEFINE_GAMEPLAY_TAG(TAG_Item_Consumable, "Item.Consumable");
@@ -18,8 +18,8 @@
 // FLOW:
 // 1. Spawned by GrenadeHandler with throw velocity
 // 2. Physics simulation (bounce, roll)
-// 3. Fuse timer countdown (reduced by cook time)
-// 4. Explode → Apply damage via GAS → Spawn effects → Destroy
+// 3. Fuse countdown in USuspenseCoreGrenadeSubsystem (reduced by cook time, no actor tick)
+// 4. Explode → Batched overlap/occlusion in subsystem → Apply damage via GAS → Spawn effects → Destroy
 //
 // REFERENCES:
 // - Escape from Tarkov: Grenade cooking, fuse mechanics
@@ -345,13 +345,31 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Grenade")
     void Defuse();
 
+    //==================================================================
+    // Grenade Subsystem Callbacks (server)
+    //==================================================================
+
+    /** Fuse scheduled by USuspenseCoreGrenadeSubsystem ran out */
+    void OnFuseExpired(uint32 ExpiredFuseId);
+
+    /**
+     * Apply explosion damage and type effects to one target
+     * Target already passed radius and occlusion checks
+     *
+     * @return true if damage was applied
+     */
+    bool ApplyExplosionToTarget(AActor* TargetActor, float Distance);
+
+    /** Every target of the queued explosion was processed */
+    void OnExplosionResolved();
+
 protected:
     //==================================================================
     // AActor Overrides
     //==================================================================
 
     virtual void BeginPlay() override;
-    virtual void Tick(float DeltaTime) override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
     //==================================================================
@@ -381,7 +399,7 @@ protected:
     UFUNCTION(BlueprintNativeEvent, Category = "Grenade")
     void Explode();
 
-    /** Apply damage to actors in radius (server only) */
+    /** Apply damage to actors in radius (server only, batched via USuspenseCoreGrenadeSubsystem when available) */
     UFUNCTION(BlueprintCallable, Category = "Grenade")
     void ApplyExplosionDamage();
 
@@ -515,6 +533,15 @@ private:
     UPROPERTY()
     TWeakObjectPtr<USuspenseCoreEventBus> EventBus;
 
+    /** Fuse in USuspenseCoreGrenadeSubsystem (0 = none) */
+    uint32 FuseId = 0;
+
+    /** Fallback fuse when the world has no grenade subsystem */
+    FTimerHandle FuseTimerHandle;
+
+    /** Explosion queued in the subsystem, damage not applied yet (keeps the actor alive) */
+    bool bExplosionDamagePending = false;
+
     //==================================================================
     // Replication
     //==================================================================
@@ -529,6 +556,9 @@ private:
     /** Start the fuse timer */
     void ArmGrenade();
 
+    /** Remove a scheduled fuse */
+    void CancelFuse();
+
     /** Play sound at grenade location */
     void PlayGrenadeSound(USoundBase* Sound);
 
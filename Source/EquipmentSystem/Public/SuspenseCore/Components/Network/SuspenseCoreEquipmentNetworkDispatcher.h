@@ -55,6 +55,37 @@ struct FSuspenseCoreNetworkOperationRequestNet
 	UPROPERTY() float Timestamp = 0.f;
 };
 
+/**
+ * Батч запросов для ServerExecuteBatch (bit-packed NetSerialize).
+ *
+ * Заголовок: BatchId, Count, ширина слотов (log2 от максимального слота),
+ * флаги общих полей (операция / приоритет / ItemID) и их значения один раз на батч.
+ * Запись: RequestId, слоты в SlotBits, Timestamp как zig-zag дельта в мс от предыдущей
+ * записи, Quantity / AnchorIndex packed, поля предмета по флагам присутствия.
+ */
+USTRUCT()
+struct FSuspenseCoreNetworkBatchNet
+{
+	GENERATED_BODY()
+
+	UPROPERTY() FGuid BatchId;
+	UPROPERTY() TArray<FSuspenseCoreNetworkOperationRequestNet> Requests;
+
+	/** Потолок размера батча (адаптивный размер и валидация на сервере) */
+	static constexpr int32 MaxRequests = 64;
+
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FSuspenseCoreNetworkBatchNet> : public TStructOpsTypeTraitsBase2<FSuspenseCoreNetworkBatchNet>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
+};
+
 // -----------------------------
 // Очередь/батчи/статистика
 // -----------------------------
@@ -74,6 +105,9 @@ struct FSuspenseCoreOperationQueueEntry
 	UPROPERTY() bool   bSecurityValidated = false;
 	UPROPERTY() float  BackoffMultiplier  = 1.0f;
 	UPROPERTY() uint64 RequestHash        = 0;
+
+	/** Снята с очереди; слот освобождается при CompactQueue() */
+	UPROPERTY() bool   bRemoved = false;
 };
 
 USTRUCT()
@@ -87,6 +121,66 @@ struct FSuspenseCoreIdempotencyEntry
 	UPROPERTY() bool                      bProcessed  = false;
 };
 
+/**
+ * Кэш идемпотентности фиксированной ёмкости
+ *
+ * - Записи лежат в кольце в порядке вставки; время мира монотонно, поэтому
+ *   голова кольца всегда истекает первой: очистка снимает записи с головы
+ *   и останавливается на первой живой (O(истёкших), без полного прохода)
+ * - Переполнение вытесняет самую старую запись (голову), как раньше RemoveAt(0)
+ * - Индекс RequestId -> позиция в кольце: open addressing, linear probing,
+ *   таблица >= 2x ёмкости; удаление backward-shift, без tombstones
+ * - Повторная вставка того же RequestId гасит старую запись в кольце
+ *
+ * Кольцо растёт до ёмкости по мере заполнения, таблица выделяется сразу.
+ */
+class FSuspenseCoreIdempotencyCache
+{
+public:
+	/** Сбрасывает содержимое и задаёт ёмкость */
+	void Reset(int32 InCapacity);
+
+	void Empty() { Reset(Capacity); }
+
+	/** @return Запись по RequestId или nullptr */
+	const FSuspenseCoreIdempotencyEntry* Find(const FGuid& RequestId) const;
+
+	/** Добавляет или заменяет запись; при полном кольце вытесняет самую старую */
+	void Add(const FSuspenseCoreIdempotencyEntry& Entry);
+
+	/** Снимает записи старше Lifetime. @return Сколько снято */
+	int32 RemoveExpired(float Now, float Lifetime);
+
+	int32 Num() const { return NumLive; }
+	int32 GetCapacity() const { return Capacity; }
+
+private:
+	struct FSlot
+	{
+		uint32 Hash      = 0;
+		int32  RingIndex = INDEX_NONE;
+	};
+
+	static uint32 HashId(const FGuid& Id);
+
+	/** @return Индекс слота с этим Id или INDEX_NONE */
+	int32 FindSlot(const FGuid& Id, uint32 Hash) const;
+
+	/** Освобождает слот со сдвигом следующих записей кластера назад */
+	void RemoveSlot(int32 SlotIndex);
+
+	/** Снимает голову кольца (живую или погашенную) */
+	void PopHead();
+
+	TArray<FSuspenseCoreIdempotencyEntry> Ring;
+	TArray<FSlot> Slots;
+	uint32 SlotMask = 0;
+	int32 Capacity  = 0;
+	int32 Head      = 0;   // самая старая позиция кольца
+	int32 Count     = 0;   // занятые позиции, включая погашенные
+	int32 NumLive   = 0;
+};
+
 USTRUCT()
 struct FSuspenseCoreOperationBatch
 {
@@ -109,6 +203,9 @@ struct FSuspenseCoreNetworkDispatcherStats
 	UPROPERTY(BlueprintReadOnly) float  AverageResponseTime = 0.0f;
 	UPROPERTY(BlueprintReadOnly) int32  SecurityRejects = 0;
 	UPROPERTY(BlueprintReadOnly) int32  IdempotentHits = 0;
+	UPROPERTY(BlueprintReadOnly) int32  CurrentBatchSize = 0;
+	UPROPERTY(BlueprintReadOnly) float  SmoothedRTT = 0.0f;
+	UPROPERTY(BlueprintReadOnly) float  ReliablePressure = 0.0f;
 };
 
 UCLASS(ClassGroup=(Equipment), meta=(BlueprintSpawnableComponent))
@@ -172,7 +269,7 @@ protected:
 	UFUNCTION(Server, Reliable, WithValidation)
 	void ServerExecuteOperation(const FSuspenseCoreNetworkOperationRequestNet& RequestNet);
 	UFUNCTION(Server, Reliable, WithValidation)
-	void ServerExecuteBatch(const FGuid& BatchId, const TArray<FSuspenseCoreNetworkOperationRequestNet>& RequestsNet);
+	void ServerExecuteBatch(const FSuspenseCoreNetworkBatchNet& BatchNet);
 	UFUNCTION(Server, Unreliable, WithValidation)
 	void ServerExecuteLowPriority(const FSuspenseCoreNetworkOperationRequestNet& RequestNet);
 
@@ -209,8 +306,19 @@ private:
 	void   HandleTimeout(const FGuid& OperationId);
 	void   UpdateResponseTimeStats(float ResponseTime);
 	bool   ShouldBatchOperation(ENetworkOperationPriority Priority) const;
+
+	// Adaptive batching
+	void   SendBatch(FSuspenseCoreOperationBatch& Batch);
+	void   UpdateAdaptiveBatchSize();
+	void   RecordRttSample(float Seconds);
+	float  SampleReliablePressure() const;
 	FSuspenseCoreOperationQueueEntry* FindQueueEntry(const FGuid& OperationId);
 
+	// Queue index (RequestId -> позиция в OperationQueue); вызывать под QueueLock
+	void   AddQueueEntry(const FSuspenseCoreOperationQueueEntry& Entry);
+	bool   RemoveQueueEntry(const FGuid& OperationId);
+	void   CompactQueue();
+
 	// Result (строковый формат оставил как был в вашем коде)
 	FString SerializeResult(const FEquipmentOperationResult& Result) const;
 	bool    DeserializeResult(const FString& Data, FEquipmentOperationResult& OutResult) const;
@@ -225,7 +333,12 @@ private:
 	UPROPERTY(EditDefaultsOnly, Category="Network|Config") float MaxJitter      = 0.5f;
 	UPROPERTY(EditDefaultsOnly, Category="Network|Config") int32 MaxBatchSize   = 10;
 	UPROPERTY(EditDefaultsOnly, Category="Network|Config") float BatchWaitTime  = 0.1f;
-	UPROPERTY(EditDefaultsOnly, Category="Network|Config") int32 MaxIdempotencyCacheSize = 100;
+
+	/** Размер батча от RTT и заполнения reliable-буфера; MaxBatchSize = размер при RTT == BatchRttReference */
+	UPROPERTY(EditDefaultsOnly, Category="Network|Config") bool  bAdaptiveBatching    = true;
+	UPROPERTY(EditDefaultsOnly, Category="Network|Config") int32 MinAdaptiveBatchSize = 2;
+	UPROPERTY(EditDefaultsOnly, Category="Network|Config") float BatchRttReference    = 0.1f;
+	UPROPERTY(EditDefaultsOnly, Category="Network|Config") int32 MaxIdempotencyCacheSize = 1024;
 	UPROPERTY(EditDefaultsOnly, Category="Network|Config") float IdempotencyLifetime     = 60.0f;
 
 	// Wiring
@@ -235,7 +348,12 @@ private:
 	// State
 	UPROPERTY() TArray<FSuspenseCoreOperationQueueEntry> OperationQueue;
 	UPROPERTY() TArray<FSuspenseCoreOperationBatch>      ActiveBatches;
-	UPROPERTY() TArray<FSuspenseCoreIdempotencyEntry>    IdempotencyCache;
+
+	/** Живые записи OperationQueue; снятые помечаются bRemoved, порядок очереди сохраняется */
+	TMap<FGuid, int32> QueueIndex;
+	int32 NumRemovedQueueEntries = 0;
+
+	FSuspenseCoreIdempotencyCache IdempotencyCache;
 
 	TMap<FGuid, FDelegateHandle> ResponseHandlers;
 
@@ -245,6 +363,9 @@ private:
 	float LastBatchTime    = 0.0f;
 	float LastIdempotencyCleanup = 0.0f;
 
+	int32 CurrentBatchSize = 10;
+	float SmoothedRtt      = 0.0f;
+
 	UPROPERTY() FSuspenseCoreNetworkDispatcherStats Statistics;
 	TArray<float> ResponseTimeSamples;
 	static constexpr int32 MaxResponseSamples = 100;
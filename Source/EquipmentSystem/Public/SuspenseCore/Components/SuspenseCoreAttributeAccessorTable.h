@@ -0,0 +1,100 @@
+// SuspenseCoreAttributeAccessorTable.h
+// Copyright Suspense Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+
+/**
+ * One readable attribute of an AttributeSet class
+ */
+struct EQUIPMENTSYSTEM_API FSuspenseCoreAttributeAccessor
+{
+    enum class EKind : uint8
+    {
+        AttributeData,
+        Float,
+        Double,
+        Int
+    };
+
+    /** Property name (same string the reflection lookup used) */
+    FString Name;
+
+    /** For GAS writes (SetNumericAttributeBase) */
+    FGameplayAttribute Attribute;
+
+    /** Reflected property, for callers that still need it */
+    FProperty* Property = nullptr;
+
+    /** Byte offset of the value inside the AttributeSet instance */
+    int32 Offset = 0;
+
+    EKind Kind = EKind::AttributeData;
+
+    /** CPF_BlueprintVisible: included in bulk reads and replication */
+    bool bVisible = false;
+};
+
+/**
+ * Compiled attribute accessor table for one AttributeSet class
+ *
+ * Built once per class from reflection, then shared by every component:
+ * - Dense index -> accessor (offset + kind), values read by pointer arithmetic
+ * - Name -> index through a perfect hash (hash-and-displace: one case-insensitive
+ *   FNV-1a pass, a per-bucket seed picks a collision-free slot, then one string compare)
+ * - Visible accessors first, so bulk reads fill [0, NumVisible) of a flat array
+ *
+ * Tables are immutable after construction and never freed (one per AttributeSet class).
+ */
+class EQUIPMENTSYSTEM_API FSuspenseCoreAttributeAccessorTable
+{
+public:
+    /** Table for the class, built on first use (thread-safe) */
+    static const FSuspenseCoreAttributeAccessorTable& Get(const UClass* AttributeSetClass);
+
+    /** @return Accessor index or INDEX_NONE (case-insensitive, like FString ==) */
+    int32 FindIndex(FStringView Name) const;
+
+    int32 Num() const { return Accessors.Num(); }
+    int32 NumVisible() const { return NumVisibleAccessors; }
+    const FSuspenseCoreAttributeAccessor& GetAccessor(int32 Index) const { return Accessors[Index]; }
+
+    /** Current value (FGameplayAttributeData) or plain numeric value */
+    float GetValue(const UAttributeSet* AttributeSet, int32 Index) const;
+
+    /** Direct write, bypassing GAS (base + current for FGameplayAttributeData) */
+    void SetValue(UAttributeSet* AttributeSet, int32 Index, float Value) const;
+
+    /** Visible values in table order into OutValues[0, NumVisible()) */
+    void ReadVisibleValues(const UAttributeSet* AttributeSet, TArrayView<float> OutValues) const;
+
+    /**
+     * Micro-benchmark: reflection walk vs table lookup on a weapon AttributeSet,
+     * per-name lookups and a full bulk read, Iterations rounds each.
+     * @return Human readable report
+     */
+    static FString RunBenchmark(int32 Iterations);
+
+private:
+    void Build(const UClass* AttributeSetClass);
+    void BuildPerfectHash();
+
+    /** Case-insensitive 64-bit FNV-1a */
+    static uint64 HashName(FStringView Name);
+
+    /** Slot for a name hash under a bucket seed */
+    static uint32 SlotFor(uint64 Hash, uint32 Seed, uint32 Mask);
+
+    TArray<FSuspenseCoreAttributeAccessor> Accessors;
+    int32 NumVisibleAccessors = 0;
+
+    /** Per-bucket displacement seeds (bucket = low hash bits) */
+    TArray<uint32> BucketSeeds;
+    uint32 BucketMask = 0;
+
+    /** Accessor index per slot, INDEX_NONE for empty slots */
+    TArray<int32> HashSlots;
+    uint32 SlotMask = 0;
+};
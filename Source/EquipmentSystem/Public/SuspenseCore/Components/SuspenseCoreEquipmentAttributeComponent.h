@@ -214,6 +214,15 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Equipment|Attributes")
     TMap<FString, float> GetAllAttributeValues() const;
 
+    /**
+     * Bulk read of one set's visible attributes into a flat array, no map or name strings.
+     * Order matches FSuspenseCoreAttributeAccessorTable::Get(Set->GetClass()) accessors.
+     * @param AttributeSet Set to read
+     * @param OutValues Resized to the number of visible attributes (capacity is kept)
+     * @return Number of values written
+     */
+    int32 ReadAttributeValues(const UAttributeSet* AttributeSet, TArray<float>& OutValues) const;
+
     /**
      * Check if attribute exists
      * @param AttributeName Name of attribute to check
@@ -298,6 +307,15 @@ protected:
      */
     FProperty* FindAttributeProperty(UAttributeSet* AttributeSet, const FString& AttributeName) const;
 
+    /**
+     * Find attribute in the owned sets through their accessor tables
+     * @param AttributeName Name to find (case-insensitive)
+     * @param OutSet Set that has the attribute
+     * @param OutIndex Accessor index in the set's table
+     * @return True if found
+     */
+    bool FindAttributeAccessor(const FString& AttributeName, UAttributeSet*& OutSet, int32& OutIndex) const;
+
     /**
      * Get attribute value from property via reflection
      * @param AttributeSet Set containing the attribute
@@ -406,9 +424,6 @@ private:
     UPROPERTY()
     int32 NextAttributePredictionKey;
 
-    /** Map for quick attribute lookup */
-    mutable TMap<FString, TPair<UAttributeSet*, FProperty*>> AttributePropertyCache;
-
     /** Critical section for thread safety */
     mutable FCriticalSection AttributeCacheCriticalSection;
 };
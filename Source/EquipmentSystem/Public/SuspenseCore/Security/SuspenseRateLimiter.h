@@ -0,0 +1,128 @@
+// SuspenseRateLimiter.h
+// Copyright SuspenseCore Team. All Rights Reserved.
+//
+// GCRA (Generic Cell Rate Algorithm) rate limiter with fixed-size state per principal.
+// Equivalent to a token bucket, but the whole bucket is one timestamp (TAT).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+/**
+ * Per-principal limiter state (24 bytes, independent of request rate)
+ */
+struct FSuspenseRateLimitState
+{
+    /** Theoretical arrival time of the next request, per-second limit */
+    double SecondTAT = 0.0;
+
+    /** Theoretical arrival time of the next request, per-minute limit */
+    double MinuteTAT = 0.0;
+
+    /** Temporary ban end (0 = not banned) */
+    double BanExpiryTime = 0.0;
+};
+
+/**
+ * Thread-safe sharded GCRA rate limiter.
+ *
+ * Features:
+ * - O(1) check and O(1) memory per principal, whatever the request rate
+ * - Two limits per principal: MaxPerSecond (burst over 1s) and MaxPerMinute (burst over 60s)
+ * - Integer keys (see MakeKey) instead of string identifiers
+ * - Sharded table: a request locks one shard out of NumShards
+ * - Idle eviction: a principal whose buckets have refilled is indistinguishable
+ *   from a new one and is dropped by CleanupIdle()
+ *
+ * A limit <= 0 disables that limit. Bans are issued by the owner (see Ban).
+ */
+class EQUIPMENTSYSTEM_API FSuspenseRateLimiter
+{
+public:
+    static constexpr int32 NumShards = 16;
+
+    explicit FSuspenseRateLimiter(int32 InMaxPerSecond = 10, int32 InMaxPerMinute = 200);
+
+    // Non-copyable
+    FSuspenseRateLimiter(const FSuspenseRateLimiter&) = delete;
+    FSuspenseRateLimiter& operator=(const FSuspenseRateLimiter&) = delete;
+
+    /** Change limits; existing states keep their TATs. Safe while other threads acquire */
+    void SetLimits(int32 InMaxPerSecond, int32 InMaxPerMinute);
+
+    /**
+     * Check and consume one request slot atomically
+     * @param Key Principal key
+     * @param Now Current time in seconds (FPlatformTime::Seconds)
+     * @return true if the request conforms; rejected requests consume nothing
+     */
+    bool TryAcquire(uint64 Key, double Now);
+
+    /**
+     * Check without consuming
+     * @return true if TryAcquire would succeed now
+     */
+    bool IsAllowed(uint64 Key, double Now) const;
+
+    /**
+     * Ban a principal that is already tracked
+     * @return true if the principal was found
+     */
+    bool Ban(uint64 Key, double Until);
+
+    /**
+     * Drop principals whose buckets are full again and who are not banned
+     * @return Number of principals removed
+     */
+    int32 CleanupIdle(double Now);
+
+    /** Remove all principals */
+    void Clear();
+
+    /** Number of tracked principals */
+    int32 Num() const;
+
+    /** Key for a player GUID */
+    static uint64 MakeKey(const FGuid& Guid);
+
+    /** Key for raw address bytes (IPv4 or IPv6, without port) */
+    static uint64 MakeKey(TArrayView<const uint8> AddressBytes);
+
+    /**
+     * Simulate RequestsPerSecond requests spread over NumPrincipals for Seconds of
+     * simulated time (5% of principals flood at 10x their share), sliding-window
+     * timestamp arrays keyed by string (the previous limiter) vs this limiter.
+     * @return Human readable report
+     */
+    static FString RunBenchmark(int32 NumPrincipals, int32 RequestsPerSecond, float Seconds);
+
+private:
+    /** Emission interval (1 / rate) and burst tolerance per cell; Interval 0 = disabled */
+    struct FLimits
+    {
+        double SecondInterval = 0.0;
+        double SecondTolerance = 0.0;
+        double MinuteInterval = 0.0;
+        double MinuteTolerance = 0.0;
+    };
+
+    /** Each shard keeps its own copy of the limits, so reads stay under the shard lock */
+    struct FShard
+    {
+        mutable FCriticalSection Lock;
+        FLimits Limits;
+        TMap<uint64, FSuspenseRateLimitState> States;
+    };
+
+    /** GCRA conformance of one cell: TAT - Now must not exceed the burst tolerance */
+    static bool Conforms(double TAT, double Now, double Interval, double Tolerance);
+
+    static bool IsAllowedLocked(const FLimits& Limits, const FSuspenseRateLimitState& State, double Now);
+
+    FShard& GetShard(uint64 Key) { return Shards[ShardIndex(Key)]; }
+    const FShard& GetShard(uint64 Key) const { return Shards[ShardIndex(Key)]; }
+    static int32 ShardIndex(uint64 Key);
+
+    FShard Shards[NumShards];
+};
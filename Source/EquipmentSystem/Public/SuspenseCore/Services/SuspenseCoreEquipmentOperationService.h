@@ -14,6 +14,7 @@
 #include "SuspenseCore/Interfaces/Equipment/ISuspenseCoreNetworkInterfaces.h"
 #include "SuspenseCore/Types/Equipment/SuspenseCoreEquipmentTypes.h"
 #include "SuspenseCore/Core/Utils/SuspenseCoreEquipmentCacheManager.h"
+#include "SuspenseCore/Core/Utils/SuspenseCoreRingBuffer.h"
 #include "SuspenseCore/Events/SuspenseCoreEventBus.h"
 #include "SuspenseCore/Services/SuspenseCoreEquipmentServiceMacros.h"
 #include "Engine/TimerHandle.h"
@@ -47,7 +48,7 @@ struct FSuspenseCoreQueuedOperation
     FEquipmentOperationRequest Request;
 
     UPROPERTY()
-    float QueueTime = 0.0f;
+    double QueueTime = 0.0;
 
     UPROPERTY()
     int32 Priority = 0;
@@ -58,6 +59,12 @@ struct FSuspenseCoreQueuedOperation
     // Diagnostic flag
     bool bIsFromPool = false;
 
+    // Enqueue order, tie-breaker for equal Priority/QueueTime (FIFO)
+    uint64 Sequence = 0;
+
+    // Position in the service priority heap (INDEX_NONE = not queued)
+    int32 HeapIndex = INDEX_NONE;
+
     bool operator<(const FSuspenseCoreQueuedOperation& Other) const
     {
         return Priority < Other.Priority;
@@ -66,9 +73,11 @@ struct FSuspenseCoreQueuedOperation
     void Reset()
     {
         Request = FEquipmentOperationRequest();
-        QueueTime = 0.0f;
+        QueueTime = 0.0;
         Priority = 0;
         TransactionId = FGuid();
+        Sequence = 0;
+        HeapIndex = INDEX_NONE;
     }
 };
 
@@ -290,6 +299,20 @@ protected:
     void ProcessQueueAsync();
     bool TickQueueFallback(float DeltaTime);
 
+    // Coalescing key: (OperationType, ItemID, SourceSlotIndex)
+    using FCoalesceKey = TTuple<uint8, FName, int32>;
+
+    // Priority heap over OperationQueue, ordered by (Priority desc, QueueTime asc, Sequence asc)
+    static bool QueueHeapBefore(const FSuspenseCoreQueuedOperation& A, const FSuspenseCoreQueuedOperation& B);
+    void QueueHeapPush(FSuspenseCoreQueuedOperation* Op);
+    FSuspenseCoreQueuedOperation* QueueHeapPop();
+    void QueueHeapRemoveAt(int32 HeapIndex);
+    void QueueHeapSiftUp(int32 HeapIndex);
+    void QueueHeapSiftDown(int32 HeapIndex);
+    void QueueHeapSet(int32 HeapIndex, FSuspenseCoreQueuedOperation* Op);
+    void ReleaseAllQueuedOperations();
+    static FCoalesceKey MakeCoalesceKey(const FSuspenseCoreQueuedOperation& Op);
+
     // Queue optimization
     int32 TryCoalesceOperation(FSuspenseCoreQueuedOperation* NewOp);
     void OptimizeQueue();
@@ -389,7 +412,17 @@ private:
     TMap<FGuid, FGuid> OperationToPredictionMap;
 
     // Queue Management
+    // Binary heap (see QueueHeap*), top = next operation to execute
     TArray<FSuspenseCoreQueuedOperation*> OperationQueue;
+    uint64 NextQueueSequence = 1;
+
+    // Coalescing index: newest queued op per key.
+    // Entries are dropped when the op leaves the heap, so pointers are always live.
+    TMap<FCoalesceKey, FSuspenseCoreQueuedOperation*> CoalesceIndex;
+
+    // OperationId -> queued op, same lifetime rules as CoalesceIndex (O(1) cancel)
+    TMap<FGuid, FSuspenseCoreQueuedOperation*> QueuedOperationsById;
+
     TMap<FGuid, TArray<FSuspenseCoreQueuedOperation*>> ActiveBatches;
     bool bIsProcessingQueue = false;
     bool bQueueProcessingEnabled = true;
@@ -412,9 +445,9 @@ private:
     mutable std::atomic<int32> ResultPoolMisses{0};
     mutable std::atomic<int32> PoolOverflows{0};
 
-    // History Management
-    TArray<FSuspenseCoreOperationHistoryEntry> OperationHistory;
-    TArray<FSuspenseCoreOperationHistoryEntry> RedoStack;
+    // History Management (fixed capacity = MaxHistorySize, oldest entries are overwritten)
+    TSuspenseCoreRingBuffer<FSuspenseCoreOperationHistoryEntry> OperationHistory;
+    TSuspenseCoreRingBuffer<FSuspenseCoreOperationHistoryEntry> RedoStack;
     int32 MaxHistorySize = 50;
 
     // Caching
@@ -7,6 +7,7 @@
 #include "SuspenseCore/Services/SuspenseCoreEquipmentServiceMacros.h"
 #include "SuspenseCore/Security/SuspenseSecureKeyStorage.h"
 #include "SuspenseCore/Security/SuspenseNonceLRUCache.h"
+#include "SuspenseCore/Security/SuspenseRateLimiter.h"
 #include "SuspenseCore/Types/Network/SuspenseCoreNetworkTypes.h"
 #include "HAL/CriticalSection.h"
 #include "Templates/SharedPointer.h"
@@ -79,7 +80,7 @@ struct FSecurityServiceConfig
     UPROPERTY(EditAnywhere, Config, Category = "RateLimit")
     bool bEnableIPRateLimit = true;
 
-    /** Maximum operations per IP per minute */
+    /** Maximum operations per IP per minute (remote address without port) */
     UPROPERTY(EditAnywhere, Config, Category = "RateLimit")
     int32 MaxOperationsPerIPPerMinute = 500;
 
@@ -120,28 +121,6 @@ struct EQUIPMENTSYSTEM_API FSecurityServiceMetrics
     void Reset();
 };
 
-//========================================
-// RATE LIMIT DATA
-//========================================
-
-/**
- * Rate limiting data for player/IP operations
- */
-struct FRateLimitEntry
-{
-    TArray<float> OperationTimestamps;
-    float LastOperationTime = 0.0f;
-    int32 ViolationCount = 0;
-    FString Identifier;
-    bool bIsTemporarilyBanned = false;
-    float BanExpiryTime = 0.0f;
-
-    bool IsOperationAllowed(float CurrentTime, int32 MaxPerSecond, int32 MaxPerMinute);
-    void RecordOperation(float CurrentTime);
-    void RecordViolation(float CurrentTime, float BanDuration, int32 MaxViolations);
-    void ClearExpiredTimestamps(float CurrentTime);
-};
-
 //========================================
 // SECURITY VALIDATION RESULT
 //========================================
@@ -304,11 +283,11 @@ protected:
     // Configuration
     FSecurityServiceConfig Config;
 
-    // Rate limiting - per player GUID
-    TMap<FGuid, FRateLimitEntry> RateLimitPerPlayer;
+    // Rate limiting - per player GUID (GCRA, own sharded locks)
+    FSuspenseRateLimiter PlayerRateLimiter;
 
     // Rate limiting - per IP address
-    TMap<FString, FRateLimitEntry> RateLimitPerIP;
+    FSuspenseRateLimiter IPRateLimiter;
 
     // Suspicious activity tracking
     TMap<FString, int32> SuspiciousActivityCount;
@@ -333,14 +312,17 @@ protected:
 private:
     // Internal helpers
     bool CheckPlayerRateLimit(const FGuid& PlayerGuid);
-    bool CheckIPRateLimit(const FString& IPAddress);
+    bool CheckIPRateLimit(APlayerController* PlayerController);
+    void ApplyRateLimitConfig();
     bool IsNonceUsed(uint64 Nonce) const;
     bool MarkNoncePending(uint64 Nonce);
     void ConfirmNonce(uint64 Nonce);
     void RejectNonce(uint64 Nonce);
 
     FString GetPlayerIdentifier(APlayerController* PlayerController) const;
-    FString GetIPAddress(APlayerController* PlayerController) const;
+
+    /** Integer key of the remote address (without port); false if there is no remote address */
+    bool GetIPKey(APlayerController* PlayerController, uint64& OutKey) const;
 
     void CleanupExpiredData();
     void UpdateMetrics(double ProcessingStartTime);
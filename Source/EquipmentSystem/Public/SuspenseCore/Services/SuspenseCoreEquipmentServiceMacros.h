@@ -159,11 +159,134 @@ struct FSuspenseCoreMetricAccumulator
     }
 };
 
+/**
+ * Pre-registered metric id.
+ * Имена регистрируются один раз; горячий путь работает с индексом, а не с FName/строкой.
+ */
+struct FSuspenseCoreMetricId
+{
+    int32 Index = INDEX_NONE;
+
+    FORCEINLINE bool IsValid() const { return Index != INDEX_NONE; }
+};
+
+/**
+ * Process-wide metric name table (FName <-> FSuspenseCoreMetricId)
+ *
+ * Общая для всех сервисов: один и тот же id означает одно и то же имя в любом FSuspenseCoreServiceMetrics.
+ * Регистрация берёт lock; чтение имени по id — без блокировок.
+ */
+struct EQUIPMENTSYSTEM_API FSuspenseCoreMetricRegistry
+{
+    static constexpr int32 MaxMetrics = 1024;
+
+    /** Stable id for the name. Invalid id when the table is full (value is dropped) */
+    static FSuspenseCoreMetricId Register(const FName& Name);
+
+    static FName GetName(FSuspenseCoreMetricId Id);
+
+    /** Registered names so far */
+    static int32 Num();
+
+    /** Shard of the calling thread, assigned round-robin on first use */
+    static uint32 GetThreadShard();
+};
+
+/**
+ * Cached id for a literal metric name: registration happens once per call site.
+ * Usage: ServiceMetrics.Inc(SUSPENSECORE_METRIC_ID("Cache.Hit"));
+ */
+#define SUSPENSECORE_METRIC_ID(MetricName) \
+    ([]() -> FSuspenseCoreMetricId { static const FSuspenseCoreMetricId CachedMetricId = FSuspenseCoreMetricRegistry::Register(FName(TEXT(MetricName))); return CachedMetricId; }())
+
+/**
+ * HDR-style log-linear latency histogram, microseconds.
+ * 8 sub-buckets per power of two: relative error <= 12.5%, values below 8 us are exact.
+ * Buckets are relaxed atomics, so a shard can be read while its thread keeps writing.
+ */
+struct FSuspenseCoreLatencyHistogram
+{
+    static constexpr int32 SubBucketBits = 3;
+    static constexpr int32 SubBuckets = 1 << SubBucketBits;
+    static constexpr int32 MaxExponent = 39; // ~6 days in us
+    static constexpr int32 NumBuckets = (MaxExponent - SubBucketBits + 2) * SubBuckets;
+
+    std::atomic<uint32> Buckets[NumBuckets];
+
+    FSuspenseCoreLatencyHistogram() { Reset(); }
+
+    static FORCEINLINE int32 BucketIndex(int64 Us)
+    {
+        if (Us < SubBuckets)
+        {
+            return Us > 0 ? int32(Us) : 0;
+        }
+        const int32 Exponent = FMath::Min<int32>(FMath::FloorLog2_64(uint64(Us)), MaxExponent);
+        const int32 Sub = int32((uint64(Us) >> (Exponent - SubBucketBits)) & (SubBuckets - 1));
+        return (Exponent - SubBucketBits + 1) * SubBuckets + Sub;
+    }
+
+    /** Representative value (bucket midpoint) */
+    static FORCEINLINE int64 BucketValue(int32 Index)
+    {
+        if (Index < SubBuckets)
+        {
+            return Index;
+        }
+        const int32 Exponent = Index / SubBuckets + SubBucketBits - 1;
+        const int64 Width = int64(1) << (Exponent - SubBucketBits);
+        const int64 Lower = int64(SubBuckets + Index % SubBuckets) * Width;
+        return Lower + Width / 2;
+    }
+
+    FORCEINLINE void Add(int64 Us)
+    {
+        Buckets[BucketIndex(Us)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void Reset()
+    {
+        for (std::atomic<uint32>& Bucket : Buckets)
+        {
+            Bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /** Quantile (0..1) over merged bucket counts, microseconds */
+    static int64 Percentile(const TArray<uint64>& Merged, uint64 Total, double Quantile)
+    {
+        if (Total == 0)
+        {
+            return 0;
+        }
+        const uint64 Rank = FMath::Max<uint64>(1, uint64(FMath::CeilToDouble(Quantile * double(Total))));
+        uint64 Seen = 0;
+        for (int32 Index = 0; Index < Merged.Num(); ++Index)
+        {
+            Seen += Merged[Index];
+            if (Seen >= Rank)
+            {
+                return BucketValue(Index);
+            }
+        }
+        return BucketValue(Merged.Num() - 1);
+    }
+};
+
 /**
  * Unified service metrics container
+ *
+ * Именованные метрики пишутся в шард текущего потока (relaxed атомики, без lock'ов),
+ * при чтении шарды сливаются. Длительности дополнительно попадают в гистограмму,
+ * из которой считаются p50/p95/p99.
+ *
+ * FName-перегрузки оставлены для совместимости: они регистрируют имя на каждом вызове,
+ * в горячих местах используйте SUSPENSECORE_METRIC_ID / SCOPED_SERVICE_TIMER.
  */
-struct FSuspenseCoreServiceMetrics
+struct EQUIPMENTSYSTEM_API FSuspenseCoreServiceMetrics
 {
+    static constexpr int32 NumShards = 8;
+
     // Global counters
     std::atomic<int64> TotalCalls{0};
     std::atomic<int64> TotalSuccess{0};
@@ -172,9 +295,27 @@ struct FSuspenseCoreServiceMetrics
     std::atomic<int64> MinDurationMs{LLONG_MAX};
     std::atomic<int64> MaxDurationMs{LLONG_MIN};
 
-    // Named metrics (methods, custom metrics)
-    mutable FCriticalSection NamedLock;
-    TMap<FName, FSuspenseCoreMetricAccumulator> Named; // Protected by NamedLock
+    /** Merged view of one named metric */
+    struct FNamedSnapshot
+    {
+        FName Name;
+        FSuspenseCoreMetricAccumulator::FSnapshot Values;
+        bool bHasLatency = false;
+        int64 LatencyCount = 0;
+        double P50Ms = 0.0;
+        double P95Ms = 0.0;
+        double P99Ms = 0.0;
+    };
+
+    FSuspenseCoreServiceMetrics();
+    ~FSuspenseCoreServiceMetrics();
+
+    FSuspenseCoreServiceMetrics(const FSuspenseCoreServiceMetrics&) = delete;
+    FSuspenseCoreServiceMetrics& operator=(const FSuspenseCoreServiceMetrics&) = delete;
+
+    /** Name used by the CSV profiler / Insights publisher; unnamed containers are not published */
+    void SetServiceName(const FString& InServiceName);
+    FString GetServiceName() const;
 
     void RecordCallDuration(int64 DurationMs)
     {
@@ -191,104 +332,103 @@ struct FSuspenseCoreServiceMetrics
     void RecordSuccess() { TotalSuccess.fetch_add(1, std::memory_order_relaxed); }
     void RecordError() { TotalErrors.fetch_add(1, std::memory_order_relaxed); }
 
-    void RecordValue(const FName& MetricName, int64 Value)
+    FORCEINLINE void RecordValue(FSuspenseCoreMetricId Id, int64 Value)
     {
-        FScopeLock L(&NamedLock);
-        FSuspenseCoreMetricAccumulator& Acc = Named.FindOrAdd(MetricName);
-        Acc.Add(Value);
+        if (FSlot* Slot = GetSlot(Id))
+        {
+            Slot->Values.Add(Value);
+        }
     }
 
-    void RecordEvent(const FName& EventName, int64 Count = 1)
+    void RecordValue(const FName& MetricName, int64 Value)
     {
-        RecordValue(EventName, Count);
+        RecordValue(FSuspenseCoreMetricRegistry::Register(MetricName), Value);
     }
 
+    void RecordEvent(FSuspenseCoreMetricId Id, int64 Count = 1) { RecordValue(Id, Count); }
+    void RecordEvent(const FName& EventName, int64 Count = 1) { RecordValue(EventName, Count); }
+
+    FORCEINLINE void Inc(FSuspenseCoreMetricId Id, int64 Delta = 1) { RecordValue(Id, Delta); }
     FORCEINLINE void Inc(const FName& MetricName, int64 Delta = 1) { RecordValue(MetricName, Delta); }
-    FORCEINLINE void AddDurationMs(const FName& MetricName, int64 DurationMs) { RecordValue(MetricName, DurationMs); }
 
-    void Reset()
+    /** Duration in microseconds: counters keep ms (как раньше), histogram keeps us */
+    FORCEINLINE void AddDurationUs(FSuspenseCoreMetricId Id, int64 DurationUs)
     {
-        TotalCalls.store(0, std::memory_order_seq_cst);
-        TotalSuccess.store(0, std::memory_order_seq_cst);
-        TotalErrors.store(0, std::memory_order_seq_cst);
-        TotalDurationMs.store(0, std::memory_order_seq_cst);
-        MinDurationMs.store(LLONG_MAX, std::memory_order_seq_cst);
-        MaxDurationMs.store(LLONG_MIN, std::memory_order_seq_cst);
-
-        FScopeLock L(&NamedLock);
-        Named.Empty();
+        if (FSlot* Slot = GetSlot(Id))
+        {
+            Slot->Values.Add(DurationUs / 1000);
+            GetOrCreate(Slot->Latency)->Add(DurationUs);
+        }
     }
 
-    bool ExportToCSV(const FString& AbsoluteFilePath, const FString& ServiceName) const
+    FORCEINLINE void AddDurationMs(FSuspenseCoreMetricId Id, int64 DurationMs) { AddDurationUs(Id, DurationMs * 1000); }
+    FORCEINLINE void AddDurationMs(const FName& MetricName, int64 DurationMs) { AddDurationMs(FSuspenseCoreMetricRegistry::Register(MetricName), DurationMs); }
+
+    /** Merge all shards. Consistent per value, not across values (writers are not paused) */
+    void GatherNamed(TArray<FNamedSnapshot>& OutSnapshots) const;
+
+    void Reset();
+
+    bool ExportToCSV(const FString& AbsoluteFilePath, const FString& InServiceName) const;
+
+    FString ToString(const FString& InServiceName) const;
+
+    /** Push counters and percentiles to the CSV profiler and Insights (no-op when both are compiled out) */
+    void PublishToProfilers() const;
+
+private:
+    struct FSlot
     {
-        FString Csv;
-        Csv += TEXT("service,metric,count,sum,min,max,avg\n");
+        FSuspenseCoreMetricAccumulator Values;
+        std::atomic<FSuspenseCoreLatencyHistogram*> Latency{nullptr};
+    };
+
+    /** Per-thread shard: lazily allocated slots, indexed by metric id */
+    struct FShard
+    {
+        std::atomic<FSlot*> Slots[FSuspenseCoreMetricRegistry::MaxMetrics];
 
+        FShard()
         {
-            const int64 totalCalls = TotalCalls.load();
-            const int64 totalDur = TotalDurationMs.load();
-            const int64 minDur = (MinDurationMs.load() == LLONG_MAX) ? 0 : MinDurationMs.load();
-            const int64 maxDur = (MaxDurationMs.load() == LLONG_MIN) ? 0 : MaxDurationMs.load();
-            const double avgDur = (totalCalls > 0) ? double(totalDur) / double(totalCalls) : 0.0;
-
-            Csv += FString::Printf(TEXT("%s,%s,%lld,%lld,%lld,%lld,%.3f\n"),
-                *ServiceName, TEXT("public_method_duration_ms"),
-                (long long)totalCalls, (long long)totalDur,
-                (long long)minDur, (long long)maxDur, avgDur);
+            for (std::atomic<FSlot*>& Slot : Slots)
+            {
+                Slot.store(nullptr, std::memory_order_relaxed);
+            }
         }
+    };
 
+    /** Lock-free lazy allocation: the losing thread frees its copy */
+    template<typename T>
+    static FORCEINLINE T* GetOrCreate(std::atomic<T*>& Ptr)
+    {
+        T* Current = Ptr.load(std::memory_order_acquire);
+        if (Current)
         {
-            Csv += FString::Printf(TEXT("%s,%s,%lld,%lld,%d,%d,%.3f\n"),
-                *ServiceName, TEXT("success"),
-                (long long)TotalSuccess.load(), (long long)TotalSuccess.load(),
-                0, 0, 1.0);
-            Csv += FString::Printf(TEXT("%s,%s,%lld,%lld,%d,%d,%.3f\n"),
-                *ServiceName, TEXT("errors"),
-                (long long)TotalErrors.load(), (long long)TotalErrors.load(),
-                0, 0, 1.0);
+            return Current;
         }
-
+        T* Created = new T();
+        if (Ptr.compare_exchange_strong(Current, Created, std::memory_order_acq_rel))
         {
-            FScopeLock L(&NamedLock);
-            for (const auto& KVP : Named)
-            {
-                const FName& Name = KVP.Key;
-                const FSuspenseCoreMetricAccumulator::FSnapshot S = KVP.Value.Snapshot();
-                Csv += FString::Printf(TEXT("%s,%s,%lld,%lld,%lld,%lld,%.3f\n"),
-                    *ServiceName, *Name.ToString(),
-                    (long long)S.Count, (long long)S.Sum,
-                    (long long)S.Min, (long long)S.Max, S.Avg);
-            }
+            return Created;
         }
-
-        return FFileHelper::SaveStringToFile(Csv, *AbsoluteFilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+        delete Created;
+        return Current;
     }
 
-    FString ToString(const FString& ServiceName) const
+    FORCEINLINE FSlot* GetSlot(FSuspenseCoreMetricId Id)
     {
-        FString Out;
-        const int64 Calls = TotalCalls.load();
-        const int64 Dur = TotalDurationMs.load();
-        const int64 Min = (MinDurationMs.load() == LLONG_MAX) ? 0 : MinDurationMs.load();
-        const int64 Max = (MaxDurationMs.load() == LLONG_MIN) ? 0 : MaxDurationMs.load();
-        const double Avg = (Calls > 0) ? double(Dur) / double(Calls) : 0.0;
-
-        Out += FString::Printf(TEXT("\n--- Metrics (%s) ---\n"), *ServiceName);
-        Out += FString::Printf(TEXT("Public calls: %lld | Success: %lld | Errors: %lld\n"),
-            (long long)Calls, (long long)TotalSuccess.load(), (long long)TotalErrors.load());
-        Out += FString::Printf(TEXT("Duration ms (sum/min/max/avg): %lld / %lld / %lld / %.3f\n"),
-            (long long)Dur, (long long)Min, (long long)Max, Avg);
-
-        FScopeLock L(&NamedLock);
-        for (const auto& KVP : Named)
+        if (!Id.IsValid())
         {
-            const FSuspenseCoreMetricAccumulator::FSnapshot S = KVP.Value.Snapshot();
-            Out += FString::Printf(TEXT("%s => count=%lld, sum=%lld, min=%lld, max=%lld, avg=%.3f\n"),
-                *KVP.Key.ToString(), (long long)S.Count, (long long)S.Sum,
-                (long long)S.Min, (long long)S.Max, S.Avg);
+            return nullptr;
         }
-        return Out;
+        FShard* Shard = GetOrCreate(Shards[FSuspenseCoreMetricRegistry::GetThreadShard()]);
+        return GetOrCreate(Shard->Slots[Id.Index]);
     }
+
+    std::atomic<FShard*> Shards[NumShards];
+
+    mutable FCriticalSection ServiceNameLock;
+    FString ServiceName; // Protected by ServiceNameLock
 };
 
 //========================================
@@ -489,24 +629,27 @@ struct FSuspenseCoreDeltaMetrics
 class FSuspenseCoreScopedServiceTimer
 {
 public:
-    FSuspenseCoreScopedServiceTimer(FSuspenseCoreServiceMetrics& InMetrics, const FName& InMethodMetricName)
+    FSuspenseCoreScopedServiceTimer(FSuspenseCoreServiceMetrics& InMetrics, FSuspenseCoreMetricId InMethodMetricId)
         : Metrics(InMetrics)
-        , MethodMetricName(InMethodMetricName)
-        , StartSeconds(FPlatformTime::Seconds())
+        , MethodMetricId(InMethodMetricId)
+        , StartCycles(FPlatformTime::Cycles64())
+    {}
+
+    FSuspenseCoreScopedServiceTimer(FSuspenseCoreServiceMetrics& InMetrics, const FName& InMethodMetricName)
+        : FSuspenseCoreScopedServiceTimer(InMetrics, FSuspenseCoreMetricRegistry::Register(InMethodMetricName))
     {}
 
     ~FSuspenseCoreScopedServiceTimer()
     {
-        const double End = FPlatformTime::Seconds();
-        const int64 Ms = (int64)((End - StartSeconds) * 1000.0);
-        Metrics.RecordCallDuration(Ms);
-        Metrics.AddDurationMs(MethodMetricName, Ms);
+        const int64 Us = (int64)(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0);
+        Metrics.RecordCallDuration(Us / 1000);
+        Metrics.AddDurationUs(MethodMetricId, Us);
     }
 
 private:
     FSuspenseCoreServiceMetrics& Metrics;
-    FName MethodMetricName;
-    double StartSeconds = 0.0;
+    FSuspenseCoreMetricId MethodMetricId;
+    uint64 StartCycles = 0;
 };
 
 class FSuspenseCoreScopedDiffTimer
@@ -574,13 +717,13 @@ private:
 //========================================
 
 #define RECORD_SERVICE_METRIC(MetricName, Value) \
-    do { ServiceMetrics.RecordValue(FName(TEXT(MetricName)), (int64)(Value)); } while(0)
+    do { ServiceMetrics.RecordValue(SUSPENSECORE_METRIC_ID(MetricName), (int64)(Value)); } while(0)
 
 #define SCOPED_SERVICE_TIMER(MetricName) \
-    FSuspenseCoreScopedServiceTimer ANON_SVC_TIMER_##__LINE__(ServiceMetrics, FName(TEXT(MetricName)))
+    FSuspenseCoreScopedServiceTimer ANON_SVC_TIMER_##__LINE__(ServiceMetrics, SUSPENSECORE_METRIC_ID(MetricName))
 
 #define SCOPED_SERVICE_TIMER_CONST(MetricName) \
-    FSuspenseCoreScopedServiceTimer ANON_SVC_TIMER_##__LINE__(const_cast<FSuspenseCoreServiceMetrics&>(ServiceMetrics), FName(TEXT(MetricName)))
+    FSuspenseCoreScopedServiceTimer ANON_SVC_TIMER_##__LINE__(const_cast<FSuspenseCoreServiceMetrics&>(ServiceMetrics), SUSPENSECORE_METRIC_ID(MetricName))
 
 //========================================
 // Delta/DIFF Metrics Macros
@@ -0,0 +1,201 @@
+// SuspenseCoreGrenadeSubsystem.h
+// Fuse scheduling and batched explosion processing for grenade projectiles
+// Copyright Suspense Team. All Rights Reserved.
+//
+// ARCHITECTURE:
+// - TickableWorldSubsystem, server/standalone only
+// - Owns every live fuse in one time-ordered heap: grenades do not tick
+// - Explosions requested during a frame are processed together on the
+//   subsystem tick: one overlap per cluster of nearby explosions,
+//   deduplicated targets, async occlusion traces resolved next frame
+//
+// PERFORMANCE:
+// - Fuse check: O(1) per frame when nothing expires, O(log N) per expiry
+// - Cluster explosions (several grenades in one spot) share one overlap query
+// - Occlusion traces run on physics worker threads instead of the game thread
+//
+// USAGE:
+// 1. Fuse:      FuseId = Subsystem->ScheduleFuse(Grenade, ExplodeTime);  // OnFuseExpired() when due
+// 2. Cancel:    Subsystem->CancelFuse(FuseId);
+// 3. Explosion: Subsystem->QueueExplosion(MoveTemp(Request));  // ApplyExplosionToTarget() per visible target
+//
+// CVARS:
+// - suspensecore.grenade.async_explosions  0 = occlusion traces run synchronously on the subsystem tick
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "SuspenseCoreGrenadeSubsystem.generated.h"
+
+class ASuspenseCoreGrenadeProjectile;
+
+/**
+ * One explosion to process on the next subsystem tick
+ */
+struct EQUIPMENTSYSTEM_API FSuspenseCoreExplosionRequest
+{
+	/** Receives per-target callbacks and OnExplosionResolved() */
+	TWeakObjectPtr<ASuspenseCoreGrenadeProjectile> Grenade;
+
+	FVector Location = FVector::ZeroVector;
+
+	/** Targets farther than this (actor location) are skipped */
+	float Radius = 0.0f;
+
+	/** Line-of-sight check from Location to each target */
+	bool bCheckOcclusion = true;
+
+	/** Actors that never receive damage (e.g. instigator without self-damage) */
+	TArray<TWeakObjectPtr<AActor>, TInlineAllocator<2>> IgnoreActors;
+};
+
+/**
+ * Per-frame counters (reset every tick)
+ */
+struct EQUIPMENTSYSTEM_API FSuspenseCoreGrenadeFrameStats
+{
+	/** Fuses that ran out this frame */
+	int32 FusesExpired = 0;
+
+	/** Explosions processed this frame */
+	int32 Explosions = 0;
+
+	/** Overlap queries issued (one per explosion cluster) */
+	int32 OverlapQueries = 0;
+
+	/** Occlusion line traces issued */
+	int32 OcclusionTraces = 0;
+
+	/** Explosion/target pairs that received damage */
+	int32 TargetsHit = 0;
+};
+
+/**
+ * USuspenseCoreGrenadeSubsystem
+ *
+ * Fuse timer and explosion batcher for ASuspenseCoreGrenadeProjectile.
+ *
+ * FRAME FLOW:
+ * 1. Apply results of last frame's occlusion traces (damage lands one frame after the explosion)
+ * 2. Pop expired fuses; exploding grenades queue explosion requests
+ * 3. Cluster queued explosions, overlap once per cluster, dedupe targets,
+ *    issue one async occlusion trace per explosion/target pair
+ *
+ * THREAD SAFETY:
+ * - GameThread only
+ *
+ * @see ASuspenseCoreGrenadeProjectile
+ */
+UCLASS()
+class EQUIPMENTSYSTEM_API USuspenseCoreGrenadeSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ═══════════════════════════════════════════════════════════════════
+	// SUBSYSTEM LIFECYCLE
+	// ═══════════════════════════════════════════════════════════════════
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// ═══════════════════════════════════════════════════════════════════
+	// STATIC ACCESS
+	// ═══════════════════════════════════════════════════════════════════
+
+	/** Get grenade subsystem for the world of the context object */
+	static USuspenseCoreGrenadeSubsystem* Get(const UObject* WorldContextObject);
+
+	// ═══════════════════════════════════════════════════════════════════
+	// FUSE API
+	// ═══════════════════════════════════════════════════════════════════
+
+	/**
+	 * Schedule Grenade->OnFuseExpired() at ExplodeTime (world time seconds)
+	 * @return Fuse id for CancelFuse (never 0)
+	 */
+	uint32 ScheduleFuse(ASuspenseCoreGrenadeProjectile* Grenade, double ExplodeTime);
+
+	/** Cancel a scheduled fuse (no-op for unknown or expired ids) */
+	void CancelFuse(uint32 FuseId);
+
+	/** Fuses scheduled and not cancelled */
+	int32 GetNumLiveFuses() const { return FuseHeap.Num() - CancelledFuses.Num(); }
+
+	// ═══════════════════════════════════════════════════════════════════
+	// EXPLOSION API
+	// ═══════════════════════════════════════════════════════════════════
+
+	/** Queue an explosion for this frame's batch */
+	void QueueExplosion(FSuspenseCoreExplosionRequest&& Request);
+
+	/** Counters of the last completed tick */
+	const FSuspenseCoreGrenadeFrameStats& GetLastFrameStats() const { return LastFrameStats; }
+
+protected:
+	struct FFuse
+	{
+		double ExplodeTime = 0.0;
+		uint32 FuseId = 0;
+		TWeakObjectPtr<ASuspenseCoreGrenadeProjectile> Grenade;
+
+		/** Min-heap on time; id breaks ties so same-time fuses go in schedule order */
+		bool operator<(const FFuse& Other) const
+		{
+			return ExplodeTime < Other.ExplodeTime
+				|| (ExplodeTime == Other.ExplodeTime && FuseId < Other.FuseId);
+		}
+	};
+
+	/** Explosion/target pair waiting for its occlusion trace */
+	struct FOcclusionCheck
+	{
+		int32 ExplosionIndex = INDEX_NONE;
+		TWeakObjectPtr<AActor> Target;
+		float Distance = 0.0f;
+		bool bDone = false;
+		bool bVisible = false;
+	};
+
+	/** Fire fuses whose time has come */
+	void ProcessFuses(double Now);
+
+	/** Overlap + dedupe for everything queued; issue occlusion traces */
+	void ProcessQueuedExplosions();
+
+	/** Apply damage for finished occlusion checks and release their explosions */
+	void ResolveOcclusion();
+
+	/** FTraceDelegate target; UserData is the index into OcclusionChecks */
+	void OnOcclusionTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	/** Damage one explosion/target pair */
+	void ApplyToTarget(const FSuspenseCoreExplosionRequest& Explosion, AActor* Target, float Distance);
+
+private:
+	/** Live fuses, heap ordered by FFuse::operator< */
+	TArray<FFuse> FuseHeap;
+
+	/** Lazily removed: skipped when they reach the top of the heap */
+	TSet<uint32> CancelledFuses;
+
+	uint32 NextFuseId = 1;
+
+	/** Requested this frame */
+	TArray<FSuspenseCoreExplosionRequest> QueuedExplosions;
+
+	/** Processed explosions waiting for occlusion results */
+	TArray<FSuspenseCoreExplosionRequest> PendingExplosions;
+	TArray<FOcclusionCheck> OcclusionChecks;
+	int32 NumOcclusionTracesInFlight = 0;
+
+	FTraceDelegate OcclusionTraceDelegate;
+
+	FSuspenseCoreGrenadeFrameStats FrameStats;
+	FSuspenseCoreGrenadeFrameStats LastFrameStats;
+};
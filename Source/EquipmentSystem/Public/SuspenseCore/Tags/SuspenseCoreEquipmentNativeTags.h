@@ -7,6 +7,20 @@
 // Usage:
 //   #include "SuspenseCore/Tags/SuspenseCoreEquipmentNativeTags.h"
 //   EventBus->Publish(SuspenseCoreEquipmentTags::Event::Equipped, Payload);
+//
+// Registered natively when the hot paths moved off RequestGameplayTag (previously
+// only looked up at runtime, so a config using them no longer fails validation):
+//   SuspenseCore.Event.Equipment.Delta, .Delta.Batch, .RequestResend
+//   SuspenseCore.Event.Cache.Invalidate.Equipment, SuspenseCore.Event.Weapon.StateChanged
+//   Weapon.State.None
+//   Equipment.State.Default / Switching / Reloading / Inspecting / Repairing / Upgrading / Error
+//   Equipment.Slot.Hand.Main, Equipment.Slot.Hand.Off, Equipment.Slot.Unique
+//   Item.Weapon.TwoHanded, Item.RequiresBothHands, Item.Shield
+//   Item.Armor.Light / Medium / Heavy
+//   Rule.Conflict.ItemCheck / SlotCheck / TypeExclusivity
+//   Resolution.Action.Prompt / Reject
+//   Set.Knight (default set bonus)
+// Add new strings here deliberately: anything registered below becomes a valid tag.
 
 #pragma once
 
@@ -143,6 +157,15 @@ namespace SuspenseCoreEquipmentTags
         //--- Slot Events (used by DataStore for EventBus) ---
         EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Event_SlotUpdated);
         EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Event_Updated);
+
+        //--- DataService Events ---
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Event_Delta);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Event_Delta_Batch);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Event_RequestResend);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Event_Cache_Invalidate);
+
+        //--- WeaponStateManager Events ---
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Event_Weapon_StateChanged);
     }
 
     //========================================
@@ -152,6 +175,7 @@ namespace SuspenseCoreEquipmentTags
     namespace WeaponState
     {
         EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Weapon_State);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Weapon_State_None);
         EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Weapon_State_Ready);
         EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Weapon_State_Holstered);
         EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Weapon_State_Drawing);
@@ -257,6 +281,50 @@ namespace SuspenseCoreEquipmentTags
         EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_State_Cooldown);
         EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_State_Locked);
         EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_State_Disabled);
+
+        // Extended states (used by DataStore state machine)
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_State_Default);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_State_Switching);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_State_Reloading);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_State_Inspecting);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_State_Repairing);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_State_Upgrading);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_State_Error);
+    }
+
+    //========================================
+    // DELTA TAGS
+    // Used for change tracking (FEquipmentDelta::ChangeType)
+    //========================================
+    namespace Delta
+    {
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Delta);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Delta_Initialize);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Delta_ItemSet);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Delta_ItemClear);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Delta_ActiveWeapon);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Delta_StateChange);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Delta_SnapshotRestore);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Delta_Reset);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Delta_Revert);
+    }
+
+    //========================================
+    // REASON TAGS
+    // Used for change reasons (FEquipmentDelta::ReasonTag)
+    //========================================
+    namespace Reason
+    {
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Reason);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Reason_Initialize);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Reason_DirectSet);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Reason_DirectClear);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Reason_ActiveChange);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Reason_StateTransition);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Reason_SnapshotRestore);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Reason_ResetToDefault);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Reason_Rollback);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Reason_Transaction);
     }
 
     //========================================
@@ -307,6 +375,11 @@ namespace SuspenseCoreEquipmentTags
 
         // Special
         EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Slot_Armband);
+
+        // Hands / uniqueness (used by ConflictRulesEngine)
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Slot_Hand_Main);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Slot_Hand_Off);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Equipment_Slot_Unique);
     }
 
     //========================================
@@ -352,6 +425,24 @@ namespace SuspenseCoreEquipmentTags
         EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Validation_Error_UniqueGroup);
     }
 
+    //========================================
+    // CONFLICT RULE TAGS
+    // Used by ConflictRulesEngine for rule/resolution identification
+    //========================================
+    namespace Conflict
+    {
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Rule_Conflict_ItemCheck);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Rule_Conflict_SlotCheck);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Rule_Conflict_TypeExclusivity);
+
+        // Resolution actions
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Resolution_Action_Prompt);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Resolution_Action_Reject);
+
+        // Built-in set bonus (default set definitions)
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Set_Knight);
+    }
+
     //========================================
     // ITEM TYPE TAGS
     // Used for item classification in equipment slots
@@ -378,6 +469,11 @@ namespace SuspenseCoreEquipmentTags
         EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Item_Weapon_Melee);
         EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Item_Weapon_Melee_Knife);
 
+        // Handedness
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Item_Weapon_TwoHanded);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Item_RequiresBothHands);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Item_Shield);
+
         // Gear tags (head, body, storage, special)
         EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Item_Gear);
         EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Item_Gear_Headwear);
@@ -393,6 +489,9 @@ namespace SuspenseCoreEquipmentTags
         EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Item_Armor);
         EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Item_Armor_Helmet);
         EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Item_Armor_BodyArmor);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Item_Armor_Light);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Item_Armor_Medium);
+        EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Item_Armor_Heavy);
 
         // Consumable/utility tags
         EQUIPMENTSYSTEM_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(TAG_Item_Consumable);
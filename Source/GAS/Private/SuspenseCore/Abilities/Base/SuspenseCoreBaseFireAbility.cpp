@@ -6,6 +6,8 @@
 #include "SuspenseCore/Tags/SuspenseCoreGameplayTags.h"
 #include "SuspenseCore/Attributes/SuspenseCoreWeaponAttributeSet.h"
 #include "SuspenseCore/Utils/SuspenseCoreTraceUtils.h"
+#include "SuspenseCore/Subsystems/SuspenseCoreShotTraceSubsystem.h"
+#include "SuspenseCore/Subsystems/SuspenseCoreLagCompensationSubsystem.h"
 #include "SuspenseCore/Utils/SuspenseCoreSpreadProcessor.h"
 #include "SuspenseCore/Utils/SuspenseCoreSpreadCalculator.h"
 #include "SuspenseCore/Core/SuspenseCoreUnits.h"
@@ -24,6 +26,7 @@
 #include "AbilitySystemGlobals.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/PlayerController.h"
+#include "GameFramework/GameStateBase.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "NiagaraFunctionLibrary.h"
 #include "NiagaraComponent.h"
@@ -331,7 +334,8 @@ FWeaponShotParams USuspenseCoreBaseFireAbility::GenerateShotRequest()
 	Params.Instigator = GetAvatarActorFromActorInfo();
 	Params.DamageMultiplier = 1.0f;
 	Params.ShotNumber = ConsecutiveShotsCount;
-	Params.Timestamp = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+	// Server clock: the server rewinds targets to this time (lag compensation)
+	Params.Timestamp = GetServerWorldTime();
 
 	return Params;
 }
@@ -352,10 +356,8 @@ void USuspenseCoreBaseFireAbility::ExecuteSingleShot()
 	}
 	else
 	{
-		// Server or standalone: process immediately
-		FSuspenseCoreShotResult Result;
-		ServerProcessShotTrace(ShotParams, Result);
-		ApplyDamageToTargets(Result.HitResults, ShotParams.BaseDamage);
+		// Server or standalone: trace goes into this frame's batch, damage lands when it completes
+		ServerSubmitShotTrace(ShotParams, false);
 		ConsumeAmmo();
 	}
 
@@ -417,19 +419,11 @@ void USuspenseCoreBaseFireAbility::ServerFireShot_Implementation(const FWeaponSh
 		return;
 	}
 
-	// Process trace
-	FSuspenseCoreShotResult Result;
-	ServerProcessShotTrace(ShotRequest, Result);
-	Result.bWasValidated = true;
-
-	// Apply damage
-	ApplyDamageToTargets(Result.HitResults, ShotRequest.BaseDamage);
+	// Queue trace; damage and the client result follow when the batch completes
+	ServerSubmitShotTrace(ShotRequest, true);
 
 	// Consume ammo
 	ConsumeAmmo();
-
-	// Send result to client
-	ClientReceiveShotResult(Result);
 }
 
 void USuspenseCoreBaseFireAbility::ClientReceiveShotResult_Implementation(const FSuspenseCoreShotResult& ShotResult)
@@ -461,7 +455,7 @@ bool USuspenseCoreBaseFireAbility::ValidateShotRequest(const FWeaponShotParams&
 	// Validate timestamp
 	if (GetWorld())
 	{
-		const float ServerTime = GetWorld()->GetTimeSeconds();
+		const float ServerTime = GetServerWorldTime();
 		const float TimeDiff = FMath::Abs(ServerTime - ShotRequest.Timestamp);
 		if (TimeDiff > MaxTimeDifference)
 		{
@@ -473,36 +467,51 @@ bool USuspenseCoreBaseFireAbility::ValidateShotRequest(const FWeaponShotParams&
 	return true;
 }
 
-void USuspenseCoreBaseFireAbility::ServerProcessShotTrace(const FWeaponShotParams& ShotRequest, FSuspenseCoreShotResult& OutResult)
+float USuspenseCoreBaseFireAbility::GetServerWorldTime() const
 {
-	OutResult.Timestamp = ShotRequest.Timestamp;
-
-	// Actors to ignore
-	TArray<AActor*> IgnoreActors;
-	if (AActor* Avatar = GetAvatarActorFromActorInfo())
+	const UWorld* World = GetWorld();
+	if (!World)
 	{
-		IgnoreActors.Add(Avatar);
+		return 0.0f;
 	}
 
+	const AGameStateBase* GameState = World->GetGameState();
+	return static_cast<float>(GameState ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds());
+}
+
+FVector USuspenseCoreBaseFireAbility::CalculateServerTraceEnd(const FWeaponShotParams& ShotRequest) const
+{
 	// Apply spread
-	FVector TraceDirection = USuspenseCoreTraceUtils::ApplySpreadToDirection(
+	const FVector TraceDirection = USuspenseCoreTraceUtils::ApplySpreadToDirection(
 		ShotRequest.Direction,
 		ShotRequest.SpreadAngle,
 		static_cast<int32>(ShotRequest.Timestamp * 1000.0f)
 	);
 
 	// Calculate end point
-	FVector TraceEnd = USuspenseCoreTraceUtils::CalculateTraceEndPoint(
+	return USuspenseCoreTraceUtils::CalculateTraceEndPoint(
 		ShotRequest.StartLocation,
 		TraceDirection,
 		ShotRequest.Range
 	);
+}
+
+void USuspenseCoreBaseFireAbility::ServerProcessShotTrace(const FWeaponShotParams& ShotRequest, FSuspenseCoreShotResult& OutResult)
+{
+	OutResult.Timestamp = ShotRequest.Timestamp;
+
+	// Actors to ignore
+	TArray<AActor*> IgnoreActors;
+	if (AActor* Avatar = GetAvatarActorFromActorInfo())
+	{
+		IgnoreActors.Add(Avatar);
+	}
 
 	// Perform trace using weapon collision profile with automatic fallback
 	USuspenseCoreTraceUtils::PerformLineTrace(
 		GetAvatarActorFromActorInfo(),
 		ShotRequest.StartLocation,
-		TraceEnd,
+		CalculateServerTraceEnd(ShotRequest),
 		SuspenseCoreCollision::GetWeaponTraceProfile(),
 		IgnoreActors,
 		bDebugTraces,
@@ -511,6 +520,71 @@ void USuspenseCoreBaseFireAbility::ServerProcessShotTrace(const FWeaponShotParam
 	);
 }
 
+void USuspenseCoreBaseFireAbility::ServerSubmitShotTrace(const FWeaponShotParams& ShotRequest, bool bNotifyClient)
+{
+	AActor* Avatar = GetAvatarActorFromActorInfo();
+	USuspenseCoreShotTraceSubsystem* ShotTraces = USuspenseCoreShotTraceSubsystem::Get(Avatar);
+
+	if (!ShotTraces)
+	{
+		// No scheduler in this world (e.g. editor preview): trace inline
+		FSuspenseCoreShotResult Result;
+		ServerProcessShotTrace(ShotRequest, Result);
+		HandleServerShotTraceResult(ShotRequest.BaseDamage, ShotRequest.StartLocation, CalculateServerTraceEnd(ShotRequest), Result, bNotifyClient);
+		return;
+	}
+
+	const FVector TraceStart = ShotRequest.StartLocation;
+	const FVector TraceEnd = CalculateServerTraceEnd(ShotRequest);
+
+	FSuspenseCoreShotTraceRequest Request;
+	Request.Instigator = Avatar;
+	Request.Start = TraceStart;
+	Request.Ends.Add(TraceEnd);
+	Request.TraceProfile = SuspenseCoreCollision::GetWeaponTraceProfile();
+	Request.bDebug = bDebugTraces;
+
+	const float Timestamp = ShotRequest.Timestamp;
+	const float BaseDamage = ShotRequest.BaseDamage;
+
+	ShotTraces->SubmitShot(MoveTemp(Request), FSuspenseCoreShotTraceCompleted::CreateWeakLambda(this,
+		[this, Timestamp, BaseDamage, TraceStart, TraceEnd, bNotifyClient](const TArray<FHitResult>& Hits, bool /*bHadBlockingHit*/)
+		{
+			FSuspenseCoreShotResult Result;
+			Result.Timestamp = Timestamp;
+			Result.HitResults = Hits;
+			HandleServerShotTraceResult(BaseDamage, TraceStart, TraceEnd, Result, bNotifyClient);
+		}));
+}
+
+void USuspenseCoreBaseFireAbility::HandleServerShotTraceResult(float BaseDamage, const FVector& TraceStart, const FVector& TraceEnd,
+	FSuspenseCoreShotResult& Result, bool bNotifyClient)
+{
+	// Ability may have lost its actor info while the trace was in flight
+	AActor* Avatar = GetCurrentActorInfo() ? GetAvatarActorFromActorInfo() : nullptr;
+	if (!Avatar)
+	{
+		return;
+	}
+
+	// Character hits are judged against where targets were when the client fired
+	if (USuspenseCoreLagCompensationSubsystem* LagCompensation = USuspenseCoreLagCompensationSubsystem::Get(Avatar))
+	{
+		LagCompensation->ResolveShot(TraceStart, TraceEnd, Result.Timestamp, Avatar, Result.HitResults);
+	}
+
+	Result.bWasValidated = true;
+
+	// Apply damage
+	ApplyDamageToTargets(Result.HitResults, BaseDamage);
+
+	// Send result to client
+	if (bNotifyClient)
+	{
+		ClientReceiveShotResult(Result);
+	}
+}
+
 void USuspenseCoreBaseFireAbility::ApplyDamageToTargets(const TArray<FHitResult>& HitResults, float BaseDamage)
 {
 	AActor* Instigator = GetAvatarActorFromActorInfo();
@@ -1511,11 +1585,13 @@ void USuspenseCoreBaseFireAbility::PublishAmmoChangedEvent()
 		EventData.SetInt(TEXT("CurrentRounds"), AmmoState.InsertedMagazine.CurrentRoundCount);
 		EventData.SetInt(TEXT("MaxCapacity"), AmmoState.InsertedMagazine.MaxCapacity);
 		EventData.SetBool(TEXT("HasChamberedRound"), AmmoState.ChamberedRound.IsChambered());
-		EventData.SetString(TEXT("LoadedAmmoType"), AmmoState.InsertedMagazine.LoadedAmmoID.ToString());
+		EventData.SetName(TEXT("LoadedAmmoType"), AmmoState.InsertedMagazine.LoadedAmmoID);
+		EventData.SetName(TEXT("AmmoKind"), TEXT("Magazine"));
 
 		// Publish on BridgeSystem tag - AmmoCounterWidget subscribes to both this
-		// and TAG_Equipment_Event_Weapon_AmmoChanged for cross-module compatibility
-		EventBus->Publish(SuspenseCoreTags::Event::Weapon::AmmoChanged, EventData);
+		// and TAG_Equipment_Event_Weapon_AmmoChanged for cross-module compatibility.
+		// Deferred: full-auto fire collapses to one magazine update per frame (LastValueWins per AmmoKind)
+		EventBus->PublishDeferred(SuspenseCoreTags::Event::Weapon::AmmoChanged, EventData);
 	}
 }
 
@@ -1525,6 +1601,6 @@ void USuspenseCoreBaseFireAbility::PublishSpreadChangedEvent(float NewSpread)
 	{
 		FSuspenseCoreEventData EventData = FSuspenseCoreEventData::Create(GetAvatarActorFromActorInfo());
 		EventData.SetFloat(FName("Spread"), NewSpread);
-		EventBus->Publish(SuspenseCoreTags::Event::Weapon::SpreadChanged, EventData);
+		EventBus->PublishDeferred(SuspenseCoreTags::Event::Weapon::SpreadChanged, EventData);
 	}
 }
@@ -335,9 +335,9 @@ void UGA_MedicalEquip::RequestStanceChange(bool bEquipping)
 				MedicalTypeTag :
 				SuspenseCoreTags::Item::Medical;
 
-			EventData.StringPayload.Add(TEXT("WeaponType"), StanceTag.ToString());
-			EventData.BoolPayload.Add(TEXT("IsDrawn"), bEquipping);
-			EventData.BoolPayload.Add(TEXT("IsMedical"), true);
+			EventData.SetString(TEXT("WeaponType"), StanceTag.ToString());
+			EventData.SetBool(TEXT("IsDrawn"), bEquipping);
+			EventData.SetBool(TEXT("IsMedical"), true);
 
 			FGameplayTag EventTag = bEquipping ?
 				SuspenseCoreTags::Event::Weapon::StanceChangeRequested :
@@ -542,10 +542,10 @@ void UGA_MedicalEquip::BroadcastEquipEvent(FGameplayTag EventTag)
 			FSuspenseCoreEventData EventData;
 			EventData.Source = AvatarActor;
 			EventData.Timestamp = FPlatformTime::Seconds();
-			EventData.StringPayload.Add(TEXT("MedicalItemID"), MedicalItemID.ToString());
-			EventData.StringPayload.Add(TEXT("MedicalType"), MedicalTypeTag.ToString());
-			EventData.IntPayload.Add(TEXT("QuickSlotIndex"), SourceQuickSlotIndex);
-			EventData.BoolPayload.Add(TEXT("IsReady"), bMedicalReady);
+			EventData.SetString(TEXT("MedicalItemID"), MedicalItemID.ToString());
+			EventData.SetString(TEXT("MedicalType"), MedicalTypeTag.ToString());
+			EventData.SetInt(TEXT("QuickSlotIndex"), SourceQuickSlotIndex);
+			EventData.SetBool(TEXT("IsReady"), bMedicalReady);
 
 			MEDICAL_LOG(Verbose, TEXT("Publishing event: %s (MedicalItemID=%s, Type=%s, Slot=%d)"),
 				*EventTag.ToString(),
@@ -561,8 +561,8 @@ bool UGA_MedicalUse::ApplyMedicalEffects()
 			FSuspenseCoreEventData EventData;
 			EventData.Source = AvatarActor;
 			EventData.Timestamp = FPlatformTime::Seconds();
-			EventData.StringPayload.Add(TEXT("MedicalItemID"), CurrentMedicalItemID.ToString());
-			EventData.IntPayload.Add(TEXT("QuickSlotIndex"), CurrentSlotIndex);
+			EventData.SetString(TEXT("MedicalItemID"), CurrentMedicalItemID.ToString());
+			EventData.SetInt(TEXT("QuickSlotIndex"), CurrentSlotIndex);
 
 			// This event can be subscribed to by MedicalUseHandler to apply effects
 			EventBus->Publish(SuspenseCoreMedicalTags::Event::TAG_Event_Medical_ApplyEffect, EventData);
@@ -672,11 +672,11 @@ void UGA_MedicalUse::BroadcastMedicalEvent(FGameplayTag EventTag)
 			FSuspenseCoreEventData EventData;
 			EventData.Source = GetAvatarActorFromActorInfo();
 			EventData.Timestamp = FPlatformTime::Seconds();
-			EventData.StringPayload.Add(TEXT("MedicalItemID"), CurrentMedicalItemID.ToString());
-			EventData.StringPayload.Add(TEXT("MedicalType"), CurrentMedicalTypeTag.ToString());
-			EventData.IntPayload.Add(TEXT("QuickSlotIndex"), CurrentSlotIndex);
-			EventData.FloatPayload.Add(TEXT("UseTime"), GetUseTime());
-			EventData.BoolPayload.Add(TEXT("EffectsApplied"), bEffectsApplied);
+			EventData.SetString(TEXT("MedicalItemID"), CurrentMedicalItemID.ToString());
+			EventData.SetString(TEXT("MedicalType"), CurrentMedicalTypeTag.ToString());
+			EventData.SetInt(TEXT("QuickSlotIndex"), CurrentSlotIndex);
+			EventData.SetFloat(TEXT("UseTime"), GetUseTime());
+			EventData.SetBool(TEXT("EffectsApplied"), bEffectsApplied);
 
 			EventBus->Publish(EventTag, EventData);
 
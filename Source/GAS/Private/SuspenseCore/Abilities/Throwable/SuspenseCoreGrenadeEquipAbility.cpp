@@ -344,9 +344,9 @@ void USuspenseCoreGrenadeEquipAbility::RequestStanceChange(bool bEquipping)
 				GrenadeTypeTag :
 				SuspenseCoreTags::Weapon::Grenade::Frag;
 
-			EventData.StringPayload.Add(TEXT("WeaponType"), StanceTag.ToString());
-			EventData.BoolPayload.Add(TEXT("IsDrawn"), bEquipping);
-			EventData.BoolPayload.Add(TEXT("IsGrenade"), true);
+			EventData.SetString(TEXT("WeaponType"), StanceTag.ToString());
+			EventData.SetBool(TEXT("IsDrawn"), bEquipping);
+			EventData.SetBool(TEXT("IsGrenade"), true);
 
 			// Use native event tags
 			FGameplayTag EventTag = bEquipping ?
@@ -571,10 +571,10 @@ void USuspenseCoreGrenadeEquipAbility::BroadcastEquipEvent(FGameplayTag EventTag
 			FSuspenseCoreEventData EventData;
 			EventData.Source = AvatarActor;  // May be null, but that's handled by listeners
 			EventData.Timestamp = FPlatformTime::Seconds();
-			EventData.StringPayload.Add(TEXT("GrenadeID"), GrenadeID.ToString());
-			EventData.StringPayload.Add(TEXT("GrenadeType"), GrenadeTypeTag.ToString());
-			EventData.IntPayload.Add(TEXT("QuickSlotIndex"), SourceQuickSlotIndex);
-			EventData.BoolPayload.Add(TEXT("IsReady"), bGrenadeReady);
+			EventData.SetString(TEXT("GrenadeID"), GrenadeID.ToString());
+			EventData.SetString(TEXT("GrenadeType"), GrenadeTypeTag.ToString());
+			EventData.SetInt(TEXT("QuickSlotIndex"), SourceQuickSlotIndex);
+			EventData.SetBool(TEXT("IsReady"), bGrenadeReady);
 
 			// Debug logging - use Verbose for production, detailed info during development
 			EQUIP_LOG(Verbose, TEXT("Publishing event: %s (GrenadeID=%s, Type=%s, Slot=%d)"),
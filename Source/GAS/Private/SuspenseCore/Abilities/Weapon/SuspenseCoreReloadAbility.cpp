@@ -775,13 +775,15 @@ void USuspenseCoreReloadAbility::ExecuteReloadOnMontageComplete()
         // Get fresh ammo state after reload
         FSuspenseCoreWeaponAmmoState FinalState = ISuspenseCoreMagazineProvider::Execute_GetAmmoState(ProviderObj);
 
-        FSuspenseCoreEventData EventData;
+        // Source is the coalescing key for the deferred AmmoChanged rule
+        FSuspenseCoreEventData EventData = FSuspenseCoreEventData::Create(GetAvatarActorFromActorInfo());
         EventData.SetInt(TEXT("CurrentRounds"), FinalState.InsertedMagazine.CurrentRoundCount);
         EventData.SetBool(TEXT("HasChamberedRound"), FinalState.ChamberedRound.IsChambered());
         EventData.SetInt(TEXT("MagazineCapacity"), FinalState.InsertedMagazine.MaxCapacity);
         EventData.SetBool(TEXT("HasMagazine"), FinalState.bHasMagazine);
+        EventData.SetName(TEXT("AmmoKind"), TEXT("Magazine"));
 
-        EventBus->Publish(SuspenseCoreTags::Event::Weapon::AmmoChanged, EventData);
+        EventBus->PublishDeferred(SuspenseCoreTags::Event::Weapon::AmmoChanged, EventData);
         RELOAD_LOG(Log, TEXT("ExecuteReloadOnMontageComplete: Published AmmoChanged event (Rounds=%d, Chambered=%s)"),
             FinalState.InsertedMagazine.CurrentRoundCount,
             FinalState.ChamberedRound.IsChambered() ? TEXT("YES") : TEXT("NO"));
@@ -1185,7 +1187,7 @@ void USuspenseCoreReloadAbility::BroadcastReloadCompleted()
         FSuspenseCoreEventData SpreadEventData = FSuspenseCoreEventData::Create(GetAvatarActorFromActorInfo());
         SpreadEventData.SetFloat(TEXT("Spread"), 0.0f);
         SpreadEventData.SetBool(TEXT("IsReloadReset"), true);
-        EventBus->Publish(SuspenseCoreTags::Event::Weapon::SpreadChanged, SpreadEventData);
+        EventBus->PublishDeferred(SuspenseCoreTags::Event::Weapon::SpreadChanged, SpreadEventData);
     }
 }
 
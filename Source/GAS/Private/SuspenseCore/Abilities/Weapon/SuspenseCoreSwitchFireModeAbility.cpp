@@ -184,7 +184,7 @@ void USuspenseCoreSwitchFireModeAbility::PublishFireModeChangedEvent(const FGame
 		FSuspenseCoreEventData EventData = FSuspenseCoreEventData::Create(GetAvatarActorFromActorInfo());
 
 		// Store fire mode tag as string and add to tags container
-		EventData.SetString(FName("FireModeTag"), NewFireMode.GetTagName().ToString());
+		EventData.SetGameplayTag(FName("FireModeTag"), NewFireMode);
 		EventData.AddTag(NewFireMode);
 
 		// Get fire mode name for display (last part of tag)
@@ -9,6 +9,42 @@
 #include "SuspenseCore/Types/SuspenseCoreTypes.h"
 #include "AbilitySystemGlobals.h"
 #include "GameFramework/Actor.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarSuspenseCoreCoalesceAttributeEvents(
+	TEXT("suspensecore.gas.coalesce_attribute_events"),
+	1,
+	TEXT("Coalesce attribute change events per ASC per frame.\n")
+	TEXT("0: Publish every attribute change immediately\n")
+	TEXT("1: One event per attribute per frame, published after actor tick (default)"),
+	ECVF_Default
+);
+
+namespace SuspenseCoreASC
+{
+	/** SuspenseCore.Event.GAS.Attribute.<Name>, falling back to ...Attribute.Changed; resolved once per attribute */
+	FGameplayTag GetAttributeEventTag(const FGameplayAttribute& Attribute)
+	{
+		check(IsInGameThread());
+		static TMap<FGameplayAttribute, FGameplayTag> TagCache;
+
+		if (const FGameplayTag* Cached = TagCache.Find(Attribute))
+		{
+			return *Cached;
+		}
+
+		const FString TagString = FString::Printf(TEXT("SuspenseCore.Event.GAS.Attribute.%s"), *Attribute.GetName());
+		FGameplayTag EventTag = FGameplayTag::RequestGameplayTag(FName(*TagString), false);
+		if (!EventTag.IsValid())
+		{
+			EventTag = FGameplayTag::RequestGameplayTag(FName(TEXT("SuspenseCore.Event.GAS.Attribute.Changed")), false);
+		}
+
+		TagCache.Add(Attribute, EventTag);
+		return EventTag;
+	}
+}
 
 USuspenseCoreAbilitySystemComponent::USuspenseCoreAbilitySystemComponent()
 {
@@ -46,6 +82,7 @@ void USuspenseCoreAbilitySystemComponent::BeginPlay()
 
 void USuspenseCoreAbilitySystemComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	FlushAttributeChangeEvents();
 	TeardownEventBusSubscriptions();
 	Super::EndPlay(EndPlayReason);
 }
@@ -56,6 +93,10 @@ void USuspenseCoreAbilitySystemComponent::EndPlay(const EEndPlayReason::Type End
 
 void USuspenseCoreAbilitySystemComponent::SetAttributeEventsEnabled(bool bEnabled)
 {
+	if (!bEnabled)
+	{
+		FlushAttributeChangeEvents();
+	}
 	bPublishAttributeEvents = bEnabled;
 }
 
@@ -69,6 +110,83 @@ void USuspenseCoreAbilitySystemComponent::PublishAttributeChangeEvent(
 		return;
 	}
 
+	UWorld* World = GetWorld();
+	const bool bCoalesce = bCoalesceAttributeEvents
+		&& CVarSuspenseCoreCoalesceAttributeEvents.GetValueOnGameThread() != 0
+		&& World
+		&& !ImmediateAttributeEvents.Contains(Attribute);
+
+	if (!bCoalesce)
+	{
+		BroadcastAttributeEvent(Attribute, OldValue, NewValue, 1);
+		return;
+	}
+
+	// Keep the first OldValue and the last NewValue of the frame
+	FPendingAttributeChange* Pending = PendingAttributeChanges.FindByPredicate(
+		[&Attribute](const FPendingAttributeChange& Change) { return Change.Attribute == Attribute; });
+
+	if (Pending)
+	{
+		Pending->NewValue = NewValue;
+		++Pending->NumChanges;
+		return;
+	}
+
+	FPendingAttributeChange& Change = PendingAttributeChanges.AddDefaulted_GetRef();
+	Change.Attribute = Attribute;
+	Change.OldValue = OldValue;
+	Change.NewValue = NewValue;
+	Change.NumChanges = 1;
+
+	if (!PostActorTickHandle.IsValid())
+	{
+		PostActorTickHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(
+			this, &USuspenseCoreAbilitySystemComponent::OnWorldPostActorTick);
+	}
+}
+
+void USuspenseCoreAbilitySystemComponent::FlushAttributeChangeEvents()
+{
+	if (PostActorTickHandle.IsValid())
+	{
+		FWorldDelegates::OnWorldPostActorTick.Remove(PostActorTickHandle);
+		PostActorTickHandle.Reset();
+	}
+
+	if (PendingAttributeChanges.Num() == 0)
+	{
+		return;
+	}
+
+	// Listeners may change attributes again; those start a new batch
+	TArray<FPendingAttributeChange> Changes = MoveTemp(PendingAttributeChanges);
+	PendingAttributeChanges.Reset();
+
+	for (const FPendingAttributeChange& Change : Changes)
+	{
+		// Damage and heal in one frame: nothing for listeners to refresh
+		if (!FMath::IsNearlyEqual(Change.OldValue, Change.NewValue))
+		{
+			BroadcastAttributeEvent(Change.Attribute, Change.OldValue, Change.NewValue, Change.NumChanges);
+		}
+	}
+}
+
+void USuspenseCoreAbilitySystemComponent::OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World == GetWorld())
+	{
+		FlushAttributeChangeEvents();
+	}
+}
+
+void USuspenseCoreAbilitySystemComponent::BroadcastAttributeEvent(
+	const FGameplayAttribute& Attribute,
+	float OldValue,
+	float NewValue,
+	int32 NumChanges)
+{
 	USuspenseCoreEventBus* EventBus = GetEventBus();
 	if (!EventBus)
 	{
@@ -77,22 +195,16 @@ void USuspenseCoreAbilitySystemComponent::PublishAttributeChangeEvent(
 
 	// Get MaxValue for attributes that have corresponding Max attributes
 	float MaxValue = NewValue;
-	const FString AttributeName = Attribute.GetName();
-
 	if (const USuspenseCoreAttributeSet* AttributeSet = GetSet<USuspenseCoreAttributeSet>())
 	{
-		if (AttributeName == TEXT("Health"))
+		if (Attribute == USuspenseCoreAttributeSet::GetHealthAttribute())
 		{
 			MaxValue = AttributeSet->GetMaxHealth();
 		}
-		else if (AttributeName == TEXT("Stamina"))
+		else if (Attribute == USuspenseCoreAttributeSet::GetStaminaAttribute())
 		{
 			MaxValue = AttributeSet->GetMaxStamina();
 		}
-		else if (AttributeName == TEXT("MaxHealth") || AttributeName == TEXT("MaxStamina"))
-		{
-			MaxValue = NewValue;
-		}
 	}
 
 	// Create event data with UI-compatible keys
@@ -100,21 +212,15 @@ void USuspenseCoreAbilitySystemComponent::PublishAttributeChangeEvent(
 
 	Data.SetFloat(TEXT("Value"), NewValue);
 	Data.SetFloat(TEXT("MaxValue"), MaxValue);
-	Data.SetString(TEXT("AttributeName"), AttributeName);
+	Data.SetString(TEXT("AttributeName"), Attribute.GetName());
 	Data.SetFloat(TEXT("OldValue"), OldValue);
 	Data.SetFloat(TEXT("NewValue"), NewValue);
 	Data.SetFloat(TEXT("Delta"), NewValue - OldValue);
+	Data.SetInt(TEXT("ChangeCount"), NumChanges);
 	Data.SetObject(TEXT("AbilitySystemComponent"), this);
 
-	// Form event tag: SuspenseCore.Event.GAS.Attribute.<AttributeName>
-	FString TagString = FString::Printf(TEXT("SuspenseCore.Event.GAS.Attribute.%s"), *AttributeName);
-	FGameplayTag EventTag = FGameplayTag::RequestGameplayTag(FName(*TagString), false);
-
-	if (!EventTag.IsValid())
-	{
-		EventTag = FGameplayTag::RequestGameplayTag(FName(TEXT("SuspenseCore.Event.GAS.Attribute.Changed")), false);
-	}
-
+	// Event tag: SuspenseCore.Event.GAS.Attribute.<AttributeName>
+	const FGameplayTag EventTag = SuspenseCoreASC::GetAttributeEventTag(Attribute);
 	if (EventTag.IsValid())
 	{
 		EventBus->Publish(EventTag, Data);
@@ -132,6 +238,9 @@ void USuspenseCoreAbilitySystemComponent::PublishCriticalEvent(
 		return;
 	}
 
+	// Listeners see the attribute values that led to this event first
+	FlushAttributeChangeEvents();
+
 	FSuspenseCoreEventData Data = FSuspenseCoreEventData::Create(GetOwner());
 	Data.SetFloat(TEXT("CurrentValue"), CurrentValue);
 	Data.SetFloat(TEXT("MaxValue"), MaxValue);
@@ -5,6 +5,7 @@
 #include "SuspenseCore/Effects/StatusEffects/SuspenseCoreStatusEffects.h"
 #include "SuspenseCore/Attributes/SuspenseCoreAttributeSet.h"
 #include "SuspenseCore/Attributes/SuspenseCoreMovementAttributeSet.h"
+#include "SuspenseCore/Tags/SuspenseCoreGameplayTags.h"
 
 //========================================================================
 // BASE CLASSES
@@ -63,7 +64,7 @@ UGE_Poisoned::UGE_Poisoned()
 	DurationPolicy = EGameplayEffectDurationType::HasDuration;
 
 	FSetByCallerFloat SetByCallerDuration;
-	SetByCallerDuration.DataTag = FGameplayTag::RequestGameplayTag(FName("Data.Effect.Duration"));
+	SetByCallerDuration.DataTag = SuspenseCoreTags::Data::Effect::Duration;
 	DurationMagnitude = FGameplayEffectModifierMagnitude(SetByCallerDuration);
 
 	// Periodic damage: every 2 seconds
@@ -76,7 +77,7 @@ UGE_Poisoned::UGE_Poisoned()
 	DamageModifier.ModifierOp = EGameplayModOp::Additive;
 
 	FSetByCallerFloat SetByCallerDamage;
-	SetByCallerDamage.DataTag = FGameplayTag::RequestGameplayTag(FName("Data.Damage.Poison"));
+	SetByCallerDamage.DataTag = SuspenseCoreTags::Data::DamagePoison;
 	DamageModifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(SetByCallerDamage);
 	Modifiers.Add(DamageModifier);
 
@@ -99,15 +100,15 @@ UGE_Poisoned::UGE_Poisoned()
 
 	// Granted tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Health.Poisoned")));
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Health::Poisoned);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	// Asset tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Damage")));
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Damage.Poison")));
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.DoT")));
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Debuff")));
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::Damage);
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::DamagePoison);
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::DoT::Root);
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::Debuff);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	UE_LOG(LogTemp, Log, TEXT("UGE_Poisoned: Configured - 30s duration, 2s tick, -10%% speed"));
@@ -124,7 +125,7 @@ UGE_Stunned::UGE_Stunned()
 	DurationPolicy = EGameplayEffectDurationType::HasDuration;
 
 	FSetByCallerFloat SetByCallerDuration;
-	SetByCallerDuration.DataTag = FGameplayTag::RequestGameplayTag(FName("Data.Effect.Duration"));
+	SetByCallerDuration.DataTag = SuspenseCoreTags::Data::Effect::Duration;
 	DurationMagnitude = FGameplayEffectModifierMagnitude(SetByCallerDuration);
 
 	// No periodic effects
@@ -148,15 +149,15 @@ UGE_Stunned::UGE_Stunned()
 
 	// Granted tags (used by abilities to block actions)
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Combat.Stunned")));
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Movement.Disabled")));
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Action.Disabled")));
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Combat::Stunned);
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Movement::Disabled);
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Action::Disabled);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	// Asset tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Debuff")));
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Debuff.Stun")));
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::Debuff);
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::DebuffStun);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	UE_LOG(LogTemp, Log, TEXT("UGE_Stunned: Configured - SetByCaller duration, movement disabled"));
@@ -189,13 +190,13 @@ UGE_Suppressed::UGE_Suppressed()
 
 	// Granted tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Combat.Suppressed")));
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Combat::Suppressed);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	// Asset tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Debuff")));
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Debuff.Suppression")));
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::Debuff);
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::DebuffSuppression);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	UE_LOG(LogTemp, Log, TEXT("UGE_Suppressed: Configured - 3s duration, aim penalty"));
@@ -229,21 +230,21 @@ UGE_Fracture_Leg::UGE_Fracture_Leg()
 
 	// Granted tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Health.Fracture")));
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Health.Fracture.Leg")));
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Movement.Limp")));
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Movement.NoSprint")));
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Health::Fracture);
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Health::FractureLeg);
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Movement::Limp);
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Movement::NoSprint);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	// Asset tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Debuff")));
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Debuff.Fracture")));
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::Debuff);
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::DebuffFracture);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	// Removal tags (surgery can remove)
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	RemoveGameplayEffectsWithTags.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Health.Fracture.Leg")));
+	RemoveGameplayEffectsWithTags.AddTag(SuspenseCoreTags::State::Health::FractureLeg);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	UE_LOG(LogTemp, Log, TEXT("UGE_Fracture_Leg: Configured - Infinite, -40%% speed, limp"));
@@ -267,20 +268,20 @@ UGE_Fracture_Arm::UGE_Fracture_Arm()
 
 	// Granted tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Health.Fracture")));
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Health.Fracture.Arm")));
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Combat.NoADS")));
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Health::Fracture);
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Health::FractureArm);
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Combat::NoADS);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	// Asset tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Debuff")));
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Debuff.Fracture")));
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::Debuff);
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::DebuffFracture);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	// Removal tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	RemoveGameplayEffectsWithTags.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Health.Fracture.Arm")));
+	RemoveGameplayEffectsWithTags.AddTag(SuspenseCoreTags::State::Health::FractureArm);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	UE_LOG(LogTemp, Log, TEXT("UGE_Fracture_Arm: Configured - Infinite, no ADS"));
@@ -318,19 +319,19 @@ UGE_Dehydrated::UGE_Dehydrated()
 
 	// Granted tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Health.Dehydrated")));
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Health::Dehydrated);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	// Asset tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Debuff")));
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Debuff.Survival")));
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.DoT")));
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::Debuff);
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::DebuffSurvival);
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::DoT::Root);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	// Removal tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	RemoveGameplayEffectsWithTags.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Health.Dehydrated")));
+	RemoveGameplayEffectsWithTags.AddTag(SuspenseCoreTags::State::Health::Dehydrated);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	UE_LOG(LogTemp, Log, TEXT("UGE_Dehydrated: Configured - Infinite, 1 HP/5s"));
@@ -364,19 +365,19 @@ UGE_Exhausted::UGE_Exhausted()
 
 	// Granted tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Health.Exhausted")));
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Movement.NoSprint")));
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Health::Exhausted);
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Movement::NoSprint);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	// Asset tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Debuff")));
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Debuff.Survival")));
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::Debuff);
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::DebuffSurvival);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	// Removal tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	RemoveGameplayEffectsWithTags.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Health.Exhausted")));
+	RemoveGameplayEffectsWithTags.AddTag(SuspenseCoreTags::State::Health::Exhausted);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	UE_LOG(LogTemp, Log, TEXT("UGE_Exhausted: Configured - Infinite, no stamina regen"));
@@ -393,7 +394,7 @@ UGE_Regenerating::UGE_Regenerating()
 	DurationPolicy = EGameplayEffectDurationType::HasDuration;
 
 	FSetByCallerFloat SetByCallerDuration;
-	SetByCallerDuration.DataTag = FGameplayTag::RequestGameplayTag(FName("Data.Effect.Duration"));
+	SetByCallerDuration.DataTag = SuspenseCoreTags::Data::Effect::Duration;
 	DurationMagnitude = FGameplayEffectModifierMagnitude(SetByCallerDuration);
 
 	// Periodic healing: every 1 second
@@ -406,7 +407,7 @@ UGE_Regenerating::UGE_Regenerating()
 	HealModifier.ModifierOp = EGameplayModOp::Additive;
 
 	FSetByCallerFloat SetByCallerHeal;
-	SetByCallerHeal.DataTag = FGameplayTag::RequestGameplayTag(FName("Data.Heal.PerTick"));
+	SetByCallerHeal.DataTag = SuspenseCoreTags::Data::Heal::PerTick;
 	HealModifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(SetByCallerHeal);
 	Modifiers.Add(HealModifier);
 
@@ -419,14 +420,14 @@ UGE_Regenerating::UGE_Regenerating()
 
 	// Granted tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Health.Regenerating")));
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Health::Regenerating);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	// Asset tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Buff")));
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Buff.Heal")));
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.HoT")));
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::Buff);
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::BuffHeal);
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::HoT);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	UE_LOG(LogTemp, Log, TEXT("UGE_Regenerating: Configured - SetByCaller duration, HoT"));
@@ -443,7 +444,7 @@ UGE_Painkiller::UGE_Painkiller()
 	DurationPolicy = EGameplayEffectDurationType::HasDuration;
 
 	FSetByCallerFloat SetByCallerDuration;
-	SetByCallerDuration.DataTag = FGameplayTag::RequestGameplayTag(FName("Data.Effect.Duration"));
+	SetByCallerDuration.DataTag = SuspenseCoreTags::Data::Effect::Duration;
 	DurationMagnitude = FGameplayEffectModifierMagnitude(SetByCallerDuration);
 
 	// No attribute modifiers - just tags that suppress pain effects
@@ -457,14 +458,14 @@ UGE_Painkiller::UGE_Painkiller()
 
 	// Granted tags - these block pain-related debuff tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Combat.Painkiller")));
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Combat.PainImmune")));
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Combat::Painkiller);
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Combat::PainImmune);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	// Asset tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Buff")));
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Buff.Painkiller")));
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::Buff);
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::BuffPainkiller);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	UE_LOG(LogTemp, Log, TEXT("UGE_Painkiller: Configured - SetByCaller duration, pain immunity"));
@@ -481,7 +482,7 @@ UGE_Adrenaline::UGE_Adrenaline()
 	DurationPolicy = EGameplayEffectDurationType::HasDuration;
 
 	FSetByCallerFloat SetByCallerDuration;
-	SetByCallerDuration.DataTag = FGameplayTag::RequestGameplayTag(FName("Data.Effect.Duration"));
+	SetByCallerDuration.DataTag = SuspenseCoreTags::Data::Effect::Duration;
 	DurationMagnitude = FGameplayEffectModifierMagnitude(SetByCallerDuration);
 
 	// Movement speed: +15%
@@ -513,13 +514,13 @@ UGE_Adrenaline::UGE_Adrenaline()
 
 	// Granted tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Combat.Adrenaline")));
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Combat::Adrenaline);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	// Asset tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Buff")));
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Buff.Combat")));
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::Buff);
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::BuffCombat);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	UE_LOG(LogTemp, Log, TEXT("UGE_Adrenaline: Configured - +15%% speed, +25%% stamina regen"));
@@ -536,7 +537,7 @@ UGE_Fortified::UGE_Fortified()
 	DurationPolicy = EGameplayEffectDurationType::HasDuration;
 
 	FSetByCallerFloat SetByCallerDuration;
-	SetByCallerDuration.DataTag = FGameplayTag::RequestGameplayTag(FName("Data.Effect.Duration"));
+	SetByCallerDuration.DataTag = SuspenseCoreTags::Data::Effect::Duration;
 	DurationMagnitude = FGameplayEffectModifierMagnitude(SetByCallerDuration);
 
 	// Damage resistance: +15% (implemented via DamageReduction attribute if exists)
@@ -551,14 +552,14 @@ UGE_Fortified::UGE_Fortified()
 
 	// Granted tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Combat.Fortified")));
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Combat.DamageResist")));
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Combat::Fortified);
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Combat::DamageResist);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	// Asset tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Buff")));
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Buff.Defense")));
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::Buff);
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::BuffDefense);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	UE_LOG(LogTemp, Log, TEXT("UGE_Fortified: Configured - +15%% damage resistance"));
@@ -575,7 +576,7 @@ UGE_Haste::UGE_Haste()
 	DurationPolicy = EGameplayEffectDurationType::HasDuration;
 
 	FSetByCallerFloat SetByCallerDuration;
-	SetByCallerDuration.DataTag = FGameplayTag::RequestGameplayTag(FName("Data.Effect.Duration"));
+	SetByCallerDuration.DataTag = SuspenseCoreTags::Data::Effect::Duration;
 	DurationMagnitude = FGameplayEffectModifierMagnitude(SetByCallerDuration);
 
 	// Movement speed: +20%
@@ -597,13 +598,13 @@ UGE_Haste::UGE_Haste()
 
 	// Granted tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableOwnedTagsContainer.AddTag(FGameplayTag::RequestGameplayTag(FName("State.Movement.Haste")));
+	InheritableOwnedTagsContainer.AddTag(SuspenseCoreTags::State::Movement::Haste);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	// Asset tags
 	PRAGMA_DISABLE_DEPRECATION_WARNINGS
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Buff")));
-	InheritableGameplayEffectTags.AddTag(FGameplayTag::RequestGameplayTag(FName("Effect.Buff.Movement")));
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::Buff);
+	InheritableGameplayEffectTags.AddTag(SuspenseCoreTags::Effect::BuffMovement);
 	PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
 	UE_LOG(LogTemp, Log, TEXT("UGE_Haste: Configured - +20%% movement speed"));
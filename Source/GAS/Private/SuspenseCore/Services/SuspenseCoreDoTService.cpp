@@ -12,7 +12,7 @@
 #include "ActiveGameplayEffectHandle.h"
 #include "Engine/World.h"
 #include "Engine/GameInstance.h"
-#include "TimerManager.h"
+#include "HAL/IConsoleManager.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogDoTService, Log, All);
 
@@ -80,13 +80,13 @@ FSuspenseCoreEventData FSuspenseCoreDoTEventPayload::ToEventData() const
 	{
 		Data.Tags.AddTag(DoTType);
 	}
-	Data.StringPayload.Add(TEXT("DoTType"), DoTType.ToString());
-	Data.FloatPayload.Add(TEXT("DamagePerTick"), DoTData.DamagePerTick);
-	Data.FloatPayload.Add(TEXT("TickInterval"), DoTData.TickInterval);
-	Data.FloatPayload.Add(TEXT("RemainingDuration"), DoTData.RemainingDuration);
-	Data.FloatPayload.Add(TEXT("Duration"), DoTData.RemainingDuration);
-	Data.FloatPayload.Add(TEXT("DamageDealt"), DamageDealt);
-	Data.IntPayload.Add(TEXT("StackCount"), DoTData.StackCount);
+	Data.SetGameplayTag(TEXT("DoTType"), DoTType);
+	Data.SetFloat(TEXT("DamagePerTick"), DoTData.DamagePerTick);
+	Data.SetFloat(TEXT("TickInterval"), DoTData.TickInterval);
+	Data.SetFloat(TEXT("RemainingDuration"), DoTData.RemainingDuration);
+	Data.SetFloat(TEXT("Duration"), DoTData.RemainingDuration);
+	Data.SetFloat(TEXT("DamageDealt"), DamageDealt);
+	Data.SetInt(TEXT("StackCount"), DoTData.StackCount);
 
 	return Data;
 }
@@ -96,28 +96,28 @@ FSuspenseCoreDoTEventPayload FSuspenseCoreDoTEventPayload::FromEventData(const F
 	FSuspenseCoreDoTEventPayload Payload;
 	Payload.AffectedActor = Cast<AActor>(EventData.Source.Get());
 
-	if (const FString* TypeStr = EventData.StringPayload.Find(TEXT("DoTType")))
+	if (const FGameplayTag* Type = EventData.FindGameplayTag(TEXT("DoTType")))
 	{
-		Payload.DoTType = FGameplayTag::RequestGameplayTag(FName(**TypeStr));
+		Payload.DoTType = *Type;
 	}
 
-	if (const float* Val = EventData.FloatPayload.Find(TEXT("DamagePerTick")))
+	if (const float* Val = EventData.FindFloat(TEXT("DamagePerTick")))
 	{
 		Payload.DoTData.DamagePerTick = *Val;
 	}
-	if (const float* Val = EventData.FloatPayload.Find(TEXT("TickInterval")))
+	if (const float* Val = EventData.FindFloat(TEXT("TickInterval")))
 	{
 		Payload.DoTData.TickInterval = *Val;
 	}
-	if (const float* Val = EventData.FloatPayload.Find(TEXT("RemainingDuration")))
+	if (const float* Val = EventData.FindFloat(TEXT("RemainingDuration")))
 	{
 		Payload.DoTData.RemainingDuration = *Val;
 	}
-	if (const float* Val = EventData.FloatPayload.Find(TEXT("DamageDealt")))
+	if (const float* Val = EventData.FindFloat(TEXT("DamageDealt")))
 	{
 		Payload.DamageDealt = *Val;
 	}
-	if (const int32* Val = EventData.IntPayload.Find(TEXT("StackCount")))
+	if (const int32* Val = EventData.FindInt(TEXT("StackCount")))
 	{
 		Payload.DoTData.StackCount = *Val;
 	}
@@ -140,28 +140,17 @@ void USuspenseCoreDoTService::Initialize(FSubsystemCollectionBase& Collection)
 
 	InitializeEventBus();
 
-	// Start duration update timer for legacy cache
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().SetTimer(
-			DurationUpdateTimerHandle,
-			this,
-			&USuspenseCoreDoTService::OnDurationUpdateTimer,
-			0.1f,  // 10 Hz update
-			true
-		);
-	}
+	// One table sweep per frame (the GameInstance has no world yet at this point, so no world timer)
+	SweepTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &USuspenseCoreDoTService::TickDoTs));
 
 	UE_LOG(LogDoTService, Log, TEXT("DoT Service initialized (ASC-driven mode)"));
 }
 
 void USuspenseCoreDoTService::Deinitialize()
 {
-	// Clear timer
-	if (UWorld* World = GetWorld())
-	{
-		World->GetTimerManager().ClearTimer(DurationUpdateTimerHandle);
-	}
+	FTSTicker::GetCoreTicker().RemoveTicker(SweepTickerHandle);
+	SweepTickerHandle.Reset();
 
 	// Unbind from all ASCs
 	for (const FSuspenseCoreASCBinding& Binding : BoundASCs)
@@ -175,8 +164,13 @@ void USuspenseCoreDoTService::Deinitialize()
 	}
 	BoundASCs.Empty();
 
-	// Clear legacy cache
-	ManualDoTCache.Empty();
+	// Clear DoT table
+	DoTTable.Reset();
+	TargetSlots.Empty();
+	ASCSlots.Empty();
+	TrackedTargets.Empty();
+	BleedingMask = 0;
+	BurningMask = 0;
 
 	Super::Deinitialize();
 }
@@ -207,52 +201,52 @@ USuspenseCoreDoTService* USuspenseCoreDoTService::Get(const UObject* WorldContex
 	return GI->GetSubsystem<USuspenseCoreDoTService>();
 }
 
+
 //==================================================================
 // IISuspenseCoreDoTService Implementation - Query API
 //==================================================================
 
+namespace SuspenseCoreDoT
+{
+	/**
+	 * ASC effects always count; a manual entry is hidden when an ASC effect
+	 * of the same type exists (manual notifications mirror GE applications)
+	 */
+	FORCEINLINE bool IsEntryVisible(const FSuspenseCoreDoTTable& Table, int32 EntryIndex, FSuspenseCoreDoTTable::FTypeMask AscMask)
+	{
+		return Table.IsFromASC(EntryIndex)
+			|| (AscMask & (FSuspenseCoreDoTTable::FTypeMask(1) << Table.GetType(EntryIndex))) == 0;
+	}
+}
+
 TArray<FSuspenseCoreActiveDoT> USuspenseCoreDoTService::GetActiveDoTs(AActor* Target) const
 {
 	TArray<FSuspenseCoreActiveDoT> Result;
 
-	if (!Target)
+	FScopeLock Lock(&ServiceLock);
+	const int32 Slot = GetQuerySlot(Target);
+	if (Slot == INDEX_NONE)
 	{
 		return Result;
 	}
 
-	// PRIMARY: Query from ASC directly (source of truth)
-	UAbilitySystemComponent* ASC = GetASCFromActor(Target);
-	if (ASC)
-	{
-		// Get all active effects with DoT tags
-		FGameplayEffectQuery Query;
-		TArray<FActiveGameplayEffectHandle> ActiveHandles = ASC->GetActiveEffects(Query);
+	const TConstArrayView<int32> Entries = DoTTable.GetTargetEntries(Slot);
+	const FSuspenseCoreDoTTable::FTypeMask AscMask = DoTTable.GetTargetAscMask(Slot);
+	Result.Reserve(Entries.Num());
 
-		for (const FActiveGameplayEffectHandle& Handle : ActiveHandles)
+	// ASC effects first, then manual entries not covered by one
+	for (const int32 EntryIndex : Entries)
+	{
+		if (DoTTable.IsFromASC(EntryIndex))
 		{
-			const FActiveGameplayEffect* ActiveEffect = ASC->GetActiveGameplayEffect(Handle);
-			if (ActiveEffect && IsDoTEffect(*ActiveEffect))
-			{
-				Result.Add(BuildDoTDataFromEffect(*ActiveEffect, Target));
-			}
+			Result.Add(BuildDoTDataFromEntry(EntryIndex));
 		}
 	}
-
-	// FALLBACK: Check legacy manual cache
-	FScopeLock Lock(&ServiceLock);
-	if (const TArray<FSuspenseCoreActiveDoT>* ManualDoTs = ManualDoTCache.Find(Target))
+	for (const int32 EntryIndex : Entries)
 	{
-		for (const FSuspenseCoreActiveDoT& DoT : *ManualDoTs)
+		if (!DoTTable.IsFromASC(EntryIndex) && SuspenseCoreDoT::IsEntryVisible(DoTTable, EntryIndex, AscMask))
 		{
-			// Avoid duplicates (if ASC already has this)
-			bool bAlreadyInResult = Result.ContainsByPredicate([&](const FSuspenseCoreActiveDoT& Existing) {
-				return Existing.DoTType == DoT.DoTType;
-			});
-
-			if (!bAlreadyInResult)
-			{
-				Result.Add(DoT);
-			}
+			Result.Add(BuildDoTDataFromEntry(EntryIndex));
 		}
 	}
 
@@ -261,40 +255,37 @@ TArray<FSuspenseCoreActiveDoT> USuspenseCoreDoTService::GetActiveDoTs(AActor* Ta
 
 bool USuspenseCoreDoTService::HasActiveBleeding(AActor* Target) const
 {
-	TArray<FSuspenseCoreActiveDoT> DoTs = GetActiveDoTs(Target);
-	for (const FSuspenseCoreActiveDoT& DoT : DoTs)
-	{
-		if (DoT.IsBleeding())
-		{
-			return true;
-		}
-	}
-	return false;
+	FScopeLock Lock(&ServiceLock);
+	const int32 Slot = GetQuerySlot(Target);
+	return Slot != INDEX_NONE && (DoTTable.GetTargetMask(Slot) & BleedingMask) != 0;
 }
 
 bool USuspenseCoreDoTService::HasActiveBurning(AActor* Target) const
 {
-	TArray<FSuspenseCoreActiveDoT> DoTs = GetActiveDoTs(Target);
-	for (const FSuspenseCoreActiveDoT& DoT : DoTs)
-	{
-		if (DoT.IsBurning())
-		{
-			return true;
-		}
-	}
-	return false;
+	FScopeLock Lock(&ServiceLock);
+	const int32 Slot = GetQuerySlot(Target);
+	return Slot != INDEX_NONE && (DoTTable.GetTargetMask(Slot) & BurningMask) != 0;
 }
 
 float USuspenseCoreDoTService::GetBleedDamagePerSecond(AActor* Target) const
 {
 	float TotalDPS = 0.0f;
-	TArray<FSuspenseCoreActiveDoT> DoTs = GetActiveDoTs(Target);
 
-	for (const FSuspenseCoreActiveDoT& DoT : DoTs)
+	FScopeLock Lock(&ServiceLock);
+	const int32 Slot = GetQuerySlot(Target);
+	if (Slot == INDEX_NONE || (DoTTable.GetTargetMask(Slot) & BleedingMask) == 0)
+	{
+		return TotalDPS;
+	}
+
+	const FSuspenseCoreDoTTable::FTypeMask AscMask = DoTTable.GetTargetAscMask(Slot);
+	for (const int32 EntryIndex : DoTTable.GetTargetEntries(Slot))
 	{
-		if (DoT.IsBleeding() && DoT.TickInterval > 0.0f)
+		const bool bBleeding = (BleedingMask & (FSuspenseCoreDoTTable::FTypeMask(1) << DoTTable.GetType(EntryIndex))) != 0;
+		const float TickInterval = DoTTable.GetTickInterval(EntryIndex);
+		if (bBleeding && TickInterval > 0.0f && SuspenseCoreDoT::IsEntryVisible(DoTTable, EntryIndex, AscMask))
 		{
-			TotalDPS += (DoT.DamagePerTick / DoT.TickInterval) * DoT.StackCount;
+			TotalDPS += (DoTTable.GetDamagePerTick(EntryIndex) / TickInterval) * DoTTable.GetStacks(EntryIndex);
 		}
 	}
 
@@ -304,15 +295,24 @@ float USuspenseCoreDoTService::GetBleedDamagePerSecond(AActor* Target) const
 float USuspenseCoreDoTService::GetBurnTimeRemaining(AActor* Target) const
 {
 	float MinRemaining = -1.0f;
-	TArray<FSuspenseCoreActiveDoT> DoTs = GetActiveDoTs(Target);
 
-	for (const FSuspenseCoreActiveDoT& DoT : DoTs)
+	FScopeLock Lock(&ServiceLock);
+	const int32 Slot = GetQuerySlot(Target);
+	if (Slot == INDEX_NONE || (DoTTable.GetTargetMask(Slot) & BurningMask) == 0)
 	{
-		if (DoT.IsBurning() && !DoT.IsInfinite())
+		return MinRemaining;
+	}
+
+	const FSuspenseCoreDoTTable::FTypeMask AscMask = DoTTable.GetTargetAscMask(Slot);
+	for (const int32 EntryIndex : DoTTable.GetTargetEntries(Slot))
+	{
+		const bool bBurning = (BurningMask & (FSuspenseCoreDoTTable::FTypeMask(1) << DoTTable.GetType(EntryIndex))) != 0;
+		const float Remaining = DoTTable.GetRemainingDuration(EntryIndex);
+		if (bBurning && Remaining >= 0.0f && SuspenseCoreDoT::IsEntryVisible(DoTTable, EntryIndex, AscMask))
 		{
-			if (MinRemaining < 0.0f || DoT.RemainingDuration < MinRemaining)
+			if (MinRemaining < 0.0f || Remaining < MinRemaining)
 			{
-				MinRemaining = DoT.RemainingDuration;
+				MinRemaining = Remaining;
 			}
 		}
 	}
@@ -322,20 +322,26 @@ float USuspenseCoreDoTService::GetBurnTimeRemaining(AActor* Target) const
 
 int32 USuspenseCoreDoTService::GetActiveDoTCount(AActor* Target) const
 {
-	return GetActiveDoTs(Target).Num();
+	FScopeLock Lock(&ServiceLock);
+	const int32 Slot = GetQuerySlot(Target);
+	if (Slot == INDEX_NONE)
+	{
+		return 0;
+	}
+
+	// Every ASC effect + one per manual type without an ASC effect (same as GetActiveDoTs().Num())
+	const FSuspenseCoreDoTTable::FTypeMask AscMask = DoTTable.GetTargetAscMask(Slot);
+	const FSuspenseCoreDoTTable::FTypeMask ManualOnly = DoTTable.GetTargetManualMask(Slot) & ~AscMask;
+	const int32 NumManual = FMath::CountBits(static_cast<uint64>(DoTTable.GetTargetManualMask(Slot)));
+	const int32 NumASC = DoTTable.GetTargetEntries(Slot).Num() - NumManual;
+	return NumASC + FMath::CountBits(static_cast<uint64>(ManualOnly));
 }
 
 bool USuspenseCoreDoTService::HasActiveDoTOfType(AActor* Target, FGameplayTag DoTType) const
 {
-	TArray<FSuspenseCoreActiveDoT> DoTs = GetActiveDoTs(Target);
-	for (const FSuspenseCoreActiveDoT& DoT : DoTs)
-	{
-		if (DoT.DoTType.MatchesTag(DoTType))
-		{
-			return true;
-		}
-	}
-	return false;
+	FScopeLock Lock(&ServiceLock);
+	const int32 Slot = GetQuerySlot(Target);
+	return Slot != INDEX_NONE && (DoTTable.GetTargetMask(Slot) & DoTTable.GetTypesMatching(DoTType)) != 0;
 }
 
 //==================================================================
@@ -357,37 +363,42 @@ void USuspenseCoreDoTService::NotifyDoTApplied(
 
 	FScopeLock Lock(&ServiceLock);
 
-	// Add to legacy cache (for non-ASC systems)
-	TArray<FSuspenseCoreActiveDoT>& DoTs = ManualDoTCache.FindOrAdd(Target);
+	const int32 Slot = TrackTarget(Target);
+	const int32 TypeIndex = RegisterDoTType(DoTType);
+	if (Slot == INDEX_NONE || TypeIndex == INDEX_NONE)
+	{
+		return;
+	}
 
-	// Check if already exists
-	FSuspenseCoreActiveDoT* Existing = DoTs.FindByPredicate([&](const FSuspenseCoreActiveDoT& D) {
-		return D.DoTType == DoTType;
-	});
+	const UWorld* World = GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+
+	// Manual entries: one per type, re-application refreshes and stacks
+	const int32 Existing = DoTTable.FindManualEntry(Slot, TypeIndex);
 
-	FSuspenseCoreActiveDoT DoTData;
-	DoTData.DoTType = DoTType;
-	DoTData.DamagePerTick = DamagePerTick;
-	DoTData.TickInterval = TickInterval;
-	DoTData.RemainingDuration = Duration;
-	DoTData.StackCount = Existing ? Existing->StackCount + 1 : 1;
-	DoTData.ApplicationTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
-	DoTData.SourceActor = Source;
+	FSuspenseCoreDoTTable::FEntryInit Init;
+	Init.DamagePerTick = DamagePerTick;
+	Init.TickInterval = TickInterval;
+	Init.RemainingDuration = Duration;
+	Init.Stacks = Existing != INDEX_NONE ? DoTTable.GetStacks(Existing) + 1 : 1;
+	Init.ApplicationTime = static_cast<float>(Now);
+	Init.Source = Source;
 
-	if (Existing)
+	int32 EntryIndex = Existing;
+	if (Existing != INDEX_NONE)
 	{
-		*Existing = DoTData;
+		DoTTable.ResetEntry(Existing, Now, Init);
 	}
 	else
 	{
-		DoTs.Add(DoTData);
+		EntryIndex = DoTTable.AddEntry(Slot, TypeIndex, Now, Init);
 	}
 
 	// Publish event (async for performance)
 	FSuspenseCoreDoTEventPayload Payload;
 	Payload.AffectedActor = Target;
 	Payload.DoTType = DoTType;
-	Payload.DoTData = DoTData;
+	Payload.DoTData = BuildDoTDataFromEntry(EntryIndex);
 
 	PublishDoTEvent(SuspenseCoreTags::Event::DoT::Applied, Payload);
 
@@ -408,33 +419,39 @@ void USuspenseCoreDoTService::NotifyDoTRemoved(
 
 	FScopeLock Lock(&ServiceLock);
 
-	// Remove from legacy cache
-	if (TArray<FSuspenseCoreActiveDoT>* DoTs = ManualDoTCache.Find(Target))
+	// Only targets that were ever tracked can have entries
+	const int32* Slot = TargetSlots.Find(Target);
+	if (!Slot)
 	{
-		int32 RemovedIndex = DoTs->IndexOfByPredicate([&](const FSuspenseCoreActiveDoT& D) {
-			return D.DoTType == DoTType;
-		});
+		return;
+	}
 
-		FSuspenseCoreDoTEventPayload Payload;
-		Payload.AffectedActor = Target;
-		Payload.DoTType = DoTType;
+	FSuspenseCoreDoTEventPayload Payload;
+	Payload.AffectedActor = Target;
+	Payload.DoTType = DoTType;
 
-		if (RemovedIndex != INDEX_NONE)
-		{
-			Payload.DoTData = (*DoTs)[RemovedIndex];
-			DoTs->RemoveAt(RemovedIndex);
-		}
+	const int32 EntryIndex = DoTTable.FindManualEntry(*Slot, DoTTable.FindType(DoTType));
+	if (EntryIndex != INDEX_NONE)
+	{
+		Payload.DoTData = BuildDoTDataFromEntry(EntryIndex);
+		DoTTable.RemoveEntry(EntryIndex);
+	}
 
-		// Publish event
-		FGameplayTag EventTag = bExpired
-			? SuspenseCoreTags::Event::DoT::Expired
-			: SuspenseCoreTags::Event::DoT::Removed;
+	// Cures by tag (RemoveActiveEffectsWithGrantedTags) do not reach OnAnyGameplayEffectRemovedDelegate,
+	// and Sweep never expires mirrored entries: re-check them against the live ASC.
+	// All mirrored types, not just DoTType: mirrored entries are typed from asset tags, so a cure
+	// by State.Health.Bleeding.* may have removed an effect tracked under Effect.DoT
+	DropInactiveASCEntries(*Slot, DoTTable.GetTargetAscMask(*Slot));
 
-		PublishDoTEvent(EventTag, Payload);
+	// Publish event
+	FGameplayTag EventTag = bExpired
+		? SuspenseCoreTags::Event::DoT::Expired
+		: SuspenseCoreTags::Event::DoT::Removed;
 
-		UE_LOG(LogDoTService, Verbose, TEXT("DoT removed (manual): %s from %s (expired=%d)"),
-			*DoTType.ToString(), *Target->GetName(), bExpired);
-	}
+	PublishDoTEvent(EventTag, Payload);
+
+	UE_LOG(LogDoTService, Verbose, TEXT("DoT removed (notify): %s from %s (expired=%d)"),
+		*DoTType.ToString(), *Target->GetName(), bExpired);
 }
 
 //==================================================================
@@ -450,18 +467,59 @@ void USuspenseCoreDoTService::BindToASC(UAbilitySystemComponent* ASC)
 
 	FScopeLock Lock(&ServiceLock);
 
+	AddASCBinding(ASC, true);
+	TrackTarget(ASC->GetOwner(), ASC);
+}
+
+void USuspenseCoreDoTService::UnbindFromASC(UAbilitySystemComponent* ASC)
+{
+	if (!ASC)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&ServiceLock);
+
+	for (int32 i = BoundASCs.Num() - 1; i >= 0; --i)
+	{
+		FSuspenseCoreASCBinding& Binding = BoundASCs[i];
+		if (Binding.ASC == ASC)
+		{
+			// Remove delegates
+			ASC->OnActiveGameplayEffectAddedDelegateToSelf.Remove(Binding.OnEffectAddedHandle);
+			ASC->OnAnyGameplayEffectRemovedDelegate().Remove(Binding.OnEffectRemovedHandle);
+
+			BoundASCs.RemoveAt(i);
+
+			// Mirrored entries would go stale without the delegates; the next query re-tracks silently
+			if (const int32* Slot = ASCSlots.Find(ASC))
+			{
+				ReleaseTarget(*Slot);
+			}
+
+			UE_LOG(LogDoTService, Log, TEXT("Unbound from ASC: %s"),
+				ASC->GetOwner() ? *ASC->GetOwner()->GetName() : TEXT("Unknown"));
+			return;
+		}
+	}
+}
+
+void USuspenseCoreDoTService::AddASCBinding(UAbilitySystemComponent* ASC, bool bPublishEvents)
+{
 	// Check if already bound
-	for (const FSuspenseCoreASCBinding& Binding : BoundASCs)
+	for (FSuspenseCoreASCBinding& Binding : BoundASCs)
 	{
 		if (Binding.ASC == ASC)
 		{
-			return;  // Already bound
+			Binding.bPublishEvents |= bPublishEvents;
+			return;
 		}
 	}
 
 	// Create new binding
 	FSuspenseCoreASCBinding NewBinding;
 	NewBinding.ASC = ASC;
+	NewBinding.bPublishEvents = bPublishEvents;
 
 	// Subscribe to effect added delegate
 	NewBinding.OnEffectAddedHandle = ASC->OnActiveGameplayEffectAddedDelegateToSelf.AddUObject(
@@ -480,35 +538,17 @@ void USuspenseCoreDoTService::BindToASC(UAbilitySystemComponent* ASC)
 
 	BoundASCs.Add(NewBinding);
 
-	UE_LOG(LogDoTService, Log, TEXT("Bound to ASC: %s"),
-		ASC->GetOwner() ? *ASC->GetOwner()->GetName() : TEXT("Unknown"));
+	UE_LOG(LogDoTService, Log, TEXT("Bound to ASC: %s%s"),
+		ASC->GetOwner() ? *ASC->GetOwner()->GetName() : TEXT("Unknown"),
+		bPublishEvents ? TEXT("") : TEXT(" (table only)"));
 }
 
-void USuspenseCoreDoTService::UnbindFromASC(UAbilitySystemComponent* ASC)
+const FSuspenseCoreASCBinding* USuspenseCoreDoTService::FindASCBinding(const UAbilitySystemComponent* ASC) const
 {
-	if (!ASC)
-	{
-		return;
-	}
-
-	FScopeLock Lock(&ServiceLock);
-
-	for (int32 i = BoundASCs.Num() - 1; i >= 0; --i)
+	return BoundASCs.FindByPredicate([ASC](const FSuspenseCoreASCBinding& Binding)
 	{
-		FSuspenseCoreASCBinding& Binding = BoundASCs[i];
-		if (Binding.ASC == ASC)
-		{
-			// Remove delegates
-			ASC->OnActiveGameplayEffectAddedDelegateToSelf.Remove(Binding.OnEffectAddedHandle);
-			ASC->OnAnyGameplayEffectRemovedDelegate().Remove(Binding.OnEffectRemovedHandle);
-
-			BoundASCs.RemoveAt(i);
-
-			UE_LOG(LogDoTService, Log, TEXT("Unbound from ASC: %s"),
-				ASC->GetOwner() ? *ASC->GetOwner()->GetName() : TEXT("Unknown"));
-			return;
-		}
-	}
+		return Binding.ASC == ASC;
+	});
 }
 
 //==================================================================
@@ -535,6 +575,19 @@ void USuspenseCoreDoTService::OnActiveGameplayEffectAdded(
 		return;
 	}
 
+	FScopeLock Lock(&ServiceLock);
+
+	if (const int32* Slot = ASCSlots.Find(ASC))
+	{
+		AddASCEntry(*Slot, *ActiveEffect);
+	}
+
+	const FSuspenseCoreASCBinding* Binding = FindASCBinding(ASC);
+	if (!Binding || !Binding->bPublishEvents)
+	{
+		return;
+	}
+
 	FSuspenseCoreActiveDoT DoTData = BuildDoTDataFromEffect(*ActiveEffect, TargetActor);
 
 	// Publish event (async for performance)
@@ -575,12 +628,25 @@ void USuspenseCoreDoTService::OnActiveGameplayEffectRemovedWithASC(
 		return;
 	}
 
+	FScopeLock Lock(&ServiceLock);
+
+	if (const int32* Slot = ASCSlots.Find(SourceASC))
+	{
+		DoTTable.RemoveEntry(DoTTable.FindEntryByHandle(*Slot, Effect.Handle));
+	}
+
+	const FSuspenseCoreASCBinding* Binding = FindASCBinding(SourceASC);
+	if (!Binding || !Binding->bPublishEvents)
+	{
+		return;
+	}
+
 	// Get target actor from the ASC that triggered the removal
 	AActor* TargetActor = SourceASC ? SourceASC->GetOwner() : nullptr;
 
 	FGameplayTag DoTType = GetDoTTypeFromEffect(Effect);
 
-	UE_LOG(LogDoTService, Warning, TEXT("DoT removed (ASC): Type=%s, Target=%s"),
+	UE_LOG(LogDoTService, Verbose, TEXT("DoT removed (ASC): Type=%s, Target=%s"),
 		*DoTType.ToString(),
 		TargetActor ? *TargetActor->GetName() : TEXT("NULL"));
 
@@ -610,8 +676,32 @@ void USuspenseCoreDoTService::OnGameplayEffectStackChanged(
 	int32 NewStackCount,
 	int32 OldStackCount)
 {
-	// Could publish stack change event if needed
 	UE_LOG(LogDoTService, Verbose, TEXT("DoT stack changed: %d -> %d"), OldStackCount, NewStackCount);
+
+	UAbilitySystemComponent* ASC = Handle.GetOwningAbilitySystemComponent();
+	if (!ASC)
+	{
+		return;
+	}
+
+	FScopeLock Lock(&ServiceLock);
+
+	const int32* Slot = ASCSlots.Find(ASC);
+	const int32 EntryIndex = Slot ? DoTTable.FindEntryByHandle(*Slot, Handle) : INDEX_NONE;
+	if (EntryIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	DoTTable.SetStacks(EntryIndex, NewStackCount);
+
+	// Stacking policies may refresh the duration
+	const FActiveGameplayEffect* ActiveEffect = ASC->GetActiveGameplayEffect(Handle);
+	if (ActiveEffect && DoTTable.GetRemainingDuration(EntryIndex) >= 0.0f)
+	{
+		const float WorldTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+		DoTTable.SetRemainingDuration(EntryIndex, FMath::Max(ActiveEffect->GetTimeRemaining(WorldTime), 0.0f));
+	}
 }
 
 //==================================================================
@@ -737,7 +827,7 @@ FSuspenseCoreActiveDoT USuspenseCoreDoTService::BuildDoTDataFromEffect(
 
 void USuspenseCoreDoTService::PublishDoTEvent(FGameplayTag EventTag, const FSuspenseCoreDoTEventPayload& Payload)
 {
-	UE_LOG(LogDoTService, Warning, TEXT("=== PublishDoTEvent === Tag: %s, Actor: %s, DoTType: %s"),
+	UE_LOG(LogDoTService, Verbose, TEXT("=== PublishDoTEvent === Tag: %s, Actor: %s, DoTType: %s"),
 		*EventTag.ToString(),
 		Payload.AffectedActor.IsValid() ? *Payload.AffectedActor->GetName() : TEXT("NULL"),
 		*Payload.DoTType.ToString());
@@ -749,8 +839,17 @@ void USuspenseCoreDoTService::PublishDoTEvent(FGameplayTag EventTag, const FSusp
 
 	if (EventBus.IsValid())
 	{
-		UE_LOG(LogDoTService, Warning, TEXT("  Publishing via EventBus..."));
-		EventBus->PublishAsync(EventTag, Payload.ToEventData());
+		UE_LOG(LogDoTService, Verbose, TEXT("  Publishing via EventBus..."));
+		if (EventTag == SuspenseCoreTags::Event::DoT::Tick)
+		{
+			// Ticks go through the deferred queue: one event per target and DoT type
+			// per frame, DamageDealt summed (Accumulate rule in the event manager)
+			EventBus->PublishDeferred(EventTag, Payload.ToEventData());
+		}
+		else
+		{
+			EventBus->PublishAsync(EventTag, Payload.ToEventData());
+		}
 	}
 	else
 	{
@@ -781,68 +880,498 @@ void USuspenseCoreDoTService::InitializeEventBus()
 	}
 }
 
+
 //==================================================================
-// Legacy Support
+// DoT Table
 //==================================================================
 
-void USuspenseCoreDoTService::OnDurationUpdateTimer()
+int32 USuspenseCoreDoTService::TrackTarget(AActor* Target, UAbilitySystemComponent* KnownASC)
 {
-	FScopeLock Lock(&ServiceLock);
+	if (!Target)
+	{
+		return INDEX_NONE;
+	}
 
-	UWorld* World = GetWorld();
-	if (!World)
+	if (const int32* Existing = TargetSlots.Find(Target))
 	{
-		return;
+		return *Existing;
 	}
 
-	const float DeltaTime = 0.1f;  // Timer interval
+	UAbilitySystemComponent* ASC = KnownASC ? KnownASC : GetASCFromActor(Target);
 
-	// Update durations in legacy cache
-	for (auto& Pair : ManualDoTCache)
+	// Avatar and owner (e.g. Character / PlayerState) resolve to one ASC: share its slot
+	if (ASC)
 	{
-		TArray<FSuspenseCoreActiveDoT>& DoTs = Pair.Value;
-
-		for (int32 i = DoTs.Num() - 1; i >= 0; --i)
+		if (const int32* ASCSlot = ASCSlots.Find(ASC))
 		{
-			FSuspenseCoreActiveDoT& DoT = DoTs[i];
+			TargetSlots.Add(Target, *ASCSlot);
+			return *ASCSlot;
+		}
+	}
+
+	const int32 Slot = DoTTable.AddTarget();
+	if (Slot >= TrackedTargets.Num())
+	{
+		TrackedTargets.SetNum(Slot + 1);
+	}
+
+	FTrackedTarget& Tracked = TrackedTargets[Slot];
+	Tracked = FTrackedTarget();
+	Tracked.Actor = Target;
+	TargetSlots.Add(Target, Slot);
+
+	if (ASC)
+	{
+		Tracked.MirroredASC = ASC;
+		Tracked.bMirrorsASC = true;
+		ASCSlots.Add(ASC, Slot);
+		AddASCBinding(ASC, false);
 
-			// Skip infinite duration effects
-			if (DoT.IsInfinite())
+		// Import effects applied before the target was tracked
+		const TArray<FActiveGameplayEffectHandle> ActiveHandles = ASC->GetActiveEffects(FGameplayEffectQuery());
+		for (const FActiveGameplayEffectHandle& Handle : ActiveHandles)
+		{
+			if (const FActiveGameplayEffect* ActiveEffect = ASC->GetActiveGameplayEffect(Handle))
 			{
-				continue;
+				AddASCEntry(Slot, *ActiveEffect);
 			}
+		}
+	}
+
+	return Slot;
+}
+
+int32 USuspenseCoreDoTService::GetQuerySlot(AActor* Target) const
+{
+	return const_cast<USuspenseCoreDoTService*>(this)->TrackTarget(Target);
+}
+
+void USuspenseCoreDoTService::ReleaseTarget(int32 TargetSlot)
+{
+	if (!DoTTable.IsValidTarget(TargetSlot))
+	{
+		return;
+	}
+
+	FTrackedTarget& Tracked = TrackedTargets[TargetSlot];
+
+	// Drop the silent binding we created; explicit BindToASC bindings belong to their caller
+	if (UAbilitySystemComponent* ASC = Tracked.MirroredASC.Get())
+	{
+		const int32 BindingIndex = BoundASCs.IndexOfByPredicate([ASC](const FSuspenseCoreASCBinding& Binding)
+		{
+			return Binding.ASC == ASC;
+		});
+		if (BindingIndex != INDEX_NONE && !BoundASCs[BindingIndex].bPublishEvents)
+		{
+			ASC->OnActiveGameplayEffectAddedDelegateToSelf.Remove(BoundASCs[BindingIndex].OnEffectAddedHandle);
+			ASC->OnAnyGameplayEffectRemovedDelegate().Remove(BoundASCs[BindingIndex].OnEffectRemovedHandle);
+			BoundASCs.RemoveAtSwap(BindingIndex);
+		}
+	}
+
+	for (auto It = TargetSlots.CreateIterator(); It; ++It)
+	{
+		if (It.Value() == TargetSlot)
+		{
+			It.RemoveCurrent();
+		}
+	}
+	for (auto It = ASCSlots.CreateIterator(); It; ++It)
+	{
+		if (It.Value() == TargetSlot)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	DoTTable.RemoveTarget(TargetSlot);
+	Tracked = FTrackedTarget();
+}
+
+int32 USuspenseCoreDoTService::RegisterDoTType(const FGameplayTag& DoTType)
+{
+	const int32 NumTypesBefore = DoTTable.NumTypes();
+	const int32 TypeIndex = DoTTable.FindOrAddType(DoTType);
+
+	if (TypeIndex == INDEX_NONE)
+	{
+		UE_LOG(LogDoTService, Warning, TEXT("DoT type not tracked: %s (invalid tag or more than %d types)"),
+			*DoTType.ToString(), FSuspenseCoreDoTTable::MaxTypes);
+	}
+	else if (DoTTable.NumTypes() != NumTypesBefore)
+	{
+		// Same hierarchy checks as FSuspenseCoreActiveDoT::IsBleeding / IsBurning, done once per type
+		BleedingMask = DoTTable.GetTypesMatching(BleedingRootTag);
+		BurningMask = DoTTable.GetTypesMatching(BurningRootTag)
+			| DoTTable.GetTypesMatching(SuspenseCoreTags::Effect::DoT::Burn);
+	}
+
+	return TypeIndex;
+}
+
+void USuspenseCoreDoTService::AddASCEntry(int32 TargetSlot, const FActiveGameplayEffect& Effect)
+{
+	if (!IsDoTEffect(Effect) || DoTTable.FindEntryByHandle(TargetSlot, Effect.Handle) != INDEX_NONE)
+	{
+		return;
+	}
+
+	const FSuspenseCoreActiveDoT Data = BuildDoTDataFromEffect(Effect, TrackedTargets[TargetSlot].Actor.Get());
+	const int32 TypeIndex = RegisterDoTType(Data.DoTType);
+	if (TypeIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	FSuspenseCoreDoTTable::FEntryInit Init;
+	Init.DamagePerTick = Data.DamagePerTick;
+	Init.TickInterval = Data.TickInterval;
+	Init.RemainingDuration = Data.RemainingDuration;
+	Init.Stacks = Data.StackCount;
+	Init.ApplicationTime = Data.ApplicationTime;
+	Init.Source = Data.SourceActor;
+	Init.EffectHandle = Effect.Handle;
+	Init.bFromASC = true;
+
+	const UWorld* World = GetWorld();
+	DoTTable.AddEntry(TargetSlot, TypeIndex, World ? World->GetTimeSeconds() : 0.0, Init);
+
+	// Stack count lives in the table; keep it in sync without re-reading the ASC on query
+	if (UAbilitySystemComponent* ASC = TrackedTargets[TargetSlot].MirroredASC.Get())
+	{
+		if (FOnActiveGameplayEffectStackChange* StackDelegate = ASC->OnGameplayEffectStackChangeDelegate(Effect.Handle))
+		{
+			StackDelegate->RemoveAll(this);
+			StackDelegate->AddUObject(this, &USuspenseCoreDoTService::OnGameplayEffectStackChanged);
+		}
+	}
+}
+
+int32 USuspenseCoreDoTService::DropInactiveASCEntries(int32 TargetSlot, FSuspenseCoreDoTTable::FTypeMask Types)
+{
+	if ((DoTTable.GetTargetAscMask(TargetSlot) & Types) == 0)
+	{
+		return 0;
+	}
+
+	const UAbilitySystemComponent* ASC = TrackedTargets[TargetSlot].MirroredASC.Get();
+
+	TArray<int32, TInlineAllocator<8>> Stale;
+	for (const int32 EntryIndex : DoTTable.GetTargetEntries(TargetSlot))
+	{
+		if (!DoTTable.IsFromASC(EntryIndex) || (Types & (FSuspenseCoreDoTTable::FTypeMask(1) << DoTTable.GetType(EntryIndex))) == 0)
+		{
+			continue;
+		}
 
-			// Reduce remaining duration
-			DoT.RemainingDuration -= DeltaTime;
+		const FActiveGameplayEffect* Effect = ASC ? ASC->GetActiveGameplayEffect(DoTTable.GetEffectHandle(EntryIndex)) : nullptr;
+		if (!Effect || Effect->IsPendingRemove)
+		{
+			Stale.Add(EntryIndex);
+		}
+	}
 
-			// Check if expired
-			if (DoT.RemainingDuration <= 0.0f)
+	// Highest index first: swap-remove only moves entries that are not in the list
+	Stale.Sort(TGreater<int32>());
+	for (const int32 EntryIndex : Stale)
+	{
+		DoTTable.RemoveEntry(EntryIndex);
+	}
+	return Stale.Num();
+}
+
+FSuspenseCoreActiveDoT USuspenseCoreDoTService::BuildDoTDataFromEntry(int32 EntryIndex) const
+{
+	FSuspenseCoreActiveDoT Data;
+	Data.DoTType = DoTTable.GetTypeTag(DoTTable.GetType(EntryIndex));
+	Data.DamagePerTick = DoTTable.GetDamagePerTick(EntryIndex);
+	Data.TickInterval = DoTTable.GetTickInterval(EntryIndex);
+	Data.RemainingDuration = DoTTable.GetRemainingDuration(EntryIndex);
+	Data.StackCount = DoTTable.GetStacks(EntryIndex);
+	Data.ApplicationTime = DoTTable.GetApplicationTime(EntryIndex);
+	Data.SourceActor = DoTTable.GetSource(EntryIndex);
+	Data.EffectHandle = DoTTable.GetEffectHandle(EntryIndex);
+	return Data;
+}
+
+bool USuspenseCoreDoTService::TickDoTs(float DeltaTime)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_SuspenseCoreDoTService_Tick);
+
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return true;
+	}
+
+	// World time: pauses with the game, restarts with a new map
+	const double Now = World->GetTimeSeconds();
+	if (Now < LastSweepTime)
+	{
+		LastSweepTime = -1.0;
+		NextCleanupTime = 0.0;
+	}
+	const float WorldDelta = LastSweepTime >= 0.0 ? static_cast<float>(Now - LastSweepTime) : 0.0f;
+	LastSweepTime = Now;
+
+	// Subscribers may call back into the service (e.g. NotifyDoTRemoved swap-removes rows),
+	// so events are only collected under the lock and published after it is released
+	SweepEvents.Reset();
+	{
+		FScopeLock Lock(&ServiceLock);
+
+		if (DoTTable.Num() > 0 && WorldDelta > 0.0f)
+		{
+			DoTTable.Sweep(Now, WorldDelta, SweepResult);
+
+			for (const int32 EntryIndex : SweepResult.Ticked)
 			{
-				// Publish expiry event
-				FSuspenseCoreDoTEventPayload Payload;
-				Payload.AffectedActor = Pair.Key.Get();
-				Payload.DoTType = DoT.DoTType;
-				Payload.DoTData = DoT;
+				FSuspenseCoreDoTEventPayload& Payload = SweepEvents.Emplace_GetRef(SuspenseCoreTags::Event::DoT::Tick, FSuspenseCoreDoTEventPayload()).Value;
+				Payload.AffectedActor = TrackedTargets[DoTTable.GetTarget(EntryIndex)].Actor;
+				Payload.DoTType = DoTTable.GetTypeTag(DoTTable.GetType(EntryIndex));
+				Payload.DoTData = BuildDoTDataFromEntry(EntryIndex);
+				Payload.DamageDealt = Payload.DoTData.DamagePerTick * Payload.DoTData.StackCount;
+			}
 
-				PublishDoTEvent(SuspenseCoreTags::Event::DoT::Expired, Payload);
+			// Descending indices: each swap-remove only moves entries already handled
+			for (const int32 EntryIndex : SweepResult.Expired)
+			{
+				FSuspenseCoreDoTEventPayload& Payload = SweepEvents.Emplace_GetRef(SuspenseCoreTags::Event::DoT::Expired, FSuspenseCoreDoTEventPayload()).Value;
+				Payload.AffectedActor = TrackedTargets[DoTTable.GetTarget(EntryIndex)].Actor;
+				Payload.DoTType = DoTTable.GetTypeTag(DoTTable.GetType(EntryIndex));
+				Payload.DoTData = BuildDoTDataFromEntry(EntryIndex);
 
-				DoTs.RemoveAt(i);
+				DoTTable.RemoveEntry(EntryIndex);
 			}
 		}
+
+		if (Now >= NextCleanupTime)
+		{
+			NextCleanupTime = Now + 1.0;
+			CleanupStaleEntries();
+		}
 	}
 
-	// Cleanup stale entries
-	CleanupStaleEntries();
+	for (const TPair<FGameplayTag, FSuspenseCoreDoTEventPayload>& Event : SweepEvents)
+	{
+		PublishDoTEvent(Event.Key, Event.Value);
+	}
+	SweepEvents.Reset();
+
+	return true;
 }
 
 void USuspenseCoreDoTService::CleanupStaleEntries()
 {
-	// Remove entries for destroyed actors
-	for (auto It = ManualDoTCache.CreateIterator(); It; ++It)
+	// Release targets whose actor (and mirrored ASC) was destroyed
+	for (int32 Slot = 0; Slot < TrackedTargets.Num(); ++Slot)
+	{
+		if (!DoTTable.IsValidTarget(Slot))
+		{
+			continue;
+		}
+
+		const FTrackedTarget& Tracked = TrackedTargets[Slot];
+		const bool bASCGone = Tracked.bMirrorsASC && !Tracked.MirroredASC.IsValid();
+		const bool bActorGone = !Tracked.bMirrorsASC && !Tracked.Actor.IsValid();
+		if (bASCGone || bActorGone)
+		{
+			ReleaseTarget(Slot);
+		}
+	}
+
+	// Aliases of destroyed actors (e.g. a dead avatar sharing its PlayerState's slot)
+	for (auto It = TargetSlots.CreateIterator(); It; ++It)
 	{
-		if (!It->Key.IsValid())
+		if (!It.Key().ResolveObjectPtr())
 		{
 			It.RemoveCurrent();
 		}
 	}
+
+	BoundASCs.RemoveAllSwap([](const FSuspenseCoreASCBinding& Binding)
+	{
+		return !Binding.ASC.IsValid();
+	});
 }
+
+//==================================================================
+// Benchmark
+//==================================================================
+
+FString USuspenseCoreDoTService::RunBenchmark(int32 NumTargets, int32 DoTsPerTarget, int32 NumFrames)
+{
+	NumTargets = FMath::Clamp(NumTargets, 1, 100000);
+	DoTsPerTarget = FMath::Clamp(DoTsPerTarget, 1, FSuspenseCoreDoTTable::MaxTypes);
+	NumFrames = FMath::Clamp(NumFrames, 1, 100000);
+
+	const FGameplayTag Types[] = {
+		SuspenseCoreTags::State::Health::BleedingLight,
+		SuspenseCoreTags::State::Health::BleedingHeavy,
+		SuspenseCoreTags::Effect::DoT::Burn,
+		SuspenseCoreTags::State::Health::Regenerating,
+		SuspenseCoreTags::State::Health::Painkiller
+	};
+	const FGameplayTag BleedingRoot = FGameplayTag::RequestGameplayTag(FName("State.Health.Bleeding"), false);
+	const FGameplayTag BurningRoot = FGameplayTag::RequestGameplayTag(FName("State.Burning"), false);
+
+	constexpr float FrameDelta = 1.0f / 60.0f;
+
+	// Long enough that nothing expires: steady-state cost
+	const float Duration = NumFrames * FrameDelta * 2.0f + 10.0f;
+
+	const int32 NumTypes = UE_ARRAY_COUNT(Types);
+
+	FRandomStream Random(0xD07);
+	auto MakeInit = [&Random, Duration]()
+	{
+		FSuspenseCoreDoTTable::FEntryInit Init;
+		Init.DamagePerTick = Random.FRandRange(1.0f, 5.0f);
+		Init.TickInterval = Random.FRandRange(0.5f, 1.0f);
+		Init.RemainingDuration = Duration;
+		return Init;
+	};
+
+	// ─────────────────────────────────────────────────────────────────
+	// Table
+	// ─────────────────────────────────────────────────────────────────
+	FSuspenseCoreDoTTable Table;
+	for (const FGameplayTag& Type : Types)
+	{
+		Table.FindOrAddType(Type);
+	}
+	const FSuspenseCoreDoTTable::FTypeMask TableBleeding = Table.GetTypesMatching(BleedingRoot);
+	const FSuspenseCoreDoTTable::FTypeMask TableBurning = Table.GetTypesMatching(BurningRoot)
+		| Table.GetTypesMatching(SuspenseCoreTags::Effect::DoT::Burn);
+
+	TArray<int32> Slots;
+	for (int32 Target = 0; Target < NumTargets; ++Target)
+	{
+		const int32 Slot = Slots.Add_GetRef(Table.AddTarget());
+		for (int32 DoT = 0; DoT < DoTsPerTarget; ++DoT)
+		{
+			Table.AddEntry(Slot, DoT % NumTypes, 0.0, MakeInit());
+		}
+	}
+
+	FSuspenseCoreDoTTable::FSweepResult Result;
+	int64 TableTicks = 0;
+	double Start = FPlatformTime::Seconds();
+	for (int32 Frame = 1; Frame <= NumFrames; ++Frame)
+	{
+		Table.Sweep(Frame * FrameDelta, FrameDelta, Result);
+		TableTicks += Result.Ticked.Num();
+	}
+	const double TableSweepMs = (FPlatformTime::Seconds() - Start) * 1e3;
+
+	int64 TableHits = 0;
+	Start = FPlatformTime::Seconds();
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		for (const int32 Slot : Slots)
+		{
+			const FSuspenseCoreDoTTable::FTypeMask Mask = Table.GetTargetMask(Slot);
+			TableHits += (Mask & TableBleeding) != 0;
+			TableHits += (Mask & TableBurning) != 0;
+		}
+	}
+	const double TableQueryMs = (FPlatformTime::Seconds() - Start) * 1e3;
+
+	// ─────────────────────────────────────────────────────────────────
+	// Previous layout: map of arrays, query = copy + tag scan
+	// ─────────────────────────────────────────────────────────────────
+	TMap<int32, TArray<FSuspenseCoreActiveDoT>> Legacy;
+	for (int32 Target = 0; Target < NumTargets; ++Target)
+	{
+		TArray<FSuspenseCoreActiveDoT>& DoTs = Legacy.Add(Target);
+		for (int32 DoT = 0; DoT < DoTsPerTarget; ++DoT)
+		{
+			const FSuspenseCoreDoTTable::FEntryInit Init = MakeInit();
+			FSuspenseCoreActiveDoT& Data = DoTs.AddDefaulted_GetRef();
+			Data.DoTType = Types[DoT % NumTypes];
+			Data.DamagePerTick = Init.DamagePerTick;
+			Data.TickInterval = Init.TickInterval;
+			Data.RemainingDuration = Init.RemainingDuration;
+		}
+	}
+
+	int64 LegacyExpired = 0;
+	Start = FPlatformTime::Seconds();
+	for (int32 Frame = 1; Frame <= NumFrames; ++Frame)
+	{
+		for (auto& Pair : Legacy)
+		{
+			TArray<FSuspenseCoreActiveDoT>& DoTs = Pair.Value;
+			for (int32 i = DoTs.Num() - 1; i >= 0; --i)
+			{
+				if (!DoTs[i].IsInfinite())
+				{
+					DoTs[i].RemainingDuration -= FrameDelta;
+					if (DoTs[i].RemainingDuration <= 0.0f)
+					{
+						DoTs.RemoveAt(i);
+						++LegacyExpired;
+					}
+				}
+			}
+		}
+	}
+	const double LegacySweepMs = (FPlatformTime::Seconds() - Start) * 1e3;
+
+	int64 LegacyHits = 0;
+	Start = FPlatformTime::Seconds();
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		for (int32 Target = 0; Target < NumTargets; ++Target)
+		{
+			// HasActiveBleeding and HasActiveBurning each rebuilt the array
+			for (int32 Query = 0; Query < 2; ++Query)
+			{
+				const TArray<FSuspenseCoreActiveDoT> DoTs = Legacy.FindChecked(Target);
+				for (const FSuspenseCoreActiveDoT& DoT : DoTs)
+				{
+					if (Query == 0 ? DoT.IsBleeding() : DoT.IsBurning())
+					{
+						++LegacyHits;
+						break;
+					}
+				}
+			}
+		}
+	}
+	const double LegacyQueryMs = (FPlatformTime::Seconds() - Start) * 1e3;
+
+	const int32 NumEntries = Table.Num();
+	const int32 NumQueries = NumTargets * 2;
+	return FString::Printf(
+		TEXT("DoT benchmark: %d targets x %d DoTs (%d entries), %d frames\n")
+		TEXT("  Sweep  table: %.3f us/frame (%.2f ns/entry, %lld ticks) | map of arrays: %.3f us/frame (%lld expired)\n")
+		TEXT("  Query  table: %.3f us/frame (%.2f ns/query) | rebuild + tag scan: %.3f us/frame (%.2f ns/query)\n")
+		TEXT("  Speedup sweep x%.1f, query x%.1f | table %llu bytes | hits %lld/%lld"),
+		NumTargets, DoTsPerTarget, NumEntries, NumFrames,
+		TableSweepMs * 1e3 / NumFrames, TableSweepMs * 1e6 / (double(NumFrames) * NumEntries), TableTicks,
+		LegacySweepMs * 1e3 / NumFrames, LegacyExpired,
+		TableQueryMs * 1e3 / NumFrames, TableQueryMs * 1e6 / (double(NumFrames) * NumQueries),
+		LegacyQueryMs * 1e3 / NumFrames, LegacyQueryMs * 1e6 / (double(NumFrames) * NumQueries),
+		LegacySweepMs / FMath::Max(TableSweepMs, 1e-6), LegacyQueryMs / FMath::Max(TableQueryMs, 1e-6),
+		static_cast<uint64>(Table.GetAllocatedSize()), TableHits, LegacyHits);
+}
+
+#if !UE_BUILD_SHIPPING
+static void HandleDoTBenchCommand(const TArray<FString>& Args)
+{
+	const int32 NumTargets = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 200;
+	const int32 DoTsPerTarget = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 5;
+	const int32 NumFrames = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 600;
+
+	const FString Report = USuspenseCoreDoTService::RunBenchmark(NumTargets, DoTsPerTarget, NumFrames);
+	UE_LOG(LogDoTService, Log, TEXT("%s"), *Report);
+}
+
+static FAutoConsoleCommand GSuspenseCoreDoTBenchCommand(
+	TEXT("SuspenseCore.DoT.Bench"),
+	TEXT("Benchmark DoT table sweep/queries vs the map-of-arrays path. Args: [Targets=200] [DoTsPerTarget=5] [Frames=600]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&HandleDoTBenchCommand)
+);
+#endif
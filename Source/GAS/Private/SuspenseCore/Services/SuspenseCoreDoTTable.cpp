@@ -0,0 +1,328 @@
+// SuspenseCoreDoTTable.cpp
+// Dense structure-of-arrays storage for active DoT effects
+// Copyright Suspense Team. All Rights Reserved.
+
+#include "SuspenseCore/Services/SuspenseCoreDoTTable.h"
+#include "Algo/Reverse.h"
+
+//==================================================================
+// Types
+//==================================================================
+
+int32 FSuspenseCoreDoTTable::FindOrAddType(const FGameplayTag& Tag)
+{
+	if (!Tag.IsValid())
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Existing = FindType(Tag);
+	if (Existing != INDEX_NONE)
+	{
+		return Existing;
+	}
+
+	if (TypeTags.Num() >= MaxTypes)
+	{
+		return INDEX_NONE;
+	}
+
+	return TypeTags.Add(Tag);
+}
+
+int32 FSuspenseCoreDoTTable::FindType(const FGameplayTag& Tag) const
+{
+	return TypeTags.IndexOfByKey(Tag);
+}
+
+FSuspenseCoreDoTTable::FTypeMask FSuspenseCoreDoTTable::GetTypesMatching(const FGameplayTag& Tag) const
+{
+	FTypeMask Mask = 0;
+	if (!Tag.IsValid())
+	{
+		return Mask;
+	}
+
+	for (int32 TypeIndex = 0; TypeIndex < TypeTags.Num(); ++TypeIndex)
+	{
+		if (TypeTags[TypeIndex].MatchesTag(Tag))
+		{
+			Mask |= FTypeMask(1) << TypeIndex;
+		}
+	}
+	return Mask;
+}
+
+//==================================================================
+// Targets
+//==================================================================
+
+int32 FSuspenseCoreDoTTable::AddTarget()
+{
+	int32 Slot;
+	if (FreeTargets.Num() > 0)
+	{
+		Slot = FreeTargets.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		Slot = Targets.AddDefaulted();
+	}
+
+	Targets[Slot].bInUse = true;
+	return Slot;
+}
+
+void FSuspenseCoreDoTTable::RemoveTarget(int32 TargetSlot)
+{
+	if (!IsValidTarget(TargetSlot))
+	{
+		return;
+	}
+
+	// RemoveEntry unlinks from Entries, so this drains the list
+	while (Targets[TargetSlot].Entries.Num() > 0)
+	{
+		RemoveEntry(Targets[TargetSlot].Entries.Last());
+	}
+
+	Targets[TargetSlot] = FTargetState();
+	FreeTargets.Add(TargetSlot);
+}
+
+//==================================================================
+// Entries
+//==================================================================
+
+int32 FSuspenseCoreDoTTable::AddEntry(int32 TargetSlot, int32 TypeIndex, double Now, const FEntryInit& Init)
+{
+	check(IsValidTarget(TargetSlot));
+	check(TypeTags.IsValidIndex(TypeIndex));
+
+	const int32 EntryIndex = EntryTarget.Add(TargetSlot);
+	EntryType.Add(static_cast<uint8>(TypeIndex));
+	NextTickTime.Add(0.0);
+	RemainingDuration.Add(0.0f);
+	Stacks.Add(0);
+	DamagePerTick.Add(0.0f);
+	TickInterval.Add(0.0f);
+	ApplicationTime.Add(0.0f);
+	Source.AddDefaulted();
+	EffectHandle.AddDefaulted();
+	bFromASC.Add(Init.bFromASC ? 1 : 0);
+
+	ResetEntry(EntryIndex, Now, Init);
+	LinkEntry(TargetSlot, EntryIndex, TypeIndex, Init.bFromASC);
+	return EntryIndex;
+}
+
+void FSuspenseCoreDoTTable::ResetEntry(int32 EntryIndex, double Now, const FEntryInit& Init)
+{
+	NextTickTime[EntryIndex] = Now + FMath::Max(Init.TickInterval, 0.0f);
+	RemainingDuration[EntryIndex] = Init.RemainingDuration;
+	Stacks[EntryIndex] = Init.Stacks;
+	DamagePerTick[EntryIndex] = Init.DamagePerTick;
+	TickInterval[EntryIndex] = Init.TickInterval;
+	ApplicationTime[EntryIndex] = Init.ApplicationTime;
+	Source[EntryIndex] = Init.Source;
+	EffectHandle[EntryIndex] = Init.EffectHandle;
+}
+
+void FSuspenseCoreDoTTable::RemoveEntry(int32 EntryIndex)
+{
+	if (!EntryTarget.IsValidIndex(EntryIndex))
+	{
+		return;
+	}
+
+	UnlinkEntry(EntryIndex);
+
+	const int32 Last = EntryTarget.Num() - 1;
+	if (EntryIndex != Last)
+	{
+		// Re-point the moved entry in its target's list
+		for (int32& Linked : Targets[EntryTarget[Last]].Entries)
+		{
+			if (Linked == Last)
+			{
+				Linked = EntryIndex;
+				break;
+			}
+		}
+	}
+
+	EntryTarget.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	EntryType.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	NextTickTime.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	RemainingDuration.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	Stacks.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	DamagePerTick.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	TickInterval.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	ApplicationTime.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	Source.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	EffectHandle.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+	bFromASC.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+}
+
+int32 FSuspenseCoreDoTTable::FindManualEntry(int32 TargetSlot, int32 TypeIndex) const
+{
+	if (!IsValidTarget(TargetSlot) || TypeIndex == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	if ((Targets[TargetSlot].ManualMask & (FTypeMask(1) << TypeIndex)) == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	for (const int32 EntryIndex : Targets[TargetSlot].Entries)
+	{
+		if (EntryType[EntryIndex] == TypeIndex && !bFromASC[EntryIndex])
+		{
+			return EntryIndex;
+		}
+	}
+	return INDEX_NONE;
+}
+
+int32 FSuspenseCoreDoTTable::FindEntryByHandle(int32 TargetSlot, FActiveGameplayEffectHandle Handle) const
+{
+	if (!IsValidTarget(TargetSlot) || !Handle.IsValid())
+	{
+		return INDEX_NONE;
+	}
+
+	for (const int32 EntryIndex : Targets[TargetSlot].Entries)
+	{
+		if (bFromASC[EntryIndex] && EffectHandle[EntryIndex] == Handle)
+		{
+			return EntryIndex;
+		}
+	}
+	return INDEX_NONE;
+}
+
+void FSuspenseCoreDoTTable::LinkEntry(int32 TargetSlot, int32 EntryIndex, int32 TypeIndex, bool bASC)
+{
+	FTargetState& Target = Targets[TargetSlot];
+	Target.Entries.Add(EntryIndex);
+
+	const FTypeMask Bit = FTypeMask(1) << TypeIndex;
+	if (bASC)
+	{
+		ensure(Target.AscCounts[TypeIndex] < MAX_uint8);
+		++Target.AscCounts[TypeIndex];
+		Target.AscMask |= Bit;
+	}
+	else
+	{
+		Target.ManualMask |= Bit;
+	}
+}
+
+void FSuspenseCoreDoTTable::UnlinkEntry(int32 EntryIndex)
+{
+	FTargetState& Target = Targets[EntryTarget[EntryIndex]];
+	Target.Entries.RemoveSingleSwap(EntryIndex, EAllowShrinking::No);
+
+	const int32 TypeIndex = EntryType[EntryIndex];
+	const FTypeMask Bit = FTypeMask(1) << TypeIndex;
+	if (bFromASC[EntryIndex])
+	{
+		if (Target.AscCounts[TypeIndex] > 0 && --Target.AscCounts[TypeIndex] == 0)
+		{
+			Target.AscMask &= ~Bit;
+		}
+	}
+	else
+	{
+		Target.ManualMask &= ~Bit;
+	}
+}
+
+//==================================================================
+// Frame Update
+//==================================================================
+
+void FSuspenseCoreDoTTable::Sweep(double Now, float DeltaSeconds, FSweepResult& OutResult)
+{
+	OutResult.Reset();
+
+	const int32 Count = EntryTarget.Num();
+	float* RESTRICT Remaining = RemainingDuration.GetData();
+	double* RESTRICT NextTick = NextTickTime.GetData();
+	const float* RESTRICT Interval = TickInterval.GetData();
+	const uint8* RESTRICT ASCFlags = bFromASC.GetData();
+
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		bool bExpired = false;
+		if (Remaining[Index] >= 0.0f)
+		{
+			Remaining[Index] = FMath::Max(Remaining[Index] - DeltaSeconds, 0.0f);
+			bExpired = Remaining[Index] <= 0.0f && !ASCFlags[Index];
+		}
+
+		if (Interval[Index] > 0.0f && NextTick[Index] <= Now)
+		{
+			// Hitches collapse into one tick; the schedule never falls behind Now
+			const double Behind = Now - NextTick[Index];
+			NextTick[Index] += Interval[Index] * (FMath::FloorToDouble(Behind / Interval[Index]) + 1.0);
+
+			if (!ASCFlags[Index] && !bExpired)
+			{
+				OutResult.Ticked.Add(Index);
+			}
+		}
+
+		if (bExpired)
+		{
+			OutResult.Expired.Add(Index);
+		}
+	}
+
+	Algo::Reverse(OutResult.Expired);
+}
+
+void FSuspenseCoreDoTTable::Reset()
+{
+	TypeTags.Reset();
+	Targets.Reset();
+	FreeTargets.Reset();
+	EntryTarget.Reset();
+	EntryType.Reset();
+	NextTickTime.Reset();
+	RemainingDuration.Reset();
+	Stacks.Reset();
+	DamagePerTick.Reset();
+	TickInterval.Reset();
+	ApplicationTime.Reset();
+	Source.Reset();
+	EffectHandle.Reset();
+	bFromASC.Reset();
+}
+
+SIZE_T FSuspenseCoreDoTTable::GetAllocatedSize() const
+{
+	SIZE_T Size = TypeTags.GetAllocatedSize()
+		+ Targets.GetAllocatedSize()
+		+ FreeTargets.GetAllocatedSize()
+		+ EntryTarget.GetAllocatedSize()
+		+ EntryType.GetAllocatedSize()
+		+ NextTickTime.GetAllocatedSize()
+		+ RemainingDuration.GetAllocatedSize()
+		+ Stacks.GetAllocatedSize()
+		+ DamagePerTick.GetAllocatedSize()
+		+ TickInterval.GetAllocatedSize()
+		+ ApplicationTime.GetAllocatedSize()
+		+ Source.GetAllocatedSize()
+		+ EffectHandle.GetAllocatedSize()
+		+ bFromASC.GetAllocatedSize();
+
+	for (const FTargetState& Target : Targets)
+	{
+		Size += Target.Entries.GetAllocatedSize();
+	}
+	return Size;
+}
@@ -0,0 +1,575 @@
+// SuspenseCoreLagCompensationSubsystem.cpp
+// SuspenseCore - Server-Side Lag Compensation
+// Copyright Suspense Team. All Rights Reserved.
+
+#include "SuspenseCore/Subsystems/SuspenseCoreLagCompensationSubsystem.h"
+#include "GameFramework/Character.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSuspenseCoreLagComp, Log, All);
+
+static TAutoConsoleVariable<int32> CVarSuspenseCoreLagCompEnabled(
+	TEXT("suspensecore.lagcomp.enabled"),
+	1,
+	TEXT("Validate server shots against rewound character hitboxes.\n")
+	TEXT("0: Use the current server pose\n")
+	TEXT("1: Rewind targets to the client fire time (default)"),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<int32> CVarSuspenseCoreLagCompSampleHz(
+	TEXT("suspensecore.lagcomp.sample_hz"),
+	30,
+	TEXT("Hitbox history sample rate, Hz."),
+	ECVF_Default
+);
+
+static TAutoConsoleVariable<int32> CVarSuspenseCoreLagCompHistoryMs(
+	TEXT("suspensecore.lagcomp.history_ms"),
+	1000,
+	TEXT("Hitbox history length, ms. Shots older than this are validated against the oldest sample."),
+	ECVF_Default
+);
+
+namespace SuspenseCoreLagComp
+{
+	struct FHitboxDef
+	{
+		const TCHAR* Bone;
+		float Radius;
+	};
+
+	// UE5 mannequin skeleton; radii in cm
+	static const FHitboxDef MannequinHitboxes[] =
+	{
+		{ TEXT("head"),        12.0f },
+		{ TEXT("neck_01"),      7.0f },
+		{ TEXT("spine_05"),    17.0f },
+		{ TEXT("spine_03"),    17.0f },
+		{ TEXT("spine_01"),    16.0f },
+		{ TEXT("pelvis"),      16.0f },
+		{ TEXT("upperarm_l"),   7.0f },
+		{ TEXT("upperarm_r"),   7.0f },
+		{ TEXT("lowerarm_l"),   6.0f },
+		{ TEXT("lowerarm_r"),   6.0f },
+		{ TEXT("thigh_l"),     10.0f },
+		{ TEXT("thigh_r"),     10.0f },
+		{ TEXT("calf_l"),       8.0f },
+		{ TEXT("calf_r"),       8.0f },
+	};
+
+	static constexpr int32 NumMannequinHitboxes = UE_ARRAY_COUNT(MannequinHitboxes);
+
+	/** Hitboxes needed before a mesh is treated as a mannequin */
+	static constexpr int32 MinResolvedBones = 8;
+
+	static double SampleInterval()
+	{
+		return 1.0 / FMath::Clamp(CVarSuspenseCoreLagCompSampleHz.GetValueOnGameThread(), 1, 240);
+	}
+}
+
+//========================================================================
+// Subsystem Lifecycle
+//========================================================================
+
+void USuspenseCoreLagCompensationSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+	}
+	ActorSpawnedHandle.Reset();
+	Tracked.Reset();
+
+	Super::Deinitialize();
+}
+
+bool USuspenseCoreLagCompensationSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+}
+
+void USuspenseCoreLagCompensationSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Only the authority validates shots
+	if (InWorld.GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	for (TActorIterator<ACharacter> It(&InWorld); It; ++It)
+	{
+		TrackCharacter(*It);
+	}
+
+	ActorSpawnedHandle = InWorld.AddOnActorSpawnedHandler(
+		FOnActorSpawned::FDelegate::CreateUObject(this, &USuspenseCoreLagCompensationSubsystem::OnActorSpawned));
+}
+
+TStatId USuspenseCoreLagCompensationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USuspenseCoreLagCompensationSubsystem, STATGROUP_Tickables);
+}
+
+USuspenseCoreLagCompensationSubsystem* USuspenseCoreLagCompensationSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<USuspenseCoreLagCompensationSubsystem>() : nullptr;
+}
+
+void USuspenseCoreLagCompensationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const UWorld* World = GetWorld();
+	if (!World || Tracked.Num() == 0)
+	{
+		return;
+	}
+
+	const double Now = World->GetTimeSeconds();
+	if (Now < NextSampleTime)
+	{
+		return;
+	}
+
+	// Fixed rate; after a hitch resume from now instead of bursting samples
+	const double Interval = SuspenseCoreLagComp::SampleInterval();
+	NextSampleTime = FMath::Max(NextSampleTime + Interval, Now + Interval * 0.5);
+
+	SampleAll(Now);
+}
+
+//========================================================================
+// Tracking
+//========================================================================
+
+int32 USuspenseCoreLagCompensationSubsystem::GetHistoryCapacity()
+{
+	const double HistorySeconds = FMath::Max(CVarSuspenseCoreLagCompHistoryMs.GetValueOnGameThread(), 0) / 1000.0;
+	// +2: one sample at each end so the full window can always be bracketed
+	return FMath::CeilToInt32(HistorySeconds / SuspenseCoreLagComp::SampleInterval()) + 2;
+}
+
+void USuspenseCoreLagCompensationSubsystem::OnActorSpawned(AActor* Actor)
+{
+	if (ACharacter* Character = Cast<ACharacter>(Actor))
+	{
+		TrackCharacter(Character);
+	}
+}
+
+void USuspenseCoreLagCompensationSubsystem::TrackCharacter(ACharacter* Character)
+{
+	if (!Character)
+	{
+		return;
+	}
+
+	for (const FTrackedCharacter& Entry : Tracked)
+	{
+		if (Entry.Character.Get() == Character)
+		{
+			return;
+		}
+	}
+
+	FTrackedCharacter& Entry = Tracked.AddDefaulted_GetRef();
+	Entry.Character = Character;
+	// Hitboxes are bound on the first sample: the mesh may not be assigned yet at spawn
+}
+
+void USuspenseCoreLagCompensationSubsystem::UntrackCharacter(ACharacter* Character)
+{
+	Tracked.RemoveAllSwap([Character](const FTrackedCharacter& Entry)
+	{
+		return Entry.Character.Get() == Character;
+	});
+}
+
+void USuspenseCoreLagCompensationSubsystem::SetupHitboxes(FTrackedCharacter& Entry) const
+{
+	using namespace SuspenseCoreLagComp;
+
+	const ACharacter* Character = Entry.Character.Get();
+	const USkeletalMeshComponent* Mesh = Character ? Character->GetMesh() : nullptr;
+
+	Entry.BoneIndices.Reset();
+	Entry.HitboxNames.Reset();
+	Entry.ResolvedAsset = Mesh ? Mesh->GetSkinnedAsset() : nullptr;
+
+	TArray<float, TInlineAllocator<NumMannequinHitboxes>> Radii;
+
+	if (Mesh && Mesh->GetSkinnedAsset())
+	{
+		for (const FHitboxDef& Def : MannequinHitboxes)
+		{
+			const FName Bone(Def.Bone);
+			const int32 BoneIndex = Mesh->GetBoneIndex(Bone);
+			if (BoneIndex != INDEX_NONE)
+			{
+				Entry.BoneIndices.Add(BoneIndex);
+				Entry.HitboxNames.Add(Bone);
+				Radii.Add(Def.Radius);
+			}
+		}
+	}
+
+	if (Entry.BoneIndices.Num() < MinResolvedBones)
+	{
+		Entry.BoneIndices.Reset();
+		Entry.HitboxNames.Reset();
+		Radii.Reset();
+
+		// Capsule fallback: lower / middle / upper sphere, the upper one counts as head
+		const UCapsuleComponent* Capsule = Character ? Character->GetCapsuleComponent() : nullptr;
+		const float CapsuleRadius = Capsule ? Capsule->GetScaledCapsuleRadius() : 34.0f;
+
+		Entry.HitboxNames.Add(NAME_None);
+		Entry.HitboxNames.Add(NAME_None);
+		Entry.HitboxNames.Add(FName(TEXT("head")));
+		Radii.Add(CapsuleRadius);
+		Radii.Add(CapsuleRadius);
+		Radii.Add(CapsuleRadius * 0.6f);
+	}
+
+	Entry.History.Initialize(AllocatedCapacity, Radii);
+}
+
+void USuspenseCoreLagCompensationSubsystem::SampleAll(double Time)
+{
+	using namespace SuspenseCoreLagComp;
+
+	// CVar change: reallocate everything (drops history, which refills within the window)
+	const int32 Capacity = GetHistoryCapacity();
+	const bool bRealloc = Capacity != AllocatedCapacity;
+	AllocatedCapacity = Capacity;
+
+	for (int32 Index = Tracked.Num() - 1; Index >= 0; --Index)
+	{
+		FTrackedCharacter& Entry = Tracked[Index];
+		const ACharacter* Character = Entry.Character.Get();
+		if (!IsValid(Character))
+		{
+			Tracked.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		const USkeletalMeshComponent* Mesh = Character->GetMesh();
+		const UObject* MeshAsset = Mesh ? Mesh->GetSkinnedAsset() : nullptr;
+		if (bRealloc || Entry.History.Capacity() == 0 || Entry.ResolvedAsset.Get() != MeshAsset)
+		{
+			SetupHitboxes(Entry);
+		}
+
+		PoseScratch.Reset();
+		if (Entry.BoneIndices.Num() > 0)
+		{
+			for (const int32 BoneIndex : Entry.BoneIndices)
+			{
+				PoseScratch.Add(FVector3f(Mesh->GetBoneTransform(BoneIndex).GetLocation()));
+			}
+		}
+		else
+		{
+			const UCapsuleComponent* Capsule = Character->GetCapsuleComponent();
+			const FVector Center = Character->GetActorLocation();
+			const float HalfHeight = Capsule ? Capsule->GetScaledCapsuleHalfHeight() : 88.0f;
+			const float Radius = Capsule ? Capsule->GetScaledCapsuleRadius() : 34.0f;
+			const float Offset = FMath::Max(HalfHeight - Radius, 0.0f);
+
+			PoseScratch.Add(FVector3f(Center - FVector(0.0, 0.0, Offset)));
+			PoseScratch.Add(FVector3f(Center));
+			PoseScratch.Add(FVector3f(Center + FVector(0.0, 0.0, Offset + Radius * 0.4f)));
+		}
+
+		Entry.History.Record(Time, PoseScratch);
+	}
+}
+
+SIZE_T USuspenseCoreLagCompensationSubsystem::GetHistoryMemoryBytes() const
+{
+	SIZE_T Bytes = Tracked.GetAllocatedSize();
+	for (const FTrackedCharacter& Entry : Tracked)
+	{
+		Bytes += Entry.History.GetAllocatedSize()
+			+ Entry.BoneIndices.GetAllocatedSize()
+			+ Entry.HitboxNames.GetAllocatedSize();
+	}
+	return Bytes;
+}
+
+//========================================================================
+// Shot Resolution
+//========================================================================
+
+bool USuspenseCoreLagCompensationSubsystem::ResolveShot(const FVector& TraceStart, const FVector& TraceEnd, double ShotTime,
+	const AActor* Instigator, TArray<FHitResult>& InOutHits) const
+{
+	if (CVarSuspenseCoreLagCompEnabled.GetValueOnGameThread() == 0 || Tracked.Num() == 0)
+	{
+		return false;
+	}
+
+	const double TraceLength = FVector::Dist(TraceStart, TraceEnd);
+	if (TraceLength <= UE_KINDA_SMALL_NUMBER)
+	{
+		return false;
+	}
+
+	// Characters whose history reaches back to the shot; the rest keep their current-pose hits
+	TArray<const FTrackedCharacter*, TInlineAllocator<32>> Rewound;
+	for (const FTrackedCharacter& Entry : Tracked)
+	{
+		const ACharacter* Character = Entry.Character.Get();
+		if (Character && Character != Instigator && Entry.History.Num() > 0 && ShotTime < Entry.History.NewestTime())
+		{
+			Rewound.Add(&Entry);
+		}
+	}
+	if (Rewound.Num() == 0)
+	{
+		return false;
+	}
+
+	auto IsRewound = [&Rewound](const AActor* Actor)
+	{
+		for (const FTrackedCharacter* Entry : Rewound)
+		{
+			if (Entry->Character.Get() == Actor)
+			{
+				return true;
+			}
+		}
+		return false;
+	};
+
+	// Drop current-pose hits on rewound characters; what is left bounds the ray
+	const int32 NumBefore = InOutHits.Num();
+	InOutHits.RemoveAll([&IsRewound](const FHitResult& Hit)
+	{
+		return IsRewound(Hit.GetActor());
+	});
+	const bool bRemovedAny = InOutHits.Num() != NumBefore;
+
+	double BlockDistance = TraceLength;
+	for (const FHitResult& Hit : InOutHits)
+	{
+		if (Hit.bBlockingHit)
+		{
+			BlockDistance = FMath::Min(BlockDistance, static_cast<double>(Hit.Distance));
+		}
+	}
+
+	const FVector RayEnd = TraceStart + (TraceEnd - TraceStart) * (BlockDistance / TraceLength);
+
+	const FTrackedCharacter* BestEntry = nullptr;
+	FSuspenseCoreHitboxRayHit BestHit;
+	for (const FTrackedCharacter* Entry : Rewound)
+	{
+		FSuspenseCoreHitboxRayHit RayHit;
+		if (Entry->History.RaycastAtTime(ShotTime, TraceStart, RayEnd, RayHit, RayScratch)
+			&& (!BestEntry || RayHit.Time < BestHit.Time))
+		{
+			BestEntry = Entry;
+			BestHit = RayHit;
+		}
+	}
+
+	if (!BestEntry)
+	{
+		// Removed hits are restored only by a rewound hit; no hit means the target had moved out of the line
+		return bRemovedAny;
+	}
+
+	const double HitDistance = BestHit.Time * BlockDistance;
+
+	// The rewound character now stops the ray: drop everything behind it, including the old blocking hit
+	InOutHits.RemoveAll([HitDistance](const FHitResult& Hit)
+	{
+		return Hit.Distance > HitDistance;
+	});
+
+	ACharacter* Character = BestEntry->Character.Get();
+
+	FHitResult& Hit = InOutHits.AddDefaulted_GetRef();
+	Hit.bBlockingHit = true;
+	Hit.TraceStart = TraceStart;
+	Hit.TraceEnd = TraceEnd;
+	Hit.Distance = static_cast<float>(HitDistance);
+	Hit.Time = static_cast<float>(HitDistance / TraceLength);
+	Hit.Location = BestHit.ImpactPoint;
+	Hit.ImpactPoint = BestHit.ImpactPoint;
+	Hit.Normal = BestHit.ImpactNormal;
+	Hit.ImpactNormal = BestHit.ImpactNormal;
+	Hit.BoneName = BestEntry->HitboxNames[BestHit.Hitbox];
+	Hit.HitObjectHandle = FActorInstanceHandle(Character);
+	Hit.Component = BestEntry->BoneIndices.Num() > 0
+		? static_cast<UPrimitiveComponent*>(Character->GetMesh())
+		: static_cast<UPrimitiveComponent*>(Character->GetCapsuleComponent());
+
+	UE_LOG(LogSuspenseCoreLagComp, Verbose, TEXT("ResolveShot: %s hit at %s, rewind %.0f ms"),
+		*Character->GetName(), *Hit.BoneName.ToString(),
+		(BestEntry->History.NewestTime() - ShotTime) * 1000.0);
+
+	return true;
+}
+
+//========================================================================
+// Benchmark
+//========================================================================
+
+FString USuspenseCoreLagCompensationSubsystem::RunBenchmark(int32 NumCharacters, int32 HistoryMs, int32 NumShots)
+{
+	using namespace SuspenseCoreLagComp;
+
+	NumCharacters = FMath::Clamp(NumCharacters, 1, 4096);
+	HistoryMs = FMath::Clamp(HistoryMs, 1, 10000);
+	NumShots = FMath::Clamp(NumShots, 1, 1000000);
+
+	const double Interval = SampleInterval();
+	const int32 NumSamples = FMath::CeilToInt32(HistoryMs / 1000.0 / Interval) + 2;
+
+	TArray<float> Radii;
+	for (const FHitboxDef& Def : MannequinHitboxes)
+	{
+		Radii.Add(Def.Radius);
+	}
+
+	FRandomStream Random(0x5C0FFEE);
+	TArray<FSuspenseCoreHitboxHistory> Histories;
+	TArray<FVector3f> Origins;
+	TArray<FVector3f> Velocities;
+	Histories.SetNum(NumCharacters);
+	for (int32 Index = 0; Index < NumCharacters; ++Index)
+	{
+		Histories[Index].Initialize(NumSamples, Radii);
+		Origins.Add(FVector3f(Random.FRandRange(-5000.f, 5000.f), Random.FRandRange(-5000.f, 5000.f), 0.0f));
+		Velocities.Add(FVector3f(Random.FRandRange(-600.f, 600.f), Random.FRandRange(-600.f, 600.f), 0.0f));
+	}
+
+	// Bone layout offsets of a standing character
+	TArray<FVector3f> BoneOffsets;
+	for (int32 Box = 0; Box < Radii.Num(); ++Box)
+	{
+		BoneOffsets.Add(FVector3f(Random.FRandRange(-20.f, 20.f), Random.FRandRange(-20.f, 20.f), 160.0f - Box * 11.0f));
+	}
+
+	// Record: fill every history past capacity once so the ring wraps
+	TArray<FVector3f> Pose;
+	Pose.SetNum(Radii.Num());
+	const int32 RecordSteps = NumSamples + NumSamples / 2;
+	const uint64 RecordStart = FPlatformTime::Cycles64();
+	for (int32 Step = 0; Step < RecordSteps; ++Step)
+	{
+		const double Time = Step * Interval;
+		for (int32 Index = 0; Index < NumCharacters; ++Index)
+		{
+			const FVector3f Root = Origins[Index] + Velocities[Index] * static_cast<float>(Time);
+			for (int32 Box = 0; Box < Pose.Num(); ++Box)
+			{
+				Pose[Box] = Root + BoneOffsets[Box];
+			}
+			Histories[Index].Record(Time, Pose);
+		}
+	}
+	const double RecordMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - RecordStart);
+
+	const double NewestTime = (RecordSteps - 1) * Interval;
+	const double OldestTime = NewestTime - HistoryMs / 1000.0;
+
+	// Rewind only (full pose interpolation), every character at one time per shot
+	TArray<FVector3f> Scratch;
+	FVector3f BoundsCenter;
+	float BoundsRadius = 0.0f;
+	double Checksum = 0.0;
+	const int32 RewindShots = FMath::Max(NumShots / 10, 1);
+	const uint64 RewindStart = FPlatformTime::Cycles64();
+	for (int32 Shot = 0; Shot < RewindShots; ++Shot)
+	{
+		const double Time = OldestTime + Random.GetFraction() * (NewestTime - OldestTime);
+		for (const FSuspenseCoreHitboxHistory& History : Histories)
+		{
+			History.Rewind(Time, Scratch, BoundsCenter, BoundsRadius);
+			Checksum += Scratch[0].X;
+		}
+	}
+	const double RewindMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - RewindStart);
+
+	// Shots: one ray from a random character's head toward another character, tested against all
+	int32 NumHits = 0;
+	const uint64 ShotStart = FPlatformTime::Cycles64();
+	for (int32 Shot = 0; Shot < NumShots; ++Shot)
+	{
+		const double Time = OldestTime + Random.GetFraction() * (NewestTime - OldestTime);
+		const int32 Target = Random.RandHelper(NumCharacters);
+		const FVector3f TargetRoot = Origins[Target] + Velocities[Target] * static_cast<float>(Time);
+		const FVector Start(TargetRoot + FVector3f(Random.FRandRange(-3000.f, 3000.f), Random.FRandRange(-3000.f, 3000.f), 150.0f));
+		const FVector Aim(TargetRoot + FVector3f(0.0f, 0.0f, 120.0f));
+		const FVector End = Start + (Aim - Start).GetSafeNormal() * 10000.0;
+
+		float BestTime = 1.0f;
+		bool bHit = false;
+		for (const FSuspenseCoreHitboxHistory& History : Histories)
+		{
+			FSuspenseCoreHitboxRayHit RayHit;
+			if (History.RaycastAtTime(Time, Start, End, RayHit, Scratch) && RayHit.Time < BestTime)
+			{
+				BestTime = RayHit.Time;
+				bHit = true;
+			}
+		}
+		NumHits += bHit ? 1 : 0;
+	}
+	const double ShotMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - ShotStart);
+
+	SIZE_T Bytes = 0;
+	for (const FSuspenseCoreHitboxHistory& History : Histories)
+	{
+		Bytes += History.GetAllocatedSize();
+	}
+
+	const int64 Rewinds = static_cast<int64>(RewindShots) * NumCharacters;
+	const int64 Raycasts = static_cast<int64>(NumShots) * NumCharacters;
+
+	return FString::Printf(
+		TEXT("LagCompensation benchmark: %d characters, %d ms history @ %.0f Hz (%d samples, %d hitboxes)\n")
+		TEXT("  Memory:   %.1f KB total, %.2f KB per character\n")
+		TEXT("  Record:   %d samples in %.3f ms (%.1f ns per character sample)\n")
+		TEXT("  Rewind:   %lld pose rewinds in %.3f ms (%.1f ns per rewind)\n")
+		TEXT("  Shots:    %d shots vs all characters in %.3f ms (%.2f us per shot, %.1f ns per character, %d hits)\n")
+		TEXT("  Checksum: %.1f"),
+		NumCharacters, HistoryMs, 1.0 / Interval, NumSamples, Radii.Num(),
+		Bytes / 1024.0, Bytes / 1024.0 / NumCharacters,
+		RecordSteps * NumCharacters, RecordMs, RecordMs * 1e6 / (static_cast<double>(RecordSteps) * NumCharacters),
+		Rewinds, RewindMs, RewindMs * 1e6 / Rewinds,
+		NumShots, ShotMs, ShotMs * 1e3 / NumShots, ShotMs * 1e6 / Raycasts, NumHits,
+		Checksum);
+}
+
+#if !UE_BUILD_SHIPPING
+static void HandleBenchLagCompensationCommand(const TArray<FString>& Args)
+{
+	const int32 NumCharacters = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 100;
+	const int32 HistoryMs = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 1000;
+	const int32 NumShots = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 10000;
+
+	const FString Report = USuspenseCoreLagCompensationSubsystem::RunBenchmark(NumCharacters, HistoryMs, NumShots);
+	UE_LOG(LogSuspenseCoreLagComp, Log, TEXT("%s"), *Report);
+}
+
+static FAutoConsoleCommand GSuspenseCoreBenchLagCompensationCommand(
+	TEXT("SuspenseCore.Weapon.BenchLagCompensation"),
+	TEXT("Benchmark hitbox history record/rewind. Args: [Characters=100] [HistoryMs=1000] [Shots=10000]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&HandleBenchLagCompensationCommand)
+);
+#endif
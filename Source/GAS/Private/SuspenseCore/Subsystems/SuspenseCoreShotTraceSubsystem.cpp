@@ -0,0 +1,302 @@
+// SuspenseCoreShotTraceSubsystem.cpp
+// SuspenseCore - Batched Async Shot Traces
+// Copyright Suspense Team. All Rights Reserved.
+
+#include "SuspenseCore/Subsystems/SuspenseCoreShotTraceSubsystem.h"
+#include "SuspenseCore/Utils/SuspenseCoreTraceUtils.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSuspenseCoreShotTrace, Log, All);
+
+CSV_DEFINE_CATEGORY(SuspenseCoreWeapon, true);
+
+static TAutoConsoleVariable<int32> CVarSuspenseCoreAsyncServerTraces(
+	TEXT("suspensecore.weapon.async_server_traces"),
+	1,
+	TEXT("How server hit traces for weapon fire are performed.\n")
+	TEXT("0: Synchronous trace inside SubmitShot (legacy behaviour)\n")
+	TEXT("1: Batched async traces, results handled next frame (default)"),
+	ECVF_Default
+);
+
+//========================================================================
+// Subsystem Lifecycle
+//========================================================================
+
+void USuspenseCoreShotTraceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	TraceDelegate.BindUObject(this, &USuspenseCoreShotTraceSubsystem::OnTraceDone);
+}
+
+void USuspenseCoreShotTraceSubsystem::Deinitialize()
+{
+	// Outstanding callbacks are dropped: their abilities go away with the world
+	if (InFlight.Num() > 0)
+	{
+		UE_LOG(LogSuspenseCoreShotTrace, Verbose, TEXT("Deinitialize: dropping %d outstanding shots"), InFlight.Num());
+	}
+
+	TraceDelegate.Unbind();
+	Queued.Reset();
+	Completed.Reset();
+	InFlight.Reset();
+
+	Super::Deinitialize();
+}
+
+bool USuspenseCoreShotTraceSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld() && Super::ShouldCreateSubsystem(Outer);
+}
+
+TStatId USuspenseCoreShotTraceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USuspenseCoreShotTraceSubsystem, STATGROUP_Tickables);
+}
+
+USuspenseCoreShotTraceSubsystem* USuspenseCoreShotTraceSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<USuspenseCoreShotTraceSubsystem>() : nullptr;
+}
+
+void USuspenseCoreShotTraceSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Results of earlier batches first, so a callback that fires again joins this frame's batch
+	DrainCompleted();
+	FlushQueued();
+
+	CSV_CUSTOM_STAT(SuspenseCoreWeapon, ShotTracesIssued, FrameStats.TracesIssued, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SuspenseCoreWeapon, ShotTraceBatchSize, FrameStats.BatchSize, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SuspenseCoreWeapon, ShotTraceLatencyMs, FrameStats.AvgLatencyMs, ECsvCustomStatOp::Set);
+
+	LastFrameStats = FrameStats;
+	FrameStats = FSuspenseCoreShotTraceFrameStats();
+}
+
+//========================================================================
+// Public API
+//========================================================================
+
+uint32 USuspenseCoreShotTraceSubsystem::SubmitShot(FSuspenseCoreShotTraceRequest&& Request, FSuspenseCoreShotTraceCompleted&& OnCompleted)
+{
+	if (Request.Ends.Num() == 0)
+	{
+		return 0;
+	}
+
+	const uint32 ShotId = NextShotId++;
+	if (NextShotId == 0)
+	{
+		NextShotId = 1;
+	}
+
+	FShotState Shot;
+	Shot.Request = MoveTemp(Request);
+	Shot.OnCompleted = MoveTemp(OnCompleted);
+	Shot.PendingTraces = Shot.Request.Ends.Num();
+	Shot.SubmitCycles = FPlatformTime::Cycles64();
+
+	if (CVarSuspenseCoreAsyncServerTraces.GetValueOnGameThread() == 0)
+	{
+		TraceNow(Shot);
+		FinishShot(Shot);
+		return ShotId;
+	}
+
+	InFlight.Add(ShotId, MoveTemp(Shot));
+	Queued.Add(ShotId);
+	return ShotId;
+}
+
+//========================================================================
+// Internals
+//========================================================================
+
+FCollisionQueryParams USuspenseCoreShotTraceSubsystem::MakeQueryParams(const FSuspenseCoreShotTraceRequest& Request)
+{
+	// Same settings as USuspenseCoreTraceUtils::PerformLineTrace
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SuspenseCoreShotTrace), true);
+	QueryParams.bReturnPhysicalMaterial = true;
+
+	if (AActor* Instigator = Request.Instigator.Get())
+	{
+		QueryParams.AddIgnoredActor(Instigator);
+	}
+	for (const TWeakObjectPtr<AActor>& Ignored : Request.IgnoreActors)
+	{
+		if (AActor* Actor = Ignored.Get())
+		{
+			QueryParams.AddIgnoredActor(Actor);
+		}
+	}
+	return QueryParams;
+}
+
+void USuspenseCoreShotTraceSubsystem::FlushQueued()
+{
+	if (Queued.Num() == 0)
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+
+	for (const uint32 ShotId : Queued)
+	{
+		FShotState* Shot = InFlight.Find(ShotId);
+		if (!Shot)
+		{
+			continue;
+		}
+
+		if (!World)
+		{
+			TraceNow(*Shot);
+			Completed.Add(ShotId);
+			continue;
+		}
+
+		const FCollisionQueryParams QueryParams = MakeQueryParams(Shot->Request);
+		for (const FVector& End : Shot->Request.Ends)
+		{
+			World->AsyncLineTraceByProfile(
+				EAsyncTraceType::Multi,
+				Shot->Request.Start,
+				End,
+				Shot->Request.TraceProfile,
+				QueryParams,
+				&TraceDelegate,
+				ShotId);
+		}
+
+		FrameStats.TracesIssued += Shot->Request.Ends.Num();
+		++FrameStats.BatchSize;
+	}
+
+	Queued.Reset();
+}
+
+void USuspenseCoreShotTraceSubsystem::OnTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	const uint32 ShotId = Datum.UserData;
+	FShotState* Shot = InFlight.Find(ShotId);
+	if (!Shot)
+	{
+		return;
+	}
+
+	bool bBlocking = false;
+	for (const FHitResult& Hit : Datum.OutHits)
+	{
+		bBlocking |= Hit.bBlockingHit;
+	}
+
+	if (Datum.OutHits.Num() > 0)
+	{
+		Shot->Hits.Append(MoveTemp(Datum.OutHits));
+	}
+	else
+	{
+		// Miss result at the end point, as PerformLineTrace does
+		FHitResult& MissHit = Shot->Hits.AddDefaulted_GetRef();
+		MissHit.TraceStart = Datum.Start;
+		MissHit.TraceEnd = Datum.End;
+		MissHit.Location = Datum.End;
+		MissHit.ImpactPoint = Datum.End;
+		MissHit.bBlockingHit = false;
+	}
+	Shot->bHadBlockingHit |= bBlocking;
+
+	if (--Shot->PendingTraces == 0)
+	{
+		Completed.Add(ShotId);
+	}
+}
+
+void USuspenseCoreShotTraceSubsystem::DrainCompleted()
+{
+	if (Completed.Num() == 0)
+	{
+		return;
+	}
+
+	// Trace order within a batch is not guaranteed; callers (e.g. client result RPCs) expect submission order
+	TArray<uint32> Ready = MoveTemp(Completed);
+	Completed.Reset();
+	Ready.Sort();
+
+	const uint64 NowCycles = FPlatformTime::Cycles64();
+	double LatencySumMs = FrameStats.AvgLatencyMs * FrameStats.ShotsCompleted;
+
+	for (const uint32 ShotId : Ready)
+	{
+		FShotState* Found = InFlight.Find(ShotId);
+		if (!Found)
+		{
+			continue;
+		}
+		FShotState Shot = MoveTemp(*Found);
+		InFlight.Remove(ShotId);
+
+		const float LatencyMs = static_cast<float>(FPlatformTime::ToMilliseconds64(NowCycles - Shot.SubmitCycles));
+		LatencySumMs += LatencyMs;
+		FrameStats.MaxLatencyMs = FMath::Max(FrameStats.MaxLatencyMs, LatencyMs);
+		++FrameStats.ShotsCompleted;
+
+		FinishShot(Shot);
+	}
+
+	FrameStats.AvgLatencyMs = FrameStats.ShotsCompleted > 0
+		? static_cast<float>(LatencySumMs / FrameStats.ShotsCompleted)
+		: 0.0f;
+}
+
+void USuspenseCoreShotTraceSubsystem::TraceNow(FShotState& Shot)
+{
+	AActor* Instigator = Shot.Request.Instigator.Get();
+	UWorld* World = Instigator ? Instigator->GetWorld() : GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const FCollisionQueryParams QueryParams = MakeQueryParams(Shot.Request);
+	for (const FVector& End : Shot.Request.Ends)
+	{
+		TArray<FHitResult> TraceHits;
+		Shot.bHadBlockingHit |= World->LineTraceMultiByProfile(
+			TraceHits, Shot.Request.Start, End, Shot.Request.TraceProfile, QueryParams);
+
+		if (TraceHits.Num() == 0)
+		{
+			FHitResult& MissHit = TraceHits.AddDefaulted_GetRef();
+			MissHit.TraceStart = Shot.Request.Start;
+			MissHit.TraceEnd = End;
+			MissHit.Location = End;
+			MissHit.ImpactPoint = End;
+			MissHit.bBlockingHit = false;
+		}
+		Shot.Hits.Append(MoveTemp(TraceHits));
+	}
+
+	FrameStats.TracesIssued += Shot.Request.Ends.Num();
+	Shot.PendingTraces = 0;
+}
+
+void USuspenseCoreShotTraceSubsystem::FinishShot(FShotState& Shot)
+{
+	if (Shot.Request.bDebug)
+	{
+		USuspenseCoreTraceUtils::DrawDebugTrace(this, Shot.Request.Start, Shot.Hits, Shot.Request.DebugDrawTime);
+	}
+
+	Shot.OnCompleted.ExecuteIfBound(Shot.Hits, Shot.bHadBlockingHit);
+}
@@ -4,6 +4,7 @@
 
 #include "SuspenseCore/Tasks/SuspenseCoreWeaponAsyncTask_PerformTrace.h"
 #include "SuspenseCore/Utils/SuspenseCoreTraceUtils.h"
+#include "SuspenseCore/Subsystems/SuspenseCoreShotTraceSubsystem.h"
 #include "SuspenseCore/Utils/SuspenseCoreSpreadCalculator.h"
 #include "SuspenseCore/Attributes/SuspenseCoreWeaponAttributeSet.h"
 #include "SuspenseCore/Tags/SuspenseCoreGameplayTags.h"
@@ -44,7 +45,8 @@ USuspenseCoreWeaponAsyncTask_PerformTrace* USuspenseCoreWeaponAsyncTask_PerformT
 USuspenseCoreWeaponAsyncTask_PerformTrace* USuspenseCoreWeaponAsyncTask_PerformTrace::PerformWeaponTraceFromRequest(
 	UGameplayAbility* OwningAbility,
 	const FWeaponShotParams& InShotRequest,
-	bool bDebug)
+	bool bDebug,
+	bool bBatchedAsync)
 {
 	USuspenseCoreWeaponAsyncTask_PerformTrace* Task = NewAbilityTask<USuspenseCoreWeaponAsyncTask_PerformTrace>(
 		OwningAbility, FName("WeaponTraceFromRequest"));
@@ -54,6 +56,7 @@ USuspenseCoreWeaponAsyncTask_PerformTrace* USuspenseCoreWeaponAsyncTask_PerformT
 		Task->ShotRequest = InShotRequest;
 		Task->bUseRequestMode = true;
 		Task->Config.bDebug = bDebug;
+		Task->Config.bBatchedAsync = bBatchedAsync;
 	}
 
 	return Task;
@@ -172,10 +175,12 @@ void USuspenseCoreWeaponAsyncTask_PerformTrace::ExecuteTrace()
 	TArray<AActor*> ActorsToIgnore;
 	ActorsToIgnore.Add(AvatarActor);
 
-	// Perform traces
+	// Build pellet end points
 	FRandomStream RandomStream;
 	RandomStream.GenerateNewSeed();
 
+	TArray<FVector> TraceEnds;
+	TraceEnds.Reserve(NumTraces);
 	for (int32 i = 0; i < NumTraces; ++i)
 	{
 		// Apply spread
@@ -183,33 +188,11 @@ void USuspenseCoreWeaponAsyncTask_PerformTrace::ExecuteTrace()
 			AimDirection, FinalSpread, RandomStream.RandRange(0, INT32_MAX));
 
 		// Calculate end point
-		FVector TraceEnd = USuspenseCoreTraceUtils::CalculateTraceEndPoint(
-			MuzzleLocation, TraceDirection, MaxRange);
-
-		// Perform trace
-		TArray<FHitResult> TraceHits;
-		bool bHadHit = USuspenseCoreTraceUtils::PerformLineTrace(
-			AvatarActor,
-			MuzzleLocation,
-			TraceEnd,
-			Config.TraceProfile,
-			ActorsToIgnore,
-			Config.bDebug,
-			Config.DebugDrawTime,
-			TraceHits
-		);
-
-		// Collect results
-		Result.HitResults.Append(TraceHits);
-		if (bHadHit)
-		{
-			Result.bHadBlockingHit = true;
-		}
+		TraceEnds.Add(USuspenseCoreTraceUtils::CalculateTraceEndPoint(
+			MuzzleLocation, TraceDirection, MaxRange));
 	}
 
-	// Broadcast result
-	OnCompleted.Broadcast(Result);
-	EndTask();
+	DispatchTraces(AvatarActor, ActorsToIgnore, MuzzleLocation, TraceEnds, MoveTemp(Result));
 }
 
 void USuspenseCoreWeaponAsyncTask_PerformTrace::ExecuteTraceFromRequest()
@@ -246,6 +229,8 @@ void USuspenseCoreWeaponAsyncTask_PerformTrace::ExecuteTraceFromRequest()
 	FRandomStream RandomStream(static_cast<int32>(ShotRequest.Timestamp * 1000.0f));
 
 	const int32 NumTraces = Result.NumTraces;
+	TArray<FVector> TraceEnds;
+	TraceEnds.Reserve(NumTraces);
 	for (int32 i = 0; i < NumTraces; ++i)
 	{
 		// Apply spread using deterministic seed
@@ -256,17 +241,64 @@ void USuspenseCoreWeaponAsyncTask_PerformTrace::ExecuteTraceFromRequest()
 		);
 
 		// Calculate end point
-		FVector TraceEnd = USuspenseCoreTraceUtils::CalculateTraceEndPoint(
+		TraceEnds.Add(USuspenseCoreTraceUtils::CalculateTraceEndPoint(
 			ShotRequest.StartLocation,
 			TraceDirection,
 			ShotRequest.Range
-		);
+		));
+	}
+
+	DispatchTraces(AvatarActor, ActorsToIgnore, ShotRequest.StartLocation, TraceEnds, MoveTemp(Result));
+}
+
+void USuspenseCoreWeaponAsyncTask_PerformTrace::DispatchTraces(
+	AActor* AvatarActor,
+	const TArray<AActor*>& ActorsToIgnore,
+	const FVector& Start,
+	const TArray<FVector>& Ends,
+	FSuspenseCoreWeaponTraceResult&& Result)
+{
+	USuspenseCoreShotTraceSubsystem* ShotTraces = Config.bBatchedAsync
+		? USuspenseCoreShotTraceSubsystem::Get(AvatarActor)
+		: nullptr;
 
+	if (ShotTraces)
+	{
+		FSuspenseCoreShotTraceRequest Request;
+		Request.Instigator = AvatarActor;
+		for (AActor* Ignored : ActorsToIgnore)
+		{
+			Request.IgnoreActors.Add(Ignored);
+		}
+		Request.Start = Start;
+		Request.Ends.Append(Ends);
+		Request.TraceProfile = Config.TraceProfile;
+		Request.bDebug = Config.bDebug;
+		Request.DebugDrawTime = Config.DebugDrawTime;
+
+		// Task stays alive until the batch completes; EndTask there
+		ShotTraces->SubmitShot(MoveTemp(Request), FSuspenseCoreShotTraceCompleted::CreateWeakLambda(this,
+			[this, PendingResult = MoveTemp(Result)](const TArray<FHitResult>& Hits, bool bHadBlockingHit) mutable
+			{
+				if (IsFinished())
+				{
+					return;
+				}
+				PendingResult.HitResults = Hits;
+				PendingResult.bHadBlockingHit = bHadBlockingHit;
+				OnCompleted.Broadcast(PendingResult);
+				EndTask();
+			}));
+		return;
+	}
+
+	for (const FVector& TraceEnd : Ends)
+	{
 		// Perform trace
 		TArray<FHitResult> TraceHits;
 		bool bHadHit = USuspenseCoreTraceUtils::PerformLineTrace(
 			AvatarActor,
-			ShotRequest.StartLocation,
+			Start,
 			TraceEnd,
 			Config.TraceProfile,
 			ActorsToIgnore,
@@ -275,6 +307,7 @@ void USuspenseCoreWeaponAsyncTask_PerformTrace::ExecuteTraceFromRequest()
 			TraceHits
 		);
 
+		// Collect results
 		Result.HitResults.Append(TraceHits);
 		if (bHadHit)
 		{
@@ -0,0 +1,260 @@
+// SuspenseCoreHitboxHistory.cpp
+// SuspenseCore - Lag Compensation Hitbox History
+// Copyright Suspense Team. All Rights Reserved.
+
+#include "SuspenseCore/Utils/SuspenseCoreHitboxHistory.h"
+
+void FSuspenseCoreHitboxHistory::Initialize(int32 InCapacity, TConstArrayView<float> InRadii)
+{
+	const int32 NewCapacity = FMath::Max(InCapacity, 2);
+	const int32 NumBoxes = InRadii.Num();
+
+	SampleTimes.SetNumZeroed(NewCapacity);
+	BoundsCenter.SetNumZeroed(NewCapacity);
+	BoundsRadius.SetNumZeroed(NewCapacity);
+
+	CenterX.SetNumZeroed(NewCapacity * NumBoxes);
+	CenterY.SetNumZeroed(NewCapacity * NumBoxes);
+	CenterZ.SetNumZeroed(NewCapacity * NumBoxes);
+
+	Radii = InRadii;
+	MaxRadius = 0.0f;
+	for (const float Radius : Radii)
+	{
+		MaxRadius = FMath::Max(MaxRadius, Radius);
+	}
+
+	Head = 0;
+	Count = 0;
+}
+
+void FSuspenseCoreHitboxHistory::Record(double Time, TConstArrayView<FVector3f> Centers)
+{
+	const int32 NumBoxes = Radii.Num();
+	const int32 Cap = SampleTimes.Num();
+	if (Cap == 0 || Centers.Num() != NumBoxes || NumBoxes == 0)
+	{
+		return;
+	}
+
+	int32 Physical;
+	if (Count < Cap)
+	{
+		Physical = Slot(Count);
+		++Count;
+	}
+	else
+	{
+		Physical = Head;
+		Head = Head + 1 == Cap ? 0 : Head + 1;
+	}
+
+	SampleTimes[Physical] = Time;
+
+	// Bounding sphere: box centroid + farthest hitbox extent
+	FVector3f Centroid = FVector3f::ZeroVector;
+	const int32 Base = Physical * NumBoxes;
+	for (int32 Box = 0; Box < NumBoxes; ++Box)
+	{
+		CenterX[Base + Box] = Centers[Box].X;
+		CenterY[Base + Box] = Centers[Box].Y;
+		CenterZ[Base + Box] = Centers[Box].Z;
+		Centroid += Centers[Box];
+	}
+	Centroid /= static_cast<float>(NumBoxes);
+
+	float RadiusSq = 0.0f;
+	for (int32 Box = 0; Box < NumBoxes; ++Box)
+	{
+		RadiusSq = FMath::Max(RadiusSq, FVector3f::DistSquared(Centroid, Centers[Box]));
+	}
+
+	BoundsCenter[Physical] = Centroid;
+	BoundsRadius[Physical] = FMath::Sqrt(RadiusSq) + MaxRadius;
+}
+
+int32 FSuspenseCoreHitboxHistory::FindSampleAtOrBefore(double Time) const
+{
+	// Times are increasing in logical order: binary search
+	int32 Low = 0;
+	int32 High = Count - 1;
+	while (Low < High)
+	{
+		const int32 Mid = (Low + High + 1) / 2;
+		if (SampleTimes[Slot(Mid)] <= Time)
+		{
+			Low = Mid;
+		}
+		else
+		{
+			High = Mid - 1;
+		}
+	}
+	return Low;
+}
+
+void FSuspenseCoreHitboxHistory::Bracket(double Time, int32& OutSlotA, int32& OutSlotB, float& OutAlpha) const
+{
+	Time = FMath::Clamp(Time, OldestTime(), NewestTime());
+	const int32 Before = FindSampleAtOrBefore(Time);
+	const int32 After = FMath::Min(Before + 1, Count - 1);
+
+	OutSlotA = Slot(Before);
+	OutSlotB = Slot(After);
+	const double Span = SampleTimes[OutSlotB] - SampleTimes[OutSlotA];
+	OutAlpha = Span > UE_SMALL_NUMBER ? static_cast<float>((Time - SampleTimes[OutSlotA]) / Span) : 0.0f;
+}
+
+void FSuspenseCoreHitboxHistory::LerpCenters(int32 SlotA, int32 SlotB, float Alpha, TArray<FVector3f>& OutCenters) const
+{
+	const int32 NumBoxes = Radii.Num();
+	OutCenters.SetNumUninitialized(NumBoxes, EAllowShrinking::No);
+
+	const float* RESTRICT AX = CenterX.GetData() + SlotA * NumBoxes;
+	const float* RESTRICT AY = CenterY.GetData() + SlotA * NumBoxes;
+	const float* RESTRICT AZ = CenterZ.GetData() + SlotA * NumBoxes;
+	const float* RESTRICT BX = CenterX.GetData() + SlotB * NumBoxes;
+	const float* RESTRICT BY = CenterY.GetData() + SlotB * NumBoxes;
+	const float* RESTRICT BZ = CenterZ.GetData() + SlotB * NumBoxes;
+	FVector3f* RESTRICT Out = OutCenters.GetData();
+
+	for (int32 Box = 0; Box < NumBoxes; ++Box)
+	{
+		Out[Box] = FVector3f(
+			AX[Box] + (BX[Box] - AX[Box]) * Alpha,
+			AY[Box] + (BY[Box] - AY[Box]) * Alpha,
+			AZ[Box] + (BZ[Box] - AZ[Box]) * Alpha);
+	}
+}
+
+bool FSuspenseCoreHitboxHistory::Rewind(double Time, TArray<FVector3f>& OutCenters, FVector3f& OutBoundsCenter, float& OutBoundsRadius) const
+{
+	if (Count == 0)
+	{
+		return false;
+	}
+
+	int32 SlotA, SlotB;
+	float Alpha;
+	Bracket(Time, SlotA, SlotB, Alpha);
+	LerpCenters(SlotA, SlotB, Alpha, OutCenters);
+
+	OutBoundsCenter = FMath::Lerp(BoundsCenter[SlotA], BoundsCenter[SlotB], Alpha);
+	OutBoundsRadius = FMath::Max(BoundsRadius[SlotA], BoundsRadius[SlotB]);
+	return true;
+}
+
+bool FSuspenseCoreHitboxHistory::RaySphere(const FVector3f& Origin, const FVector3f& Dir, float Length,
+	const FVector3f& Center, float Radius, float& OutDistance)
+{
+	const FVector3f ToCenter = Center - Origin;
+	const float Projection = FVector3f::DotProduct(ToCenter, Dir);
+	const float DistSq = ToCenter.SizeSquared() - Projection * Projection;
+	const float RadiusSq = Radius * Radius;
+	if (DistSq > RadiusSq)
+	{
+		return false;
+	}
+
+	const float HalfChord = FMath::Sqrt(RadiusSq - DistSq);
+	float Distance = Projection - HalfChord;
+	if (Distance < 0.0f)
+	{
+		// Origin inside the sphere
+		Distance = 0.0f;
+		if (Projection + HalfChord < 0.0f)
+		{
+			return false;
+		}
+	}
+	if (Distance > Length)
+	{
+		return false;
+	}
+
+	OutDistance = Distance;
+	return true;
+}
+
+bool FSuspenseCoreHitboxHistory::RaycastAtTime(double Time, const FVector& Start, const FVector& End,
+	FSuspenseCoreHitboxRayHit& OutHit, TArray<FVector3f>& Scratch) const
+{
+	if (Count == 0)
+	{
+		return false;
+	}
+
+	const FVector3f Origin(Start);
+	const FVector3f Delta(End - Start);
+	const float Length = Delta.Size();
+	if (Length <= UE_KINDA_SMALL_NUMBER)
+	{
+		return false;
+	}
+	const FVector3f Dir = Delta / Length;
+
+	int32 SlotA, SlotB;
+	float Alpha;
+	Bracket(Time, SlotA, SlotB, Alpha);
+
+	// Broadphase before touching per-hitbox data; most rays miss most characters
+	float Distance = 0.0f;
+	const FVector3f BoundsC = FMath::Lerp(BoundsCenter[SlotA], BoundsCenter[SlotB], Alpha);
+	const float BoundsR = FMath::Max(BoundsRadius[SlotA], BoundsRadius[SlotB]);
+	if (!RaySphere(Origin, Dir, Length, BoundsC, BoundsR, Distance))
+	{
+		return false;
+	}
+
+	LerpCenters(SlotA, SlotB, Alpha, Scratch);
+
+	float Best = Length;
+	int32 BestBox = INDEX_NONE;
+	for (int32 Box = 0; Box < Scratch.Num(); ++Box)
+	{
+		if (RaySphere(Origin, Dir, Best, Scratch[Box], Radii[Box], Distance) && Distance < Best)
+		{
+			Best = Distance;
+			BestBox = Box;
+		}
+	}
+
+	if (BestBox == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const FVector3f Impact = Origin + Dir * Best;
+	OutHit.Time = Best / Length;
+	OutHit.Hitbox = BestBox;
+	OutHit.ImpactPoint = FVector(Impact);
+	OutHit.ImpactNormal = FVector((Impact - Scratch[BestBox]).GetSafeNormal());
+	return true;
+}
+
+void FSuspenseCoreHitboxHistory::Reset()
+{
+	Head = 0;
+	Count = 0;
+}
+
+double FSuspenseCoreHitboxHistory::OldestTime() const
+{
+	return Count > 0 ? SampleTimes[Slot(0)] : 0.0;
+}
+
+double FSuspenseCoreHitboxHistory::NewestTime() const
+{
+	return Count > 0 ? SampleTimes[Slot(Count - 1)] : 0.0;
+}
+
+SIZE_T FSuspenseCoreHitboxHistory::GetAllocatedSize() const
+{
+	return SampleTimes.GetAllocatedSize()
+		+ BoundsCenter.GetAllocatedSize()
+		+ BoundsRadius.GetAllocatedSize()
+		+ CenterX.GetAllocatedSize()
+		+ CenterY.GetAllocatedSize()
+		+ CenterZ.GetAllocatedSize()
+		+ Radii.GetAllocatedSize();
+}
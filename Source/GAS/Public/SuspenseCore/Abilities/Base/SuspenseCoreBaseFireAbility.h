@@ -634,10 +634,30 @@ protected:
 	bool ValidateShotRequest(const FWeaponShotParams& ShotRequest) const;
 
 	/**
-	 * Process shot trace on server.
+	 * Process shot trace on server (synchronous).
+	 * Fallback when the world has no USuspenseCoreShotTraceSubsystem.
 	 */
 	void ServerProcessShotTrace(const FWeaponShotParams& ShotRequest, FSuspenseCoreShotResult& OutResult);
 
+	/**
+	 * Queue the shot's hit trace in this frame's async batch.
+	 * Damage (and the client result, if bNotifyClient) is applied when the trace completes.
+	 */
+	void ServerSubmitShotTrace(const FWeaponShotParams& ShotRequest, bool bNotifyClient);
+
+	/**
+	 * Apply damage for a finished server trace and optionally confirm it to the owning client.
+	 * Character hits are re-tested against lag-compensated poses at Result.Timestamp first.
+	 */
+	void HandleServerShotTraceResult(float BaseDamage, const FVector& TraceStart, const FVector& TraceEnd,
+		FSuspenseCoreShotResult& Result, bool bNotifyClient);
+
+	/** Replicated server clock (GameState), local world time without one. Used for shot timestamps */
+	float GetServerWorldTime() const;
+
+	/** Deterministic trace end for a shot request (spread seeded by timestamp) */
+	FVector CalculateServerTraceEnd(const FWeaponShotParams& ShotRequest) const;
+
 	/**
 	 * Apply damage to hit targets.
 	 */
@@ -24,6 +24,12 @@ class USuspenseCoreEventBus;
  * - Автоматическая публикация событий при изменении атрибутов
  * - Поддержка GameplayTags для идентификации событий
  * - Интеграция с SuspenseCoreEventManager
+ *
+ * Коалесцирование атрибутов:
+ * - Изменения копятся до конца кадра (OnWorldPostActorTick): одно событие
+ *   на атрибут за кадр, OldValue — до первого изменения, NewValue — после последнего
+ * - ImmediateAttributeEvents / suspensecore.gas.coalesce_attribute_events 0 — публикация сразу
+ * - PublishCriticalEvent сначала сбрасывает накопленное (порядок событий сохраняется)
  */
 UCLASS(ClassGroup = "SuspenseCore", meta = (BlueprintSpawnableComponent))
 class GAS_API USuspenseCoreAbilitySystemComponent : public UAbilitySystemComponent
@@ -57,6 +63,7 @@ public:
 	/**
 	 * Публиковать событие при изменении атрибута.
 	 * Вызывается автоматически из AttributeSet.
+	 * Событие уходит в конце кадра, одно на атрибут (см. bCoalesceAttributeEvents).
 	 */
 	void PublishAttributeChangeEvent(
 		const FGameplayAttribute& Attribute,
@@ -64,6 +71,11 @@ public:
 		float NewValue
 	);
 
+	/**
+	 * Опубликовать накопленные за кадр изменения атрибутов немедленно.
+	 */
+	void FlushAttributeChangeEvents();
+
 	/**
 	 * Публиковать событие при критическом изменении (смерть, низкое здоровье).
 	 */
@@ -135,6 +147,14 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "SuspenseCore|Events")
 	bool bPublishAttributeEvents = true;
 
+	/** Одно событие на атрибут за кадр вместо события на каждое изменение */
+	UPROPERTY(EditDefaultsOnly, Category = "SuspenseCore|Events")
+	bool bCoalesceAttributeEvents = true;
+
+	/** Атрибуты, события которых публикуются сразу (для gameplay-критичных слушателей) */
+	UPROPERTY(EditDefaultsOnly, Category = "SuspenseCore|Events")
+	TArray<FGameplayAttribute> ImmediateAttributeEvents;
+
 	/** Кэшированный EventBus */
 	mutable TWeakObjectPtr<USuspenseCoreEventBus> CachedEventBus;
 
@@ -147,4 +167,25 @@ protected:
 	 * Отписаться от EventBus.
 	 */
 	virtual void TeardownEventBusSubscriptions();
+
+private:
+	/** Изменение атрибута, ожидающее публикации в конце кадра */
+	struct FPendingAttributeChange
+	{
+		FGameplayAttribute Attribute;
+		float OldValue = 0.0f;
+		float NewValue = 0.0f;
+		int32 NumChanges = 0;
+	};
+
+	/** Грязные атрибуты текущего кадра (обычно 1-3, линейный поиск) */
+	TArray<FPendingAttributeChange> PendingAttributeChanges;
+
+	/** Подписка на OnWorldPostActorTick, только пока есть грязные атрибуты */
+	FDelegateHandle PostActorTickHandle;
+
+	void OnWorldPostActorTick(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	/** Собрать и отправить одно событие атрибута */
+	void BroadcastAttributeEvent(const FGameplayAttribute& Attribute, float OldValue, float NewValue, int32 NumChanges);
 };
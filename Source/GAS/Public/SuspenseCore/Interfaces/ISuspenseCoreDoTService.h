@@ -111,6 +111,8 @@ public:
 
 	/**
 	 * Notify service of DoT removal
+	 * Drops the manual entry of this type and any ASC-mirrored entry whose effect is
+	 * no longer active (call after RemoveActiveEffectsWithGrantedTags)
 	 * @param bExpired true if naturally expired, false if healed
 	 */
 	virtual void NotifyDoTRemoved(
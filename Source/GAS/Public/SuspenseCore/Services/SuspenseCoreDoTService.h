@@ -15,12 +15,23 @@
 // - OnAnyGameplayEffectRemovedDelegate
 // This eliminates state duplication and ensures consistency.
 //
+// STORAGE (v3.0):
+// Active DoTs (ASC-mirrored and manual) live in one FSuspenseCoreDoTTable:
+// dense SoA entries + per-target type bitmask. Queries read the table
+// (HasActiveBleeding = one bit test), durations and tick times advance in one
+// linear sweep per frame instead of a timer walking a map of arrays.
+// Targets are tracked on first query/notify; their ASC is mirrored silently
+// (no events) unless BindToASC was called.
+//
 // USAGE:
 // 1. Character calls BindToASC() when ASC is initialized
 // 2. Service auto-tracks all DoT effects via ASC delegates
 // 3. Query via interface: Service->HasActiveBleeding(Actor)
 // 4. UI subscribes to EventBus (Event.DoT.Applied, etc.)
 //
+// Console (non-shipping):
+//   SuspenseCore.DoT.Bench [Targets=200] [DoTsPerTarget=5] [Frames=600]
+//
 // FLOW:
 // ASC::ApplyGE → ASC Delegate → DoTService::OnEffectAdded → EventBus → UI
 
@@ -33,6 +44,8 @@
 #include "ActiveGameplayEffectHandle.h"
 #include "SuspenseCore/Types/SuspenseCoreTypes.h"
 #include "SuspenseCore/Interfaces/ISuspenseCoreDoTService.h"
+#include "SuspenseCore/Services/SuspenseCoreDoTTable.h"
+#include "Containers/Ticker.h"
 #include "SuspenseCoreDoTService.generated.h"
 
 // Forward declarations
@@ -123,6 +136,9 @@ struct FSuspenseCoreASCBinding
 	FDelegateHandle OnEffectAddedHandle;
 	FDelegateHandle OnEffectRemovedHandle;
 	FDelegateHandle OnEffectStackChangedHandle;
+
+	/** false = mirror into the DoT table only (auto-tracked target, no EventBus traffic) */
+	bool bPublishEvents = true;
 };
 
 /**
@@ -218,6 +234,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "SuspenseCore|DoT")
 	float BP_GetBurnTimeRemaining(AActor* Target) const { return GetBurnTimeRemaining(Target); }
 
+	// ═══════════════════════════════════════════════════════════════════
+	// DIAGNOSTICS
+	// ═══════════════════════════════════════════════════════════════════
+
+	/** Entries in the DoT table (ASC-mirrored + manual) */
+	int32 GetNumTrackedDoTs() const { return DoTTable.Num(); }
+
+	/**
+	 * Synthetic benchmark: NumTargets x DoTsPerTarget entries, NumFrames sweeps + per-target
+	 * bleeding/burning queries, against the previous map-of-arrays rebuild-per-query path.
+	 * @return Human readable report
+	 */
+	static FString RunBenchmark(int32 NumTargets, int32 DoTsPerTarget, int32 NumFrames);
+
 protected:
 	// ═══════════════════════════════════════════════════════════════════
 	// ASC DELEGATE HANDLERS
@@ -300,6 +330,55 @@ protected:
 	 */
 	void InitializeEventBus();
 
+	// ═══════════════════════════════════════════════════════════════════
+	// DOT TABLE
+	// ═══════════════════════════════════════════════════════════════════
+
+	/** Per table target slot */
+	struct FTrackedTarget
+	{
+		/** First actor tracked into this slot (avatar and owner of one ASC share a slot) */
+		TWeakObjectPtr<AActor> Actor;
+
+		/** ASC whose effects are mirrored into the table */
+		TWeakObjectPtr<UAbilitySystemComponent> MirroredASC;
+		bool bMirrorsASC = false;
+	};
+
+	/**
+	 * Table slot for Target, tracking it on first use.
+	 * The target's ASC (KnownASC or looked up) is bound silently and its active DoTs imported.
+	 */
+	int32 TrackTarget(AActor* Target, UAbilitySystemComponent* KnownASC = nullptr);
+
+	/** TrackTarget for const queries (tracking is a cache fill, not an observable change) */
+	int32 GetQuerySlot(AActor* Target) const;
+
+	/** Drop a target's entries, its silent ASC binding and its slot */
+	void ReleaseTarget(int32 TargetSlot);
+
+	/** Table type index for a DoT tag; refreshes the bleeding/burning masks on new types */
+	int32 RegisterDoTType(const FGameplayTag& DoTType);
+
+	/** Subscribe to ASC delegates (idempotent; upgrades a silent binding when bPublishEvents) */
+	void AddASCBinding(UAbilitySystemComponent* ASC, bool bPublishEvents);
+	const FSuspenseCoreASCBinding* FindASCBinding(const UAbilitySystemComponent* ASC) const;
+
+	/** Mirror one active ASC effect into the table (no-op for non-DoT effects or known handles) */
+	void AddASCEntry(int32 TargetSlot, const FActiveGameplayEffect& Effect);
+
+	/**
+	 * Remove the target's mirrored entries of the given types whose effect is no longer
+	 * active on the ASC (removals the ASC delegate did not report)
+	 * @return Number of entries removed
+	 */
+	int32 DropInactiveASCEntries(int32 TargetSlot, FSuspenseCoreDoTTable::FTypeMask Types);
+
+	FSuspenseCoreActiveDoT BuildDoTDataFromEntry(int32 EntryIndex) const;
+
+	/** FTSTicker callback: one table sweep per frame */
+	bool TickDoTs(float DeltaTime);
+
 private:
 	// ═══════════════════════════════════════════════════════════════════
 	// STATE
@@ -321,14 +400,35 @@ private:
 	FGameplayTag BurningRootTag;
 
 	// ═══════════════════════════════════════════════════════════════════
-	// LEGACY SUPPORT (for manual notification during transition)
+	// DOT TABLE STATE
 	// ═══════════════════════════════════════════════════════════════════
 
-	/** Manual DoT cache (legacy, for non-ASC systems) */
-	TMap<TWeakObjectPtr<AActor>, TArray<FSuspenseCoreActiveDoT>> ManualDoTCache;
+	/** All active DoTs: ASC-mirrored and manual (NotifyDoTApplied) */
+	FSuspenseCoreDoTTable DoTTable;
+
+	/** Actor -> table target slot */
+	TMap<TObjectKey<AActor>, int32> TargetSlots;
+
+	/** Mirrored ASC -> table target slot */
+	TMap<TObjectKey<UAbilitySystemComponent>, int32> ASCSlots;
+
+	/** Indexed by table target slot */
+	TArray<FTrackedTarget> TrackedTargets;
+
+	/** Registered types matching the bleeding / burning roots */
+	FSuspenseCoreDoTTable::FTypeMask BleedingMask = 0;
+	FSuspenseCoreDoTTable::FTypeMask BurningMask = 0;
+
+	/** Reused by every sweep */
+	FSuspenseCoreDoTTable::FSweepResult SweepResult;
+
+	/** Events collected by a sweep, published once ServiceLock is released (reused by every sweep) */
+	TArray<TPair<FGameplayTag, FSuspenseCoreDoTEventPayload>> SweepEvents;
+
+	FTSTicker::FDelegateHandle SweepTickerHandle;
+	double LastSweepTime = -1.0;
+	double NextCleanupTime = 0.0;
 
-	/** Timer for manual cache duration updates */
-	FTimerHandle DurationUpdateTimerHandle;
-	void OnDurationUpdateTimer();
+	/** Release targets whose actor was destroyed */
 	void CleanupStaleEntries();
 };
@@ -0,0 +1,199 @@
+// SuspenseCoreDoTTable.h
+// Dense structure-of-arrays storage for active DoT effects
+// Copyright Suspense Team. All Rights Reserved.
+//
+// LAYOUT:
+// - Entries: parallel arrays, swap-removed (order is not stable)
+//   hot:  Target, Type, NextTickTime, RemainingDuration, Stacks  (read every frame)
+//   cold: DamagePerTick, TickInterval, ApplicationTime, Source, EffectHandle, bFromASC
+// - Targets: slot per tracked actor with a bitmask of active DoT types
+//   (one bit per registered type tag, up to MaxTypes)
+// - Types: tag <-> index table, grows on first use of a tag
+//
+// PERFORMANCE:
+// - "Has any bleeding" = one AND against a precomputed type mask
+// - Expiry and tick scheduling = one linear sweep over the hot arrays
+// - Per-target iteration via a short index list, no allocation
+//
+// Owned by USuspenseCoreDoTService; has no UObject or world dependency,
+// so it can be driven directly by benchmarks.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "ActiveGameplayEffectHandle.h"
+
+/**
+ * FSuspenseCoreDoTTable
+ *
+ * THREAD SAFETY:
+ * - None; the owner serializes access
+ */
+class GAS_API FSuspenseCoreDoTTable
+{
+public:
+	/** Bits in FTypeMask */
+	static constexpr int32 MaxTypes = 32;
+	using FTypeMask = uint32;
+
+	/** Values for a new entry */
+	struct FEntryInit
+	{
+		float DamagePerTick = 0.0f;
+		float TickInterval = 1.0f;
+
+		/** Seconds left; < 0 = infinite */
+		float RemainingDuration = -1.0f;
+
+		int32 Stacks = 1;
+		float ApplicationTime = 0.0f;
+		TWeakObjectPtr<AActor> Source;
+
+		/** Set for entries mirrored from an ASC; those are never expired by Sweep */
+		FActiveGameplayEffectHandle EffectHandle;
+		bool bFromASC = false;
+	};
+
+	/** Entry indices produced by one Sweep (valid until the next mutation) */
+	struct FSweepResult
+	{
+		/** Manual entries whose tick time passed this frame */
+		TArray<int32> Ticked;
+
+		/** Manual entries whose duration ran out, descending (safe to RemoveEntry in order) */
+		TArray<int32> Expired;
+
+		void Reset()
+		{
+			Ticked.Reset();
+			Expired.Reset();
+		}
+	};
+
+	// ═══════════════════════════════════════════════════════════════════
+	// TYPES
+	// ═══════════════════════════════════════════════════════════════════
+
+	/** @return Type index, INDEX_NONE if the tag is invalid or the table is full */
+	int32 FindOrAddType(const FGameplayTag& Tag);
+	int32 FindType(const FGameplayTag& Tag) const;
+	const FGameplayTag& GetTypeTag(int32 TypeIndex) const { return TypeTags[TypeIndex]; }
+	int32 NumTypes() const { return TypeTags.Num(); }
+
+	/** Mask of registered types whose tag matches Tag (hierarchical, like MatchesTag) */
+	FTypeMask GetTypesMatching(const FGameplayTag& Tag) const;
+
+	// ═══════════════════════════════════════════════════════════════════
+	// TARGETS
+	// ═══════════════════════════════════════════════════════════════════
+
+	/** Allocate a target slot (reuses freed slots) */
+	int32 AddTarget();
+
+	/** Remove every entry of the target and free its slot */
+	void RemoveTarget(int32 TargetSlot);
+
+	bool IsValidTarget(int32 TargetSlot) const { return Targets.IsValidIndex(TargetSlot) && Targets[TargetSlot].bInUse; }
+
+	/** Types with at least one entry (ASC or manual) */
+	FTypeMask GetTargetMask(int32 TargetSlot) const { return Targets[TargetSlot].AscMask | Targets[TargetSlot].ManualMask; }
+	FTypeMask GetTargetAscMask(int32 TargetSlot) const { return Targets[TargetSlot].AscMask; }
+	FTypeMask GetTargetManualMask(int32 TargetSlot) const { return Targets[TargetSlot].ManualMask; }
+
+	/** Entry indices of the target */
+	TConstArrayView<int32> GetTargetEntries(int32 TargetSlot) const { return Targets[TargetSlot].Entries; }
+
+	int32 NumTargets() const { return Targets.Num() - FreeTargets.Num(); }
+
+	// ═══════════════════════════════════════════════════════════════════
+	// ENTRIES
+	// ═══════════════════════════════════════════════════════════════════
+
+	/** @return Entry index */
+	int32 AddEntry(int32 TargetSlot, int32 TypeIndex, double Now, const FEntryInit& Init);
+
+	/** Swap-remove: the last entry moves into EntryIndex */
+	void RemoveEntry(int32 EntryIndex);
+
+	/** Manual entry of the given type on the target (at most one per type) */
+	int32 FindManualEntry(int32 TargetSlot, int32 TypeIndex) const;
+
+	/** ASC-mirrored entry with the given handle */
+	int32 FindEntryByHandle(int32 TargetSlot, FActiveGameplayEffectHandle Handle) const;
+
+	/** Overwrite a manual entry (re-application refreshes duration and tick phase) */
+	void ResetEntry(int32 EntryIndex, double Now, const FEntryInit& Init);
+
+	int32 Num() const { return EntryTarget.Num(); }
+
+	int32 GetTarget(int32 EntryIndex) const { return EntryTarget[EntryIndex]; }
+	int32 GetType(int32 EntryIndex) const { return EntryType[EntryIndex]; }
+	double GetNextTickTime(int32 EntryIndex) const { return NextTickTime[EntryIndex]; }
+	float GetRemainingDuration(int32 EntryIndex) const { return RemainingDuration[EntryIndex]; }
+	int32 GetStacks(int32 EntryIndex) const { return Stacks[EntryIndex]; }
+	float GetDamagePerTick(int32 EntryIndex) const { return DamagePerTick[EntryIndex]; }
+	float GetTickInterval(int32 EntryIndex) const { return TickInterval[EntryIndex]; }
+	float GetApplicationTime(int32 EntryIndex) const { return ApplicationTime[EntryIndex]; }
+	const TWeakObjectPtr<AActor>& GetSource(int32 EntryIndex) const { return Source[EntryIndex]; }
+	FActiveGameplayEffectHandle GetEffectHandle(int32 EntryIndex) const { return EffectHandle[EntryIndex]; }
+	bool IsFromASC(int32 EntryIndex) const { return bFromASC[EntryIndex] != 0; }
+
+	/** ASC entries are refreshed from the effect when read */
+	void SetStacks(int32 EntryIndex, int32 InStacks) { Stacks[EntryIndex] = InStacks; }
+	void SetRemainingDuration(int32 EntryIndex, float Remaining) { RemainingDuration[EntryIndex] = Remaining; }
+
+	// ═══════════════════════════════════════════════════════════════════
+	// FRAME UPDATE
+	// ═══════════════════════════════════════════════════════════════════
+
+	/**
+	 * Advance every entry by DeltaSeconds in one pass: count down durations,
+	 * step tick times past Now. Entries are not removed here; the caller
+	 * publishes events for OutResult.Expired and then removes them.
+	 * ASC entries are clamped at zero and wait for their effect's removal.
+	 */
+	void Sweep(double Now, float DeltaSeconds, FSweepResult& OutResult);
+
+	void Reset();
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FTargetState
+	{
+		FTypeMask AscMask = 0;
+		FTypeMask ManualMask = 0;
+
+		/** ASC entries per type (an ASC may hold several effects of one type) */
+		uint8 AscCounts[MaxTypes] = {};
+
+		TArray<int32, TInlineAllocator<4>> Entries;
+		bool bInUse = false;
+	};
+
+	void LinkEntry(int32 TargetSlot, int32 EntryIndex, int32 TypeIndex, bool bASC);
+	void UnlinkEntry(int32 EntryIndex);
+
+	// Types
+	TArray<FGameplayTag, TInlineAllocator<MaxTypes>> TypeTags;
+
+	// Targets
+	TArray<FTargetState> Targets;
+	TArray<int32> FreeTargets;
+
+	// Entries - hot
+	TArray<int32> EntryTarget;
+	TArray<uint8> EntryType;
+	TArray<double> NextTickTime;
+	TArray<float> RemainingDuration;
+	TArray<int32> Stacks;
+
+	// Entries - cold
+	TArray<float> DamagePerTick;
+	TArray<float> TickInterval;
+	TArray<float> ApplicationTime;
+	TArray<TWeakObjectPtr<AActor>> Source;
+	TArray<FActiveGameplayEffectHandle> EffectHandle;
+	TArray<uint8> bFromASC;
+};
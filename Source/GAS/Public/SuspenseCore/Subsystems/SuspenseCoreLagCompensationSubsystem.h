@@ -0,0 +1,146 @@
+// SuspenseCoreLagCompensationSubsystem.h
+// SuspenseCore - Server-Side Lag Compensation
+// Copyright Suspense Team. All Rights Reserved.
+//
+// Records a short hitbox history for every character on the server and
+// re-tests shots against the poses targets had at the client's fire time,
+// instead of against their current server pose.
+//
+// Usage (after the server hit trace):
+//   if (USuspenseCoreLagCompensationSubsystem* LagComp = USuspenseCoreLagCompensationSubsystem::Get(this))
+//   {
+//       LagComp->ResolveShot(TraceStart, TraceEnd, ShotTimestamp, Instigator, Hits);
+//   }
+//
+// CVars:
+//   suspensecore.lagcomp.enabled     0 = validate against the current pose
+//   suspensecore.lagcomp.sample_hz   History sample rate (default 30)
+//   suspensecore.lagcomp.history_ms  Rewind window; older shots are clamped (default 1000)
+//
+// Console (non-shipping):
+//   SuspenseCore.Weapon.BenchLagCompensation [Characters] [HistoryMs] [Shots]
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/HitResult.h"
+#include "SuspenseCore/Utils/SuspenseCoreHitboxHistory.h"
+#include "SuspenseCoreLagCompensationSubsystem.generated.h"
+
+class ACharacter;
+
+/**
+ * USuspenseCoreLagCompensationSubsystem
+ *
+ * FLOW:
+ * 1. Characters are tracked from spawn (server / standalone only)
+ * 2. Tick samples every tracked character's hitbox bones at a fixed rate
+ *    into its FSuspenseCoreHitboxHistory ring
+ * 3. ResolveShot replaces current-pose character hits in a trace result with
+ *    the hit against the rewound, interpolated pose
+ *
+ * HITBOXES:
+ * - Spheres on mannequin bones (head, neck, spine, pelvis, limbs)
+ * - Meshes without those bones fall back to three spheres along the capsule
+ *
+ * MEMORY:
+ * - Bounded per character: (HistoryMs * SampleHz / 1000 + 2) samples,
+ *   see FSuspenseCoreHitboxHistory for the per-sample cost
+ *
+ * THREAD SAFETY:
+ * - GameThread only
+ */
+UCLASS()
+class GAS_API USuspenseCoreLagCompensationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//========================================================================
+	// Subsystem Lifecycle
+	//========================================================================
+
+	virtual void Deinitialize() override;
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Get subsystem for the world of the context object */
+	static USuspenseCoreLagCompensationSubsystem* Get(const UObject* WorldContextObject);
+
+	//========================================================================
+	// Public API
+	//========================================================================
+
+	/**
+	 * Re-test a finished hit trace against rewound character poses.
+	 * Character hits from the current pose are dropped; the closest rewound
+	 * hitbox in front of the first world blocking hit is added as the blocking hit.
+	 * Characters without history older than ShotTime keep their current-pose hits.
+	 *
+	 * @param ShotTime  Client fire time on the server clock (GameState server world time)
+	 * @return true if InOutHits was changed
+	 */
+	bool ResolveShot(const FVector& TraceStart, const FVector& TraceEnd, double ShotTime,
+		const AActor* Instigator, TArray<FHitResult>& InOutHits) const;
+
+	/** Start/stop recording a character (spawned characters are tracked automatically) */
+	void TrackCharacter(ACharacter* Character);
+	void UntrackCharacter(ACharacter* Character);
+
+	int32 GetNumTrackedCharacters() const { return Tracked.Num(); }
+
+	/** Bytes held by all histories */
+	SIZE_T GetHistoryMemoryBytes() const;
+
+	/**
+	 * Synthetic benchmark: NumCharacters histories of HistoryMs at the current sample rate,
+	 * then NumShots rays, each rewound against every character at a random time in the window.
+	 * @return Human readable report
+	 */
+	static FString RunBenchmark(int32 NumCharacters, int32 HistoryMs, int32 NumShots);
+
+protected:
+	struct FTrackedCharacter
+	{
+		TWeakObjectPtr<ACharacter> Character;
+
+		/** Mesh the bone indices were resolved against */
+		TWeakObjectPtr<const UObject> ResolvedAsset;
+
+		/** Bone index per hitbox; empty = capsule fallback */
+		TArray<int32> BoneIndices;
+
+		/** Bone name reported in hit results, per hitbox */
+		TArray<FName> HitboxNames;
+
+		FSuspenseCoreHitboxHistory History;
+	};
+
+	/** Bind hitboxes to the character's current mesh and (re)allocate history */
+	void SetupHitboxes(FTrackedCharacter& Entry) const;
+
+	/** Record one sample for every tracked character */
+	void SampleAll(double Time);
+
+	void OnActorSpawned(AActor* Actor);
+
+	/** Samples per history for the current CVars */
+	static int32 GetHistoryCapacity();
+
+private:
+	TArray<FTrackedCharacter> Tracked;
+
+	/** Reused per sample / per ray */
+	TArray<FVector3f> PoseScratch;
+	mutable TArray<FVector3f> RayScratch;
+
+	double NextSampleTime = 0.0;
+
+	/** Capacity the histories were allocated with; CVar changes reallocate */
+	int32 AllocatedCapacity = 0;
+
+	FDelegateHandle ActorSpawnedHandle;
+};
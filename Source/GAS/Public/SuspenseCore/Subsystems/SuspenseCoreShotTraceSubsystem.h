@@ -0,0 +1,172 @@
+// SuspenseCoreShotTraceSubsystem.h
+// SuspenseCore - Batched Async Shot Traces
+// Copyright Suspense Team. All Rights Reserved.
+//
+// Collects hit traces requested during a frame and issues them as async
+// line traces in one batch. Results come back on the next frame and are
+// handed to callers from a completion queue, in submission order.
+//
+// Usage:
+//   if (USuspenseCoreShotTraceSubsystem* Traces = USuspenseCoreShotTraceSubsystem::Get(this))
+//   {
+//       FSuspenseCoreShotTraceRequest Request;
+//       Request.Start = Muzzle;
+//       Request.Ends.Add(End);
+//       Traces->SubmitShot(MoveTemp(Request),
+//           FSuspenseCoreShotTraceCompleted::CreateWeakLambda(this, [](const TArray<FHitResult>& Hits, bool bBlocking) {}));
+//   }
+//
+// CVars:
+//   suspensecore.weapon.async_server_traces  0 = trace synchronously inside SubmitShot
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "WorldCollision.h"
+#include "SuspenseCoreShotTraceSubsystem.generated.h"
+
+/**
+ * Fired once per shot when all of its traces are done.
+ * Hits of every pellet are concatenated; a pellet with no hit contributes one miss result at its end point.
+ */
+DECLARE_DELEGATE_TwoParams(FSuspenseCoreShotTraceCompleted, const TArray<FHitResult>& /*Hits*/, bool /*bHadBlockingHit*/);
+
+/**
+ * One shot: common start, one end point per pellet.
+ */
+struct GAS_API FSuspenseCoreShotTraceRequest
+{
+	/** World context and first ignored actor */
+	TWeakObjectPtr<AActor> Instigator;
+
+	/** Extra actors to ignore (instigator is always ignored) */
+	TArray<TWeakObjectPtr<AActor>, TInlineAllocator<2>> IgnoreActors;
+
+	FVector Start = FVector::ZeroVector;
+
+	/** Trace end per pellet */
+	TArray<FVector, TInlineAllocator<1>> Ends;
+
+	/** Collision profile for the trace */
+	FName TraceProfile;
+
+	/** Draw result when it arrives */
+	bool bDebug = false;
+	float DebugDrawTime = 2.0f;
+};
+
+/**
+ * Per-frame counters (reset every tick)
+ */
+struct GAS_API FSuspenseCoreShotTraceFrameStats
+{
+	/** Line traces issued this frame */
+	int32 TracesIssued = 0;
+
+	/** Shots flushed in this frame's batch */
+	int32 BatchSize = 0;
+
+	/** Shots whose callbacks ran this frame */
+	int32 ShotsCompleted = 0;
+
+	/** Submit -> callback latency of the shots completed this frame, ms */
+	float AvgLatencyMs = 0.0f;
+	float MaxLatencyMs = 0.0f;
+};
+
+/**
+ * USuspenseCoreShotTraceSubsystem
+ *
+ * Server-side shot trace scheduler for fire abilities and weapon trace tasks.
+ *
+ * FRAME FLOW:
+ * 1. SubmitShot queues the shot (no physics work on the caller's stack)
+ * 2. Tick runs callbacks for shots whose traces finished, then flushes this
+ *    frame's queue as AsyncLineTraceByProfile calls
+ * 3. The engine runs the batch on worker threads; results land at the start of the next frame
+ *
+ * THREAD SAFETY:
+ * - GameThread only
+ */
+UCLASS()
+class GAS_API USuspenseCoreShotTraceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//========================================================================
+	// Subsystem Lifecycle
+	//========================================================================
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Get subsystem for the world of the context object */
+	static USuspenseCoreShotTraceSubsystem* Get(const UObject* WorldContextObject);
+
+	//========================================================================
+	// Public API
+	//========================================================================
+
+	/**
+	 * Queue a shot for this frame's batch.
+	 * OnCompleted runs from Tick on a later frame, or inline when async traces are disabled.
+	 * @return Shot id (0 if the request was empty)
+	 */
+	uint32 SubmitShot(FSuspenseCoreShotTraceRequest&& Request, FSuspenseCoreShotTraceCompleted&& OnCompleted);
+
+	/** Counters of the last completed tick */
+	const FSuspenseCoreShotTraceFrameStats& GetLastFrameStats() const { return LastFrameStats; }
+
+	/** Shots queued or in flight */
+	int32 GetNumOutstandingShots() const { return Queued.Num() + InFlight.Num(); }
+
+protected:
+	struct FShotState
+	{
+		FSuspenseCoreShotTraceRequest Request;
+		FSuspenseCoreShotTraceCompleted OnCompleted;
+		TArray<FHitResult> Hits;
+		int32 PendingTraces = 0;
+		bool bHadBlockingHit = false;
+		uint64 SubmitCycles = 0;
+	};
+
+	/** Issue async traces for everything queued this frame */
+	void FlushQueued();
+
+	/** Run callbacks of finished shots, oldest first */
+	void DrainCompleted();
+
+	/** FTraceDelegate target; UserData carries the shot id */
+	void OnTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	/** Synchronous path (CVar off / no world) */
+	void TraceNow(FShotState& Shot);
+
+	void FinishShot(FShotState& Shot);
+
+	static FCollisionQueryParams MakeQueryParams(const FSuspenseCoreShotTraceRequest& Request);
+
+private:
+	/** Submitted this frame, not issued yet */
+	TArray<uint32> Queued;
+
+	/** Every queued or in-flight shot */
+	TMap<uint32, FShotState> InFlight;
+
+	/** Shots whose last trace arrived; drained next Tick */
+	TArray<uint32> Completed;
+
+	FTraceDelegate TraceDelegate;
+
+	uint32 NextShotId = 1;
+
+	FSuspenseCoreShotTraceFrameStats FrameStats;
+	FSuspenseCoreShotTraceFrameStats LastFrameStats;
+};
@@ -64,6 +64,10 @@ struct GAS_API FSuspenseCoreWeaponTraceConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace")
 	float OverrideMaxRange;
 
+	/** Route traces through USuspenseCoreShotTraceSubsystem (batched async, OnCompleted fires a frame later) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trace")
+	bool bBatchedAsync;
+
 	FSuspenseCoreWeaponTraceConfig()
 		: bUseMuzzleToScreenCenter(true)
 		, bDebug(false)
@@ -72,6 +76,7 @@ struct GAS_API FSuspenseCoreWeaponTraceConfig
 		, OverrideNumTraces(0)
 		, OverrideSpreadAngle(-1.0f)
 		, OverrideMaxRange(-1.0f)
+		, bBatchedAsync(false)
 	{
 	}
 };
@@ -137,6 +142,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(
  * - Spread modifiers based on player state
  * - Configurable via weapon attributes or overrides
  * - Debug visualization support
+ * - Optional batched async mode (USuspenseCoreShotTraceSubsystem)
  *
  * Note: This task is for VISUALS ONLY. Damage is handled server-side
  * in the fire ability using authoritative traces.
@@ -190,7 +196,8 @@ public:
 	static USuspenseCoreWeaponAsyncTask_PerformTrace* PerformWeaponTraceFromRequest(
 		UGameplayAbility* OwningAbility,
 		const FWeaponShotParams& ShotRequest,
-		bool bDebug = false
+		bool bDebug = false,
+		bool bBatchedAsync = false
 	);
 
 	//========================================================================
@@ -224,6 +231,13 @@ protected:
 	/** Calculate spread modifiers based on player state */
 	float CalculateSpreadModifier() const;
 
+	/**
+	 * Trace Start -> each end, fill Result, broadcast and end the task.
+	 * Synchronous, or through the shot trace subsystem when Config.bBatchedAsync is set.
+	 */
+	void DispatchTraces(AActor* AvatarActor, const TArray<AActor*>& ActorsToIgnore,
+		const FVector& Start, const TArray<FVector>& Ends, FSuspenseCoreWeaponTraceResult&& Result);
+
 private:
 	/** Trace configuration */
 	UPROPERTY()
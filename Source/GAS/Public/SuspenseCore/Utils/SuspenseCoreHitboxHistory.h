@@ -0,0 +1,118 @@
+// SuspenseCoreHitboxHistory.h
+// SuspenseCore - Lag Compensation Hitbox History
+// Copyright Suspense Team. All Rights Reserved.
+//
+// Fixed-capacity ring of past hitbox poses for one character, used by the
+// server to rewind targets to the time a client fired.
+//
+// LAYOUT (SoA):
+// - One time stamp and one bounding sphere per sample
+// - Hitbox centers stored as separate X/Y/Z float planes, sample-major
+//   ([Sample * NumHitboxes + Hitbox]), so interpolating a pose is three
+//   straight lerp loops over contiguous floats
+// - Radii are per hitbox, not per sample
+//
+// Memory: Capacity * (8 + 16 + NumHitboxes * 12) bytes, fixed at Initialize.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Closest hitbox a ray hits in a rewound pose
+ */
+struct GAS_API FSuspenseCoreHitboxRayHit
+{
+	/** Distance along the ray (0..1 of Start->End) */
+	float Time = 1.0f;
+
+	/** Hitbox index into the owner's hitbox list */
+	int32 Hitbox = INDEX_NONE;
+
+	FVector ImpactPoint = FVector::ZeroVector;
+	FVector ImpactNormal = FVector::ZeroVector;
+
+	bool IsValid() const { return Hitbox != INDEX_NONE; }
+};
+
+/**
+ * FSuspenseCoreHitboxHistory
+ *
+ * Hitboxes are spheres. A sample is recorded at a fixed rate by the owner;
+ * Rewind() interpolates between the two samples bracketing the requested time.
+ *
+ * THREAD SAFETY:
+ * - GameThread only (owned by USuspenseCoreLagCompensationSubsystem)
+ */
+class GAS_API FSuspenseCoreHitboxHistory
+{
+public:
+	/** Allocate storage. Drops any recorded samples */
+	void Initialize(int32 InCapacity, TConstArrayView<float> InRadii);
+
+	/**
+	 * Record a pose as the newest sample (overwrites the oldest when full).
+	 * Times must be increasing.
+	 */
+	void Record(double Time, TConstArrayView<FVector3f> Centers);
+
+	/**
+	 * Pose at Time, interpolated between bracketing samples.
+	 * Time is clamped to the recorded range.
+	 * @return false if nothing is recorded
+	 */
+	bool Rewind(double Time, TArray<FVector3f>& OutCenters, FVector3f& OutBoundsCenter, float& OutBoundsRadius) const;
+
+	/**
+	 * Ray test against the pose at Time.
+	 * Broadphase on the interpolated bounding sphere, then every hitbox sphere.
+	 * Scratch is reused between calls to avoid allocation.
+	 */
+	bool RaycastAtTime(double Time, const FVector& Start, const FVector& End,
+		FSuspenseCoreHitboxRayHit& OutHit, TArray<FVector3f>& Scratch) const;
+
+	void Reset();
+
+	int32 Num() const { return Count; }
+	int32 Capacity() const { return SampleTimes.Num(); }
+	int32 NumHitboxes() const { return Radii.Num(); }
+	double OldestTime() const;
+	double NewestTime() const;
+
+	/** Bytes held by this history */
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	/** Physical slot of logical sample (0 = oldest) */
+	FORCEINLINE int32 Slot(int32 Logical) const
+	{
+		const int32 Index = Head + Logical;
+		return Index >= SampleTimes.Num() ? Index - SampleTimes.Num() : Index;
+	}
+
+	/** Logical index of the newest sample with time <= Time (Count > 0, Time >= oldest) */
+	int32 FindSampleAtOrBefore(double Time) const;
+
+	/** Samples bracketing Time (clamped to the recorded range) and the blend between them */
+	void Bracket(double Time, int32& OutSlotA, int32& OutSlotB, float& OutAlpha) const;
+
+	/** Interpolated hitbox centers between two physical slots */
+	void LerpCenters(int32 SlotA, int32 SlotB, float Alpha, TArray<FVector3f>& OutCenters) const;
+
+	static bool RaySphere(const FVector3f& Origin, const FVector3f& Dir, float Length,
+		const FVector3f& Center, float Radius, float& OutDistance);
+
+	TArray<double> SampleTimes;
+	TArray<FVector3f> BoundsCenter;
+	TArray<float> BoundsRadius;
+
+	TArray<float> CenterX;
+	TArray<float> CenterY;
+	TArray<float> CenterZ;
+
+	TArray<float> Radii;
+	float MaxRadius = 0.0f;
+
+	int32 Head = 0;
+	int32 Count = 0;
+};
@@ -0,0 +1,22 @@
+using UnrealBuildTool;
+
+public class GASTests : ModuleRules
+{
+	public GASTests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine",
+				"GameplayTags",
+				"GameplayAbilities",
+				"BridgeSystem",
+				"GAS"
+			}
+		);
+	}
+}
@@ -0,0 +1,9 @@
+// GASTests.cpp
+// SuspenseCore - EventBus Architecture
+// Copyright Suspense Team. All Rights Reserved.
+//
+// Headless automation tests for GAS (Session Frontend / -ExecCmds="Automation RunTests SuspenseCore.GAS").
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, GASTests)
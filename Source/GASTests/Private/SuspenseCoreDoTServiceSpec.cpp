@@ -0,0 +1,122 @@
+// SuspenseCoreDoTServiceSpec.cpp
+// SuspenseCore - EventBus Architecture
+// Copyright Suspense Team. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AbilitySystemComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameplayEffectComponents/AssetTagsGameplayEffectComponent.h"
+#include "GameplayEffectComponents/TargetTagsGameplayEffectComponent.h"
+#include "SuspenseCore/Effects/Grenade/GE_BleedingEffect.h"
+#include "SuspenseCore/Services/SuspenseCoreDoTService.h"
+#include "SuspenseCore/Tags/SuspenseCoreGameplayTags.h"
+
+BEGIN_DEFINE_SPEC(FSuspenseCoreDoTServiceSpec, "SuspenseCore.GAS.DoT",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+	UGameInstance* GameInstance = nullptr;
+	USuspenseCoreDoTService* Service = nullptr;
+	AActor* Target = nullptr;
+	UAbilitySystemComponent* ASC = nullptr;
+
+	/** Infinite effect typed and granted as State.Health.Bleeding.Light (the tags the service classifies by) */
+	UGameplayEffect* MakeLightBleed() const
+	{
+		UGameplayEffect* Effect = NewObject<UGameplayEffect>(GetTransientPackage());
+		Effect->DurationPolicy = EGameplayEffectDurationType::Infinite;
+
+		FInheritedTagContainer Tags;
+		Tags.Added.AddTag(SuspenseCoreTags::State::Health::BleedingLight);
+		Effect->FindOrAddComponent<UAssetTagsGameplayEffectComponent>().SetAndApplyAssetTagChanges(Tags);
+		Effect->FindOrAddComponent<UTargetTagsGameplayEffectComponent>().SetAndApplyTargetTagChanges(Tags);
+		return Effect;
+	}
+
+	/** Cure the way the medical handler does: by granted tag, then notify the service */
+	int32 CureLightBleed() const
+	{
+		FGameplayTagContainer CureTags;
+		CureTags.AddTag(SuspenseCoreTags::State::Health::BleedingLight);
+		const int32 Removed = ASC->RemoveActiveEffectsWithGrantedTags(CureTags);
+		Service->NotifyDoTRemoved(Target, SuspenseCoreTags::State::Health::BleedingLight, false);
+		return Removed;
+	}
+END_DEFINE_SPEC(FSuspenseCoreDoTServiceSpec)
+
+void FSuspenseCoreDoTServiceSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		// Standalone game instance: the service needs its subsystem collection (root tags, EventBus)
+		GameInstance = NewObject<UGameInstance>(GEngine);
+		GameInstance->InitializeStandalone();
+		Service = GameInstance->GetSubsystem<USuspenseCoreDoTService>();
+
+		Target = GameInstance->GetWorld()->SpawnActor<AActor>();
+		ASC = NewObject<UAbilitySystemComponent>(Target);
+		ASC->RegisterComponent();
+		ASC->InitAbilityActorInfo(Target, Target);
+	});
+
+	AfterEach([this]()
+	{
+		UWorld* World = GameInstance->GetWorld();
+		GameInstance->Shutdown();
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+
+		GameInstance = nullptr;
+		Service = nullptr;
+		Target = nullptr;
+		ASC = nullptr;
+	});
+
+	Describe("NotifyDoTRemoved", [this]()
+	{
+		It("should drop a mirrored bleed cured by granted tag", [this]()
+		{
+			ASC->ApplyGameplayEffectToSelf(MakeLightBleed(), 1.0f, ASC->MakeEffectContext());
+			Service->BindToASC(ASC);
+			TestTrue(TEXT("Bleeding after bind"), Service->HasActiveBleeding(Target));
+
+			// Stand-in for a removal path that skips the ASC delegate
+			ASC->OnAnyGameplayEffectRemovedDelegate().Clear();
+
+			TestEqual(TEXT("Removed"), CureLightBleed(), 1);
+			TestFalse(TEXT("Bleeding after cure"), Service->HasActiveBleeding(Target));
+			TestEqual(TEXT("DoTs after cure"), Service->GetActiveDoTCount(Target), 0);
+		});
+
+		It("should drop GE_BleedingEffect_Light cured by granted tag", [this]()
+		{
+			FGameplayEffectSpecHandle Spec = ASC->MakeOutgoingSpec(
+				UGE_BleedingEffect_Light::StaticClass(), 1.0f, ASC->MakeEffectContext());
+			Spec.Data->SetSetByCallerMagnitude(SuspenseCoreTags::Data::DoT::Bleed, 1.0f);
+			ASC->ApplyGameplayEffectSpecToSelf(*Spec.Data.Get());
+			Service->BindToASC(ASC);
+			TestEqual(TEXT("DoTs after bind"), Service->GetActiveDoTCount(Target), 1);
+
+			ASC->OnAnyGameplayEffectRemovedDelegate().Clear();
+
+			TestEqual(TEXT("Removed"), CureLightBleed(), 1);
+			TestEqual(TEXT("DoTs after cure"), Service->GetActiveDoTCount(Target), 0);
+		});
+
+		It("should keep mirrored effects that are still active", [this]()
+		{
+			ASC->ApplyGameplayEffectToSelf(MakeLightBleed(), 1.0f, ASC->MakeEffectContext());
+			Service->BindToASC(ASC);
+
+			// Notify without a cure: the effect is still on the ASC
+			Service->NotifyDoTRemoved(Target, SuspenseCoreTags::State::Health::BleedingLight, false);
+			TestTrue(TEXT("Still bleeding"), Service->HasActiveBleeding(Target));
+		});
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
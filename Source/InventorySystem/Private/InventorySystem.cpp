@@ -1,15 +1,17 @@
 ﻿#include "InventorySystem.h"
+#include "SuspenseCore/Debug/SuspenseCoreInventoryDebugger.h"
 
 #define LOCTEXT_NAMESPACE "FInventorySystemModule"
 
 void FInventorySystemModule::StartupModule()
 {
-    
+    // SuspenseCore.Inventory.* debug/self-test/benchmark commands (no-op in Shipping)
+    USuspenseCoreInventoryDebugger::RegisterConsoleCommands();
 }
 
 void FInventorySystemModule::ShutdownModule()
 {
-    
+    USuspenseCoreInventoryDebugger::UnregisterConsoleCommands();
 }
 
 #undef LOCTEXT_NAMESPACE
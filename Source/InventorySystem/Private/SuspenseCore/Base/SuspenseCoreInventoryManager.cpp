@@ -631,7 +631,10 @@ void USuspenseCoreInventoryManager::BroadcastGlobalEvent(FGameplayTag EventTag,
 	{
 		FSuspenseCoreEventData EventData;
 		EventData.Source = const_cast<USuspenseCoreInventoryManager*>(this);
-		EventData.StringPayload = Payload;
+		for (const TPair<FName, FString>& Pair : Payload)
+		{
+			EventData.SetString(Pair.Key, Pair.Value);
+		}
 		EventBus->Publish(EventTag, EventData);
 	}
 }
@@ -17,6 +17,7 @@
 #include "Net/UnrealNetwork.h"
 #include "Engine/World.h"
 #include "GameFramework/GameStateBase.h"
+#include "HAL/IConsoleManager.h"
 
 //==================================================================
 // Performance Profiling (STAT Group)
@@ -29,10 +30,19 @@ DECLARE_CYCLE_STAT(TEXT("Inventory GetUIData"), STAT_Inventory_GetUIData, STATGR
 DECLARE_CYCLE_STAT(TEXT("Inventory OnRep"), STAT_Inventory_OnRep, STATGROUP_SuspenseCore);
 DECLARE_CYCLE_STAT(TEXT("Inventory RecalculateWeight"), STAT_Inventory_RecalculateWeight, STATGROUP_SuspenseCore);
 
+#if !UE_BUILD_SHIPPING
+static TAutoConsoleVariable<int32> CVarSuspenseCoreInventoryWeightValidationInterval(
+	TEXT("suspensecore.inventory.weight_validation_interval"),
+	100,
+	TEXT("Compare the running inventory weight against a full recompute every N weight updates.\n")
+	TEXT("0: Disabled"),
+	ECVF_Default
+);
+#endif
+
 USuspenseCoreInventoryComponent::USuspenseCoreInventoryComponent()
 	: CurrentWeight(0.0f)
 	, bIsInitialized(false)
-	, bTransactionActive(false)
 	, ProviderID(FGuid::NewGuid())
 {
 	PrimaryComponentTick.bCanEverTick = false;
@@ -80,6 +90,9 @@ void USuspenseCoreInventoryComponent::PostLoad()
 {
 	Super::PostLoad();
 
+	// ItemInstances may come from serialized data - index is not saved
+	RebuildInstanceIndex();
+
 	// Check if save data needs migration
 	if (SaveDataVersion < SUSPENSECORE_INVENTORY_SAVE_VERSION)
 	{
@@ -113,6 +126,8 @@ void USuspenseCoreInventoryComponent::MigrateSaveData(int32 FromVersion, int32 T
 
 		if (MigratedCount > 0)
 		{
+			RebuildInstanceIndex();
+
 			UE_LOG(LogSuspenseCoreInventory, Log,
 				TEXT("MigrateSaveData v0->v1: Generated %d missing InstanceIDs"),
 				MigratedCount);
@@ -233,18 +248,17 @@ bool USuspenseCoreInventoryComponent::AddItemInstanceToSlot(const FSuspenseCoreI
 		return false;
 	}
 
-	// Get item data for validation (single lookup, cached for iteration)
-	FSuspenseCoreItemData ItemData;
-	USuspenseCoreDataManager* DataManager = GetDataManager();
-	if (!DataManager)
+	// Item statics for validation (cached per ItemID, no row copy)
+	FItemStatics ItemData;
+	if (!GetItemStatics(ItemInstance.ItemID, ItemData))
 	{
-		UE_LOG(LogSuspenseCoreInventory, Warning, TEXT("AddItemInstanceToSlot: DataManager is null"));
-		BroadcastErrorEvent(ESuspenseCoreInventoryResult::ItemNotFound, TEXT("DataManager not available"));
-		return false;
-	}
+		if (!GetDataManager())
+		{
+			UE_LOG(LogSuspenseCoreInventory, Warning, TEXT("AddItemInstanceToSlot: DataManager is null"));
+			BroadcastErrorEvent(ESuspenseCoreInventoryResult::ItemNotFound, TEXT("DataManager not available"));
+			return false;
+		}
 
-	if (!DataManager->GetItemData(ItemInstance.ItemID, ItemData))
-	{
 		UE_LOG(LogSuspenseCoreInventory, Warning, TEXT("AddItemInstanceToSlot: Item %s not found in DataManager"),
 			*ItemInstance.ItemID.ToString());
 		BroadcastErrorEvent(ESuspenseCoreInventoryResult::ItemNotFound,
@@ -255,25 +269,17 @@ bool USuspenseCoreInventoryComponent::AddItemInstanceToSlot(const FSuspenseCoreI
 	// Cache item weight for incremental updates
 	// For magazines: use GetWeightWithRounds() to include loaded rounds
 	// @see TarkovStyle_Ammo_System_Design.md - Magazine weight system
-	const float UnitWeight = ItemData.InventoryProps.Weight;
-	const int32 MaxStackSize = ItemData.InventoryProps.MaxStackSize;
+	const int64 UnitWeightGrams = ItemData.UnitWeightGrams;
+	const int32 MaxStackSize = ItemData.MaxStackSize;
 
 	// Calculate actual weight for this item (including magazine ammo if applicable)
-	float ActualItemWeight = UnitWeight * ItemInstance.Quantity;
-	if (ItemInstance.IsMagazine())
-	{
-		FSuspenseCoreMagazineData MagData;
-		if (DataManager->GetMagazineData(ItemInstance.MagazineData.MagazineID, MagData))
-		{
-			ActualItemWeight = MagData.GetWeightWithRounds(ItemInstance.MagazineData.CurrentRoundCount);
-		}
-	}
+	const int64 ActualItemWeightGrams = GetInstanceWeightGrams(ItemInstance);
 
-	UE_LOG(LogSuspenseCoreInventory, Log, TEXT("AddItemInstanceToSlot: ItemData loaded - GridSize=%dx%d, Weight=%.2f (ActualWeight=%.2f)"),
-		ItemData.InventoryProps.GridSize.X, ItemData.InventoryProps.GridSize.Y, UnitWeight, ActualItemWeight);
+	UE_LOG(LogSuspenseCoreInventory, Log, TEXT("AddItemInstanceToSlot: ItemData loaded - GridSize=%dx%d, Weight=%.3f (ActualWeight=%.3f)"),
+		ItemData.GridSize.X, ItemData.GridSize.Y, UnitWeightGrams / 1000.0f, ActualItemWeightGrams / 1000.0f);
 
 	// Check total weight for entire quantity
-	float TotalItemWeight = ActualItemWeight;
+	const float TotalItemWeight = ActualItemWeightGrams / 1000.0f;
 	if (CurrentWeight + TotalItemWeight > Config.MaxWeight)
 	{
 		UE_LOG(LogSuspenseCoreInventory, Warning, TEXT("AddItemInstanceToSlot: Weight exceeded (%.1f + %.1f > %.1f)"),
@@ -285,7 +291,7 @@ bool USuspenseCoreInventoryComponent::AddItemInstanceToSlot(const FSuspenseCoreI
 	}
 
 	// Check type restrictions
-	if (Config.AllowedItemTypes.Num() > 0 && !Config.AllowedItemTypes.HasTag(ItemData.Classification.ItemType))
+	if (Config.AllowedItemTypes.Num() > 0 && !Config.AllowedItemTypes.HasTag(ItemData.ItemType))
 	{
 		FString AllowedTypesStr;
 		for (const FGameplayTag& Tag : Config.AllowedItemTypes)
@@ -294,18 +300,18 @@ bool USuspenseCoreInventoryComponent::AddItemInstanceToSlot(const FSuspenseCoreI
 			AllowedTypesStr += Tag.ToString();
 		}
 		UE_LOG(LogSuspenseCoreInventory, Warning, TEXT("AddItemInstanceToSlot: Type %s not in allowed types. Allowed: [%s]"),
-			*ItemData.Classification.ItemType.ToString(), *AllowedTypesStr);
+			*ItemData.ItemType.ToString(), *AllowedTypesStr);
 		BroadcastErrorEvent(ESuspenseCoreInventoryResult::TypeNotAllowed,
-			FString::Printf(TEXT("Item type %s not allowed"), *ItemData.Classification.ItemType.ToString()));
+			FString::Printf(TEXT("Item type %s not allowed"), *ItemData.ItemType.ToString()));
 		return false;
 	}
 
-	if (Config.DisallowedItemTypes.HasTag(ItemData.Classification.ItemType))
+	if (Config.DisallowedItemTypes.HasTag(ItemData.ItemType))
 	{
 		UE_LOG(LogSuspenseCoreInventory, Warning, TEXT("AddItemInstanceToSlot: Type %s is disallowed"),
-			*ItemData.Classification.ItemType.ToString());
+			*ItemData.ItemType.ToString());
 		BroadcastErrorEvent(ESuspenseCoreInventoryResult::TypeNotAllowed,
-			FString::Printf(TEXT("Item type %s is disallowed"), *ItemData.Classification.ItemType.ToString()));
+			FString::Printf(TEXT("Item type %s is disallowed"), *ItemData.ItemType.ToString()));
 		return false;
 	}
 
@@ -324,7 +330,7 @@ bool USuspenseCoreInventoryComponent::AddItemInstanceToSlot(const FSuspenseCoreI
 		++IterationCount;
 
 		// Try auto-stacking first
-		if (Config.bAutoStack && ItemData.InventoryProps.IsStackable())
+		if (Config.bAutoStack && ItemData.IsStackable())
 		{
 			for (FSuspenseCoreItemInstance& ExistingInstance : ItemInstances)
 			{
@@ -333,6 +339,8 @@ bool USuspenseCoreInventoryComponent::AddItemInstanceToSlot(const FSuspenseCoreI
 					int32 SpaceInStack = MaxStackSize - ExistingInstance.Quantity;
 					if (SpaceInStack > 0)
 					{
+						RecordUndo(ExistingInstance.UniqueInstanceID, &ExistingInstance);
+
 						int32 ToAdd = FMath::Min(SpaceInStack, RemainingQuantity);
 						ExistingInstance.Quantity += ToAdd;
 						RemainingQuantity -= ToAdd;
@@ -342,7 +350,7 @@ bool USuspenseCoreInventoryComponent::AddItemInstanceToSlot(const FSuspenseCoreI
 						ReplicatedInventory.UpdateItem(ExistingInstance);
 
 						// Incremental weight update (O(1) instead of O(n))
-						UpdateWeightDelta(UnitWeight * ToAdd);
+						UpdateWeightDelta(UnitWeightGrams * ToAdd);
 
 						// Broadcast event
 						BroadcastItemEvent(SUSPENSE_INV_EVENT_ITEM_QTY_CHANGED, ExistingInstance, ExistingInstance.SlotIndex);
@@ -366,7 +374,7 @@ bool USuspenseCoreInventoryComponent::AddItemInstanceToSlot(const FSuspenseCoreI
 		int32 PlacementSlot = CurrentTargetSlot;
 		if (PlacementSlot == INDEX_NONE)
 		{
-			PlacementSlot = FindFreeSlot(ItemData.InventoryProps.GridSize, Config.bAllowRotation);
+			PlacementSlot = FindFreeSlot(ItemData.GridSize, Config.bAllowRotation);
 		}
 
 		if (PlacementSlot == INDEX_NONE)
@@ -388,7 +396,7 @@ bool USuspenseCoreInventoryComponent::AddItemInstanceToSlot(const FSuspenseCoreI
 		}
 
 		// Check placement validity
-		if (!CanPlaceItemAtSlot(ItemData.InventoryProps.GridSize, PlacementSlot, false))
+		if (!CanPlaceItemAtSlot(ItemData.GridSize, PlacementSlot, false))
 		{
 			if (CurrentTargetSlot != INDEX_NONE)
 			{
@@ -414,22 +422,13 @@ bool USuspenseCoreInventoryComponent::AddItemInstanceToSlot(const FSuspenseCoreI
 		NewInstance.GridPosition = SlotToGridCoords(PlacementSlot);
 
 		// Add to inventory
-		ItemInstances.Add(NewInstance);
+		AppendItemInstance(NewInstance);
 		UpdateGridSlots(NewInstance, true);
 		ReplicatedInventory.AddItem(NewInstance);
 
 		// Incremental weight update
-		// For magazines: use full weight with rounds (ActualItemWeight calculated above)
-		// Magazines don't stack so QuantityForThisStack will always be 1 for them
-		if (NewInstance.IsMagazine())
-		{
-			// Use the pre-calculated ActualItemWeight which includes ammo rounds
-			UpdateWeightDelta(ActualItemWeight);
-		}
-		else
-		{
-			UpdateWeightDelta(UnitWeight * QuantityForThisStack);
-		}
+		// For magazines: full weight with rounds (magazines don't stack, quantity is always 1)
+		UpdateWeightDelta(GetInstanceWeightGrams(NewInstance));
 
 		// Update counters
 		RemainingQuantity -= QuantityForThisStack;
@@ -503,7 +502,10 @@ bool USuspenseCoreInventoryComponent::RemoveItemByID_Implementation(FName ItemID
 			else
 			{
 				// Partial removal
+				RecordUndo(Instance.UniqueInstanceID, &Instance);
+				const int64 OldWeightGrams = GetInstanceWeightGrams(Instance);
 				Instance.Quantity -= RemainingToRemove;
+				UpdateWeightDelta(GetInstanceWeightGrams(Instance) - OldWeightGrams);
 				ReplicatedInventory.UpdateItem(Instance);
 				BroadcastItemEvent(SUSPENSE_INV_EVENT_ITEM_QTY_CHANGED, Instance, Instance.SlotIndex);
 				RemainingToRemove = 0;
@@ -511,7 +513,6 @@ bool USuspenseCoreInventoryComponent::RemoveItemByID_Implementation(FName ItemID
 		}
 	}
 
-	RecalculateWeight();
 	BroadcastInventoryUpdated();
 
 	return RemainingToRemove == 0;
@@ -597,18 +598,12 @@ int32 USuspenseCoreInventoryComponent::GetTotalItemCount_Implementation() const
 TArray<FSuspenseCoreItemInstance> USuspenseCoreInventoryComponent::FindItemsByType(FGameplayTag ItemType) const
 {
 	TArray<FSuspenseCoreItemInstance> Result;
-	USuspenseCoreDataManager* DataManager = GetDataManager();
-	if (!DataManager)
-	{
-		return Result;
-	}
-
 	for (const FSuspenseCoreItemInstance& Instance : ItemInstances)
 	{
-		FSuspenseCoreItemData ItemData;
-		if (DataManager->GetItemData(Instance.ItemID, ItemData))
+		FItemStatics ItemData;
+		if (GetItemStatics(Instance.ItemID, ItemData))
 		{
-			if (ItemData.Classification.ItemType.MatchesTag(ItemType))
+			if (ItemData.ItemType.MatchesTag(ItemType))
 			{
 				Result.Add(Instance);
 			}
@@ -646,16 +641,15 @@ bool USuspenseCoreInventoryComponent::MoveItem_Implementation(int32 FromSlot, in
 		return false;
 	}
 
-	FSuspenseCoreItemData ItemData;
-	USuspenseCoreDataManager* DataManager = GetDataManager();
-	if (!DataManager || !DataManager->GetItemData(Instance.ItemID, ItemData))
+	FItemStatics ItemData;
+	if (!GetItemStatics(Instance.ItemID, ItemData))
 	{
 		return false;
 	}
 
 	// Check if target is valid
 	bool bRotated = Instance.Rotation != 0;
-	if (!CanPlaceItemAtSlot(ItemData.InventoryProps.GridSize, ToSlot, bRotated))
+	if (!CanPlaceItemAtSlot(ItemData.GridSize, ToSlot, bRotated))
 	{
 		return false;
 	}
@@ -741,17 +735,9 @@ bool USuspenseCoreInventoryComponent::SwapItems(int32 Slot1, int32 Slot2)
 
 bool USuspenseCoreInventoryComponent::RotateItemAtSlot(int32 SlotIndex)
 {
-	FSuspenseCoreItemInstance* Instance = nullptr;
-	for (FSuspenseCoreItemInstance& Inst : ItemInstances)
-	{
-		if (Inst.SlotIndex == SlotIndex)
-		{
-			Instance = &Inst;
-			break;
-		}
-	}
-
-	if (!Instance)
+	// Only the anchor slot addresses an item for rotation
+	FSuspenseCoreItemInstance* Instance = FindItemInstanceInternal(GetInstanceIDAtSlot(SlotIndex));
+	if (!Instance || Instance->SlotIndex != SlotIndex)
 	{
 		return false;
 	}
@@ -781,7 +767,7 @@ int32 USuspenseCoreInventoryComponent::FindFreeSlot(FIntPoint ItemGridSize, bool
 {
 	SCOPE_CYCLE_COUNTER(STAT_Inventory_FindFreeSlot);
 
-	// Delegate to Storage if available (uses FreeSlotBitmap for faster queries)
+	// Delegate to Storage if available (bitboard fit search)
 	if (GridStorage && GridStorage->IsInitialized())
 	{
 		bool bRotated = false;
@@ -901,47 +887,41 @@ bool USuspenseCoreInventoryComponent::CanReceiveItem_Implementation(FName ItemID
 		return false;
 	}
 
-	USuspenseCoreDataManager* DataManager = GetDataManager();
-	if (!DataManager)
-	{
-		return false;
-	}
-
-	FSuspenseCoreItemData ItemData;
-	if (!DataManager->GetItemData(ItemID, ItemData))
+	FItemStatics ItemData;
+	if (!GetItemStatics(ItemID, ItemData))
 	{
 		return false;
 	}
 
 	// Check weight
-	float ItemWeight = ItemData.InventoryProps.Weight * Quantity;
+	float ItemWeight = (ItemData.UnitWeightGrams * Quantity) / 1000.0f;
 	if (CurrentWeight + ItemWeight > Config.MaxWeight)
 	{
 		return false;
 	}
 
 	// Check type
-	if (Config.AllowedItemTypes.Num() > 0 && !Config.AllowedItemTypes.HasTag(ItemData.Classification.ItemType))
+	if (Config.AllowedItemTypes.Num() > 0 && !Config.AllowedItemTypes.HasTag(ItemData.ItemType))
 	{
 		return false;
 	}
 
-	if (Config.DisallowedItemTypes.HasTag(ItemData.Classification.ItemType))
+	if (Config.DisallowedItemTypes.HasTag(ItemData.ItemType))
 	{
 		return false;
 	}
 
 	// Check space (simplified - just check if any slot available)
-	if (FindFreeSlot(ItemData.InventoryProps.GridSize, Config.bAllowRotation) == INDEX_NONE)
+	if (FindFreeSlot(ItemData.GridSize, Config.bAllowRotation) == INDEX_NONE)
 	{
 		// Check if can stack
-		if (ItemData.InventoryProps.IsStackable())
+		if (ItemData.IsStackable())
 		{
 			for (const FSuspenseCoreItemInstance& Instance : ItemInstances)
 			{
 				if (Instance.ItemID == ItemID)
 				{
-					int32 SpaceInStack = ItemData.InventoryProps.MaxStackSize - Instance.Quantity;
+					int32 SpaceInStack = ItemData.MaxStackSize - Instance.Quantity;
 					if (SpaceInStack >= Quantity)
 					{
 						return true;
@@ -985,6 +965,30 @@ bool USuspenseCoreInventoryComponent::ValidateIntegrity(TArray<FString>& OutErro
 		}
 	}
 
+	// Legacy mirror must follow the storage (replication and old callers still read it)
+	if (GridStorage && GridStorage->IsInitialized())
+	{
+		PRAGMA_DISABLE_DEPRECATION_WARNINGS
+		if (GridSlots_DEPRECATED.Num() != TotalSlots)
+		{
+			OutErrors.Add(FString::Printf(TEXT("Legacy grid has %d slots, storage %d"), GridSlots_DEPRECATED.Num(), TotalSlots));
+			bValid = false;
+		}
+		else
+		{
+			for (int32 SlotIndex = 0; SlotIndex < TotalSlots; ++SlotIndex)
+			{
+				if (GridSlots_DEPRECATED[SlotIndex].InstanceID != GridStorage->GetSlot(SlotIndex).InstanceID)
+				{
+					OutErrors.Add(FString::Printf(TEXT("Legacy grid slot %d out of sync with storage"), SlotIndex));
+					bValid = false;
+					break;
+				}
+			}
+		}
+		PRAGMA_ENABLE_DEPRECATION_WARNINGS
+	}
+
 	return bValid;
 }
 
@@ -994,78 +998,119 @@ bool USuspenseCoreInventoryComponent::ValidateIntegrity(TArray<FString>& OutErro
 
 void USuspenseCoreInventoryComponent::BeginTransaction()
 {
-	if (bTransactionActive)
-	{
-		UE_LOG(LogSuspenseCoreInventory, Warning, TEXT("Transaction already active"));
-		return;
-	}
-
-	TransactionSnapshot.Items = ItemInstances;
+	// Nested Begin opens a savepoint - costs nothing until something is touched
+	UndoLog.BeginSavepoint();
 
-	// Capture slot state from GridStorage (SSOT)
-	const int32 TotalSlots = GetTotalSlotCount();
-	TransactionSnapshot.Slots.SetNum(TotalSlots);
-	for (int32 i = 0; i < TotalSlots; ++i)
-	{
-		TransactionSnapshot.Slots[i] = GetGridSlot(i);
-	}
-
-	TransactionSnapshot.CurrentWeight = CurrentWeight;
-	TransactionSnapshot.SnapshotTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
-	bTransactionActive = true;
-
-	UE_LOG(LogSuspenseCoreInventory, Verbose, TEXT("Transaction started"));
+	UE_LOG(LogSuspenseCoreInventory, Verbose, TEXT("Transaction started (depth %d)"), UndoLog.GetDepth());
 }
 
 void USuspenseCoreInventoryComponent::CommitTransaction()
 {
-	if (!bTransactionActive)
+	if (!UndoLog.IsActive())
 	{
 		return;
 	}
 
-	bTransactionActive = false;
-	TransactionSnapshot = FSuspenseCoreInventorySnapshot();
+	UndoLog.ReleaseSavepoint();
 
-	UE_LOG(LogSuspenseCoreInventory, Verbose, TEXT("Transaction committed"));
+	UE_LOG(LogSuspenseCoreInventory, Verbose, TEXT("Transaction committed (depth %d)"), UndoLog.GetDepth());
 }
 
 void USuspenseCoreInventoryComponent::RollbackTransaction()
 {
-	if (!bTransactionActive)
+	if (!UndoLog.IsActive())
 	{
 		return;
 	}
 
-	ItemInstances = TransactionSnapshot.Items;
-	CurrentWeight = TransactionSnapshot.CurrentWeight;
-	bTransactionActive = false;
+	TArray<FSuspenseCoreInventoryUndoEntry> UndoEntries;
+	UndoLog.PopSavepoint(UndoEntries);
 
-	// Rebuild GridStorage from snapshot
+	TGuardValue<bool> ReplayGuard(bReplayingUndoLog, true);
 	EnsureStorageInitialized();
-	if (GridStorage && GridStorage->IsInitialized())
+	const bool bHasStorage = GridStorage && GridStorage->IsInitialized();
+
+	// 1. Lift every touched item off the grid so restored footprints can't collide
+	//    (freed cells are mirrored to the legacy array after step 3)
+	TArray<int32> LiftedSlots;
+	if (bHasStorage)
 	{
-		GridStorage->Clear();
-		for (const FSuspenseCoreItemInstance& Instance : ItemInstances)
+		for (const FSuspenseCoreInventoryUndoEntry& Entry : UndoEntries)
 		{
-			UpdateGridSlots(Instance, true);
+			LiftedSlots.Append(GridStorage->GetOccupiedSlots(Entry.InstanceID));
+			GridStorage->RemoveItem(Entry.InstanceID);
 		}
 	}
 
-	// Rebuild replicated data
-	ReplicatedInventory.ClearItems();
-	for (const FSuspenseCoreItemInstance& Instance : ItemInstances)
+	// 2. Restore pre-images (entries are newest first, one per instance)
+	//    Weight moves by exactly (pre-image - current) per touched instance
+	int64 WeightDeltaGrams = 0;
+	for (const FSuspenseCoreInventoryUndoEntry& Entry : UndoEntries)
 	{
-		ReplicatedInventory.AddItem(Instance);
+		const int32 Index = FindItemInstanceIndex(Entry.InstanceID);
+		if (Index != INDEX_NONE)
+		{
+			WeightDeltaGrams -= GetInstanceWeightGrams(ItemInstances[Index]);
+		}
+		if (Entry.bExisted)
+		{
+			WeightDeltaGrams += GetInstanceWeightGrams(Entry.PreImage);
+		}
+
+		if (!Entry.bExisted)
+		{
+			if (Index != INDEX_NONE)
+			{
+				RemoveItemInstanceAt(Index);
+			}
+			ReplicatedInventory.RemoveItem(Entry.InstanceID);
+			continue;
+		}
+
+		if (Index != INDEX_NONE)
+		{
+			ItemInstances[Index] = Entry.PreImage;
+		}
+		else
+		{
+			AppendItemInstance(Entry.PreImage);
+		}
+
+		if (ReplicatedInventory.FindItem(Entry.InstanceID))
+		{
+			ReplicatedInventory.UpdateItem(Entry.PreImage);
+		}
+		else
+		{
+			ReplicatedInventory.AddItem(Entry.PreImage);
+		}
 	}
 
+	// 3. Put restored items back on the grid
+	for (const FSuspenseCoreInventoryUndoEntry& Entry : UndoEntries)
+	{
+		if (Entry.bExisted && bHasStorage)
+		{
+			UpdateGridSlots(Entry.PreImage, true);
+		}
+		InvalidateItemUICache(Entry.InstanceID);
+	}
+
+	if (bHasStorage)
+	{
+		SyncStorageSlotsToLegacyArray(LiftedSlots);
+	}
+
+	SetTrackedWeight(TrackedWeightGrams + WeightDeltaGrams);
+
 	BroadcastInventoryUpdated();
-	UE_LOG(LogSuspenseCoreInventory, Log, TEXT("Transaction rolled back"));
+	UE_LOG(LogSuspenseCoreInventory, Log, TEXT("Transaction rolled back (%d instances restored, depth %d)"),
+		UndoEntries.Num(), UndoLog.GetDepth());
 }
 
 bool USuspenseCoreInventoryComponent::IsTransactionActive() const
 {
-	return bTransactionActive;
+	return UndoLog.IsActive();
 }
 
 //==================================================================
@@ -1092,6 +1137,25 @@ bool USuspenseCoreInventoryComponent::SplitStack(int32 SourceSlot, int32 SplitQu
 		return false;
 	}
 
+	// The split-off part must become its own stack: AddItemInstanceToSlot would
+	// auto-stack it straight back into the source, so place it directly
+	FItemStatics ItemData;
+	if (!GetItemStatics(SourceInstance.ItemID, ItemData))
+	{
+		return false;
+	}
+
+	int32 PlacementSlot = TargetSlot;
+	if (PlacementSlot == INDEX_NONE || !CanPlaceItemAtSlot(ItemData.GridSize, PlacementSlot, false))
+	{
+		PlacementSlot = FindFreeSlot(ItemData.GridSize, false);
+	}
+	if (PlacementSlot == INDEX_NONE)
+	{
+		BroadcastErrorEvent(ESuspenseCoreInventoryResult::NoSpace, TEXT("No space for split stack"));
+		return false;
+	}
+
 	// Reduce source stack
 	FSuspenseCoreItemInstance* SourcePtr = FindItemInstanceInternal(SourceInstance.UniqueInstanceID);
 	if (!SourcePtr)
@@ -1099,16 +1163,25 @@ bool USuspenseCoreInventoryComponent::SplitStack(int32 SourceSlot, int32 SplitQu
 		return false;
 	}
 
+	// The split-off part leaves the source here and is re-added (with its weight) below
+	const int64 OldWeightGrams = GetInstanceWeightGrams(*SourcePtr);
 	SourcePtr->Quantity -= SplitQuantity;
+	UpdateWeightDelta(GetInstanceWeightGrams(*SourcePtr) - OldWeightGrams);
 	ReplicatedInventory.UpdateItem(*SourcePtr);
+	BroadcastItemEvent(SUSPENSE_INV_EVENT_ITEM_QTY_CHANGED, *SourcePtr, SourcePtr->SlotIndex);
 
 	// Create new stack
 	FSuspenseCoreItemInstance NewStack = SourceInstance;
 	NewStack.UniqueInstanceID = FGuid::NewGuid();
 	NewStack.Quantity = SplitQuantity;
-	NewStack.SlotIndex = -1;
+	NewStack.SlotIndex = PlacementSlot;
+	NewStack.Rotation = 0;
+	AddItemInternal(NewStack, PlacementSlot);
+	BroadcastItemEvent(SUSPENSE_INV_EVENT_ITEM_ADDED, NewStack, PlacementSlot);
 
-	return AddItemInstanceToSlot(NewStack, TargetSlot);
+	InvalidateAllUICache();
+	BroadcastInventoryUpdated();
+	return true;
 }
 
 int32 USuspenseCoreInventoryComponent::ConsolidateStacks(FName ItemID)
@@ -1120,16 +1193,12 @@ int32 USuspenseCoreInventoryComponent::ConsolidateStacks(FName ItemID)
 		return 0;
 	}
 
-	USuspenseCoreDataManager* DataManager = GetDataManager();
-	if (!DataManager)
-	{
-		return 0;
-	}
-
 	int32 TotalConsolidated = 0;
 
-	// Build a map of ItemID -> array of instance indices for stackable items
-	TMap<FName, TArray<int32>> StackableItemGroups;
+	// Build a map of ItemID -> instance IDs for stackable items.
+	// Array positions go stale once RemoveItemInstanceAt shifts the tail down,
+	// so groups keep IDs and resolve them through InstanceIndexByID when needed.
+	TMap<FName, TArray<FGuid>> StackableItemGroups;
 
 	for (int32 i = 0; i < ItemInstances.Num(); ++i)
 	{
@@ -1142,54 +1211,64 @@ int32 USuspenseCoreInventoryComponent::ConsolidateStacks(FName ItemID)
 		}
 
 		// Check if item is stackable
-		FSuspenseCoreItemData ItemData;
-		if (!DataManager->GetItemData(Instance.ItemID, ItemData))
+		FItemStatics ItemData;
+		if (!GetItemStatics(Instance.ItemID, ItemData))
 		{
 			continue;
 		}
 
-		if (!ItemData.InventoryProps.IsStackable())
+		if (!ItemData.IsStackable())
 		{
 			continue;
 		}
 
-		StackableItemGroups.FindOrAdd(Instance.ItemID).Add(i);
+		StackableItemGroups.FindOrAdd(Instance.ItemID).Add(Instance.UniqueInstanceID);
 	}
 
 	// Process each group of stackable items
 	for (auto& Pair : StackableItemGroups)
 	{
 		const FName& CurrentItemID = Pair.Key;
-		TArray<int32>& InstanceIndices = Pair.Value;
+		TArray<FGuid>& GroupInstanceIDs = Pair.Value;
 
 		// Skip if only one stack
-		if (InstanceIndices.Num() <= 1)
+		if (GroupInstanceIDs.Num() <= 1)
 		{
 			continue;
 		}
 
 		// Get max stack size for this item
-		FSuspenseCoreItemData ItemData;
-		if (!DataManager->GetItemData(CurrentItemID, ItemData))
+		FItemStatics ItemData;
+		if (!GetItemStatics(CurrentItemID, ItemData))
 		{
 			continue;
 		}
-		const int32 MaxStackSize = ItemData.InventoryProps.MaxStackSize;
-		const float UnitWeight = ItemData.InventoryProps.Weight;
+		const int32 MaxStackSize = ItemData.MaxStackSize;
+
+		// Resolve once; pointers stay valid until the removal pass below
+		TArray<FSuspenseCoreItemInstance*> GroupInstances;
+		GroupInstances.Reserve(GroupInstanceIDs.Num());
+		for (const FGuid& GroupInstanceID : GroupInstanceIDs)
+		{
+			if (FSuspenseCoreItemInstance* Instance = FindItemInstanceInternal(GroupInstanceID))
+			{
+				GroupInstances.Add(Instance);
+			}
+		}
 
 		// Sort by quantity descending (fill larger stacks first)
-		InstanceIndices.Sort([this](int32 A, int32 B)
+		GroupInstances.Sort([](const FSuspenseCoreItemInstance& A, const FSuspenseCoreItemInstance& B)
 		{
-			return ItemInstances[A].Quantity > ItemInstances[B].Quantity;
+			return A.Quantity > B.Quantity;
 		});
 
 		// Track instances to remove after consolidation
 		TArray<FGuid> InstancesToRemove;
 
 		// Merge smaller stacks into larger ones
-		for (int32 i = 0; i < InstanceIndices.Num(); ++i)
+		for (int32 i = 0; i < GroupInstances.Num(); ++i)
 		{
-			FSuspenseCoreItemInstance& TargetInstance = ItemInstances[InstanceIndices[i]];
+			FSuspenseCoreItemInstance& TargetInstance = *GroupInstances[i];
 
 			// Skip if already marked for removal or already full
 			if (InstancesToRemove.Contains(TargetInstance.UniqueInstanceID))
@@ -1203,9 +1282,9 @@ int32 USuspenseCoreInventoryComponent::ConsolidateStacks(FName ItemID)
 			}
 
 			// Try to absorb from other stacks
-			for (int32 j = i + 1; j < InstanceIndices.Num(); ++j)
+			for (int32 j = i + 1; j < GroupInstances.Num(); ++j)
 			{
-				FSuspenseCoreItemInstance& SourceInstance = ItemInstances[InstanceIndices[j]];
+				FSuspenseCoreItemInstance& SourceInstance = *GroupInstances[j];
 
 				// Skip if already marked for removal
 				if (InstancesToRemove.Contains(SourceInstance.UniqueInstanceID))
@@ -1242,47 +1321,42 @@ int32 USuspenseCoreInventoryComponent::ConsolidateStacks(FName ItemID)
 			}
 		}
 
-		// Remove emptied stacks (iterate backwards to avoid index shifting)
-		for (const FGuid& InstanceIDToRemove : InstancesToRemove)
+		// Update replicated data for modified stacks (before removal invalidates GroupInstances)
+		for (const FSuspenseCoreItemInstance* Instance : GroupInstances)
 		{
-			for (int32 i = ItemInstances.Num() - 1; i >= 0; --i)
+			if (!InstancesToRemove.Contains(Instance->UniqueInstanceID))
 			{
-				if (ItemInstances[i].UniqueInstanceID == InstanceIDToRemove)
-				{
-					// Clear grid slots
-					UpdateGridSlots(ItemInstances[i], false);
-
-					// Remove from replication
-					ReplicatedInventory.RemoveItem(InstanceIDToRemove);
-
-					// Remove from array
-					ItemInstances.RemoveAt(i);
-
-					UE_LOG(LogSuspenseCoreInventory, Verbose,
-						TEXT("ConsolidateStacks: Removed empty stack %s"), *InstanceIDToRemove.ToString());
-					break;
-				}
+				ReplicatedInventory.UpdateItem(*Instance);
 			}
 		}
 
-		// Update replicated data for modified stacks
-		for (int32 Idx : InstanceIndices)
+		// Remove emptied stacks
+		for (const FGuid& InstanceIDToRemove : InstancesToRemove)
 		{
-			if (Idx < ItemInstances.Num())
+			const int32 Index = FindItemInstanceIndex(InstanceIDToRemove);
+			if (Index == INDEX_NONE)
 			{
-				const FSuspenseCoreItemInstance& Instance = ItemInstances[Idx];
-				if (!InstancesToRemove.Contains(Instance.UniqueInstanceID))
-				{
-					ReplicatedInventory.UpdateItem(Instance);
-				}
+				continue;
 			}
+
+			// Clear grid slots
+			UpdateGridSlots(ItemInstances[Index], false);
+
+			// Remove from replication
+			ReplicatedInventory.RemoveItem(InstanceIDToRemove);
+
+			// Remove from array
+			RemoveItemInstanceAt(Index);
+
+			UE_LOG(LogSuspenseCoreInventory, Verbose,
+				TEXT("ConsolidateStacks: Removed empty stack %s"), *InstanceIDToRemove.ToString());
 		}
 	}
 
 	if (TotalConsolidated > 0)
 	{
-		// Recalculate weight for consistency
-		RecalculateWeight();
+		// Weight is unchanged: quantity only moved between stacks of one item,
+		// and the removed stacks were empty
 
 		// Invalidate UI cache
 		InvalidateAllUICache();
@@ -1363,8 +1437,9 @@ bool USuspenseCoreInventoryComponent::InitializeFromLoadout(FName LoadoutID)
 
 void USuspenseCoreInventoryComponent::Initialize(int32 GridWidth, int32 GridHeight, float InMaxWeight)
 {
-	Config.GridWidth = FMath::Clamp(GridWidth, 1, 20);
-	Config.GridHeight = FMath::Clamp(GridHeight, 1, 20);
+	// Storage limits: one 64-bit row mask per row, stash-sized heights
+	Config.GridWidth = FMath::Clamp(GridWidth, 1, USuspenseCoreInventoryStorage::MaxGridWidth);
+	Config.GridHeight = FMath::Clamp(GridHeight, 1, USuspenseCoreInventoryStorage::MaxGridHeight);
 	Config.MaxWeight = FMath::Max(0.0f, InMaxWeight);
 
 	// Clear item type restrictions - they should be set explicitly after initialization
@@ -1379,7 +1454,9 @@ void USuspenseCoreInventoryComponent::Initialize(int32 GridWidth, int32 GridHeig
 	SyncStorageToLegacyArray();
 
 	ItemInstances.Empty();
-	CurrentWeight = 0.0f;
+	InstanceIndexByID.Empty();
+	UndoLog.Reset();
+	SetTrackedWeight(0);
 	bIsInitialized = true;
 
 	// Reset search hint
@@ -1489,7 +1566,14 @@ bool USuspenseCoreInventoryComponent::IsInitialized() const
 
 void USuspenseCoreInventoryComponent::Clear()
 {
+	// Clearing inside a transaction touches everything - log it all so rollback can restore
+	for (const FSuspenseCoreItemInstance& Instance : ItemInstances)
+	{
+		RecordUndo(Instance.UniqueInstanceID, &Instance);
+	}
+
 	ItemInstances.Empty();
+	InstanceIndexByID.Empty();
 
 	// Clear GridStorage (SSOT)
 	if (GridStorage && GridStorage->IsInitialized())
@@ -1500,7 +1584,7 @@ void USuspenseCoreInventoryComponent::Clear()
 	// Sync to legacy array for replication
 	SyncStorageToLegacyArray();
 
-	CurrentWeight = 0.0f;
+	SetTrackedWeight(0);
 	ReplicatedInventory.ClearItems();
 
 	if (USuspenseCoreEventBus* EventBus = GetEventBus())
@@ -1528,12 +1612,13 @@ void USuspenseCoreInventoryComponent::BroadcastInventoryUpdated()
 	static const FGameplayTag FullRefreshTag = FGameplayTag::RequestGameplayTag(FName("SuspenseCore.Event.UIProvider.DataChanged.Full"));
 	BroadcastUIDataChanged(FullRefreshTag, FGuid());
 
-	// Also broadcast via EventBus
+	// Also broadcast via EventBus - deferred, so batch operations collapse to one
+	// Updated per inventory per frame (LastValueWins rule in the event manager)
 	if (USuspenseCoreEventBus* EventBus = GetEventBus())
 	{
 		FSuspenseCoreEventData EventData;
 		EventData.Source = const_cast<USuspenseCoreInventoryComponent*>(this);
-		EventBus->Publish(SUSPENSE_INV_EVENT_UPDATED, EventData);
+		EventBus->PublishDeferred(SUSPENSE_INV_EVENT_UPDATED, EventData);
 	}
 }
 
@@ -1558,6 +1643,16 @@ void USuspenseCoreInventoryComponent::LogContents() const
 	}
 }
 
+#if WITH_DEV_AUTOMATION_TESTS
+void USuspenseCoreInventoryComponent::SetItemStaticsForTest(FName ItemID, float UnitWeight, FIntPoint GridSize, int32 MaxStackSize)
+{
+	FItemStatics& Statics = ItemStaticsCache.FindOrAdd(ItemID);
+	Statics.UnitWeightGrams = WeightToGrams(UnitWeight);
+	Statics.GridSize = GridSize;
+	Statics.MaxStackSize = FMath::Max(1, MaxStackSize);
+}
+#endif
+
 //==================================================================
 // Internal Operations
 //==================================================================
@@ -1596,10 +1691,10 @@ bool USuspenseCoreInventoryComponent::AddItemInternal(const FSuspenseCoreItemIns
 	NewInstance.SlotIndex = TargetSlot;
 	NewInstance.GridPosition = SlotToGridCoords(TargetSlot);
 
-	ItemInstances.Add(NewInstance);
+	AppendItemInstance(NewInstance);
 	UpdateGridSlots(NewInstance, true);
 	ReplicatedInventory.AddItem(NewInstance);
-	RecalculateWeight();
+	UpdateWeightDelta(GetInstanceWeightGrams(NewInstance));
 
 	return true;
 }
@@ -1608,11 +1703,7 @@ bool USuspenseCoreInventoryComponent::RemoveItemInternal(const FGuid& InstanceID
 {
 	SCOPE_CYCLE_COUNTER(STAT_Inventory_RemoveItem);
 
-	int32 Index = ItemInstances.IndexOfByPredicate([&InstanceID](const FSuspenseCoreItemInstance& Instance)
-	{
-		return Instance.UniqueInstanceID == InstanceID;
-	});
-
+	const int32 Index = FindItemInstanceIndex(InstanceID);
 	if (Index == INDEX_NONE)
 	{
 		return false;
@@ -1621,42 +1712,13 @@ bool USuspenseCoreInventoryComponent::RemoveItemInternal(const FGuid& InstanceID
 	OutRemovedInstance = ItemInstances[Index];
 
 	// Calculate weight delta BEFORE removal (incremental update)
-	// For magazines: use GetWeightWithRounds() to include loaded rounds
+	// For magazines: includes loaded rounds
 	// @see TarkovStyle_Ammo_System_Design.md:112-130 - Magazine weight system
-	float WeightToRemove = 0.0f;
-	USuspenseCoreDataManager* DataManager = GetDataManager();
-	if (DataManager)
-	{
-		if (OutRemovedInstance.IsMagazine())
-		{
-			FSuspenseCoreMagazineData MagData;
-			if (DataManager->GetMagazineData(OutRemovedInstance.MagazineData.MagazineID, MagData))
-			{
-				WeightToRemove = MagData.GetWeightWithRounds(OutRemovedInstance.MagazineData.CurrentRoundCount);
-			}
-			else
-			{
-				// Fallback to base item weight
-				FSuspenseCoreItemData ItemData;
-				if (DataManager->GetItemData(OutRemovedInstance.ItemID, ItemData))
-				{
-					WeightToRemove = ItemData.InventoryProps.Weight * OutRemovedInstance.Quantity;
-				}
-			}
-		}
-		else
-		{
-			FSuspenseCoreItemData ItemData;
-			if (DataManager->GetItemData(OutRemovedInstance.ItemID, ItemData))
-			{
-				WeightToRemove = ItemData.InventoryProps.Weight * OutRemovedInstance.Quantity;
-			}
-		}
-	}
+	const int64 WeightToRemove = GetInstanceWeightGrams(OutRemovedInstance);
 
 	// Remove from data structures
 	UpdateGridSlots(OutRemovedInstance, false);
-	ItemInstances.RemoveAt(Index);
+	RemoveItemInstanceAt(Index);
 	ReplicatedInventory.RemoveItem(InstanceID);
 
 	// Incremental weight update (O(1) instead of O(n))
@@ -1688,8 +1750,8 @@ void USuspenseCoreInventoryComponent::BroadcastItemEvent(FGameplayTag EventTag,
 
 	FSuspenseCoreEventData EventData;
 	EventData.Source = this;
-	EventData.SetString(TEXT("InstanceID"), Instance.UniqueInstanceID.ToString());
-	EventData.SetString(TEXT("ItemID"), Instance.ItemID.ToString());
+	EventData.SetGuid(TEXT("InstanceID"), Instance.UniqueInstanceID);
+	EventData.SetName(TEXT("ItemID"), Instance.ItemID);
 	EventData.SetInt(TEXT("Quantity"), Instance.Quantity);
 	EventData.SetInt(TEXT("SlotIndex"), SlotIndex);
 
@@ -1764,6 +1826,7 @@ void USuspenseCoreInventoryComponent::OnRep_ReplicatedInventory()
 		{
 			ItemInstances.Add(RepItem.ToItemInstance());
 		}
+		RebuildInstanceIndex();
 
 		for (const FSuspenseCoreItemInstance& Instance : ItemInstances)
 		{
@@ -1826,30 +1889,16 @@ void USuspenseCoreInventoryComponent::HandleReplicatedItemRemove(const FSuspense
 	if (LocalInstance)
 	{
 		// Calculate weight to remove BEFORE removing
-		float WeightToRemove = 0.0f;
-		USuspenseCoreDataManager* DataManager = GetDataManager();
-		if (DataManager)
-		{
-			FSuspenseCoreItemData ItemData;
-			if (DataManager->GetItemData(LocalInstance->ItemID, ItemData))
-			{
-				WeightToRemove = ItemData.InventoryProps.Weight * LocalInstance->Quantity;
-			}
-		}
+		const int64 WeightToRemove = GetInstanceWeightGrams(*LocalInstance);
 
 		// Remove from grid slots
 		UpdateGridSlots(*LocalInstance, false);
 
 		// Remove from items array
-		int32 Index = ItemInstances.IndexOfByPredicate(
-			[&Item](const FSuspenseCoreItemInstance& Inst)
-			{
-				return Inst.UniqueInstanceID == Item.InstanceID;
-			});
-
+		const int32 Index = FindItemInstanceIndex(Item.InstanceID);
 		if (Index != INDEX_NONE)
 		{
-			ItemInstances.RemoveAt(Index);
+			RemoveItemInstanceAt(Index);
 		}
 
 		// Update weight incrementally
@@ -1876,28 +1925,20 @@ void USuspenseCoreInventoryComponent::HandleReplicatedItemAdd(const FSuspenseCor
 		UE_LOG(LogSuspenseCoreInventory, Warning,
 			TEXT("HandleReplicatedItemAdd: Item %s already exists! Updating instead."),
 			*Item.InstanceID.ToString());
+		const int64 OldWeightGrams = GetInstanceWeightGrams(*Existing);
 		*Existing = NewInstance;
+		UpdateWeightDelta(GetInstanceWeightGrams(NewInstance) - OldWeightGrams);
 		return;
 	}
 
 	// Add to local items array
-	ItemInstances.Add(NewInstance);
+	AppendItemInstance(NewInstance);
 
 	// Update grid slots
 	UpdateGridSlots(NewInstance, true);
 
-	// Calculate and add weight
-	float WeightToAdd = 0.0f;
-	USuspenseCoreDataManager* DataManager = GetDataManager();
-	if (DataManager)
-	{
-		FSuspenseCoreItemData ItemData;
-		if (DataManager->GetItemData(NewInstance.ItemID, ItemData))
-		{
-			WeightToAdd = ItemData.InventoryProps.Weight * NewInstance.Quantity;
-		}
-	}
-	UpdateWeightDelta(WeightToAdd);
+	// Add weight
+	UpdateWeightDelta(GetInstanceWeightGrams(NewInstance));
 
 	// Invalidate UI cache
 	InvalidateAllUICache();
@@ -1920,17 +1961,8 @@ void USuspenseCoreInventoryComponent::HandleReplicatedItemChange(const FSuspense
 		return;
 	}
 
-	// Get item data for weight calculation
-	USuspenseCoreDataManager* DataManager = GetDataManager();
-	float UnitWeight = 0.0f;
-	if (DataManager)
-	{
-		FSuspenseCoreItemData ItemData;
-		if (DataManager->GetItemData(LocalInstance->ItemID, ItemData))
-		{
-			UnitWeight = ItemData.InventoryProps.Weight;
-		}
-	}
+	// Weight before the change, for the delta below
+	const int64 OldWeightGrams = GetInstanceWeightGrams(*LocalInstance);
 
 	// Check if position changed
 	bool bPositionChanged = (LocalInstance->SlotIndex != Item.SlotIndex) ||
@@ -1943,10 +1975,6 @@ void USuspenseCoreInventoryComponent::HandleReplicatedItemChange(const FSuspense
 		UpdateGridSlots(*LocalInstance, false);
 	}
 
-	// Calculate weight delta from quantity change
-	int32 OldQuantity = LocalInstance->Quantity;
-	int32 QuantityDelta = Item.Quantity - OldQuantity;
-
 	// Update local instance fields
 	LocalInstance->Quantity = Item.Quantity;
 	LocalInstance->SlotIndex = Item.SlotIndex;
@@ -1969,10 +1997,7 @@ void USuspenseCoreInventoryComponent::HandleReplicatedItemChange(const FSuspense
 	}
 
 	// Update weight if quantity changed
-	if (QuantityDelta != 0)
-	{
-		UpdateWeightDelta(UnitWeight * QuantityDelta);
-	}
+	UpdateWeightDelta(GetInstanceWeightGrams(*LocalInstance) - OldWeightGrams);
 
 	// Invalidate UI cache for this item
 	InvalidateItemUICache(Item.InstanceID);
@@ -2101,151 +2126,247 @@ void USuspenseCoreInventoryComponent::RecalculateWeight()
 {
 	SCOPE_CYCLE_COUNTER(STAT_Inventory_RecalculateWeight);
 
-	CurrentWeight = 0.0f;
-	USuspenseCoreDataManager* DataManager = GetDataManager();
-	if (!DataManager)
+	SetTrackedWeight(ComputeWeightGrams());
+}
+
+void USuspenseCoreInventoryComponent::UpdateWeightDelta(int64 WeightDeltaGrams)
+{
+	// O(1) incremental weight update - use instead of RecalculateWeight() in hotpath
+	SetTrackedWeight(TrackedWeightGrams + WeightDeltaGrams);
+
+#if !UE_BUILD_SHIPPING
+	// Periodic validation in development builds
+	const int32 ValidationInterval = CVarSuspenseCoreInventoryWeightValidationInterval.GetValueOnGameThread();
+	if (ValidationInterval > 0 && ++ValidationOperationCounter % ValidationInterval == 0)
 	{
-		return;
+		ValidateTrackedWeight(TEXT("UpdateWeightDelta"));
 	}
+#endif
+}
 
+void USuspenseCoreInventoryComponent::SetTrackedWeight(int64 WeightGrams)
+{
+	TrackedWeightGrams = WeightGrams;
+	CurrentWeight = FMath::Max<int64>(0, WeightGrams) / 1000.0f;
+}
+
+int64 USuspenseCoreInventoryComponent::ComputeWeightGrams() const
+{
+	int64 WeightGrams = 0;
 	for (const FSuspenseCoreItemInstance& Instance : ItemInstances)
 	{
-		// For magazines: use EmptyWeight + (WeightPerRound * CurrentRoundCount)
-		// @see TarkovStyle_Ammo_System_Design.md:112-130 - Magazine weight system
-		// @see SuspenseCoreMagazineTypes.h:127 - GetWeightWithRounds()
-		if (Instance.IsMagazine())
-		{
-			FSuspenseCoreMagazineData MagData;
-			if (DataManager->GetMagazineData(Instance.MagazineData.MagazineID, MagData))
-			{
-				CurrentWeight += MagData.GetWeightWithRounds(Instance.MagazineData.CurrentRoundCount);
-			}
-			else
-			{
-				// Fallback: use base item weight if magazine data not found
-				FSuspenseCoreItemData ItemData;
-				if (DataManager->GetItemData(Instance.ItemID, ItemData))
-				{
-					CurrentWeight += ItemData.InventoryProps.Weight * Instance.Quantity;
-				}
-			}
-		}
-		else
-		{
-			// Regular items: weight * quantity
-			FSuspenseCoreItemData ItemData;
-			if (DataManager->GetItemData(Instance.ItemID, ItemData))
-			{
-				CurrentWeight += ItemData.InventoryProps.Weight * Instance.Quantity;
-			}
-		}
+		WeightGrams += GetInstanceWeightGrams(Instance);
 	}
+	return WeightGrams;
 }
 
-void USuspenseCoreInventoryComponent::UpdateWeightDelta(float WeightDelta)
+int64 USuspenseCoreInventoryComponent::GetInstanceWeightGrams(const FSuspenseCoreItemInstance& Instance) const
 {
-	// O(1) incremental weight update - use instead of RecalculateWeight() in hotpath
-	CurrentWeight = FMath::Max(0.0f, CurrentWeight + WeightDelta);
-
-#if !UE_BUILD_SHIPPING
-	// Periodic validation in development builds
-	++ValidationOperationCounter;
-	if (ValidationOperationCounter % 100 == 0) // Every 100 operations
+	// For magazines: EmptyWeight + (WeightPerRound * CurrentRoundCount)
+	// @see TarkovStyle_Ammo_System_Design.md:112-130 - Magazine weight system
+	// @see SuspenseCoreMagazineTypes.h:127 - GetWeightWithRounds()
+	if (Instance.IsMagazine())
 	{
-		float CalculatedWeight = 0.0f;
-		USuspenseCoreDataManager* DataManager = GetDataManager();
-		if (DataManager)
+		FMagazineStatics MagStatics;
+		if (GetMagazineStatics(Instance.MagazineData.MagazineID, MagStatics))
 		{
-			for (const FSuspenseCoreItemInstance& Instance : ItemInstances)
-			{
-				// For magazines: use GetWeightWithRounds() to include loaded rounds
-				// @see TarkovStyle_Ammo_System_Design.md:112-130
-				if (Instance.IsMagazine())
-				{
-					FSuspenseCoreMagazineData MagData;
-					if (DataManager->GetMagazineData(Instance.MagazineData.MagazineID, MagData))
-					{
-						CalculatedWeight += MagData.GetWeightWithRounds(Instance.MagazineData.CurrentRoundCount);
-					}
-					else
-					{
-						FSuspenseCoreItemData ItemData;
-						if (DataManager->GetItemData(Instance.ItemID, ItemData))
-						{
-							CalculatedWeight += ItemData.InventoryProps.Weight * Instance.Quantity;
-						}
-					}
-				}
-				else
-				{
-					FSuspenseCoreItemData ItemData;
-					if (DataManager->GetItemData(Instance.ItemID, ItemData))
-					{
-						CalculatedWeight += ItemData.InventoryProps.Weight * Instance.Quantity;
-					}
-				}
-			}
+			return MagStatics.GetWeightWithRounds(Instance.MagazineData.CurrentRoundCount);
 		}
+		// Fallback: base item weight if magazine data not found
+	}
 
-		if (!FMath::IsNearlyEqual(CurrentWeight, CalculatedWeight, 0.01f))
-		{
-			UE_LOG(LogSuspenseCoreInventory, Error,
-				TEXT("Weight desync detected! Tracked: %.2f, Calculated: %.2f - Force syncing"),
-				CurrentWeight, CalculatedWeight);
-			CurrentWeight = CalculatedWeight; // Force sync to correct value
-		}
+	FItemStatics Statics;
+	if (GetItemStatics(Instance.ItemID, Statics))
+	{
+		return Statics.UnitWeightGrams * Instance.Quantity;
 	}
-#endif
+	return 0;
 }
 
-void USuspenseCoreInventoryComponent::UpdateGridSlots(const FSuspenseCoreItemInstance& Instance, bool bPlace)
+bool USuspenseCoreInventoryComponent::GetItemStatics(FName ItemID, FItemStatics& OutStatics) const
 {
-	USuspenseCoreDataManager* DataManager = GetDataManager();
-	if (!DataManager)
+	if (const FItemStatics* Cached = ItemStaticsCache.Find(ItemID))
 	{
-		return;
+		OutStatics = *Cached;
+		return true;
 	}
 
+	USuspenseCoreDataManager* DataManager = GetDataManager();
 	FSuspenseCoreItemData ItemData;
-	if (!DataManager->GetItemData(Instance.ItemID, ItemData))
+	if (!DataManager || !DataManager->GetItemData(ItemID, ItemData))
+	{
+		return false;
+	}
+
+	OutStatics.UnitWeightGrams = WeightToGrams(ItemData.InventoryProps.Weight);
+	OutStatics.GridSize = ItemData.InventoryProps.GridSize;
+	OutStatics.MaxStackSize = ItemData.InventoryProps.MaxStackSize;
+	OutStatics.ItemType = ItemData.Classification.ItemType;
+	ItemStaticsCache.Add(ItemID, OutStatics);
+	return true;
+}
+
+bool USuspenseCoreInventoryComponent::GetMagazineStatics(FName MagazineID, FMagazineStatics& OutStatics) const
+{
+	if (const FMagazineStatics* Cached = MagazineStaticsCache.Find(MagazineID))
+	{
+		OutStatics = *Cached;
+		return true;
+	}
+
+	USuspenseCoreDataManager* DataManager = GetDataManager();
+	FSuspenseCoreMagazineData MagData;
+	if (!DataManager || !DataManager->GetMagazineData(MagazineID, MagData))
+	{
+		return false;
+	}
+
+	OutStatics.EmptyWeightGrams = WeightToGrams(MagData.EmptyWeight);
+	OutStatics.WeightPerRoundGrams = WeightToGrams(MagData.WeightPerRound);
+	OutStatics.MaxCapacity = MagData.MaxCapacity;
+	MagazineStaticsCache.Add(MagazineID, OutStatics);
+	return true;
+}
+
+#if !UE_BUILD_SHIPPING
+void USuspenseCoreInventoryComponent::ValidateTrackedWeight(const TCHAR* Context)
+{
+	const int64 CalculatedGrams = ComputeWeightGrams();
+	if (CalculatedGrams != TrackedWeightGrams)
+	{
+		UE_LOG(LogSuspenseCoreInventory, Error,
+			TEXT("[%s] Weight desync detected! Tracked: %lld g, Calculated: %lld g - Force syncing"),
+			Context, TrackedWeightGrams, CalculatedGrams);
+		SetTrackedWeight(CalculatedGrams); // Force sync to correct value
+	}
+}
+#endif
+
+void USuspenseCoreInventoryComponent::UpdateGridSlots(const FSuspenseCoreItemInstance& Instance, bool bPlace)
+{
+	FItemStatics ItemData;
+	if (!GetItemStatics(Instance.ItemID, ItemData))
 	{
 		return;
 	}
 
-	FIntPoint ItemSize = ItemData.InventoryProps.GridSize;
+	FIntPoint ItemSize = ItemData.GridSize;
 	bool bRotated = Instance.Rotation != 0;
 
 	// Update GridStorage FIRST (SSOT for all grid operations)
 	if (GridStorage && GridStorage->IsInitialized())
 	{
+		// Only the item footprint changes - mirror just those cells
+		TArray<int32> ChangedSlots;
 		if (bPlace)
 		{
 			GridStorage->PlaceItem(Instance.UniqueInstanceID, ItemSize, Instance.SlotIndex, bRotated);
+			ChangedSlots = GridStorage->GetOccupiedSlots(Instance.UniqueInstanceID);
 		}
 		else
 		{
+			ChangedSlots = GridStorage->GetOccupiedSlots(Instance.UniqueInstanceID);
 			GridStorage->RemoveItem(Instance.UniqueInstanceID);
 		}
+
+		// Sync to legacy array for replication compatibility
+		SyncStorageSlotsToLegacyArray(ChangedSlots);
 	}
+}
 
-	// Sync to legacy array for replication compatibility
-	SyncStorageToLegacyArray();
+void USuspenseCoreInventoryComponent::SyncStorageSlotsToLegacyArray(const TArray<int32>& SlotIndices)
+{
+	PRAGMA_DISABLE_DEPRECATION_WARNINGS
+	const bool bMirrorSized = GridSlots_DEPRECATED.Num() == GridStorage->GetTotalSlots();
+	if (bMirrorSized)
+	{
+		for (const int32 SlotIndex : SlotIndices)
+		{
+			GridSlots_DEPRECATED[SlotIndex] = GridStorage->GetSlot(SlotIndex);
+		}
+	}
+	PRAGMA_ENABLE_DEPRECATION_WARNINGS
+
+	if (!bMirrorSized)
+	{
+		SyncStorageToLegacyArray();
+	}
+}
+
+int32 USuspenseCoreInventoryComponent::FindItemInstanceIndex(const FGuid& InstanceID) const
+{
+	const int32* IndexPtr = InstanceIndexByID.Find(InstanceID);
+	if (!IndexPtr)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Index = *IndexPtr;
+	if (!ensureMsgf(ItemInstances.IsValidIndex(Index) && ItemInstances[Index].UniqueInstanceID == InstanceID,
+		TEXT("InstanceIndexByID out of sync for %s"), *InstanceID.ToString()))
+	{
+		return INDEX_NONE;
+	}
+	return Index;
+}
+
+int32 USuspenseCoreInventoryComponent::AppendItemInstance(const FSuspenseCoreItemInstance& Instance)
+{
+	RecordUndo(Instance.UniqueInstanceID, nullptr);
+
+	const int32 Index = ItemInstances.Add(Instance);
+	InstanceIndexByID.Add(Instance.UniqueInstanceID, Index);
+	return Index;
+}
+
+void USuspenseCoreInventoryComponent::RemoveItemInstanceAt(int32 Index)
+{
+	if (!ItemInstances.IsValidIndex(Index))
+	{
+		return;
+	}
+
+	const FGuid InstanceID = ItemInstances[Index].UniqueInstanceID;
+	RecordUndo(InstanceID, &ItemInstances[Index]);
+
+	InstanceIndexByID.Remove(InstanceID);
+	ItemInstances.RemoveAt(Index);
+
+	// Order-preserving removal (UI lists, saves and sort ties follow array order):
+	// every instance after the hole moved down by one
+	for (int32 i = Index; i < ItemInstances.Num(); ++i)
+	{
+		InstanceIndexByID.FindChecked(ItemInstances[i].UniqueInstanceID) = i;
+	}
+}
+
+void USuspenseCoreInventoryComponent::RebuildInstanceIndex()
+{
+	InstanceIndexByID.Reset();
+	InstanceIndexByID.Reserve(ItemInstances.Num());
+	for (int32 i = 0; i < ItemInstances.Num(); ++i)
+	{
+		InstanceIndexByID.Add(ItemInstances[i].UniqueInstanceID, i);
+	}
 }
 
 FSuspenseCoreItemInstance* USuspenseCoreInventoryComponent::FindItemInstanceInternal(const FGuid& InstanceID)
 {
-	return ItemInstances.FindByPredicate([&InstanceID](const FSuspenseCoreItemInstance& Instance)
+	const int32 Index = FindItemInstanceIndex(InstanceID);
+	if (Index == INDEX_NONE)
 	{
-		return Instance.UniqueInstanceID == InstanceID;
-	});
+		return nullptr;
+	}
+
+	// Mutable access = intent to write: capture pre-image on first touch
+	RecordUndo(InstanceID, &ItemInstances[Index]);
+	return &ItemInstances[Index];
 }
 
 const FSuspenseCoreItemInstance* USuspenseCoreInventoryComponent::FindItemInstanceInternal(const FGuid& InstanceID) const
 {
-	return ItemInstances.FindByPredicate([&InstanceID](const FSuspenseCoreItemInstance& Instance)
-	{
-		return Instance.UniqueInstanceID == InstanceID;
-	});
+	const int32 Index = FindItemInstanceIndex(InstanceID);
+	return Index != INDEX_NONE ? &ItemInstances[Index] : nullptr;
 }
 
 //==================================================================
@@ -2281,11 +2402,13 @@ bool USuspenseCoreInventoryComponent::UpdateMagazineData(const FGuid& ItemInstan
 		return false;
 	}
 
-	// Update magazine data
+	// Update magazine data (weight follows the round count)
+	const int64 OldWeightGrams = GetInstanceWeightGrams(*Item);
 	Item->MagazineData = NewMagData;
 
 	// Ensure instance GUIDs are synced
 	Item->MagazineData.InstanceGuid = Item->UniqueInstanceID;
+	UpdateWeightDelta(GetInstanceWeightGrams(*Item) - OldWeightGrams);
 
 	// Mark for replication
 	MarkItemDirty(ItemInstanceID);
@@ -2361,9 +2484,8 @@ void USuspenseCoreInventoryComponent::MarkItemDirty(const FGuid& InstanceID)
 void USuspenseCoreInventoryComponent::OnMagazineRoundLoaded(FGameplayTag EventTag, const FSuspenseCoreEventData& EventData)
 {
 	// Check if this event is for our container
-	FString ContainerIDStr = EventData.GetString(TEXT("SourceContainerID"));
-	FGuid EventContainerID;
-	if (!FGuid::Parse(ContainerIDStr, EventContainerID))
+	const FGuid EventContainerID = EventData.GetGuid(TEXT("SourceContainerID"));
+	if (!EventContainerID.IsValid())
 	{
 		return;
 	}
@@ -2375,17 +2497,16 @@ void USuspenseCoreInventoryComponent::OnMagazineRoundLoaded(FGameplayTag EventTa
 	}
 
 	// Parse magazine instance ID
-	FString MagInstanceIDStr = EventData.GetString(TEXT("MagazineInstanceID"));
-	FGuid MagInstanceID;
-	if (!FGuid::Parse(MagInstanceIDStr, MagInstanceID))
+	const FGuid MagInstanceID = EventData.GetGuid(TEXT("MagazineInstanceID"));
+	if (!MagInstanceID.IsValid())
 	{
 		UE_LOG(LogSuspenseCoreInventory, Warning,
-			TEXT("OnMagazineRoundLoaded: Invalid MagazineInstanceID: %s"), *MagInstanceIDStr);
+			TEXT("OnMagazineRoundLoaded: Invalid MagazineInstanceID: %s"), *EventData.GetString(TEXT("MagazineInstanceID")));
 		return;
 	}
 
 	// Get round data
-	FName AmmoID = FName(*EventData.GetString(TEXT("AmmoID")));
+	FName AmmoID = EventData.GetName(TEXT("AmmoID"));
 	int32 NewRoundCount = EventData.GetInt(TEXT("NewRoundCount"));
 	int32 MaxCapacity = EventData.GetInt(TEXT("MaxCapacity"));
 
@@ -2407,6 +2528,9 @@ void USuspenseCoreInventoryComponent::OnMagazineRoundLoaded(FGameplayTag EventTa
 		return;
 	}
 
+	// Magazine contribution before the round goes in (weight follows CurrentRoundCount)
+	const int64 OldMagazineWeightGrams = GetInstanceWeightGrams(*Item);
+
 	// Update magazine state
 	Item->MagazineData.CurrentRoundCount = NewRoundCount;
 	Item->MagazineData.LoadedAmmoID = AmmoID;
@@ -2422,24 +2546,9 @@ void USuspenseCoreInventoryComponent::OnMagazineRoundLoaded(FGameplayTag EventTa
 	// @see SuspenseCoreItemTypes.h:603 - UniqueInstanceID, :616 - Quantity
 	//==================================================================
 
-	// Get magazine's WeightPerRound to update inventory weight
-	USuspenseCoreDataManager* DM = GetDataManager();
-	float MagazineWeightPerRound = 0.0f;
-	if (DM)
-	{
-		FSuspenseCoreMagazineData MagData;
-		if (DM->GetMagazineData(Item->MagazineData.MagazineID, MagData))
-		{
-			MagazineWeightPerRound = MagData.WeightPerRound;
-		}
-	}
-
-	// Add WeightPerRound to magazine (round is now inside magazine)
+	// Add the round to the magazine's weight (EmptyWeight + WeightPerRound * Rounds)
 	// This compensates for the ammo weight we're about to subtract
-	if (MagazineWeightPerRound > 0.0f)
-	{
-		UpdateWeightDelta(MagazineWeightPerRound);
-	}
+	UpdateWeightDelta(GetInstanceWeightGrams(*Item) - OldMagazineWeightGrams);
 
 	int32 SourceSlot = EventData.GetInt(TEXT("SourceInventorySlot"));
 	if (SourceSlot >= 0)
@@ -2451,26 +2560,12 @@ void USuspenseCoreInventoryComponent::OnMagazineRoundLoaded(FGameplayTag EventTa
 			FSuspenseCoreItemInstance* AmmoItem = GetItemByInstanceID(AmmoItemCopy.UniqueInstanceID);
 			if (AmmoItem)
 			{
-				// Get ammo weight for proper weight tracking
-				float AmmoUnitWeight = 0.0f;
-				if (DM)
-				{
-					FSuspenseCoreItemData AmmoData;
-					if (DM->GetItemData(AmmoID, AmmoData))
-					{
-						AmmoUnitWeight = AmmoData.InventoryProps.Weight;
-					}
-				}
-
-				// Update weight BEFORE decrement (fixes weight mismatch error)
+				// Update weight around the decrement (fixes weight mismatch error)
 				// RemoveItemInternal calculates weight as unitWeight * Quantity,
-				// so if Quantity is already 0, it won't remove any weight
-				if (AmmoUnitWeight > 0.0f)
-				{
-					UpdateWeightDelta(-AmmoUnitWeight);
-				}
-
+				// so once Quantity is 0 it won't remove any weight
+				const int64 OldAmmoWeightGrams = GetInstanceWeightGrams(*AmmoItem);
 				AmmoItem->Quantity--;
+				UpdateWeightDelta(GetInstanceWeightGrams(*AmmoItem) - OldAmmoWeightGrams);
 
 				if (AmmoItem->Quantity <= 0)
 				{
@@ -2501,17 +2596,15 @@ void USuspenseCoreInventoryComponent::OnMagazineRoundLoaded(FGameplayTag EventTa
 void USuspenseCoreInventoryComponent::OnMagazineRoundUnloaded(FGameplayTag EventTag, const FSuspenseCoreEventData& EventData)
 {
 	// Check container ID
-	FString ContainerIDStr = EventData.GetString(TEXT("SourceContainerID"));
-	FGuid EventContainerID;
-	if (!FGuid::Parse(ContainerIDStr, EventContainerID) || EventContainerID != ProviderID)
+	const FGuid EventContainerID = EventData.GetGuid(TEXT("SourceContainerID"));
+	if (!EventContainerID.IsValid() || EventContainerID != ProviderID)
 	{
 		return;
 	}
 
 	// Parse magazine instance ID
-	FString MagInstanceIDStr = EventData.GetString(TEXT("MagazineInstanceID"));
-	FGuid MagInstanceID;
-	if (!FGuid::Parse(MagInstanceIDStr, MagInstanceID))
+	const FGuid MagInstanceID = EventData.GetGuid(TEXT("MagazineInstanceID"));
+	if (!MagInstanceID.IsValid())
 	{
 		return;
 	}
@@ -2530,19 +2623,7 @@ void USuspenseCoreInventoryComponent::OnMagazineRoundUnloaded(FGameplayTag Event
 	// @see TarkovStyle_Ammo_System_Design.md:112-130 - Magazine weight system
 	// @see SuspenseCoreMagazineTypes.h:127 - GetWeightWithRounds()
 	//==================================================================
-	USuspenseCoreDataManager* DM = GetDataManager();
-	if (DM)
-	{
-		FSuspenseCoreMagazineData MagData;
-		if (DM->GetMagazineData(Item->MagazineData.MagazineID, MagData))
-		{
-			// Subtract WeightPerRound from magazine (round is being removed)
-			if (MagData.WeightPerRound > 0.0f)
-			{
-				UpdateWeightDelta(-MagData.WeightPerRound);
-			}
-		}
-	}
+	const int64 OldMagazineWeightGrams = GetInstanceWeightGrams(*Item);
 
 	// Update magazine state
 	Item->MagazineData.CurrentRoundCount = NewRoundCount;
@@ -2551,6 +2632,9 @@ void USuspenseCoreInventoryComponent::OnMagazineRoundUnloaded(FGameplayTag Event
 		Item->MagazineData.LoadedAmmoID = NAME_None;
 	}
 
+	// Subtract the unloaded rounds' weight
+	UpdateWeightDelta(GetInstanceWeightGrams(*Item) - OldMagazineWeightGrams);
+
 	// Mark dirty and broadcast
 	MarkItemDirty(MagInstanceID);
 	InvalidateItemUICache(MagInstanceID);
@@ -2560,9 +2644,8 @@ void USuspenseCoreInventoryComponent::OnMagazineRoundUnloaded(FGameplayTag Event
 void USuspenseCoreInventoryComponent::OnMagazineLoadCompleted(FGameplayTag EventTag, const FSuspenseCoreEventData& EventData)
 {
 	// Check container ID
-	FString ContainerIDStr = EventData.GetString(TEXT("SourceContainerID"));
-	FGuid EventContainerID;
-	if (!FGuid::Parse(ContainerIDStr, EventContainerID) || EventContainerID != ProviderID)
+	const FGuid EventContainerID = EventData.GetGuid(TEXT("SourceContainerID"));
+	if (!EventContainerID.IsValid() || EventContainerID != ProviderID)
 	{
 		return;
 	}
@@ -2571,9 +2654,8 @@ void USuspenseCoreInventoryComponent::OnMagazineLoadCompleted(FGameplayTag Event
 	// The individual RoundLoaded events should have already updated the state
 	// This serves as a final confirmation and can trigger any completion-specific logic
 
-	FString MagInstanceIDStr = EventData.GetString(TEXT("MagazineInstanceID"));
-	FGuid MagInstanceID;
-	if (!FGuid::Parse(MagInstanceIDStr, MagInstanceID))
+	const FGuid MagInstanceID = EventData.GetGuid(TEXT("MagazineInstanceID"));
+	if (!MagInstanceID.IsValid())
 	{
 		return;
 	}
@@ -2844,7 +2926,10 @@ void USuspenseCoreInventoryComponent::Server_RemoveItemByID_Implementation(FName
 			}
 			else
 			{
+				RecordUndo(Instance.UniqueInstanceID, &Instance);
+				const int64 OldWeightGrams = GetInstanceWeightGrams(Instance);
 				Instance.Quantity -= RemainingToRemove;
+				UpdateWeightDelta(GetInstanceWeightGrams(Instance) - OldWeightGrams);
 				ReplicatedInventory.UpdateItem(Instance);
 				BroadcastItemEvent(SUSPENSE_INV_EVENT_ITEM_QTY_CHANGED, Instance, Instance.SlotIndex);
 				RemainingToRemove = 0;
@@ -2852,7 +2937,6 @@ void USuspenseCoreInventoryComponent::Server_RemoveItemByID_Implementation(FName
 		}
 	}
 
-	RecalculateWeight();
 	BroadcastInventoryUpdated();
 }
 
@@ -2870,15 +2954,14 @@ void USuspenseCoreInventoryComponent::Server_MoveItem_Implementation(int32 FromS
 		return;
 	}
 
-	FSuspenseCoreItemData ItemData;
-	USuspenseCoreDataManager* DataManager = GetDataManager();
-	if (!DataManager || !DataManager->GetItemData(Instance.ItemID, ItemData))
+	FItemStatics ItemData;
+	if (!GetItemStatics(Instance.ItemID, ItemData))
 	{
 		return;
 	}
 
 	bool bRotated = Instance.Rotation != 0;
-	if (!CanPlaceItemAtSlot(ItemData.InventoryProps.GridSize, ToSlot, bRotated))
+	if (!CanPlaceItemAtSlot(ItemData.GridSize, ToSlot, bRotated))
 	{
 		return;
 	}
@@ -2967,7 +3050,10 @@ void USuspenseCoreInventoryComponent::Server_SplitStack_Implementation(int32 Sou
 		return;
 	}
 
+	// The split-off part leaves the source here and is re-added (with its weight) below
+	const int64 OldWeightGrams = GetInstanceWeightGrams(*SourcePtr);
 	SourcePtr->Quantity -= SplitQuantity;
+	UpdateWeightDelta(GetInstanceWeightGrams(*SourcePtr) - OldWeightGrams);
 	ReplicatedInventory.UpdateItem(*SourcePtr);
 
 	FSuspenseCoreItemInstance NewStack = SourceInstance;
@@ -3222,23 +3308,22 @@ TArray<int32> USuspenseCoreInventoryComponent::GetOccupiedSlotsForItem(const FGu
 		return Result;
 	}
 
-	// Get item data for size
-	USuspenseCoreDataManager* DataManager = GetDataManager();
-	if (!DataManager)
+	// GridStorage keeps the placed footprint - no item data lookup needed
+	if (GridStorage && GridStorage->ContainsItem(ItemInstanceID))
 	{
-		Result.Add(Instance->SlotIndex);
-		return Result;
+		return GridStorage->GetOccupiedSlots(ItemInstanceID);
 	}
 
-	FSuspenseCoreItemData ItemData;
-	if (!DataManager->GetItemData(Instance->ItemID, ItemData))
+	// Get item statics for size
+	FItemStatics ItemData;
+	if (!GetItemStatics(Instance->ItemID, ItemData))
 	{
 		Result.Add(Instance->SlotIndex);
 		return Result;
 	}
 
 	// Calculate effective size (considering rotation)
-	FIntPoint ItemSize = ItemData.InventoryProps.GridSize;
+	FIntPoint ItemSize = ItemData.GridSize;
 	bool bRotated = Instance->Rotation != 0;
 	FIntPoint EffectiveSize = bRotated ? FIntPoint(ItemSize.Y, ItemSize.X) : ItemSize;
 	FIntPoint StartCoords = SlotToGridCoords(Instance->SlotIndex);
@@ -3304,20 +3389,14 @@ bool USuspenseCoreInventoryComponent::CanPlaceItemAtSlot(const FGuid& ItemID, in
 		return false;
 	}
 
-	// Get item data for size
-	USuspenseCoreDataManager* DataManager = GetDataManager();
-	if (!DataManager)
+	// Get item statics for size
+	FItemStatics ItemData;
+	if (!GetItemStatics(Instance->ItemID, ItemData))
 	{
 		return false;
 	}
 
-	FSuspenseCoreItemData ItemData;
-	if (!DataManager->GetItemData(Instance->ItemID, ItemData))
-	{
-		return false;
-	}
-
-	FIntPoint ItemSize = ItemData.InventoryProps.GridSize;
+	FIntPoint ItemSize = ItemData.GridSize;
 
 	// Check placement using existing method
 	return CanPlaceItemAtSlot(ItemSize, SlotIndex, bRotated);
@@ -3349,8 +3428,8 @@ bool USuspenseCoreInventoryComponent::RequestUseItem(int32 SlotIndex)
 	{
 		FSuspenseCoreEventData EventData;
 		EventData.Source = const_cast<USuspenseCoreInventoryComponent*>(this);
-		EventData.SetString(TEXT("InstanceID"), Instance.UniqueInstanceID.ToString());
-		EventData.SetString(TEXT("ItemID"), Instance.ItemID.ToString());
+		EventData.SetGuid(TEXT("InstanceID"), Instance.UniqueInstanceID);
+		EventData.SetName(TEXT("ItemID"), Instance.ItemID);
 		EventData.SetInt(TEXT("SlotIndex"), SlotIndex);
 		EventBus->Publish(FGameplayTag::RequestGameplayTag(FName(TEXT("SuspenseCore.Event.UIRequest.UseItem"))), EventData);
 	}
@@ -3373,8 +3452,8 @@ bool USuspenseCoreInventoryComponent::RequestDropItem(int32 SlotIndex, int32 Qua
 	{
 		FSuspenseCoreEventData EventData;
 		EventData.Source = const_cast<USuspenseCoreInventoryComponent*>(this);
-		EventData.SetString(TEXT("InstanceID"), Instance.UniqueInstanceID.ToString());
-		EventData.SetString(TEXT("ItemID"), Instance.ItemID.ToString());
+		EventData.SetGuid(TEXT("InstanceID"), Instance.UniqueInstanceID);
+		EventData.SetName(TEXT("ItemID"), Instance.ItemID);
 		EventData.SetInt(TEXT("SlotIndex"), SlotIndex);
 		EventData.SetInt(TEXT("Quantity"), Quantity > 0 ? Quantity : Instance.Quantity);
 		EventBus->Publish(FGameplayTag::RequestGameplayTag(FName(TEXT("SuspenseCore.Event.UIRequest.DropItem"))), EventData);
@@ -3406,10 +3485,10 @@ bool USuspenseCoreInventoryComponent::RequestTransferItem(
 	{
 		FSuspenseCoreEventData EventData;
 		EventData.Source = const_cast<USuspenseCoreInventoryComponent*>(this);
-		EventData.SetString(TEXT("InstanceID"), Instance.UniqueInstanceID.ToString());
-		EventData.SetString(TEXT("ItemID"), Instance.ItemID.ToString());
+		EventData.SetGuid(TEXT("InstanceID"), Instance.UniqueInstanceID);
+		EventData.SetName(TEXT("ItemID"), Instance.ItemID);
 		EventData.SetInt(TEXT("SourceSlot"), SlotIndex);
-		EventData.SetString(TEXT("TargetProviderID"), TargetProviderID.ToString());
+		EventData.SetGuid(TEXT("TargetProviderID"), TargetProviderID);
 		EventData.SetInt(TEXT("TargetSlot"), TargetSlot);
 		EventData.SetInt(TEXT("Quantity"), Quantity > 0 ? Quantity : Instance.Quantity);
 		EventBus->Publish(FGameplayTag::RequestGameplayTag(FName(TEXT("SuspenseCore.Event.UIRequest.TransferItem"))), EventData);
@@ -3495,7 +3574,7 @@ bool USuspenseCoreInventoryComponent::ExecuteContextAction(int32 SlotIndex, cons
 			{
 				FSuspenseCoreEventData EventData;
 				EventData.Source = const_cast<USuspenseCoreInventoryComponent*>(this);
-				EventData.SetString(TEXT("InstanceID"), Instance.UniqueInstanceID.ToString());
+				EventData.SetGuid(TEXT("InstanceID"), Instance.UniqueInstanceID);
 				EventData.SetInt(TEXT("SlotIndex"), SlotIndex);
 				EventBus->Publish(FGameplayTag::RequestGameplayTag(FName(TEXT("SuspenseCore.Event.UIRequest.EquipItem"))), EventData);
 			}
@@ -3535,8 +3614,8 @@ bool USuspenseCoreInventoryComponent::ExecuteContextAction(int32 SlotIndex, cons
 			{
 				FSuspenseCoreEventData EventData;
 				EventData.Source = const_cast<USuspenseCoreInventoryComponent*>(this);
-				EventData.SetString(TEXT("InstanceID"), Instance.UniqueInstanceID.ToString());
-				EventData.SetString(TEXT("ItemID"), Instance.ItemID.ToString());
+				EventData.SetGuid(TEXT("InstanceID"), Instance.UniqueInstanceID);
+				EventData.SetName(TEXT("ItemID"), Instance.ItemID);
 				EventBus->Publish(FGameplayTag::RequestGameplayTag(FName(TEXT("SuspenseCore.UIAction.Examine"))), EventData);
 			}
 			return true;
@@ -3657,8 +3736,8 @@ void USuspenseCoreInventoryComponent::BroadcastUIDataChanged(const FGameplayTag&
 	{
 		FSuspenseCoreEventData EventData;
 		EventData.Source = const_cast<USuspenseCoreInventoryComponent*>(this);
-		EventData.SetString(TEXT("ProviderID"), ProviderID.ToString());
-		EventData.SetString(TEXT("AffectedItemID"), AffectedItemID.ToString());
+		EventData.SetGuid(TEXT("ProviderID"), ProviderID);
+		EventData.SetGuid(TEXT("AffectedItemID"), AffectedItemID);
 		EventBus->Publish(FGameplayTag::RequestGameplayTag(FName(TEXT("SuspenseCore.Event.UIProvider.DataChanged"))), EventData);
 	}
 }
@@ -3763,46 +3842,12 @@ void USuspenseCoreInventoryComponent::ValidateInventoryIntegrityInternal(const F
 		}
 	}
 
-	// 3. Check weight consistency
-	// For magazines: use GetWeightWithRounds() to include loaded rounds
-	// @see TarkovStyle_Ammo_System_Design.md:112-130 - Magazine weight system
-	float CalculatedWeight = 0.0f;
-	USuspenseCoreDataManager* DataManager = GetDataManager();
-	if (DataManager)
-	{
-		for (const FSuspenseCoreItemInstance& Instance : ItemInstances)
-		{
-			if (Instance.IsMagazine())
-			{
-				FSuspenseCoreMagazineData MagData;
-				if (DataManager->GetMagazineData(Instance.MagazineData.MagazineID, MagData))
-				{
-					CalculatedWeight += MagData.GetWeightWithRounds(Instance.MagazineData.CurrentRoundCount);
-				}
-				else
-				{
-					FSuspenseCoreItemData ItemData;
-					if (DataManager->GetItemData(Instance.ItemID, ItemData))
-					{
-						CalculatedWeight += ItemData.InventoryProps.Weight * Instance.Quantity;
-					}
-				}
-			}
-			else
-			{
-				FSuspenseCoreItemData ItemData;
-				if (DataManager->GetItemData(Instance.ItemID, ItemData))
-				{
-					CalculatedWeight += ItemData.InventoryProps.Weight * Instance.Quantity;
-				}
-			}
-		}
-	}
-
-	if (!FMath::IsNearlyEqual(CurrentWeight, CalculatedWeight, 0.01f))
+	// 3. Check weight consistency (running sum must match a full recompute exactly)
+	const int64 CalculatedGrams = ComputeWeightGrams();
+	if (CalculatedGrams != TrackedWeightGrams)
 	{
-		Errors.Add(FString::Printf(TEXT("[%s] Weight mismatch: Tracked %.2f, Calculated %.2f"),
-			*Context, CurrentWeight, CalculatedWeight));
+		Errors.Add(FString::Printf(TEXT("[%s] Weight mismatch: Tracked %lld g, Calculated %lld g"),
+			*Context, TrackedWeightGrams, CalculatedGrams));
 	}
 
 	// Log errors if any
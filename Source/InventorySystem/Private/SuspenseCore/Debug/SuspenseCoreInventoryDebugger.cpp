@@ -5,9 +5,18 @@
 #include "SuspenseCore/Debug/SuspenseCoreInventoryDebugger.h"
 #include "SuspenseCore/Components/SuspenseCoreInventoryComponent.h"
 #include "SuspenseCore/Base/SuspenseCoreInventoryManager.h"
+#include "SuspenseCore/Operations/SuspenseCoreInventoryUndoLog.h"
+#include "SuspenseCore/Storage/SuspenseCoreInventoryStorage.h"
+#include "SuspenseCore/Types/Inventory/SuspenseCoreInventoryNetCodec.h"
 #include "SuspenseCore/Base/SuspenseCoreInventoryLogs.h"
 #include "Engine/Canvas.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
 #include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 
 TArray<IConsoleObject*> USuspenseCoreInventoryDebugger::ConsoleCommands;
 
@@ -500,6 +509,538 @@ bool USuspenseCoreInventoryDebugger::TestAddRemoveCycle(
 	return true;
 }
 
+namespace
+{
+	/** Collects failed checks for the self tests */
+	struct FSuspenseCoreSelfTestLog
+	{
+		FString& Report;
+		int32 Checks = 0;
+		int32 Failures = 0;
+
+		explicit FSuspenseCoreSelfTestLog(FString& InReport)
+			: Report(InReport)
+		{
+		}
+
+		bool Check(bool bCondition, const FString& What)
+		{
+			++Checks;
+			if (!bCondition)
+			{
+				++Failures;
+				Report += FString::Printf(TEXT("FAIL: %s\n"), *What);
+			}
+			return bCondition;
+		}
+
+		bool Finish()
+		{
+			Report += FString::Printf(TEXT("%d/%d checks passed\n"), Checks - Failures, Checks);
+			return Failures == 0;
+		}
+	};
+}
+
+bool USuspenseCoreInventoryDebugger::RunGridSelfTest(FString& OutReport)
+{
+	OutReport = TEXT("=== Grid Self Test ===\n");
+	FSuspenseCoreSelfTestLog Log(OutReport);
+
+	//==================================================================
+	// Place / bounds / overlap (10x6 grid)
+	//==================================================================
+	USuspenseCoreInventoryStorage* Storage = NewObject<USuspenseCoreInventoryStorage>(GetTransientPackage());
+	Storage->Initialize(10, 6);
+	Log.Check(Storage->GetFreeSlotCount() == 60, TEXT("Initialize: 60 free cells"));
+
+	const FGuid A = FGuid::NewGuid();
+	Log.Check(Storage->PlaceItem(A, FIntPoint(2, 3), 0), TEXT("Place 2x3 at slot 0"));
+	Log.Check(Storage->GetFreeSlotCount() == 54, TEXT("Place: 6 cells occupied"));
+	Log.Check(Storage->GetInstanceIDAtSlot(21) == A && Storage->GetAnchorSlot(21) == 0, TEXT("Place: (1,2) belongs to the anchor at 0"));
+	Log.Check(!Storage->IsSlotOccupied(2) && !Storage->IsSlotOccupied(30), TEXT("Place: footprint stops at column 2 / row 3"));
+	Log.Check(Storage->GetOccupiedSlots(A).Num() == 6, TEXT("GetOccupiedSlots: 6 cells"));
+
+	const FGuid B = FGuid::NewGuid();
+	Log.Check(!Storage->PlaceItem(B, FIntPoint(2, 2), 11), TEXT("Overlapping place rejected"));
+	Log.Check(!Storage->CanPlaceItem(FIntPoint(2, 2), 9), TEXT("Right edge overflow rejected"));
+	Log.Check(!Storage->CanPlaceItem(FIntPoint(1, 2), 50), TEXT("Bottom edge overflow rejected"));
+	Log.Check(!Storage->CanPlaceItem(FIntPoint(1, 1), INDEX_NONE) && !Storage->CanPlaceItem(FIntPoint(1, 1), 60), TEXT("Invalid slot rejected"));
+
+	bool bRotated = false;
+	Log.Check(Storage->FindFreeSlot(FIntPoint(2, 2), false, bRotated) == 2 && !bRotated, TEXT("FindFreeSlot: first fit right of the 2x3"));
+	Log.Check(Storage->PlaceItem(B, FIntPoint(2, 2), 2), TEXT("Place 2x2 at slot 2"));
+
+	//==================================================================
+	// Move / rotate
+	//==================================================================
+	Log.Check(Storage->MoveItem(B, FIntPoint(2, 2), 3), TEXT("Move onto own footprint"));
+	Log.Check(Storage->GetAnchorSlotForInstance(B) == 3 && !Storage->IsSlotOccupied(2), TEXT("Move: old cells freed"));
+	Log.Check(!Storage->MoveItem(B, FIntPoint(2, 2), 1), TEXT("Move onto another item rejected"));
+	Log.Check(Storage->GetAnchorSlotForInstance(B) == 3, TEXT("Rejected move keeps placement"));
+
+	Log.Check(Storage->MoveItem(A, FIntPoint(2, 3), 0, true), TEXT("Rotate 2x3 in place to 3x2"));
+	Log.Check(Storage->GetInstanceIDAtSlot(2) == A && !Storage->IsSlotOccupied(20), TEXT("Rotate: footprint is 3x2"));
+
+	const FGuid C = FGuid::NewGuid();
+	Log.Check(Storage->PlaceItem(C, FIntPoint(1, 1), 20), TEXT("Place 1x1 below the rotated item"));
+	Log.Check(!Storage->MoveItem(A, FIntPoint(2, 3), 0, false), TEXT("Rotate blocked by neighbour rejected"));
+	Log.Check(Storage->GetInstanceIDAtSlot(2) == A, TEXT("Rejected rotate keeps footprint"));
+
+	//==================================================================
+	// Remove / clear
+	//==================================================================
+	Log.Check(Storage->RemoveItem(B), TEXT("Remove 2x2"));
+	Log.Check(!Storage->RemoveItem(B), TEXT("Double remove rejected"));
+	Log.Check(Storage->GetFreeSlotCount() == 53 && !Storage->ContainsItem(B), TEXT("Remove: cells freed"));
+
+	Storage->Clear();
+	Log.Check(Storage->GetFreeSlotCount() == 60 && !Storage->ContainsItem(A), TEXT("Clear: grid empty"));
+
+	//==================================================================
+	// Fit search: rotation fallback, full grid, hint invalidation
+	//==================================================================
+	USuspenseCoreInventoryStorage* Narrow = NewObject<USuspenseCoreInventoryStorage>(GetTransientPackage());
+	Narrow->Initialize(2, 4);
+	Log.Check(Narrow->FindFreeSlot(FIntPoint(3, 1), false, bRotated) == INDEX_NONE, TEXT("FindFreeSlot: 3x1 does not fit a 2-wide grid"));
+	Log.Check(Narrow->FindFreeSlot(FIntPoint(3, 1), true, bRotated) == 0 && bRotated, TEXT("FindFreeSlot: rotation fallback"));
+
+	USuspenseCoreInventoryStorage* Small = NewObject<USuspenseCoreInventoryStorage>(GetTransientPackage());
+	Small->Initialize(4, 4);
+	TArray<FGuid> Filled;
+	for (int32 i = 0; i < 16; ++i)
+	{
+		const int32 Slot = Small->FindFreeSlot(FIntPoint(1, 1), false, bRotated);
+		if (!Log.Check(Slot == i && Small->PlaceItem(Filled.Add_GetRef(FGuid::NewGuid()), FIntPoint(1, 1), Slot),
+			FString::Printf(TEXT("Fill: cell %d placed in row-major order"), i)))
+		{
+			break;
+		}
+	}
+	Log.Check(Small->FindFreeSlot(FIntPoint(1, 1), false, bRotated) == INDEX_NONE, TEXT("FindFreeSlot: full grid"));
+	if (Filled.IsValidIndex(9))
+	{
+		Small->RemoveItem(Filled[9]);
+		Log.Check(Small->FindFreeSlot(FIntPoint(1, 1), false, bRotated) == 9, TEXT("FindFreeSlot: hole found after removal"));
+	}
+
+	//==================================================================
+	// Undo log: first write per level, nesting, release into parent
+	//==================================================================
+	FSuspenseCoreInventoryUndoLog UndoLog;
+	TArray<FSuspenseCoreInventoryUndoEntry> Replay;
+
+	FSuspenseCoreItemInstance Item;
+	Item.UniqueInstanceID = FGuid::NewGuid();
+	Item.Quantity = 5;
+
+	UndoLog.BeginSavepoint();
+	UndoLog.Record(Item.UniqueInstanceID, &Item);
+	Item.Quantity = 7;
+	UndoLog.Record(Item.UniqueInstanceID, &Item);
+	Item.Quantity = 9;
+	Log.Check(UndoLog.NumEntries() == 1, TEXT("UndoLog: one pre-image per instance per level"));
+
+	UndoLog.BeginSavepoint();
+	UndoLog.Record(Item.UniqueInstanceID, &Item);
+	Item.Quantity = 11;
+	const FGuid Created = FGuid::NewGuid();
+	UndoLog.Record(Created, nullptr);
+	Log.Check(UndoLog.GetDepth() == 2 && UndoLog.NumEntries() == 3, TEXT("UndoLog: nested level logs again"));
+
+	UndoLog.PopSavepoint(Replay);
+	Log.Check(Replay.Num() == 2 && Replay[0].InstanceID == Created && !Replay[0].bExisted, TEXT("UndoLog: inner rollback newest first, created instance removed"));
+	Log.Check(Replay.Num() == 2 && Replay[1].bExisted && Replay[1].PreImage.Quantity == 9, TEXT("UndoLog: inner rollback restores state at inner begin"));
+
+	UndoLog.PopSavepoint(Replay);
+	Log.Check(Replay.Num() == 1 && Replay[0].PreImage.Quantity == 5, TEXT("UndoLog: outer rollback restores state at outer begin"));
+	Log.Check(!UndoLog.IsActive(), TEXT("UndoLog: inactive after outer rollback"));
+
+	Item.Quantity = 5;
+	UndoLog.BeginSavepoint();
+	UndoLog.BeginSavepoint();
+	UndoLog.Record(Item.UniqueInstanceID, &Item);
+	Item.Quantity = 6;
+	UndoLog.ReleaseSavepoint();
+	Log.Check(UndoLog.GetDepth() == 1 && UndoLog.NumEntries() == 1, TEXT("UndoLog: release merges into parent"));
+	UndoLog.PopSavepoint(Replay);
+	Log.Check(Replay.Num() == 1 && Replay[0].PreImage.Quantity == 5, TEXT("UndoLog: parent rollback covers released child"));
+
+	return Log.Finish();
+}
+
+bool USuspenseCoreInventoryDebugger::RunComponentSelfTest(
+	USuspenseCoreInventoryComponent* Component,
+	FName StackableItemID,
+	FString& OutReport)
+{
+	OutReport = TEXT("=== Component Self Test ===\n");
+	if (!Component || !Component->IsInitialized() || StackableItemID.IsNone())
+	{
+		OutReport += TEXT("Invalid component or item\n");
+		return false;
+	}
+
+	FSuspenseCoreSelfTestLog Log(OutReport);
+
+	auto Count = [Component, StackableItemID]()
+	{
+		return Component->Execute_GetItemCountByID(Component, StackableItemID);
+	};
+	auto Weight = [Component]()
+	{
+		return Component->Execute_GetCurrentWeight(Component);
+	};
+	auto CheckIntegrity = [Component, &Log](const TCHAR* Step)
+	{
+		TArray<FString> Errors;
+		const bool bValid = Component->ValidateIntegrity(Errors);
+		Log.Check(bValid, FString::Printf(TEXT("%s: integrity (%s)"), Step, *FString::Join(Errors, TEXT("; "))));
+	};
+
+	Component->Clear();
+
+	//==================================================================
+	// Add / stack
+	//==================================================================
+	if (!Log.Check(Component->Execute_AddItemByID(Component, StackableItemID, 5), TEXT("Add 5")))
+	{
+		Component->Clear();
+		return Log.Finish();
+	}
+	Log.Check(Count() == 5 && Component->GetAllItemInstances().Num() == 1, TEXT("Add: one stack of 5"));
+	const float FullWeight = Weight();
+	Log.Check(FullWeight > 0.0f, TEXT("Add: weight tracked"));
+	CheckIntegrity(TEXT("Add"));
+
+	Log.Check(Component->Execute_AddItemByID(Component, StackableItemID, 1) && Count() == 6, TEXT("Add 1 more"));
+	Log.Check(Component->Execute_RemoveItemByID(Component, StackableItemID, 1) && Count() == 5, TEXT("Remove 1"));
+	Log.Check(Weight() == FullWeight, TEXT("Add + remove: weight round-trips exactly"));
+
+	//==================================================================
+	// Split / consolidate
+	//==================================================================
+	const int32 StackSlot = Component->GetAllItemInstances()[0].SlotIndex;
+	Log.Check(Component->SplitStack(StackSlot, 2, INDEX_NONE), TEXT("Split 2"));
+	Log.Check(Component->GetAllItemInstances().Num() == 2 && Count() == 5, TEXT("Split: two stacks, same count"));
+	Log.Check(Weight() == FullWeight, TEXT("Split: weight unchanged"));
+	CheckIntegrity(TEXT("Split"));
+
+	Log.Check(Component->ConsolidateStacks(StackableItemID) > 0, TEXT("Consolidate"));
+	Log.Check(Component->GetAllItemInstances().Num() == 1 && Count() == 5, TEXT("Consolidate: one stack, same count"));
+	Log.Check(Weight() == FullWeight, TEXT("Consolidate: weight unchanged"));
+	CheckIntegrity(TEXT("Consolidate"));
+
+	//==================================================================
+	// Move / rotate
+	//==================================================================
+	const FSuspenseCoreItemInstance Stack = Component->GetAllItemInstances()[0];
+	const FIntPoint GridSize = Component->Execute_GetGridSize(Component);
+	int32 MoveTarget = INDEX_NONE;
+	for (int32 Slot = GridSize.X * GridSize.Y - 1; Slot >= 0; --Slot)
+	{
+		if (Slot != Stack.SlotIndex && Component->CanPlaceItemAtSlot(Stack.UniqueInstanceID, Slot, Stack.Rotation != 0))
+		{
+			MoveTarget = Slot;
+			break;
+		}
+	}
+	if (Log.Check(MoveTarget != INDEX_NONE, TEXT("Move: free target found")))
+	{
+		Log.Check(Component->Execute_MoveItem(Component, Stack.SlotIndex, MoveTarget), TEXT("Move"));
+		FSuspenseCoreItemInstance Moved;
+		Log.Check(Component->FindItemInstance(Stack.UniqueInstanceID, Moved) && Moved.SlotIndex == MoveTarget,
+			TEXT("Move: instance at target slot"));
+		CheckIntegrity(TEXT("Move"));
+
+		// Square items may legitimately refuse or no-op; only the grid must stay consistent
+		Component->RotateItemAtSlot(MoveTarget);
+		CheckIntegrity(TEXT("Rotate"));
+	}
+
+	//==================================================================
+	// Transactions
+	//==================================================================
+	Component->BeginTransaction();
+	Log.Check(Component->Execute_RemoveItemByID(Component, StackableItemID, 3) && Count() == 2, TEXT("Txn: remove 3"));
+	Component->RollbackTransaction();
+	Log.Check(Count() == 5 && !Component->IsTransactionActive(), TEXT("Rollback: count restored"));
+	Log.Check(Weight() == FullWeight, TEXT("Rollback: weight restored exactly"));
+	CheckIntegrity(TEXT("Rollback"));
+
+	Component->BeginTransaction();
+	Component->Execute_RemoveItemByID(Component, StackableItemID, 1);
+	Component->BeginTransaction();
+	Component->Execute_RemoveItemByID(Component, StackableItemID, 1);
+	Component->RollbackTransaction();
+	Log.Check(Count() == 4 && Component->GetTransactionDepth() == 1, TEXT("Nested rollback: inner change undone only"));
+	Component->CommitTransaction();
+	Log.Check(Count() == 4 && !Component->IsTransactionActive(), TEXT("Commit: outer change kept"));
+	CheckIntegrity(TEXT("Commit"));
+
+	Component->Clear();
+	Log.Check(Weight() == 0.0f && Component->Execute_GetTotalItemCount(Component) == 0, TEXT("Clear: empty, zero weight"));
+
+	return Log.Finish();
+}
+
+namespace
+{
+	/**
+	 * Clear Component and fill it with Count single-unit stacks of ItemID: add in bulk,
+	 * then split one unit off at a time. Grid and weight limits may stop it early.
+	 * @return Stacks actually seeded (0 if the item could not be added)
+	 */
+	int32 SeedSingleUnitStacks(USuspenseCoreInventoryComponent* Component, FName ItemID, int32 Count)
+	{
+		Component->Clear();
+		if (!Component->Execute_AddItemByID(Component, ItemID, Count))
+		{
+			return 0;
+		}
+
+		// Splitting keeps the source anchor, so one pass over the bulk stacks is enough
+		const TArray<FSuspenseCoreItemInstance> BulkStacks = Component->GetAllItemInstances();
+		int32 NumStacks = BulkStacks.Num();
+		for (const FSuspenseCoreItemInstance& Stack : BulkStacks)
+		{
+			for (int32 Remaining = Stack.Quantity; Remaining > 1 && NumStacks < Count; --Remaining)
+			{
+				if (!Component->SplitStack(Stack.SlotIndex, 1, INDEX_NONE))
+				{
+					return NumStacks;
+				}
+				++NumStacks;
+			}
+		}
+		return NumStacks;
+	}
+}
+
+void USuspenseCoreInventoryDebugger::BenchmarkTransactions(
+	USuspenseCoreInventoryComponent* Component,
+	FName StackableItemID,
+	const TArray<int32>& ItemCounts,
+	int32 TouchedPerTxn,
+	int32 Iterations,
+	FString& OutReport)
+{
+	OutReport = TEXT("=== Transaction Benchmark (Begin + RemoveItemByID + Rollback) ===\n");
+	if (!Component || !Component->IsInitialized() || StackableItemID.IsNone())
+	{
+		OutReport += TEXT("Invalid component or item\n");
+		return;
+	}
+
+	TouchedPerTxn = FMath::Max(1, TouchedPerTxn);
+	Iterations = FMath::Max(1, Iterations);
+
+	OutReport += FString::Printf(TEXT("Item: %s, removed per txn: %d, iterations: %d\n"),
+		*StackableItemID.ToString(), TouchedPerTxn, Iterations);
+	OutReport += TEXT("Stacks | Txn us/txn | Rollback us/txn\n");
+
+	for (const int32 ItemCount : ItemCounts)
+	{
+		if (ItemCount <= 0)
+		{
+			continue;
+		}
+
+		const int32 NumStacks = SeedSingleUnitStacks(Component, StackableItemID, ItemCount);
+		if (NumStacks == 0)
+		{
+			OutReport += FString::Printf(TEXT("%6d | could not add %s\n"), ItemCount, *StackableItemID.ToString());
+			continue;
+		}
+
+		const int32 Touched = FMath::Min(TouchedPerTxn, ItemCount);
+		const int32 CountBefore = Component->Execute_GetItemCountByID(Component, StackableItemID);
+
+		double RollbackSeconds = 0.0;
+		const double TxnStart = FPlatformTime::Seconds();
+		for (int32 Iter = 0; Iter < Iterations; ++Iter)
+		{
+			Component->BeginTransaction();
+			Component->Execute_RemoveItemByID(Component, StackableItemID, Touched);
+
+			const double RollbackStart = FPlatformTime::Seconds();
+			Component->RollbackTransaction();
+			RollbackSeconds += FPlatformTime::Seconds() - RollbackStart;
+		}
+		const double TxnUs = (FPlatformTime::Seconds() - TxnStart) * 1e6 / Iterations;
+
+		const bool bRestored = Component->Execute_GetItemCountByID(Component, StackableItemID) == CountBefore;
+		OutReport += FString::Printf(TEXT("%6d | %10.2f | %15.2f%s\n"),
+			NumStacks, TxnUs, RollbackSeconds * 1e6 / Iterations,
+			bRestored ? TEXT("") : TEXT("  (ROLLBACK MISMATCH)"));
+	}
+
+	Component->Clear();
+}
+
+namespace
+{
+	/** Synthetic item for the grid benchmarks */
+	struct FSuspenseCoreBenchGridItem
+	{
+		FGuid InstanceID;
+		FIntPoint Size = FIntPoint(1, 1);
+		int32 AnchorSlot = INDEX_NONE;
+		bool bRotated = false;
+	};
+
+	/**
+	 * Fill to ~TargetPercent occupied cells with a seeded 1x1..2x3 mix.
+	 * Overfills first, then removes random items, so holes are spread like a played inventory.
+	 */
+	void FillBenchGrid(USuspenseCoreInventoryStorage* Storage, int32 TargetPercent, int32 Seed, TArray<FSuspenseCoreBenchGridItem>& OutItems)
+	{
+		// 50% 1x1, 20% 1x2, 20% 2x2, 10% 2x3
+		static const FIntPoint Sizes[] = {
+			FIntPoint(1, 1), FIntPoint(1, 1), FIntPoint(1, 1), FIntPoint(1, 1), FIntPoint(1, 1),
+			FIntPoint(1, 2), FIntPoint(1, 2), FIntPoint(2, 2), FIntPoint(2, 2), FIntPoint(2, 3)
+		};
+
+		FRandomStream Random(Seed);
+		const FIntPoint GridSize = Storage->GetGridSize();
+		const int32 TotalCells = GridSize.X * GridSize.Y;
+		const int32 TargetCells = TotalCells * TargetPercent / 100;
+		const int32 OverfillCells = TargetCells + (TotalCells - TargetCells) / 2;
+
+		int32 Occupied = 0;
+		while (TargetCells > 0 && Occupied < OverfillCells)
+		{
+			FIntPoint Size = Sizes[Random.RandHelper(UE_ARRAY_COUNT(Sizes))];
+			bool bRotated = false;
+			int32 Slot = Storage->FindFreeSlot(Size, true, bRotated);
+			if (Slot == INDEX_NONE && Size != FIntPoint(1, 1))
+			{
+				Size = FIntPoint(1, 1);
+				Slot = Storage->FindFreeSlot(Size, false, bRotated);
+			}
+			if (Slot == INDEX_NONE)
+			{
+				break;
+			}
+
+			FSuspenseCoreBenchGridItem& Item = OutItems.AddDefaulted_GetRef();
+			Item.InstanceID = FGuid(Seed, OutItems.Num(), 0xB3AC, 1);
+			Item.Size = Size;
+			Item.AnchorSlot = Slot;
+			Item.bRotated = bRotated;
+			Storage->PlaceItem(Item.InstanceID, Size, Slot, bRotated);
+			Occupied += Size.X * Size.Y;
+		}
+
+		while (Occupied > TargetCells && OutItems.Num() > 0)
+		{
+			const int32 Index = Random.RandHelper(OutItems.Num());
+			Storage->RemoveItem(OutItems[Index].InstanceID);
+			Occupied -= OutItems[Index].Size.X * OutItems[Index].Size.Y;
+			OutItems.RemoveAtSwap(Index);
+		}
+	}
+
+}
+
+void USuspenseCoreInventoryDebugger::BenchmarkGrid(
+	int32 GridWidth,
+	const TArray<int32>& GridHeights,
+	const TArray<int32>& FillPercents,
+	int32 Iterations,
+	FString& OutCsv)
+{
+	Iterations = FMath::Max(1, Iterations);
+
+	OutCsv = TEXT("op,grid_w,grid_h,fill_target_pct,fill_actual_pct,items,iterations,ns_per_op\n");
+
+	USuspenseCoreInventoryStorage* Storage = NewObject<USuspenseCoreInventoryStorage>(GetTransientPackage());
+
+	for (const int32 GridHeight : GridHeights)
+	{
+		if (GridHeight <= 0)
+		{
+			continue;
+		}
+
+		for (const int32 RawFill : FillPercents)
+		{
+			const int32 FillPercent = FMath::Clamp(RawFill, 0, 95);
+
+			// Storage clamps to its own limits - rows report (and loops use) the real size
+			Storage->Initialize(GridWidth, GridHeight);
+			const FIntPoint GridSize = Storage->GetGridSize();
+
+			TArray<FSuspenseCoreBenchGridItem> Items;
+			FillBenchGrid(Storage, FillPercent, GridSize.X * 100000 + GridSize.Y * 100 + FillPercent, Items);
+
+			const int32 TotalCells = GridSize.X * GridSize.Y;
+			const float ActualFill = 100.0f * (TotalCells - Storage->GetFreeSlotCount()) / TotalCells;
+
+			auto AddRow = [&](const TCHAR* Op, double Seconds, int64 Ops)
+			{
+				OutCsv += FString::Printf(TEXT("%s,%d,%d,%d,%.1f,%d,%d,%.1f\n"),
+					Op, GridSize.X, GridSize.Y, FillPercent, ActualFill, Items.Num(), Iterations,
+					Ops > 0 ? Seconds * 1e9 / Ops : 0.0);
+			};
+
+			bool bRotated = false;
+
+			// FindFreeSlot on an unchanged grid (fit hints stay warm, like repeated CanReceiveItem)
+			{
+				const double Start = FPlatformTime::Seconds();
+				for (int32 Iter = 0; Iter < Iterations; ++Iter)
+				{
+					Storage->FindFreeSlot(FIntPoint(1, 1), true, bRotated);
+					Storage->FindFreeSlot(FIntPoint(2, 2), true, bRotated);
+					Storage->FindFreeSlot(FIntPoint(2, 3), true, bRotated);
+				}
+				AddRow(TEXT("FindFreeSlot"), FPlatformTime::Seconds() - Start, int64(Iterations) * 3);
+			}
+
+			// Remove + find + re-place: every removal drops the hints
+			{
+				const double Start = FPlatformTime::Seconds();
+				for (int32 Iter = 0; Iter < Iterations; ++Iter)
+				{
+					if (Items.Num() == 0)
+					{
+						Storage->FindFreeSlot(FIntPoint(1, 1), true, bRotated);
+						continue;
+					}
+
+					FSuspenseCoreBenchGridItem& Item = Items[Iter % Items.Num()];
+					Storage->RemoveItem(Item.InstanceID);
+					const int32 Slot = Storage->FindFreeSlot(Item.Size, true, bRotated);
+					if (Slot != INDEX_NONE && Storage->PlaceItem(Item.InstanceID, Item.Size, Slot, bRotated))
+					{
+						Item.AnchorSlot = Slot;
+						Item.bRotated = bRotated;
+					}
+					else
+					{
+						Storage->PlaceItem(Item.InstanceID, Item.Size, Item.AnchorSlot, Item.bRotated);
+					}
+				}
+				AddRow(TEXT("FindFreeSlotChurn"), FPlatformTime::Seconds() - Start, Iterations);
+			}
+
+			// CanPlaceItem at every anchor
+			{
+				const double Start = FPlatformTime::Seconds();
+				for (int32 Iter = 0; Iter < Iterations; ++Iter)
+				{
+					for (int32 Slot = 0; Slot < TotalCells; ++Slot)
+					{
+						Storage->CanPlaceItem(FIntPoint(2, 2), Slot, false);
+					}
+				}
+				AddRow(TEXT("CanPlaceItem"), FPlatformTime::Seconds() - Start, int64(Iterations) * TotalCells);
+			}
+		}
+	}
+}
+
 void USuspenseCoreInventoryDebugger::SetDebugDrawEnabled(USuspenseCoreInventoryComponent* Component, bool bEnable)
 {
 	// Would set a flag on component to enable debug drawing
@@ -520,6 +1061,36 @@ void USuspenseCoreInventoryDebugger::RegisterConsoleCommands()
 		TEXT("List all registered inventories"),
 		FConsoleCommandWithArgsDelegate::CreateStatic(&HandleListCommand)
 	));
+
+	ConsoleCommands.Add(IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("SuspenseCore.Inventory.BenchTransactions"),
+		TEXT("Begin/remove/rollback on the local player's inventory at 50/200/400 stacks (clears it). Args: <StackableItemID> [Touched=4] [Iterations=1000]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&HandleBenchTransactionsCommand)
+	));
+
+	ConsoleCommands.Add(IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("SuspenseCore.Inventory.SelfTest"),
+		TEXT("Headless grid storage and undo log checks"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&HandleSelfTestCommand)
+	));
+
+	ConsoleCommands.Add(IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("SuspenseCore.Inventory.SelfTestComponent"),
+		TEXT("Stack/split/move/transaction checks on the local player's inventory (clears it). Args: <StackableItemID>"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&HandleSelfTestComponentCommand)
+	));
+
+	ConsoleCommands.Add(IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("SuspenseCore.Inventory.BenchGrid"),
+		TEXT("Grid benchmarks at 10x10..10x100, 0-95% fill, written as CSV. Args: [Iterations=200] [CsvPath=Saved/Benchmarks/InventoryGrid-<time>.csv]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&HandleBenchGridCommand)
+	));
+
+	ConsoleCommands.Add(IConsoleManager::Get().RegisterConsoleCommand(
+		TEXT("SuspenseCore.Inventory.BenchReplicationBytes"),
+		TEXT("Bytes per op of the quantized inventory delta vs the FastArray item layout. Args: [Items=40]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&HandleBenchReplicationBytesCommand)
+	));
 #endif
 }
 
@@ -534,6 +1105,30 @@ void USuspenseCoreInventoryDebugger::UnregisterConsoleCommands()
 #endif
 }
 
+namespace
+{
+	/** Inventory lives on the pawn or the player state depending on the game mode */
+	USuspenseCoreInventoryComponent* FindLocalPlayerInventory(UWorld* World)
+	{
+		APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+		if (!PC)
+		{
+			return nullptr;
+		}
+
+		USuspenseCoreInventoryComponent* Component = nullptr;
+		if (APawn* Pawn = PC->GetPawn())
+		{
+			Component = Pawn->FindComponentByClass<USuspenseCoreInventoryComponent>();
+		}
+		if (!Component && PC->PlayerState)
+		{
+			Component = PC->PlayerState->FindComponentByClass<USuspenseCoreInventoryComponent>();
+		}
+		return Component;
+	}
+}
+
 void USuspenseCoreInventoryDebugger::HandleDebugCommand(const TArray<FString>& Args)
 {
 	UE_LOG(LogSuspenseCoreInventory, Log, TEXT("Inventory Debug Command"));
@@ -555,3 +1150,90 @@ void USuspenseCoreInventoryDebugger::HandleClearCommand(const TArray<FString>& A
 {
 	// inventory.clear
 }
+
+void USuspenseCoreInventoryDebugger::HandleBenchTransactionsCommand(const TArray<FString>& Args, UWorld* World)
+{
+	if (Args.Num() < 1)
+	{
+		UE_LOG(LogSuspenseCoreInventory, Warning, TEXT("Usage: SuspenseCore.Inventory.BenchTransactions <StackableItemID> [Touched] [Iterations]"));
+		return;
+	}
+
+	USuspenseCoreInventoryComponent* Component = FindLocalPlayerInventory(World);
+	if (!Component)
+	{
+		UE_LOG(LogSuspenseCoreInventory, Warning, TEXT("SuspenseCore.Inventory.BenchTransactions: no local player inventory"));
+		return;
+	}
+
+	const int32 Touched = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 4;
+	const int32 Iterations = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 1000;
+
+	FString Report;
+	BenchmarkTransactions(Component, FName(*Args[0]), { 50, 200, 400 }, Touched, Iterations, Report);
+	UE_LOG(LogSuspenseCoreInventory, Log, TEXT("%s"), *Report);
+}
+
+void USuspenseCoreInventoryDebugger::HandleSelfTestCommand(const TArray<FString>& Args)
+{
+	FString Report;
+	const bool bPassed = RunGridSelfTest(Report);
+	UE_LOG(LogSuspenseCoreInventory, Log, TEXT("%s"), *Report);
+	if (!bPassed)
+	{
+		UE_LOG(LogSuspenseCoreInventory, Error, TEXT("SuspenseCore.Inventory.SelfTest: FAILED"));
+	}
+}
+
+void USuspenseCoreInventoryDebugger::HandleSelfTestComponentCommand(const TArray<FString>& Args, UWorld* World)
+{
+	if (Args.Num() < 1)
+	{
+		UE_LOG(LogSuspenseCoreInventory, Warning, TEXT("Usage: SuspenseCore.Inventory.SelfTestComponent <StackableItemID>"));
+		return;
+	}
+
+	USuspenseCoreInventoryComponent* Component = FindLocalPlayerInventory(World);
+	if (!Component)
+	{
+		UE_LOG(LogSuspenseCoreInventory, Warning, TEXT("SuspenseCore.Inventory.SelfTestComponent: no local player inventory"));
+		return;
+	}
+
+	FString Report;
+	const bool bPassed = RunComponentSelfTest(Component, FName(*Args[0]), Report);
+	UE_LOG(LogSuspenseCoreInventory, Log, TEXT("%s"), *Report);
+	if (!bPassed)
+	{
+		UE_LOG(LogSuspenseCoreInventory, Error, TEXT("SuspenseCore.Inventory.SelfTestComponent: FAILED"));
+	}
+}
+
+void USuspenseCoreInventoryDebugger::HandleBenchGridCommand(const TArray<FString>& Args)
+{
+	const int32 Iterations = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 200;
+	const FString CsvPath = Args.Num() > 1
+		? Args[1]
+		: FPaths::ProjectSavedDir() / TEXT("Benchmarks") / FString::Printf(TEXT("InventoryGrid-%s.csv"), *FDateTime::Now().ToString());
+
+	FString Csv;
+	BenchmarkGrid(10, { 10, 25, 50, 100 }, { 0, 25, 50, 75, 90, 95 }, Iterations, Csv);
+	UE_LOG(LogSuspenseCoreInventory, Log, TEXT("%s"), *Csv);
+
+	if (FFileHelper::SaveStringToFile(Csv, *CsvPath))
+	{
+		UE_LOG(LogSuspenseCoreInventory, Log, TEXT("SuspenseCore.Inventory.BenchGrid: wrote %s"), *CsvPath);
+	}
+	else
+	{
+		UE_LOG(LogSuspenseCoreInventory, Warning, TEXT("SuspenseCore.Inventory.BenchGrid: could not write %s"), *CsvPath);
+	}
+}
+
+void USuspenseCoreInventoryDebugger::HandleBenchReplicationBytesCommand(const TArray<FString>& Args)
+{
+	const int32 NumItems = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 40;
+
+	const FString Report = FSuspenseCoreInventoryNetCodec::RunBenchmark(NumItems);
+	UE_LOG(LogSuspenseCoreInventory, Log, TEXT("%s"), *Report);
+}
@@ -53,10 +53,7 @@ void USuspenseCoreInventoryReplicator::RequestFullSync()
 
 void USuspenseCoreInventoryReplicator::MarkItemDirty(const FGuid& InstanceID)
 {
-	if (!DirtyItems.Contains(InstanceID))
-	{
-		DirtyItems.Add(InstanceID);
-	}
+	DirtyItems.Add(InstanceID);
 }
 
 void USuspenseCoreInventoryReplicator::MarkAllDirty()
@@ -66,8 +63,9 @@ void USuspenseCoreInventoryReplicator::MarkAllDirty()
 		return;
 	}
 
-	DirtyItems.Empty();
+	DirtyItems.Reset();
 	TArray<FSuspenseCoreItemInstance> Items = TargetComponent->GetAllItemInstances();
+	DirtyItems.Reserve(Items.Num());
 	for (const FSuspenseCoreItemInstance& Item : Items)
 	{
 		DirtyItems.Add(Item.UniqueInstanceID);
@@ -88,7 +86,8 @@ void USuspenseCoreInventoryReplicator::FlushReplication()
 	Stats.LastSyncTime = TargetComponent->GetWorld() ?
 		TargetComponent->GetWorld()->GetTimeSeconds() : 0.0f;
 
-	// Estimate bytes (rough calculation)
+	// Estimate bytes (upper bound: in-memory size; the quantized wire record is far
+	// smaller, see SuspenseCore.Inventory.BenchReplicationBytes)
 	Stats.BytesSent += DirtyItems.Num() * sizeof(FSuspenseCoreReplicatedItem);
 
 	FSuspenseCoreInventoryLogHelper::LogReplication(TEXT("Flush"), DirtyItems.Num());
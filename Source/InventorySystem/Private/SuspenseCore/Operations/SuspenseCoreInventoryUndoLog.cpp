@@ -0,0 +1,103 @@
+// SuspenseCoreInventoryUndoLog.cpp
+// SuspenseCore - EventBus Architecture
+// Copyright Suspense Team. All Rights Reserved.
+
+#include "SuspenseCore/Operations/SuspenseCoreInventoryUndoLog.h"
+
+void FSuspenseCoreInventoryUndoLog::BeginSavepoint()
+{
+	Savepoints.Add(Entries.Num());
+}
+
+void FSuspenseCoreInventoryUndoLog::Record(const FGuid& InstanceID, const FSuspenseCoreItemInstance* Current)
+{
+	const int32 Depth = Savepoints.Num();
+	if (Depth == 0 || !InstanceID.IsValid())
+	{
+		return;
+	}
+
+	int32& Logged = LoggedDepth.FindOrAdd(InstanceID, INDEX_NONE);
+	if (Logged == Depth)
+	{
+		// Pre-image for this level already captured
+		return;
+	}
+
+	FSuspenseCoreInventoryUndoEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.InstanceID = InstanceID;
+	Entry.bExisted = Current != nullptr;
+	if (Current)
+	{
+		Entry.PreImage = *Current;
+	}
+	Entry.PrevLoggedDepth = Logged;
+
+	Logged = Depth;
+}
+
+void FSuspenseCoreInventoryUndoLog::ReleaseSavepoint()
+{
+	if (Savepoints.Num() <= 1)
+	{
+		Reset();
+		return;
+	}
+
+	const int32 ParentDepth = Savepoints.Num() - 1;
+	const int32 FirstEntry = Savepoints.Pop(EAllowShrinking::No);
+
+	// Parent keeps its own (older) pre-image where it has one; the rest are adopted
+	int32 WriteIndex = FirstEntry;
+	for (int32 ReadIndex = FirstEntry; ReadIndex < Entries.Num(); ++ReadIndex)
+	{
+		FSuspenseCoreInventoryUndoEntry& Entry = Entries[ReadIndex];
+		LoggedDepth.FindChecked(Entry.InstanceID) = ParentDepth;
+
+		if (Entry.PrevLoggedDepth == ParentDepth)
+		{
+			continue;
+		}
+
+		if (WriteIndex != ReadIndex)
+		{
+			Entries[WriteIndex] = MoveTemp(Entry);
+		}
+		++WriteIndex;
+	}
+	Entries.SetNum(WriteIndex, EAllowShrinking::No);
+}
+
+void FSuspenseCoreInventoryUndoLog::PopSavepoint(TArray<FSuspenseCoreInventoryUndoEntry>& OutEntries)
+{
+	OutEntries.Reset();
+	if (Savepoints.Num() == 0)
+	{
+		return;
+	}
+
+	const int32 FirstEntry = Savepoints.Pop(EAllowShrinking::No);
+
+	OutEntries.Reserve(Entries.Num() - FirstEntry);
+	for (int32 Index = Entries.Num() - 1; Index >= FirstEntry; --Index)
+	{
+		FSuspenseCoreInventoryUndoEntry& Entry = Entries[Index];
+		if (Entry.PrevLoggedDepth == INDEX_NONE)
+		{
+			LoggedDepth.Remove(Entry.InstanceID);
+		}
+		else
+		{
+			LoggedDepth.FindChecked(Entry.InstanceID) = Entry.PrevLoggedDepth;
+		}
+		OutEntries.Add(MoveTemp(Entry));
+	}
+	Entries.SetNum(FirstEntry, EAllowShrinking::No);
+}
+
+void FSuspenseCoreInventoryUndoLog::Reset()
+{
+	Entries.Reset();
+	Savepoints.Reset();
+	LoggedDepth.Reset();
+}
@@ -16,12 +16,14 @@ void USuspenseCoreInventoryStorage::Initialize(int32 InGridWidth, int32 InGridHe
 {
 	check(IsInGameThread());
 
-	GridWidth = FMath::Clamp(InGridWidth, 1, 50);
-	GridHeight = FMath::Clamp(InGridHeight, 1, 50);
+	GridWidth = FMath::Clamp(InGridWidth, 1, MaxGridWidth);
+	GridHeight = FMath::Clamp(InGridHeight, 1, MaxGridHeight);
 
 	int32 TotalSlots = GridWidth * GridHeight;
 	Slots.SetNum(TotalSlots);
-	FreeSlotBitmap.Init(true, TotalSlots);
+	RowOccupancy.Init(0, GridHeight);
+	FitSearchHints.Reset();
+	Placements.Reset();
 
 	for (FSuspenseCoreInventorySlot& Slot : Slots)
 	{
@@ -105,32 +107,43 @@ bool USuspenseCoreInventoryStorage::CanPlaceItem(FIntPoint ItemSize, int32 SlotI
 	FIntPoint StartCoords = SlotToCoords(SlotIndex);
 
 	// Check bounds
-	if (StartCoords.X + EffectiveSize.X > GridWidth ||
+	if (EffectiveSize.X <= 0 || EffectiveSize.Y <= 0 ||
+		StartCoords.X + EffectiveSize.X > GridWidth ||
 		StartCoords.Y + EffectiveSize.Y > GridHeight)
 	{
 		return false;
 	}
 
-	// Check each cell
-	for (int32 Y = 0; Y < EffectiveSize.Y; ++Y)
+	return IsAreaFree(StartCoords, EffectiveSize, IgnoreInstanceID);
+}
+
+bool USuspenseCoreInventoryStorage::IsAreaFree(FIntPoint StartCoords, FIntPoint EffectiveSize, const FGuid& IgnoreInstanceID) const
+{
+	const uint64 FootprintMask = MakeRunMask(EffectiveSize.X) << StartCoords.X;
+
+	for (int32 Y = StartCoords.Y; Y < StartCoords.Y + EffectiveSize.Y; ++Y)
 	{
-		for (int32 X = 0; X < EffectiveSize.X; ++X)
+		uint64 Conflicts = RowOccupancy[Y] & FootprintMask;
+		if (Conflicts == 0)
 		{
-			int32 CheckSlot = CoordsToSlot(FIntPoint(StartCoords.X + X, StartCoords.Y + Y));
-			if (CheckSlot == INDEX_NONE)
-			{
-				return false;
-			}
+			continue;
+		}
 
-			if (IsSlotOccupied(CheckSlot))
+		if (!IgnoreInstanceID.IsValid())
+		{
+			return false;
+		}
+
+		// Only the colliding cells need a slot lookup (moves ignore their own footprint)
+		const int32 RowBase = Y * GridWidth;
+		while (Conflicts != 0)
+		{
+			const int32 X = static_cast<int32>(FMath::CountTrailingZeros64(Conflicts));
+			if (Slots[RowBase + X].InstanceID != IgnoreInstanceID)
 			{
-				// Check if this is the item we're ignoring (for moves)
-				if (IgnoreInstanceID.IsValid() && Slots[CheckSlot].InstanceID == IgnoreInstanceID)
-				{
-					continue;
-				}
 				return false;
 			}
+			Conflicts &= Conflicts - 1;
 		}
 	}
 
@@ -159,11 +172,16 @@ bool USuspenseCoreInventoryStorage::PlaceItem(FGuid InstanceID, FIntPoint ItemSi
 				Slots[CellSlot].InstanceID = InstanceID;
 				Slots[CellSlot].bIsAnchor = (X == 0 && Y == 0);
 				Slots[CellSlot].OffsetFromAnchor = FIntPoint(X, Y);
-				FreeSlotBitmap[CellSlot] = false;
 			}
 		}
 	}
 
+	SetAreaOccupied(StartCoords, EffectiveSize, true);
+
+	FPlacement& Placement = Placements.FindOrAdd(InstanceID);
+	Placement.AnchorSlot = SlotIndex;
+	Placement.EffectiveSize = EffectiveSize;
+
 	return true;
 }
 
@@ -171,19 +189,28 @@ bool USuspenseCoreInventoryStorage::RemoveItem(FGuid InstanceID)
 {
 	check(IsInGameThread());
 
-	bool bRemoved = false;
+	FPlacement Placement;
+	if (!Placements.RemoveAndCopyValue(InstanceID, Placement))
+	{
+		return false;
+	}
 
-	for (int32 i = 0; i < Slots.Num(); ++i)
+	const FIntPoint StartCoords = SlotToCoords(Placement.AnchorSlot);
+	for (int32 Y = 0; Y < Placement.EffectiveSize.Y; ++Y)
 	{
-		if (Slots[i].InstanceID == InstanceID)
+		for (int32 X = 0; X < Placement.EffectiveSize.X; ++X)
 		{
-			Slots[i].Clear();
-			FreeSlotBitmap[i] = true;
-			bRemoved = true;
+			const int32 CellSlot = CoordsToSlot(FIntPoint(StartCoords.X + X, StartCoords.Y + Y));
+			if (CellSlot != INDEX_NONE && Slots[CellSlot].InstanceID == InstanceID)
+			{
+				Slots[CellSlot].Clear();
+			}
 		}
 	}
 
-	return bRemoved;
+	// Also resets fit hints - freed cells can create fits above any cached start row
+	SetAreaOccupied(StartCoords, Placement.EffectiveSize, false);
+	return true;
 }
 
 bool USuspenseCoreInventoryStorage::MoveItem(FGuid InstanceID, FIntPoint ItemSize, int32 NewSlotIndex, bool bRotated)
@@ -207,42 +234,90 @@ int32 USuspenseCoreInventoryStorage::FindFreeSlot(FIntPoint ItemSize, bool bAllo
 {
 	OutRotated = false;
 
+	if (!bIsInitialized)
+	{
+		return INDEX_NONE;
+	}
+
 	// Try normal orientation first
-	for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+	const int32 FoundSlot = FindFirstFit(ItemSize);
+	if (FoundSlot != INDEX_NONE)
 	{
-		if (CanPlaceItem(ItemSize, SlotIndex, false))
-		{
-			return SlotIndex;
-		}
+		return FoundSlot;
 	}
 
 	// Try rotated if allowed
 	if (bAllowRotation && ItemSize.X != ItemSize.Y)
 	{
-		for (int32 SlotIndex = 0; SlotIndex < Slots.Num(); ++SlotIndex)
+		const int32 RotatedSlot = FindFirstFit(GetEffectiveSize(ItemSize, true));
+		if (RotatedSlot != INDEX_NONE)
 		{
-			if (CanPlaceItem(ItemSize, SlotIndex, true))
-			{
-				OutRotated = true;
-				return SlotIndex;
-			}
+			OutRotated = true;
+			return RotatedSlot;
 		}
 	}
 
 	return INDEX_NONE;
 }
 
-int32 USuspenseCoreInventoryStorage::GetFreeSlotCount() const
+int32 USuspenseCoreInventoryStorage::FindFirstFit(FIntPoint EffectiveSize) const
 {
-	int32 Count = 0;
-	for (int32 i = 0; i < FreeSlotBitmap.Num(); ++i)
+	if (EffectiveSize.X <= 0 || EffectiveSize.Y <= 0 ||
+		EffectiveSize.X > GridWidth || EffectiveSize.Y > GridHeight)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 LastStartRow = GridHeight - EffectiveSize.Y;
+	int32& StartRowHint = FitSearchHints.FindOrAdd(EffectiveSize, 0);
+	if (StartRowHint > LastStartRow)
+	{
+		return INDEX_NONE;
+	}
+
+	const uint64 RowMask = GetRowMask();
+
+	// Bits X where EffectiveSize.X consecutive cells starting at X are free in row Y
+	auto GetRowFitMask = [this, RowMask, Width = EffectiveSize.X](int32 Y) -> uint64
 	{
-		if (FreeSlotBitmap[i])
+		const uint64 Free = ~RowOccupancy[Y] & RowMask;
+		uint64 Fit = Free;
+		for (int32 Shift = 1; Shift < Width && Fit != 0; ++Shift)
 		{
-			++Count;
+			Fit &= Free >> Shift;
 		}
+		return Fit;
+	};
+
+	for (int32 StartY = StartRowHint; StartY <= LastStartRow; ++StartY)
+	{
+		// AND the horizontal fit masks of every row the footprint covers
+		uint64 Candidates = GetRowFitMask(StartY);
+		for (int32 DY = 1; DY < EffectiveSize.Y && Candidates != 0; ++DY)
+		{
+			Candidates &= GetRowFitMask(StartY + DY);
+		}
+
+		if (Candidates != 0)
+		{
+			// Placements never create fits, so nothing above StartY can fit until a removal
+			StartRowHint = StartY;
+			return StartY * GridWidth + static_cast<int32>(FMath::CountTrailingZeros64(Candidates));
+		}
+	}
+
+	StartRowHint = LastStartRow + 1;
+	return INDEX_NONE;
+}
+
+int32 USuspenseCoreInventoryStorage::GetFreeSlotCount() const
+{
+	int32 OccupiedCount = 0;
+	for (const uint64 Row : RowOccupancy)
+	{
+		OccupiedCount += static_cast<int32>(FMath::CountBits(Row));
 	}
-	return Count;
+	return Slots.Num() - OccupiedCount;
 }
 
 float USuspenseCoreInventoryStorage::GetFragmentationRatio() const
@@ -258,19 +333,12 @@ float USuspenseCoreInventoryStorage::GetFragmentationRatio() const
 		return 0.0f;
 	}
 
-	// Count transitions between occupied/free
+	// Count transitions between occupied/free (adjacent bits that differ)
+	const uint64 PairMask = MakeRunMask(GridWidth - 1);
 	int32 Transitions = 0;
-	for (int32 Y = 0; Y < GridHeight; ++Y)
+	for (const uint64 Row : RowOccupancy)
 	{
-		for (int32 X = 0; X < GridWidth - 1; ++X)
-		{
-			int32 Slot1 = CoordsToSlot(FIntPoint(X, Y));
-			int32 Slot2 = CoordsToSlot(FIntPoint(X + 1, Y));
-			if (FreeSlotBitmap[Slot1] != FreeSlotBitmap[Slot2])
-			{
-				++Transitions;
-			}
-		}
+		Transitions += static_cast<int32>(FMath::CountBits((Row ^ (Row >> 1)) & PairMask));
 	}
 
 	// Normalize by theoretical max transitions
@@ -302,15 +370,18 @@ bool USuspenseCoreInventoryStorage::IsValidCoords(FIntPoint Coords) const
 		   Coords.Y >= 0 && Coords.Y < GridHeight;
 }
 
+int32 USuspenseCoreInventoryStorage::GetAnchorSlotForInstance(FGuid InstanceID) const
+{
+	const FPlacement* Placement = Placements.Find(InstanceID);
+	return Placement ? Placement->AnchorSlot : INDEX_NONE;
+}
+
 TArray<int32> USuspenseCoreInventoryStorage::GetOccupiedSlots(FGuid InstanceID) const
 {
 	TArray<int32> Result;
-	for (int32 i = 0; i < Slots.Num(); ++i)
+	if (const FPlacement* Placement = Placements.Find(InstanceID))
 	{
-		if (Slots[i].InstanceID == InstanceID)
-		{
-			Result.Add(i);
-		}
+		GetPlacementSlots(*Placement, Result);
 	}
 	return Result;
 }
@@ -318,13 +389,14 @@ TArray<int32> USuspenseCoreInventoryStorage::GetOccupiedSlots(FGuid InstanceID)
 TArray<int32> USuspenseCoreInventoryStorage::GetAllAnchorSlots() const
 {
 	TArray<int32> Result;
-	for (int32 i = 0; i < Slots.Num(); ++i)
+	Result.Reserve(Placements.Num());
+	for (const TPair<FGuid, FPlacement>& Pair : Placements)
 	{
-		if (!Slots[i].IsEmpty() && Slots[i].bIsAnchor)
-		{
-			Result.Add(i);
-		}
+		Result.Add(Pair.Value.AnchorSlot);
 	}
+
+	// Keep grid order for callers that iterate anchors for display
+	Result.Sort();
 	return Result;
 }
 
@@ -384,10 +456,78 @@ TArray<int32> USuspenseCoreInventoryStorage::CalculateOccupiedSlots(int32 Anchor
 	return Result;
 }
 
+uint64 USuspenseCoreInventoryStorage::MakeRunMask(int32 Width)
+{
+	if (Width <= 0)
+	{
+		return 0;
+	}
+	return Width >= 64 ? ~uint64(0) : ((uint64(1) << Width) - 1);
+}
+
+void USuspenseCoreInventoryStorage::SetAreaOccupied(FIntPoint StartCoords, FIntPoint EffectiveSize, bool bOccupied)
+{
+	const uint64 FootprintMask = MakeRunMask(EffectiveSize.X) << StartCoords.X;
+	const int32 EndY = FMath::Min(StartCoords.Y + EffectiveSize.Y, GridHeight);
+
+	for (int32 Y = StartCoords.Y; Y < EndY; ++Y)
+	{
+		if (bOccupied)
+		{
+			RowOccupancy[Y] |= FootprintMask;
+		}
+		else
+		{
+			RowOccupancy[Y] &= ~FootprintMask;
+		}
+	}
+
+	if (!bOccupied)
+	{
+		FitSearchHints.Reset();
+	}
+}
+
+void USuspenseCoreInventoryStorage::GetPlacementSlots(const FPlacement& Placement, TArray<int32>& OutSlots) const
+{
+	const FIntPoint StartCoords = SlotToCoords(Placement.AnchorSlot);
+	OutSlots.Reserve(OutSlots.Num() + Placement.EffectiveSize.X * Placement.EffectiveSize.Y);
+
+	for (int32 Y = 0; Y < Placement.EffectiveSize.Y; ++Y)
+	{
+		for (int32 X = 0; X < Placement.EffectiveSize.X; ++X)
+		{
+			const int32 CellSlot = CoordsToSlot(FIntPoint(StartCoords.X + X, StartCoords.Y + Y));
+			if (CellSlot != INDEX_NONE)
+			{
+				OutSlots.Add(CellSlot);
+			}
+		}
+	}
+}
+
 void USuspenseCoreInventoryStorage::UpdateFreeBitmap()
 {
+	RowOccupancy.Init(0, GridHeight);
+	Placements.Reset();
+
 	for (int32 i = 0; i < Slots.Num(); ++i)
 	{
-		FreeSlotBitmap[i] = Slots[i].IsEmpty();
+		const FSuspenseCoreInventorySlot& Slot = Slots[i];
+		if (Slot.IsEmpty())
+		{
+			continue;
+		}
+
+		RowOccupancy[i / GridWidth] |= uint64(1) << (i % GridWidth);
+
+		// Footprint extent = furthest offset seen + 1
+		const int32 AnchorSlot = Slot.bIsAnchor ? i : GetAnchorSlot(i);
+		FPlacement& Placement = Placements.FindOrAdd(Slot.InstanceID);
+		Placement.AnchorSlot = AnchorSlot;
+		Placement.EffectiveSize.X = FMath::Max(Placement.EffectiveSize.X, Slot.OffsetFromAnchor.X + 1);
+		Placement.EffectiveSize.Y = FMath::Max(Placement.EffectiveSize.Y, Slot.OffsetFromAnchor.Y + 1);
 	}
+
+	FitSearchHints.Reset();
 }
@@ -14,6 +14,7 @@
 #include "SuspenseCore/Types/UI/SuspenseCoreUIContainerTypes.h"
 #include "SuspenseCore/Types/SuspenseCoreTypes.h"  // FSuspenseCoreSubscriptionHandle, FSuspenseCoreNativeEventCallback
 #include "SuspenseCore/Base/SuspenseCoreInventoryLogs.h"
+#include "SuspenseCore/Operations/SuspenseCoreInventoryUndoLog.h"
 #include "SuspenseCoreInventoryComponent.generated.h"
 
 //==================================================================
@@ -140,11 +141,19 @@ public:
 	// ISuspenseCoreInventory - Transaction System
 	//==================================================================
 
+	/**
+	 * Transactions are undo-logged: only instances touched after Begin are copied.
+	 * Begin while active opens a nested savepoint; Commit/Rollback close the innermost one.
+	 */
 	virtual void BeginTransaction() override;
 	virtual void CommitTransaction() override;
 	virtual void RollbackTransaction() override;
 	virtual bool IsTransactionActive() const override;
 
+	/** Number of open (nested) transactions */
+	UFUNCTION(BlueprintPure, Category = "SuspenseCore|Inventory")
+	int32 GetTransactionDepth() const { return UndoLog.GetDepth(); }
+
 	//==================================================================
 	// ISuspenseCoreInventory - Stack Operations
 	//==================================================================
@@ -175,6 +184,11 @@ public:
 	virtual FString GetDebugString() const override;
 	virtual void LogContents() const override;
 
+#if WITH_DEV_AUTOMATION_TESTS
+	/** Register item statics without a DataManager, so automation tests can run headless */
+	void SetItemStaticsForTest(FName ItemID, float UnitWeight, FIntPoint GridSize, int32 MaxStackSize);
+#endif
+
 	//==================================================================
 	// ISuspenseCoreUIDataProvider - Identity
 	//==================================================================
@@ -489,6 +503,13 @@ private:
 	UPROPERTY(Transient)
 	TArray<FSuspenseCoreItemInstance> ItemInstances;
 
+	/**
+	 * InstanceID -> index into ItemInstances.
+	 * Mutate ItemInstances through AppendItemInstance/RemoveItemInstanceAt,
+	 * or call RebuildInstanceIndex after bulk assignment.
+	 */
+	TMap<FGuid, int32> InstanceIndexByID;
+
 	//==================================================================
 	// Grid Storage (SSOT for all Grid Operations)
 	//==================================================================
@@ -544,10 +565,16 @@ private:
 	UPROPERTY(ReplicatedUsing = OnRep_ReplicatedInventory)
 	FSuspenseCoreReplicatedInventory ReplicatedInventory;
 
-	/** Current total weight */
+	/** Current total weight (mirror of TrackedWeightGrams for readers) */
 	UPROPERTY(Transient)
 	float CurrentWeight;
 
+	/**
+	 * Running weight sum in grams. Fixed point so add/remove/split/stack
+	 * deltas cancel exactly and never drift from a full recompute.
+	 */
+	int64 TrackedWeightGrams = 0;
+
 	/** Is inventory initialized */
 	UPROPERTY(Transient)
 	bool bIsInitialized;
@@ -570,13 +597,20 @@ private:
 	// Transaction State
 	//==================================================================
 
-	/** Transaction snapshot */
-	UPROPERTY(Transient)
-	FSuspenseCoreInventorySnapshot TransactionSnapshot;
+	/** Pre-images of instances touched by open transactions */
+	FSuspenseCoreInventoryUndoLog UndoLog;
 
-	/** Is transaction active */
-	UPROPERTY(Transient)
-	bool bTransactionActive;
+	/** Set while RollbackTransaction replays the log (suppresses re-logging) */
+	bool bReplayingUndoLog = false;
+
+	/** Log pre-image before writing an instance (no-op outside transactions) */
+	void RecordUndo(const FGuid& InstanceID, const FSuspenseCoreItemInstance* Current)
+	{
+		if (!bReplayingUndoLog && UndoLog.IsActive())
+		{
+			UndoLog.Record(InstanceID, Current);
+		}
+	}
 
 	//==================================================================
 	// Cached References
@@ -665,15 +699,65 @@ private:
 	/** Check if coordinates are valid */
 	bool IsValidGridCoords(FIntPoint Coords) const;
 
-	/** Recalculate current weight (full recalculation - use for validation) */
+	/** Recalculate current weight (full recalculation - initial sync only) */
 	void RecalculateWeight();
 
-	/** Incremental weight update (O(1) - use in hotpath) */
-	void UpdateWeightDelta(float WeightDelta);
+	/** Incremental weight update in grams (O(1) - use in hotpath) */
+	void UpdateWeightDelta(int64 WeightDeltaGrams);
+
+	/** Set the running sum and its float mirror */
+	void SetTrackedWeight(int64 WeightGrams);
+
+	/** Full recompute from instances (uses the statics cache, no DataManager row copies) */
+	int64 ComputeWeightGrams() const;
+
+	/** Weight of one instance in grams (magazines include loaded rounds) */
+	int64 GetInstanceWeightGrams(const FSuspenseCoreItemInstance& Instance) const;
 
 	/** Update grid slots for item placement */
 	void UpdateGridSlots(const FSuspenseCoreItemInstance& Instance, bool bPlace);
 
+	//==================================================================
+	// Item Statics Cache
+	//==================================================================
+
+	/** Per-ItemID data needed on hot paths, copied once out of the DataManager row */
+	struct FItemStatics
+	{
+		/** Unit weight in grams */
+		int64 UnitWeightGrams = 0;
+		FIntPoint GridSize = FIntPoint(1, 1);
+		int32 MaxStackSize = 1;
+		FGameplayTag ItemType;
+
+		bool IsStackable() const { return MaxStackSize > 1; }
+	};
+
+	/** Per-MagazineID weight data (grams) */
+	struct FMagazineStatics
+	{
+		int64 EmptyWeightGrams = 0;
+		int64 WeightPerRoundGrams = 0;
+		int32 MaxCapacity = 0;
+
+		int64 GetWeightWithRounds(int32 RoundCount) const
+		{
+			return EmptyWeightGrams + WeightPerRoundGrams * FMath::Clamp(RoundCount, 0, MaxCapacity);
+		}
+	};
+
+	/** Statics for ItemID (resolved on first use; unknown IDs are not cached) */
+	bool GetItemStatics(FName ItemID, FItemStatics& OutStatics) const;
+
+	/** Magazine statics for MagazineID (resolved on first use) */
+	bool GetMagazineStatics(FName MagazineID, FMagazineStatics& OutStatics) const;
+
+	/** Item data tables are immutable at runtime, so entries never go stale */
+	mutable TMap<FName, FItemStatics> ItemStaticsCache;
+	mutable TMap<FName, FMagazineStatics> MagazineStaticsCache;
+
+	static int64 WeightToGrams(float Weight) { return FMath::RoundToInt64(static_cast<double>(Weight) * 1000.0); }
+
 	//==================================================================
 	// Validation Layer (Development builds only)
 	//==================================================================
@@ -682,11 +766,32 @@ private:
 	/** Validate inventory integrity - checks for desync between data structures */
 	void ValidateInventoryIntegrityInternal(const FString& Context) const;
 
+	/**
+	 * Compare the running weight sum against a full recompute; log and resync on mismatch.
+	 * Runs every suspensecore.inventory.weight_validation_interval weight updates.
+	 */
+	void ValidateTrackedWeight(const TCHAR* Context);
+
 	/** Operation counter for periodic validation */
 	mutable int32 ValidationOperationCounter = 0;
 #endif
 
-	/** Find item instance by ID (internal) */
+	/** Find item instance by ID (internal, O(1) via InstanceIndexByID). Mutable lookup logs an undo pre-image */
 	FSuspenseCoreItemInstance* FindItemInstanceInternal(const FGuid& InstanceID);
 	const FSuspenseCoreItemInstance* FindItemInstanceInternal(const FGuid& InstanceID) const;
+
+	/** Find index of item instance in ItemInstances or INDEX_NONE */
+	int32 FindItemInstanceIndex(const FGuid& InstanceID) const;
+
+	/** Append instance and index it. Returns new array index */
+	int32 AppendItemInstance(const FSuspenseCoreItemInstance& Instance);
+
+	/** Remove instance by array index, keeping the order of the rest, and fix up the index (O(N - Index)) */
+	void RemoveItemInstanceAt(int32 Index);
+
+	/** Rebuild InstanceIndexByID from ItemInstances (after bulk assignment) */
+	void RebuildInstanceIndex();
+
+	/** Copy the given storage cells into the deprecated GridSlots mirror */
+	void SyncStorageSlotsToLegacyArray(const TArray<int32>& SlotIndices);
 };
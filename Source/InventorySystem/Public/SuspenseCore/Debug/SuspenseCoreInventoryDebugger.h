@@ -13,6 +13,7 @@
 class USuspenseCoreInventoryComponent;
 class USuspenseCoreInventoryManager;
 class UCanvas;
+class UWorld;
 
 /**
  * FSuspenseCoreInventoryDebugInfo
@@ -239,6 +240,79 @@ public:
 		int32 Iterations
 	);
 
+	/**
+	 * Headless grid and undo log checks (no world, no DataManager).
+	 * Covers place/remove/move/rotate, bounds and overlap rejection,
+	 * fit search with rotation, nested savepoint commit/rollback.
+	 * @param OutReport One line per failed check plus a summary
+	 * @return true if every check passed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SuspenseCore|Inventory|Debug")
+	static bool RunGridSelfTest(FString& OutReport);
+
+	/**
+	 * Component checks on a live inventory: stack, split, consolidate, move, rotate,
+	 * transaction commit/rollback, weight round-trips and integrity after each step.
+	 * The inventory is cleared before and after the run.
+	 * @param Component Target inventory (authority)
+	 * @param StackableItemID Item known to the DataManager with MaxStackSize >= 5
+	 * @param OutReport One line per failed check plus a summary
+	 * @return true if every check passed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SuspenseCore|Inventory|Debug")
+	static bool RunComponentSelfTest(
+		USuspenseCoreInventoryComponent* Component,
+		FName StackableItemID,
+		FString& OutReport
+	);
+
+	//==================================================================
+	// Benchmarks
+	//==================================================================
+
+	/**
+	 * Time the component's own transaction path: BeginTransaction, RemoveItemByID, RollbackTransaction.
+	 * Clears the component, seeds it with single-unit stacks of StackableItemID and clears it again at the end.
+	 * @param Component Initialized inventory (needs the item data manager, so a live world)
+	 * @param StackableItemID Item with MaxStackSize > 1
+	 * @param ItemCounts Stack counts to measure, capped by grid and weight limits
+	 * @param TouchedPerTxn Units removed inside each transaction
+	 * @param Iterations Transactions per measurement
+	 * @param OutReport Timing table
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SuspenseCore|Inventory|Debug")
+	static void BenchmarkTransactions(
+		USuspenseCoreInventoryComponent* Component,
+		FName StackableItemID,
+		const TArray<int32>& ItemCounts,
+		int32 TouchedPerTxn,
+		int32 Iterations,
+		FString& OutReport
+	);
+
+	/**
+	 * Grid benchmarks on USuspenseCoreInventoryStorage, one row per op x height x fill level.
+	 * Fill is a seeded mix of 1x1..2x3 items, so rows are comparable between runs.
+	 * Ops:
+	 * - FindFreeSlot: 1x1/2x2/2x3 queries on an unchanged grid (fit hints warm)
+	 * - FindFreeSlotChurn: remove + find + re-place one item (hints invalidated each time)
+	 * - CanPlaceItem: 2x2 check at every slot
+	 * Consolidate/Sort need item data, see the SuspenseCore.Inventory.Benchmark.StackOps automation test.
+	 * @param GridWidth Columns (clamped by the storage, rows report the real size)
+	 * @param GridHeights Rows to measure
+	 * @param FillPercents Target occupied-cell percentages (0-95)
+	 * @param Iterations Repetitions per row
+	 * @param OutCsv Header + rows: op,grid_w,grid_h,fill_target_pct,fill_actual_pct,items,iterations,ns_per_op
+	 */
+	UFUNCTION(BlueprintCallable, Category = "SuspenseCore|Inventory|Debug")
+	static void BenchmarkGrid(
+		int32 GridWidth,
+		const TArray<int32>& GridHeights,
+		const TArray<int32>& FillPercents,
+		int32 Iterations,
+		FString& OutCsv
+	);
+
 	//==================================================================
 	// Visual Debug
 	//==================================================================
@@ -292,6 +366,21 @@ private:
 	/** Handle console command: inventory.clear */
 	static void HandleClearCommand(const TArray<FString>& Args);
 
+	/** Handle console command: SuspenseCore.Inventory.BenchTransactions <StackableItemID> [Touched] [Iterations] */
+	static void HandleBenchTransactionsCommand(const TArray<FString>& Args, UWorld* World);
+
+	/** Handle console command: SuspenseCore.Inventory.SelfTest */
+	static void HandleSelfTestCommand(const TArray<FString>& Args);
+
+	/** Handle console command: SuspenseCore.Inventory.SelfTestComponent <StackableItemID> */
+	static void HandleSelfTestComponentCommand(const TArray<FString>& Args, UWorld* World);
+
+	/** Handle console command: SuspenseCore.Inventory.BenchGrid [Iterations] [CsvPath] */
+	static void HandleBenchGridCommand(const TArray<FString>& Args);
+
+	/** Handle console command: SuspenseCore.Inventory.BenchReplicationBytes [Items] */
+	static void HandleBenchReplicationBytesCommand(const TArray<FString>& Args);
+
 	/** Console command handles */
 	static TArray<IConsoleObject*> ConsoleCommands;
 };
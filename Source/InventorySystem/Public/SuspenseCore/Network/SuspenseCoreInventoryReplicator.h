@@ -302,7 +302,7 @@ protected:
 	TMap<FGuid, FSuspenseCoreInventorySnapshot> PendingPredictions;
 
 	/** Items marked dirty for replication */
-	TArray<FGuid> DirtyItems;
+	TSet<FGuid> DirtyItems;
 
 	/** Replication statistics */
 	FSuspenseCoreReplicationStats Stats;
@@ -0,0 +1,90 @@
+// SuspenseCoreInventoryUndoLog.h
+// SuspenseCore - EventBus Architecture
+// Copyright Suspense Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SuspenseCore/Types/Inventory/SuspenseCoreInventoryTypes.h"
+
+/**
+ * FSuspenseCoreInventoryUndoEntry
+ *
+ * Pre-image of one item instance, captured on its first write inside a savepoint.
+ */
+struct INVENTORYSYSTEM_API FSuspenseCoreInventoryUndoEntry
+{
+	/** Instance the entry restores */
+	FGuid InstanceID;
+
+	/** false = instance was created inside the savepoint (rollback removes it) */
+	bool bExisted = false;
+
+	/** State before the first write (valid only if bExisted) */
+	FSuspenseCoreItemInstance PreImage;
+
+	/** Depth this instance was logged at before this entry (INDEX_NONE = not logged) */
+	int32 PrevLoggedDepth = INDEX_NONE;
+};
+
+/**
+ * FSuspenseCoreInventoryUndoLog
+ *
+ * Undo log used by USuspenseCoreInventoryComponent transactions.
+ * Replaces the full inventory snapshot: only touched instances are copied.
+ *
+ * SEMANTICS:
+ * - BeginSavepoint pushes a level; the first write to an instance in a level logs its pre-image
+ * - ReleaseSavepoint merges the level into its parent, dropping entries the parent already has
+ * - PopSavepoint hands back the level's entries newest-first for the owner to replay
+ *
+ * Cost of every operation is proportional to the instances touched, not to inventory size.
+ * Grid cells and weight are not logged - the owner derives them from the restored instances
+ * on replay (weight as a gram delta between current and pre-image instances).
+ *
+ * THREAD SAFETY:
+ * - GameThread only (owned by the inventory component)
+ */
+class INVENTORYSYSTEM_API FSuspenseCoreInventoryUndoLog
+{
+public:
+	/** Open a savepoint */
+	void BeginSavepoint();
+
+	/**
+	 * Log pre-image before a write.
+	 * @param InstanceID Instance about to change
+	 * @param Current Current state, nullptr if the instance is about to be created
+	 */
+	void Record(const FGuid& InstanceID, const FSuspenseCoreItemInstance* Current);
+
+	/** Commit innermost savepoint into its parent (outermost: discard the log) */
+	void ReleaseSavepoint();
+
+	/**
+	 * Close innermost savepoint for rollback.
+	 * @param OutEntries Entries to replay, newest first
+	 */
+	void PopSavepoint(TArray<FSuspenseCoreInventoryUndoEntry>& OutEntries);
+
+	/** Drop everything */
+	void Reset();
+
+	/** Any savepoint open */
+	bool IsActive() const { return Savepoints.Num() > 0; }
+
+	/** Open savepoint count */
+	int32 GetDepth() const { return Savepoints.Num(); }
+
+	/** Logged pre-images across all levels */
+	int32 NumEntries() const { return Entries.Num(); }
+
+private:
+	TArray<FSuspenseCoreInventoryUndoEntry> Entries;
+
+	/** First entry index of each open savepoint */
+	TArray<int32> Savepoints;
+
+	/** Instance -> deepest level holding its pre-image */
+	TMap<FGuid, int32> LoggedDepth;
+};
@@ -6,7 +6,6 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
-#include "Containers/BitArray.h"
 #include "SuspenseCore/Types/Inventory/SuspenseCoreInventoryTypes.h"
 #include "SuspenseCoreInventoryStorage.generated.h"
 
@@ -20,11 +19,15 @@
  * - Manages grid slots with multi-cell item support
  * - Uses anchor cells with offsets for large items
  * - Supports item rotation (90 degree increments)
- * - Free slot bitmap for fast space queries
+ * - Per-row 64-bit occupancy masks: placement tests are shift-and-AND per row
+ * - Fit search ANDs row masks instead of probing cells, with a per-size
+ *   start-row hint so repeated queries (auto-pickup, quick move) skip filled rows
+ * - Instance -> placement index: remove/move/occupied-slot queries are O(footprint)
  * - Fragmentation detection and defragmentation
  *
  * GRID LAYOUT:
  * - Linear indexing: index = y * GridWidth + x
+ * - Bit X of RowOccupancy[Y] is set when cell (X, Y) is occupied (width <= 64)
  * - Anchor cell is top-left of multi-cell items
  * - Other cells reference anchor via offset
  *
@@ -39,12 +42,19 @@ class INVENTORYSYSTEM_API USuspenseCoreInventoryStorage : public UObject
 public:
 	USuspenseCoreInventoryStorage();
 
+	/** Widest grid: one row must fit in a single 64-bit occupancy mask */
+	static constexpr int32 MaxGridWidth = 64;
+
+	/** Tallest grid: rows are independent masks, so height only costs memory */
+	static constexpr int32 MaxGridHeight = 256;
+
 	//==================================================================
 	// Initialization
 	//==================================================================
 
 	/**
-	 * Initialize storage grid.
+	 * Initialize storage grid. Sizes are clamped to MaxGridWidth x MaxGridHeight;
+	 * read the result back with GetGridSize().
 	 * @param InGridWidth Grid width (columns)
 	 * @param InGridHeight Grid height (rows)
 	 */
@@ -221,6 +231,22 @@ public:
 	// Occupied Slots Query
 	//==================================================================
 
+	/**
+	 * Get anchor slot of an item.
+	 * @param InstanceID Item to query
+	 * @return Anchor slot index or INDEX_NONE if not placed
+	 */
+	UFUNCTION(BlueprintPure, Category = "SuspenseCore|Inventory|Storage")
+	int32 GetAnchorSlotForInstance(FGuid InstanceID) const;
+
+	/**
+	 * Check if an item is placed in this grid.
+	 * @param InstanceID Item to query
+	 * @return true if item has a placement
+	 */
+	UFUNCTION(BlueprintPure, Category = "SuspenseCore|Inventory|Storage")
+	bool ContainsItem(FGuid InstanceID) const { return Placements.Contains(InstanceID); }
+
 	/**
 	 * Get all slots occupied by an item.
 	 * @param InstanceID Item to query
@@ -249,6 +275,13 @@ public:
 	void LogGridState() const;
 
 private:
+	/** Where an item sits in the grid (footprint already rotated) */
+	struct FPlacement
+	{
+		int32 AnchorSlot = INDEX_NONE;
+		FIntPoint EffectiveSize = FIntPoint::ZeroValue;
+	};
+
 	/** Grid width */
 	UPROPERTY()
 	int32 GridWidth;
@@ -261,8 +294,21 @@ private:
 	UPROPERTY()
 	TArray<FSuspenseCoreInventorySlot> Slots;
 
-	/** Free slot bitmap for fast queries (not UPROPERTY - TBitArray not supported) */
-	TBitArray<> FreeSlotBitmap;
+	/**
+	 * Occupancy bitboard, one mask per row (bit X = cell X occupied).
+	 * Derived from Slots, rebuilt on Initialize/Clear - not serialized.
+	 */
+	TArray<uint64> RowOccupancy;
+
+	/**
+	 * First row worth searching for a given effective item size.
+	 * Placing items only removes fits, so a hint stays valid until something is removed;
+	 * a hint of GridHeight caches "no fit at all". Cleared on any removal.
+	 */
+	mutable TMap<FIntPoint, int32> FitSearchHints;
+
+	/** Instance -> anchor and footprint. Kept in sync by Place/Remove/Clear, rebuilt from Slots when needed */
+	TMap<FGuid, FPlacement> Placements;
 
 	/** Is initialized */
 	UPROPERTY()
@@ -274,6 +320,24 @@ private:
 	/** Get all slots that would be occupied by item */
 	TArray<int32> CalculateOccupiedSlots(int32 AnchorSlot, FIntPoint ItemSize, bool bRotated) const;
 
-	/** Update free slot bitmap */
+	/** Mask with the lowest Width bits set */
+	static uint64 MakeRunMask(int32 Width);
+
+	/** Mask of all valid columns in a row */
+	uint64 GetRowMask() const { return MakeRunMask(GridWidth); }
+
+	/** Does footprint collide with occupied cells (optionally ignoring one instance) */
+	bool IsAreaFree(FIntPoint StartCoords, FIntPoint EffectiveSize, const FGuid& IgnoreInstanceID) const;
+
+	/** Find first anchor (row-major) for an already-oriented size, or INDEX_NONE */
+	int32 FindFirstFit(FIntPoint EffectiveSize) const;
+
+	/** Set/clear footprint bits for one rectangle */
+	void SetAreaOccupied(FIntPoint StartCoords, FIntPoint EffectiveSize, bool bOccupied);
+
+	/** Append slot indices covered by a placement */
+	void GetPlacementSlots(const FPlacement& Placement, TArray<int32>& OutSlots) const;
+
+	/** Rebuild occupancy masks and placement index from Slots */
 	void UpdateFreeBitmap();
 };
@@ -0,0 +1,21 @@
+using UnrealBuildTool;
+
+public class InventorySystemTests : ModuleRules
+{
+	public InventorySystemTests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine",
+				"GameplayTags",
+				"BridgeSystem",
+				"InventorySystem"
+			}
+		);
+	}
+}
@@ -0,0 +1,9 @@
+// InventorySystemTests.cpp
+// SuspenseCore - EventBus Architecture
+// Copyright Suspense Team. All Rights Reserved.
+//
+// Headless automation tests for InventorySystem (Session Frontend / -ExecCmds="Automation RunTests SuspenseCore.Inventory").
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, InventorySystemTests)
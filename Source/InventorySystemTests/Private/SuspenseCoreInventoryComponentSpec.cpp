@@ -0,0 +1,271 @@
+// SuspenseCoreInventoryComponentSpec.cpp
+// SuspenseCore - EventBus Architecture
+// Copyright Suspense Team. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "SuspenseCoreInventoryTestWorld.h"
+
+BEGIN_DEFINE_SPEC(FSuspenseCoreInventoryComponentSpec, "SuspenseCore.Inventory.Component",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+	TUniquePtr<FSuspenseCoreInventoryTestWorld> TestWorld;
+	USuspenseCoreInventoryComponent* Inventory = nullptr;
+
+	bool Add(FName ItemID, int32 Quantity)
+	{
+		return Inventory->Execute_AddItemInstance(Inventory, FSuspenseCoreItemInstance(ItemID, Quantity));
+	}
+
+	int32 Count(FName ItemID) const
+	{
+		return Inventory->Execute_GetItemCountByID(Inventory, ItemID);
+	}
+
+	float Weight() const
+	{
+		return Inventory->Execute_GetCurrentWeight(Inventory);
+	}
+
+	int32 NumStacks() const
+	{
+		return Inventory->GetAllItemInstances().Num();
+	}
+
+	void TestIntegrity(const TCHAR* Step)
+	{
+		TArray<FString> Errors;
+		const bool bValid = Inventory->ValidateIntegrity(Errors);
+		TestTrue(FString::Printf(TEXT("%s: integrity (%s)"), Step, *FString::Join(Errors, TEXT("; "))), bValid);
+	}
+END_DEFINE_SPEC(FSuspenseCoreInventoryComponentSpec)
+
+void FSuspenseCoreInventoryComponentSpec::Define()
+{
+	using FTestWorld = FSuspenseCoreInventoryTestWorld;
+
+	BeforeEach([this]()
+	{
+		TestWorld = MakeUnique<FTestWorld>();
+		Inventory = TestWorld->CreateInventory();
+	});
+
+	AfterEach([this]()
+	{
+		Inventory = nullptr;
+		TestWorld.Reset();
+	});
+
+	Describe("Place", [this]()
+	{
+		It("should place an item and track its weight", [this]()
+		{
+			TestTrue(TEXT("Add case"), Add(FTestWorld::CaseID, 1));
+			TestEqual(TEXT("Count"), Count(FTestWorld::CaseID), 1);
+			TestEqual(TEXT("Weight"), Weight(), 2.0f);
+			TestIntegrity(TEXT("Place"));
+		});
+
+		It("should refuse items over the weight limit", [this]()
+		{
+			Inventory->Initialize(10, 6, 3.0f);
+			TestTrue(TEXT("First case"), Add(FTestWorld::CaseID, 1));
+			TestFalse(TEXT("Second case"), Add(FTestWorld::CaseID, 1));
+			TestEqual(TEXT("Count"), Count(FTestWorld::CaseID), 1);
+		});
+
+		It("should use the full height of a 10x68 stash", [this]()
+		{
+			Inventory = TestWorld->CreateInventory(10, 68, 1000.0f);
+			TestEqual(TEXT("Slots"), Inventory->GetMaxSlots(), 680);
+
+			// Top-left cell of the 2x3 footprint in the last three rows
+			const int32 LastRowsSlot = 65 * 10 + 8;
+			TestTrue(TEXT("Place in the last rows"), Inventory->AddItemInstanceToSlot(FSuspenseCoreItemInstance(FTestWorld::CaseID, 1), LastRowsSlot));
+			TestTrue(TEXT("Bottom-right cell"), Inventory->IsSlotOccupied(67 * 10 + 9));
+
+			// 1x1 in the very last cell
+			TestTrue(TEXT("Place in the last cell"), Inventory->AddItemInstanceToSlot(FSuspenseCoreItemInstance(FTestWorld::AmmoID, 1), 67 * 10 + 7));
+			TestIntegrity(TEXT("Stash"));
+		});
+	});
+
+	Describe("Remove", [this]()
+	{
+		It("should round-trip the weight exactly", [this]()
+		{
+			Add(FTestWorld::AmmoID, 30);
+			const float FullWeight = Weight();
+			TestTrue(TEXT("Add 1"), Add(FTestWorld::AmmoID, 1));
+			TestTrue(TEXT("Remove 1"), Inventory->Execute_RemoveItemByID(Inventory, FTestWorld::AmmoID, 1));
+			TestEqual(TEXT("Count"), Count(FTestWorld::AmmoID), 30);
+			TestEqual(TEXT("Weight"), Weight(), FullWeight);
+			TestIntegrity(TEXT("Remove"));
+		});
+
+		It("should empty the inventory on Clear", [this]()
+		{
+			Add(FTestWorld::AmmoID, 30);
+			Add(FTestWorld::CaseID, 1);
+			Inventory->Clear();
+			TestEqual(TEXT("Stacks"), NumStacks(), 0);
+			TestEqual(TEXT("Weight"), Weight(), 0.0f);
+		});
+	});
+
+	Describe("Stack", [this]()
+	{
+		It("should fill existing stacks before opening new ones", [this]()
+		{
+			Add(FTestWorld::AmmoID, 30);
+			Add(FTestWorld::AmmoID, 40);
+			TestEqual(TEXT("Count"), Count(FTestWorld::AmmoID), 70);
+			TestEqual(TEXT("Stacks"), NumStacks(), 2);
+			TestIntegrity(TEXT("Stack"));
+		});
+
+		It("should not stack non-stackable items", [this]()
+		{
+			Add(FTestWorld::CaseID, 1);
+			Add(FTestWorld::CaseID, 1);
+			TestEqual(TEXT("Stacks"), NumStacks(), 2);
+		});
+	});
+
+	Describe("Split", [this]()
+	{
+		BeforeEach([this]()
+		{
+			Add(FTestWorld::AmmoID, 30);
+		});
+
+		It("should create a second stack without changing count or weight", [this]()
+		{
+			const float FullWeight = Weight();
+			const int32 Slot = Inventory->GetAllItemInstances()[0].SlotIndex;
+			TestTrue(TEXT("Split 10"), Inventory->SplitStack(Slot, 10, INDEX_NONE));
+			TestEqual(TEXT("Stacks"), NumStacks(), 2);
+			TestEqual(TEXT("Count"), Count(FTestWorld::AmmoID), 30);
+			TestEqual(TEXT("Weight"), Weight(), FullWeight);
+			TestIntegrity(TEXT("Split"));
+		});
+
+		It("should reject splitting the whole stack", [this]()
+		{
+			const int32 Slot = Inventory->GetAllItemInstances()[0].SlotIndex;
+			TestFalse(TEXT("Split 30"), Inventory->SplitStack(Slot, 30, INDEX_NONE));
+			TestEqual(TEXT("Stacks"), NumStacks(), 1);
+		});
+
+		It("should be undone by ConsolidateStacks", [this]()
+		{
+			const int32 Slot = Inventory->GetAllItemInstances()[0].SlotIndex;
+			Inventory->SplitStack(Slot, 10, INDEX_NONE);
+			TestTrue(TEXT("Consolidate"), Inventory->ConsolidateStacks(FTestWorld::AmmoID) > 0);
+			TestEqual(TEXT("Stacks"), NumStacks(), 1);
+			TestEqual(TEXT("Count"), Count(FTestWorld::AmmoID), 30);
+			TestIntegrity(TEXT("Consolidate"));
+		});
+	});
+
+	Describe("Move", [this]()
+	{
+		It("should move an item to a free slot", [this]()
+		{
+			Add(FTestWorld::CaseID, 1);
+			const FSuspenseCoreItemInstance Case = Inventory->GetAllItemInstances()[0];
+			// Bottom-right corner of the 10x6 grid for a 2x3 footprint
+			const int32 Target = 3 * 10 + 8;
+			TestTrue(TEXT("Move"), Inventory->Execute_MoveItem(Inventory, Case.SlotIndex, Target));
+
+			FSuspenseCoreItemInstance Moved;
+			TestTrue(TEXT("Find"), Inventory->FindItemInstance(Case.UniqueInstanceID, Moved));
+			TestEqual(TEXT("Slot"), Moved.SlotIndex, Target);
+			TestFalse(TEXT("Old slot freed"), Inventory->IsSlotOccupied(Case.SlotIndex));
+			TestIntegrity(TEXT("Move"));
+		});
+	});
+
+	Describe("Rotate", [this]()
+	{
+		It("should only rotate at the anchor slot", [this]()
+		{
+			Add(FTestWorld::AmmoID, 30);
+			const int32 Slot = Inventory->GetAllItemInstances()[0].SlotIndex;
+			TestFalse(TEXT("Empty slot"), Inventory->RotateItemAtSlot(Slot + 1));
+			TestTrue(TEXT("Anchor"), Inventory->RotateItemAtSlot(Slot));
+			TestEqual(TEXT("Rotation"), Inventory->GetAllItemInstances()[0].Rotation, 90);
+			TestIntegrity(TEXT("Rotate"));
+		});
+	});
+
+	Describe("Transactions", [this]()
+	{
+		BeforeEach([this]()
+		{
+			Add(FTestWorld::AmmoID, 30);
+		});
+
+		It("should restore count and weight on rollback", [this]()
+		{
+			const float FullWeight = Weight();
+			Inventory->BeginTransaction();
+			Inventory->Execute_RemoveItemByID(Inventory, FTestWorld::AmmoID, 12);
+			Add(FTestWorld::CaseID, 1);
+			Inventory->RollbackTransaction();
+
+			TestFalse(TEXT("Inactive"), Inventory->IsTransactionActive());
+			TestEqual(TEXT("Ammo"), Count(FTestWorld::AmmoID), 30);
+			TestEqual(TEXT("Case"), Count(FTestWorld::CaseID), 0);
+			TestEqual(TEXT("Weight"), Weight(), FullWeight);
+			TestIntegrity(TEXT("Rollback"));
+		});
+
+		It("should undo a split on rollback", [this]()
+		{
+			const int32 Slot = Inventory->GetAllItemInstances()[0].SlotIndex;
+			Inventory->BeginTransaction();
+			Inventory->SplitStack(Slot, 10, INDEX_NONE);
+			Inventory->RollbackTransaction();
+
+			TestEqual(TEXT("Stacks"), NumStacks(), 1);
+			TestEqual(TEXT("Quantity"), Inventory->GetAllItemInstances()[0].Quantity, 30);
+			TestIntegrity(TEXT("Split rollback"));
+		});
+
+		It("should restore the legacy grid mirror when a move is rolled back", [this]()
+		{
+			Add(FTestWorld::CaseID, 1);
+			const FSuspenseCoreItemInstance Case = Inventory->GetAllItemInstances().Last();
+			const int32 Target = 3 * 10 + 8;
+
+			Inventory->BeginTransaction();
+			TestTrue(TEXT("Move"), Inventory->Execute_MoveItem(Inventory, Case.SlotIndex, Target));
+			Inventory->RollbackTransaction();
+
+			TestFalse(TEXT("Target freed"), Inventory->IsSlotOccupied(Target));
+			// ValidateIntegrity compares the legacy mirror cell by cell
+			TestIntegrity(TEXT("Move rollback"));
+		});
+
+		It("should roll back only the inner level of a nested transaction", [this]()
+		{
+			Inventory->BeginTransaction();
+			Inventory->Execute_RemoveItemByID(Inventory, FTestWorld::AmmoID, 1);
+			Inventory->BeginTransaction();
+			Inventory->Execute_RemoveItemByID(Inventory, FTestWorld::AmmoID, 1);
+			Inventory->RollbackTransaction();
+
+			TestEqual(TEXT("Depth"), Inventory->GetTransactionDepth(), 1);
+			TestEqual(TEXT("Count after inner rollback"), Count(FTestWorld::AmmoID), 29);
+
+			Inventory->CommitTransaction();
+			TestFalse(TEXT("Inactive"), Inventory->IsTransactionActive());
+			TestEqual(TEXT("Count after commit"), Count(FTestWorld::AmmoID), 29);
+			TestIntegrity(TEXT("Commit"));
+		});
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
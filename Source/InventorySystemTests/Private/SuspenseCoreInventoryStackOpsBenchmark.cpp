@@ -0,0 +1,222 @@
+// SuspenseCoreInventoryStackOpsBenchmark.cpp
+// SuspenseCore - EventBus Architecture
+// Copyright Suspense Team. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "SuspenseCoreInventoryTestWorld.h"
+#include "SuspenseCore/Base/SuspenseCoreInventoryLogs.h"
+#include "SuspenseCore/Base/SuspenseCoreInventoryManager.h"
+#include "Engine/GameInstance.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+	using FTestWorld = FSuspenseCoreInventoryTestWorld;
+
+	constexpr int32 CaseCells = 6;
+
+	int32 CountOccupiedCells(const USuspenseCoreInventoryComponent* Inventory)
+	{
+		int32 Occupied = 0;
+		for (int32 Slot = 0; Slot < Inventory->GetSlotCount(); ++Slot)
+		{
+			Occupied += Inventory->IsSlotOccupied(Slot) ? 1 : 0;
+		}
+		return Occupied;
+	}
+
+	/**
+	 * Fill to ~TargetPercent occupied cells: a third in 2x3 cases, the rest in single-round ammo stacks
+	 * for ConsolidateStacks to merge. Overfills first, then removes random items, so holes are spread
+	 * like a played inventory (same scheme as the storage grid benchmark).
+	 */
+	void FillInventory(USuspenseCoreInventoryComponent* Inventory, int32 TargetPercent, int32 Seed)
+	{
+		Inventory->Clear();
+
+		const int32 TotalCells = Inventory->GetSlotCount();
+		const int32 TargetCells = TotalCells * TargetPercent / 100;
+		if (TargetCells == 0)
+		{
+			return;
+		}
+		const int32 OverfillCells = TargetCells + (TotalCells - TargetCells) / 2;
+
+		int32 Occupied = 0;
+		for (int32 Case = 0; Case < OverfillCells / 3 / CaseCells; ++Case)
+		{
+			if (!Inventory->Execute_AddItemInstance(Inventory, FSuspenseCoreItemInstance(FTestWorld::CaseID, 1)))
+			{
+				break;
+			}
+			Occupied += CaseCells;
+		}
+
+		// Bulk add, then split down to one round per stack (splitting keeps the source anchor)
+		const int32 Rounds = OverfillCells - Occupied;
+		if (Rounds > 0 && Inventory->Execute_AddItemInstance(Inventory, FSuspenseCoreItemInstance(FTestWorld::AmmoID, Rounds)))
+		{
+			int32 NumStacks = 0;
+			for (const FSuspenseCoreItemInstance& Stack : Inventory->GetAllItemInstances())
+			{
+				NumStacks += Stack.ItemID == FTestWorld::AmmoID ? 1 : 0;
+			}
+
+			for (const FSuspenseCoreItemInstance& Stack : Inventory->GetAllItemInstances())
+			{
+				for (int32 Remaining = Stack.Quantity; Stack.ItemID == FTestWorld::AmmoID && Remaining > 1; --Remaining)
+				{
+					if (!Inventory->SplitStack(Stack.SlotIndex, 1, INDEX_NONE))
+					{
+						break;
+					}
+					++NumStacks;
+				}
+			}
+			Occupied += NumStacks;
+		}
+
+		FRandomStream Random(Seed);
+		TArray<FSuspenseCoreItemInstance> Items = Inventory->GetAllItemInstances();
+		while (Occupied > TargetCells && Items.Num() > 0)
+		{
+			const int32 Index = Random.RandHelper(Items.Num());
+			Inventory->RemoveItemInstance(Items[Index].UniqueInstanceID);
+			Occupied -= Items[Index].ItemID == FTestWorld::CaseID ? CaseCells : 1;
+			Items.RemoveAtSwap(Index);
+		}
+	}
+
+	/** Per-item logging would dominate the timings */
+	struct FScopedQuietInventoryLog
+	{
+		ELogVerbosity::Type Saved = LogSuspenseCoreInventory.GetVerbosity();
+
+		FScopedQuietInventoryLog() { LogSuspenseCoreInventory.SetVerbosity(ELogVerbosity::Error); }
+		~FScopedQuietInventoryLog() { LogSuspenseCoreInventory.SetVerbosity(Saved); }
+	};
+}
+
+/**
+ * Component-level inventory ops, one CSV row per op x grid height x fill level.
+ * Ops:
+ * - FindFreeSlot: 1x1/2x2/2x3 queries on an unchanged grid
+ * - CanPlaceItem: 2x2 check at every slot
+ * - ConsolidateStacks: merge the single-round ammo stacks (reseeded before each run, seeding not timed)
+ * - SortInventory: USuspenseCoreInventoryManager::SortInventory by quantity (reseeded the same way)
+ * CSV columns match SuspenseCore.Inventory.BenchGrid; written to Saved/Benchmarks/InventoryStackOps-<time>.csv.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSuspenseCoreInventoryStackOpsBenchmark, "SuspenseCore.Inventory.Benchmark.StackOps",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FSuspenseCoreInventoryStackOpsBenchmark::RunTest(const FString& Parameters)
+{
+	static const int32 GridHeights[] = { 10, 25, 50, 100 };
+	static const int32 FillPercents[] = { 0, 25, 50, 75, 90, 95 };
+	constexpr int32 GridWidth = 10;
+	constexpr int32 QueryIterations = 200;
+	constexpr int32 StackIterations = 5;
+
+	FTestWorld TestWorld;
+
+	// SortInventory only reads its arguments, so an uninitialized manager will do
+	USuspenseCoreInventoryManager* Manager = NewObject<USuspenseCoreInventoryManager>(
+		NewObject<UGameInstance>(GetTransientPackage()));
+
+	FString Csv = TEXT("op,grid_w,grid_h,fill_target_pct,fill_actual_pct,items,iterations,ns_per_op\n");
+
+	{
+		FScopedQuietInventoryLog QuietLog;
+
+		for (const int32 GridHeight : GridHeights)
+		{
+			USuspenseCoreInventoryComponent* Inventory = TestWorld.CreateInventory(GridWidth, GridHeight, 100000.0f);
+			const FIntPoint GridSize = Inventory->GetGridSize();
+			const int32 TotalCells = GridSize.X * GridSize.Y;
+
+			for (const int32 FillPercent : FillPercents)
+			{
+				const int32 Seed = GridSize.X * 100000 + GridSize.Y * 100 + FillPercent;
+				FillInventory(Inventory, FillPercent, Seed);
+
+				const float ActualFill = 100.0f * CountOccupiedCells(Inventory) / TotalCells;
+				const int32 NumItems = Inventory->GetItemCount();
+
+				auto AddRow = [&](const TCHAR* Op, double Seconds, int32 Iterations, int64 Ops)
+				{
+					Csv += FString::Printf(TEXT("%s,%d,%d,%d,%.1f,%d,%d,%.1f\n"),
+						Op, GridSize.X, GridSize.Y, FillPercent, ActualFill, NumItems, Iterations,
+						Ops > 0 ? Seconds * 1e9 / Ops : 0.0);
+				};
+
+				{
+					const double Start = FPlatformTime::Seconds();
+					for (int32 Iter = 0; Iter < QueryIterations; ++Iter)
+					{
+						Inventory->FindFreeSlot(FIntPoint(1, 1), true);
+						Inventory->FindFreeSlot(FIntPoint(2, 2), true);
+						Inventory->FindFreeSlot(FIntPoint(2, 3), true);
+					}
+					AddRow(TEXT("FindFreeSlot"), FPlatformTime::Seconds() - Start, QueryIterations, int64(QueryIterations) * 3);
+				}
+
+				{
+					const double Start = FPlatformTime::Seconds();
+					for (int32 Iter = 0; Iter < QueryIterations; ++Iter)
+					{
+						for (int32 Slot = 0; Slot < TotalCells; ++Slot)
+						{
+							Inventory->CanPlaceItemAtSlot(FIntPoint(2, 2), Slot, false);
+						}
+					}
+					AddRow(TEXT("CanPlaceItem"), FPlatformTime::Seconds() - Start, QueryIterations, int64(QueryIterations) * TotalCells);
+				}
+
+				double ConsolidateSeconds = 0.0;
+				double SortSeconds = 0.0;
+				for (int32 Iter = 0; Iter < StackIterations; ++Iter)
+				{
+					FillInventory(Inventory, FillPercent, Seed);
+					double Start = FPlatformTime::Seconds();
+					Inventory->ConsolidateStacks(FTestWorld::AmmoID);
+					ConsolidateSeconds += FPlatformTime::Seconds() - Start;
+
+					FillInventory(Inventory, FillPercent, Seed);
+					Start = FPlatformTime::Seconds();
+					Manager->SortInventory(Inventory, FName("Quantity"));
+					SortSeconds += FPlatformTime::Seconds() - Start;
+				}
+				AddRow(TEXT("ConsolidateStacks"), ConsolidateSeconds, StackIterations, StackIterations);
+				AddRow(TEXT("SortInventory"), SortSeconds, StackIterations, StackIterations);
+
+				TArray<FString> Errors;
+				const bool bValid = Inventory->ValidateIntegrity(Errors);
+				TestTrue(FString::Printf(TEXT("Integrity at %dx%d, %d%% (%s)"), GridSize.X, GridSize.Y, FillPercent,
+					*FString::Join(Errors, TEXT("; "))), bValid);
+			}
+		}
+	}
+
+	UE_LOG(LogSuspenseCoreInventory, Log, TEXT("%s"), *Csv);
+
+	const FString CsvPath = FPaths::ProjectSavedDir() / TEXT("Benchmarks")
+		/ FString::Printf(TEXT("InventoryStackOps-%s.csv"), *FDateTime::Now().ToString());
+	if (FFileHelper::SaveStringToFile(Csv, *CsvPath))
+	{
+		AddInfo(FString::Printf(TEXT("Wrote %s"), *CsvPath));
+	}
+	else
+	{
+		AddWarning(FString::Printf(TEXT("Could not write %s"), *CsvPath));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
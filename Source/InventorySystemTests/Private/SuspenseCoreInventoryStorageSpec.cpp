@@ -0,0 +1,170 @@
+// SuspenseCoreInventoryStorageSpec.cpp
+// SuspenseCore - EventBus Architecture
+// Copyright Suspense Team. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "SuspenseCore/Storage/SuspenseCoreInventoryStorage.h"
+#include "UObject/Package.h"
+
+BEGIN_DEFINE_SPEC(FSuspenseCoreInventoryStorageSpec, "SuspenseCore.Inventory.Storage",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+	USuspenseCoreInventoryStorage* Storage = nullptr;
+	FGuid A;
+	FGuid B;
+	bool bRotated = false;
+END_DEFINE_SPEC(FSuspenseCoreInventoryStorageSpec)
+
+void FSuspenseCoreInventoryStorageSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		Storage = NewObject<USuspenseCoreInventoryStorage>(GetTransientPackage());
+		Storage->Initialize(10, 6);
+		A = FGuid::NewGuid();
+		B = FGuid::NewGuid();
+		bRotated = false;
+	});
+
+	AfterEach([this]()
+	{
+		Storage = nullptr;
+	});
+
+	Describe("Initialize", [this]()
+	{
+		It("should start with every cell free", [this]()
+		{
+			TestEqual(TEXT("Free cells"), Storage->GetFreeSlotCount(), 60);
+		});
+
+		It("should clamp to the row mask width", [this]()
+		{
+			Storage->Initialize(USuspenseCoreInventoryStorage::MaxGridWidth + 10, 4);
+			TestEqual(TEXT("Width"), Storage->GetGridSize().X, USuspenseCoreInventoryStorage::MaxGridWidth);
+		});
+	});
+
+	Describe("Place", [this]()
+	{
+		It("should occupy the whole footprint", [this]()
+		{
+			TestTrue(TEXT("Place 2x3 at 0"), Storage->PlaceItem(A, FIntPoint(2, 3), 0));
+			TestEqual(TEXT("Free cells"), Storage->GetFreeSlotCount(), 54);
+			TestEqual(TEXT("Owner of (1,2)"), Storage->GetInstanceIDAtSlot(21), A);
+			TestEqual(TEXT("Anchor of (1,2)"), Storage->GetAnchorSlot(21), 0);
+			TestFalse(TEXT("Column 2 free"), Storage->IsSlotOccupied(2));
+			TestFalse(TEXT("Row 3 free"), Storage->IsSlotOccupied(30));
+			TestEqual(TEXT("Occupied slots"), Storage->GetOccupiedSlots(A).Num(), 6);
+		});
+
+		It("should reject overlaps, edge overflow and invalid slots", [this]()
+		{
+			Storage->PlaceItem(A, FIntPoint(2, 3), 0);
+			TestFalse(TEXT("Overlap"), Storage->PlaceItem(B, FIntPoint(2, 2), 11));
+			TestFalse(TEXT("Right edge"), Storage->CanPlaceItem(FIntPoint(2, 2), 9));
+			TestFalse(TEXT("Bottom edge"), Storage->CanPlaceItem(FIntPoint(1, 2), 50));
+			TestFalse(TEXT("INDEX_NONE"), Storage->CanPlaceItem(FIntPoint(1, 1), INDEX_NONE));
+			TestFalse(TEXT("Past the end"), Storage->CanPlaceItem(FIntPoint(1, 1), 60));
+		});
+
+		It("should find the first fit in row-major order", [this]()
+		{
+			Storage->PlaceItem(A, FIntPoint(2, 3), 0);
+			TestEqual(TEXT("First 2x2 fit"), Storage->FindFreeSlot(FIntPoint(2, 2), false, bRotated), 2);
+			TestFalse(TEXT("Not rotated"), bRotated);
+		});
+
+		It("should fall back to the rotated footprint", [this]()
+		{
+			Storage->Initialize(2, 4);
+			TestEqual(TEXT("3x1 unrotated"), Storage->FindFreeSlot(FIntPoint(3, 1), false, bRotated), INDEX_NONE);
+			TestEqual(TEXT("3x1 rotated"), Storage->FindFreeSlot(FIntPoint(3, 1), true, bRotated), 0);
+			TestTrue(TEXT("Rotated"), bRotated);
+		});
+	});
+
+	Describe("Remove", [this]()
+	{
+		It("should free the footprint once", [this]()
+		{
+			Storage->PlaceItem(A, FIntPoint(2, 2), 0);
+			TestTrue(TEXT("Remove"), Storage->RemoveItem(A));
+			TestFalse(TEXT("Double remove"), Storage->RemoveItem(A));
+			TestEqual(TEXT("Free cells"), Storage->GetFreeSlotCount(), 60);
+			TestFalse(TEXT("Contains"), Storage->ContainsItem(A));
+		});
+
+		It("should expose the hole to the fit search", [this]()
+		{
+			Storage->Initialize(4, 4);
+			TArray<FGuid> Filled;
+			for (int32 Slot = 0; Slot < 16; ++Slot)
+			{
+				Storage->PlaceItem(Filled.Add_GetRef(FGuid::NewGuid()), FIntPoint(1, 1), Slot);
+			}
+			TestEqual(TEXT("Full grid"), Storage->FindFreeSlot(FIntPoint(1, 1), false, bRotated), INDEX_NONE);
+
+			Storage->RemoveItem(Filled[9]);
+			TestEqual(TEXT("Hole"), Storage->FindFreeSlot(FIntPoint(1, 1), false, bRotated), 9);
+		});
+
+		It("should empty the grid on Clear", [this]()
+		{
+			Storage->PlaceItem(A, FIntPoint(2, 3), 0);
+			Storage->PlaceItem(B, FIntPoint(1, 1), 9);
+			Storage->Clear();
+			TestEqual(TEXT("Free cells"), Storage->GetFreeSlotCount(), 60);
+			TestFalse(TEXT("Contains A"), Storage->ContainsItem(A));
+		});
+	});
+
+	Describe("Move", [this]()
+	{
+		BeforeEach([this]()
+		{
+			Storage->PlaceItem(A, FIntPoint(2, 3), 0);
+			Storage->PlaceItem(B, FIntPoint(2, 2), 2);
+		});
+
+		It("should allow overlapping its own footprint", [this]()
+		{
+			TestTrue(TEXT("Move by one column"), Storage->MoveItem(B, FIntPoint(2, 2), 3));
+			TestEqual(TEXT("New anchor"), Storage->GetAnchorSlotForInstance(B), 3);
+			TestFalse(TEXT("Old cell freed"), Storage->IsSlotOccupied(2));
+		});
+
+		It("should keep the placement when blocked", [this]()
+		{
+			TestFalse(TEXT("Move onto A"), Storage->MoveItem(B, FIntPoint(2, 2), 1));
+			TestEqual(TEXT("Anchor"), Storage->GetAnchorSlotForInstance(B), 2);
+		});
+	});
+
+	Describe("Rotate", [this]()
+	{
+		BeforeEach([this]()
+		{
+			Storage->PlaceItem(A, FIntPoint(2, 3), 0);
+		});
+
+		It("should swap the footprint in place", [this]()
+		{
+			TestTrue(TEXT("Rotate to 3x2"), Storage->MoveItem(A, FIntPoint(2, 3), 0, true));
+			TestEqual(TEXT("Owner of (2,0)"), Storage->GetInstanceIDAtSlot(2), A);
+			TestFalse(TEXT("(0,2) freed"), Storage->IsSlotOccupied(20));
+		});
+
+		It("should keep the footprint when a neighbour blocks it", [this]()
+		{
+			Storage->MoveItem(A, FIntPoint(2, 3), 0, true);
+			Storage->PlaceItem(B, FIntPoint(1, 1), 20);
+			TestFalse(TEXT("Rotate back"), Storage->MoveItem(A, FIntPoint(2, 3), 0, false));
+			TestEqual(TEXT("Owner of (2,0)"), Storage->GetInstanceIDAtSlot(2), A);
+		});
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,62 @@
+// SuspenseCoreInventoryTestWorld.h
+// SuspenseCore - EventBus Architecture
+// Copyright Suspense Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "SuspenseCore/Components/SuspenseCoreInventoryComponent.h"
+
+/**
+ * Throwaway game world with one authoritative actor, for component tests without a map.
+ * There is no game instance, so items come from SetItemStaticsForTest instead of the DataManager.
+ */
+class FSuspenseCoreInventoryTestWorld
+{
+public:
+	/** 1x1, stacks to 60, 10 g per round */
+	static inline const FName AmmoID = TEXT("Test.Ammo");
+
+	/** 2x3, does not stack, 2 kg */
+	static inline const FName CaseID = TEXT("Test.Case");
+
+	static constexpr int32 AmmoMaxStack = 60;
+
+	FSuspenseCoreInventoryTestWorld()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("SuspenseCoreInventoryTestWorld"));
+		GEngine->CreateNewWorldContext(EWorldType::Game).SetCurrentWorld(World);
+		Owner = World->SpawnActor<AActor>();
+	}
+
+	~FSuspenseCoreInventoryTestWorld()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	FSuspenseCoreInventoryTestWorld(const FSuspenseCoreInventoryTestWorld&) = delete;
+	FSuspenseCoreInventoryTestWorld& operator=(const FSuspenseCoreInventoryTestWorld&) = delete;
+
+	/** Initialized inventory owned by the test actor, with the test items registered */
+	USuspenseCoreInventoryComponent* CreateInventory(int32 GridWidth = 10, int32 GridHeight = 6, float MaxWeight = 100.0f) const
+	{
+		USuspenseCoreInventoryComponent* Inventory = NewObject<USuspenseCoreInventoryComponent>(Owner);
+		Inventory->SetItemStaticsForTest(AmmoID, 0.01f, FIntPoint(1, 1), AmmoMaxStack);
+		Inventory->SetItemStaticsForTest(CaseID, 2.0f, FIntPoint(2, 3), 1);
+		Inventory->Initialize(GridWidth, GridHeight, MaxWeight);
+		return Inventory;
+	}
+
+private:
+	UWorld* World = nullptr;
+	AActor* Owner = nullptr;
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,90 @@
+// SuspenseCoreInventoryUndoLogTest.cpp
+// SuspenseCore - EventBus Architecture
+// Copyright Suspense Team. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "SuspenseCore/Operations/SuspenseCoreInventoryUndoLog.h"
+#include "SuspenseCore/Debug/SuspenseCoreInventoryDebugger.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSuspenseCoreInventoryUndoLogTest, "SuspenseCore.Inventory.UndoLog",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSuspenseCoreInventoryUndoLogTest::RunTest(const FString& Parameters)
+{
+	FSuspenseCoreInventoryUndoLog UndoLog;
+	TArray<FSuspenseCoreInventoryUndoEntry> Replay;
+
+	FSuspenseCoreItemInstance Item;
+	Item.UniqueInstanceID = FGuid::NewGuid();
+	Item.Quantity = 5;
+
+	// First write per level only
+	UndoLog.BeginSavepoint();
+	UndoLog.Record(Item.UniqueInstanceID, &Item);
+	Item.Quantity = 7;
+	UndoLog.Record(Item.UniqueInstanceID, &Item);
+	Item.Quantity = 9;
+	TestEqual(TEXT("One pre-image per instance per level"), UndoLog.NumEntries(), 1);
+
+	// Nested level logs again
+	UndoLog.BeginSavepoint();
+	UndoLog.Record(Item.UniqueInstanceID, &Item);
+	Item.Quantity = 11;
+	const FGuid Created = FGuid::NewGuid();
+	UndoLog.Record(Created, nullptr);
+	TestEqual(TEXT("Depth"), UndoLog.GetDepth(), 2);
+	TestEqual(TEXT("Entries"), UndoLog.NumEntries(), 3);
+
+	UndoLog.PopSavepoint(Replay);
+	if (TestEqual(TEXT("Inner rollback entries"), Replay.Num(), 2))
+	{
+		TestEqual(TEXT("Newest first"), Replay[0].InstanceID, Created);
+		TestFalse(TEXT("Created instance is removed"), Replay[0].bExisted);
+		TestEqual(TEXT("Inner rollback restores state at inner begin"), Replay[1].PreImage.Quantity, 9);
+	}
+
+	UndoLog.PopSavepoint(Replay);
+	if (TestEqual(TEXT("Outer rollback entries"), Replay.Num(), 1))
+	{
+		TestEqual(TEXT("Outer rollback restores state at outer begin"), Replay[0].PreImage.Quantity, 5);
+	}
+	TestFalse(TEXT("Inactive after outer rollback"), UndoLog.IsActive());
+
+	// Release merges the child into its parent
+	Item.Quantity = 5;
+	UndoLog.BeginSavepoint();
+	UndoLog.BeginSavepoint();
+	UndoLog.Record(Item.UniqueInstanceID, &Item);
+	Item.Quantity = 6;
+	UndoLog.ReleaseSavepoint();
+	TestEqual(TEXT("Depth after release"), UndoLog.GetDepth(), 1);
+	TestEqual(TEXT("Entries after release"), UndoLog.NumEntries(), 1);
+
+	UndoLog.PopSavepoint(Replay);
+	if (TestEqual(TEXT("Parent rollback entries"), Replay.Num(), 1))
+	{
+		TestEqual(TEXT("Parent rollback covers released child"), Replay[0].PreImage.Quantity, 5);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSuspenseCoreInventoryGridSelfTest, "SuspenseCore.Inventory.GridSelfTest",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSuspenseCoreInventoryGridSelfTest::RunTest(const FString& Parameters)
+{
+	// Same checks as the SuspenseCore.Inventory.SelfTest console command
+	FString Report;
+	const bool bPassed = USuspenseCoreInventoryDebugger::RunGridSelfTest(Report);
+	if (!bPassed)
+	{
+		AddError(Report);
+	}
+	return bPassed;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
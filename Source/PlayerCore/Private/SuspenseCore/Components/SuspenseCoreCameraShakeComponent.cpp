@@ -215,7 +215,7 @@ void USuspenseCoreCameraShakeComponent::OnDamageShakeEvent(
 	FGameplayTag EventTag,
 	const FSuspenseCoreEventData& EventData)
 {
-	// For damage events, check if we are the target (via ObjectPayload "Target")
+	// For damage events, check if we are the target (via object value "Target")
 	// or if Source is our owner (damage applied to self)
 	UObject* DamageTarget = EventData.GetObject<UObject>(TEXT("Target"));
 	if (DamageTarget && DamageTarget != GetOwner())
@@ -701,7 +701,7 @@ void ASuspenseCorePlayerState::HandleAttributeChange(const FGameplayTag& Attribu
 	if (USuspenseCoreEventBus* EventBus = GetEventBus())
 	{
 		FSuspenseCoreEventData EventData = FSuspenseCoreEventData::Create(this);
-		EventData.SetString(FName("Attribute"), AttributeTag.ToString());
+		EventData.SetGameplayTag(FName("Attribute"), AttributeTag);
 		EventData.SetFloat(FName("NewValue"), NewValue);
 		EventData.SetFloat(FName("OldValue"), OldValue);
 
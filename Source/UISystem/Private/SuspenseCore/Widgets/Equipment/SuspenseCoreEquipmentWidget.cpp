@@ -587,7 +587,7 @@ void USuspenseCoreEquipmentWidget::OnEquipmentItemEquipped(FGameplayTag EventTag
 
 	// Extract slot index from event data if available
 	int32 TargetSlot = INDEX_NONE;
-	if (const int32* SlotPtr = EventData.IntPayload.Find(FName("TargetSlot")))
+	if (const int32* SlotPtr = EventData.FindInt(FName("TargetSlot")))
 	{
 		TargetSlot = *SlotPtr;
 	}
@@ -600,10 +600,7 @@ void USuspenseCoreEquipmentWidget::OnEquipmentItemEquipped(FGameplayTag EventTag
 		{
 			FSuspenseCoreItemUIData ItemData;
 			// Extract item info from event data if available
-			if (const FString* ItemIDStr = EventData.StringPayload.Find(FName("ItemID")))
-			{
-				ItemData.ItemID = FName(**ItemIDStr);
-			}
+			ItemData.ItemID = EventData.GetName(FName("ItemID"));
 			K2_OnEquipRequested(SlotWidget->GetSlotType(), ItemData);
 		}
 	}
@@ -620,7 +617,7 @@ void USuspenseCoreEquipmentWidget::OnEquipmentItemUnequipped(FGameplayTag EventT
 
 	// Extract slot index from event data if available
 	int32 SourceSlot = INDEX_NONE;
-	if (const int32* SlotPtr = EventData.IntPayload.Find(FName("SourceSlot")))
+	if (const int32* SlotPtr = EventData.FindInt(FName("SourceSlot")))
 	{
 		SourceSlot = *SlotPtr;
 	}
@@ -677,7 +674,7 @@ void USuspenseCoreEquipmentWidget::OnQuickSlotAssignedEvent(FGameplayTag EventTa
 	SlotData.State = ESuspenseCoreUISlotState::Occupied;
 
 	FSuspenseCoreItemUIData ItemData;
-	ItemData.ItemID = FName(*EventData.GetString(TEXT("ItemID")));
+	ItemData.ItemID = EventData.GetName(TEXT("ItemID"));
 	ItemData.DisplayName = FText::FromString(EventData.GetString(TEXT("DisplayName")));
 	ItemData.Quantity = EventData.GetInt(TEXT("Quantity"), 1);
 
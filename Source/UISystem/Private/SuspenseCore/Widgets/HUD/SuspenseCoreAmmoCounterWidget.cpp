@@ -518,7 +518,7 @@ void USuspenseCoreAmmoCounterWidget::OnMagazineInsertedEvent(FGameplayTag EventT
 
 	int32 Rounds = EventData.GetInt(TEXT("CurrentRounds"), 0);
 	int32 Capacity = EventData.GetInt(TEXT("MaxCapacity"), 30);
-	FName AmmoType = FName(*EventData.GetString(TEXT("LoadedAmmoType")));
+	FName AmmoType = EventData.GetName(TEXT("LoadedAmmoType"));
 
 	CachedAmmoData.MagazineRounds = Rounds;
 	CachedAmmoData.MagazineCapacity = Capacity;
@@ -614,15 +614,15 @@ void USuspenseCoreAmmoCounterWidget::OnFireModeChangedEvent(FGameplayTag EventTa
 		return;
 	}
 
-	// Get fire mode tag string - broadcasts use "FireModeTag" field
-	FString FireModeTagStr = EventData.GetString(TEXT("FireModeTag"));
-
 	// Get display name - SwitchFireModeAbility uses "FireModeName", fallback to extracting from tag
 	FString FireModeDisplayName = EventData.GetString(TEXT("FireModeName"));
 
-	// Get fire mode tag using native tag mapping
+	// Broadcasts use the typed "FireModeTag" field; string values go through native tag mapping
 	// CRITICAL: Use helper function instead of RequestGameplayTag() per project architecture
-	FGameplayTag FireModeTag = GetFireModeTagFromString(FireModeTagStr);
+	const FGameplayTag* TypedFireModeTag = EventData.FindGameplayTag(TEXT("FireModeTag"));
+	FGameplayTag FireModeTag = TypedFireModeTag
+		? *TypedFireModeTag
+		: GetFireModeTagFromString(EventData.GetString(TEXT("FireModeTag")));
 
 	// If display name not provided, extract from tag (last segment)
 	if (FireModeDisplayName.IsEmpty() && FireModeTag.IsValid())
@@ -462,8 +462,7 @@ USuspenseCoreEventBus* USuspenseCoreMagazineInspectionWidget::GetEventBus() cons
 void USuspenseCoreMagazineInspectionWidget::OnAmmoLoadingStartedEvent(FGameplayTag EventTag, const FSuspenseCoreEventData& EventData)
 {
 	// Check if this event is for our magazine
-	FGuid MagazineID;
-	FGuid::Parse(EventData.GetString(TEXT("MagazineInstanceID")), MagazineID);
+	const FGuid MagazineID = EventData.GetGuid(TEXT("MagazineInstanceID"));
 	if (MagazineID != CachedInspectionData.MagazineInstanceID)
 	{
 		return;
@@ -489,8 +488,7 @@ void USuspenseCoreMagazineInspectionWidget::OnAmmoLoadingStartedEvent(FGameplayT
 void USuspenseCoreMagazineInspectionWidget::OnAmmoLoadingProgressEvent(FGameplayTag EventTag, const FSuspenseCoreEventData& EventData)
 {
 	// Check if this event is for our magazine
-	FGuid MagazineID;
-	FGuid::Parse(EventData.GetString(TEXT("MagazineInstanceID")), MagazineID);
+	const FGuid MagazineID = EventData.GetGuid(TEXT("MagazineInstanceID"));
 	if (MagazineID != CachedInspectionData.MagazineInstanceID)
 	{
 		return;
@@ -501,7 +499,7 @@ void USuspenseCoreMagazineInspectionWidget::OnAmmoLoadingProgressEvent(FGameplay
 	int32 MaxCapacity = EventData.GetInt(TEXT("MaxCapacity"), CachedInspectionData.MaxCapacity);
 	int32 RoundsProcessed = EventData.GetInt(TEXT("RoundsProcessed"), 0);
 	float Progress = EventData.GetFloat(TEXT("Progress"), 0.0f);
-	FString AmmoIDStr = EventData.GetString(TEXT("AmmoID"));
+	const FName AmmoID = EventData.GetName(TEXT("AmmoID"));
 
 	// The slot that was just loaded is (NewRoundCount - 1) since we just added a round
 	int32 LoadedSlotIndex = NewRoundCount - 1;
@@ -512,7 +510,7 @@ void USuspenseCoreMagazineInspectionWidget::OnAmmoLoadingProgressEvent(FGameplay
 		FSuspenseCoreRoundSlotData LoadedSlot;
 		LoadedSlot.SlotIndex = LoadedSlotIndex;
 		LoadedSlot.bIsOccupied = true;
-		LoadedSlot.AmmoID = FName(*AmmoIDStr);
+		LoadedSlot.AmmoID = AmmoID;
 		// AmmoDisplayName would need to come from DataManager - use AmmoID for now
 		LoadedSlot.AmmoDisplayName = FText::FromName(LoadedSlot.AmmoID);
 
@@ -534,8 +532,7 @@ void USuspenseCoreMagazineInspectionWidget::OnAmmoLoadingProgressEvent(FGameplay
 void USuspenseCoreMagazineInspectionWidget::OnAmmoLoadingCompletedEvent(FGameplayTag EventTag, const FSuspenseCoreEventData& EventData)
 {
 	// Check if this event is for our magazine
-	FGuid MagazineID;
-	FGuid::Parse(EventData.GetString(TEXT("MagazineInstanceID")), MagazineID);
+	const FGuid MagazineID = EventData.GetGuid(TEXT("MagazineInstanceID"));
 	if (MagazineID != CachedInspectionData.MagazineInstanceID)
 	{
 		return;
@@ -559,8 +556,7 @@ void USuspenseCoreMagazineInspectionWidget::OnAmmoLoadingCompletedEvent(FGamepla
 void USuspenseCoreMagazineInspectionWidget::OnAmmoLoadingCancelledEvent(FGameplayTag EventTag, const FSuspenseCoreEventData& EventData)
 {
 	// Check if this event is for our magazine
-	FGuid MagazineID;
-	FGuid::Parse(EventData.GetString(TEXT("MagazineInstanceID")), MagazineID);
+	const FGuid MagazineID = EventData.GetGuid(TEXT("MagazineInstanceID"));
 	if (MagazineID != CachedInspectionData.MagazineInstanceID)
 	{
 		return;
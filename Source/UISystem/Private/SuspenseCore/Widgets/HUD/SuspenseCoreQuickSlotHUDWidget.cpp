@@ -349,7 +349,7 @@ void USuspenseCoreQuickSlotHUDWidget::OnQuickSlotAssignedEvent(FGameplayTag Even
 
 	FSuspenseCoreQuickSlotHUDData SlotData;
 	SlotData.SlotIndex = SlotIndex;
-	SlotData.ItemID = FName(*EventData.GetString(TEXT("ItemID")));
+	SlotData.ItemID = EventData.GetName(TEXT("ItemID"));
 	SlotData.DisplayName = FText::FromString(EventData.GetString(TEXT("DisplayName")));
 	SlotData.Quantity = EventData.GetInt(TEXT("Quantity"), 1);
 	SlotData.bIsMagazine = EventData.GetBool(TEXT("IsMagazine"), false);
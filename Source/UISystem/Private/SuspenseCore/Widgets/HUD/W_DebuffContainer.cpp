@@ -221,12 +221,8 @@ void UW_DebuffContainer::OnDoTApplied(FGameplayTag EventTag, const FSuspenseCore
 	}
 	else
 	{
-		// Try to get from string field
-		FString DoTTypeStr = EventData.GetString(TEXT("DoTType"));
-		if (!DoTTypeStr.IsEmpty())
-		{
-			DoTType = FGameplayTag::RequestGameplayTag(FName(*DoTTypeStr), false);
-		}
+		// Typed tag field (no string round trip)
+		DoTType = EventData.GetGameplayTag(TEXT("DoTType"));
 	}
 
 	if (!DoTType.IsValid())
@@ -269,12 +265,8 @@ void UW_DebuffContainer::OnDoTRemoved(FGameplayTag EventTag, const FSuspenseCore
 	}
 	else
 	{
-		// Try to get from string field
-		FString DoTTypeStr = EventData.GetString(TEXT("DoTType"));
-		if (!DoTTypeStr.IsEmpty())
-		{
-			DoTType = FGameplayTag::RequestGameplayTag(FName(*DoTTypeStr), false);
-		}
+		// Typed tag field (no string round trip)
+		DoTType = EventData.GetGameplayTag(TEXT("DoTType"));
 	}
 
 	if (!DoTType.IsValid())
@@ -309,25 +301,21 @@ void UW_DebuffContainer::OnDoTTick(FGameplayTag EventTag, const FSuspenseCoreEve
 	// For now, icons update their own timers via NativeTick
 
 	// Optional: Update remaining duration from event
-	FString DoTTypeStr = EventData.GetString(TEXT("DoTType"));
-	if (!DoTTypeStr.IsEmpty())
+	const FGameplayTag DoTType = EventData.GetGameplayTag(TEXT("DoTType"));
+	if (DoTType.IsValid())
 	{
-		FGameplayTag DoTType = FGameplayTag::RequestGameplayTag(FName(*DoTTypeStr), false);
-		if (DoTType.IsValid())
+		if (TObjectPtr<UW_DebuffIcon>* IconPtr = ActiveDebuffs.Find(DoTType))
 		{
-			if (TObjectPtr<UW_DebuffIcon>* IconPtr = ActiveDebuffs.Find(DoTType))
+			float RemainingDuration = EventData.GetFloat(TEXT("RemainingDuration"), -1.0f);
+			if (RemainingDuration >= 0.0f)
+			{
+				(*IconPtr)->UpdateTimer(RemainingDuration);
+			}
+
+			int32 StackCount = EventData.GetInt(TEXT("StackCount"), 0);
+			if (StackCount > 0)
 			{
-				float RemainingDuration = EventData.GetFloat(TEXT("RemainingDuration"), -1.0f);
-				if (RemainingDuration >= 0.0f)
-				{
-					(*IconPtr)->UpdateTimer(RemainingDuration);
-				}
-
-				int32 StackCount = EventData.GetInt(TEXT("StackCount"), 0);
-				if (StackCount > 0)
-				{
-					(*IconPtr)->UpdateStackCount(StackCount);
-				}
+				(*IconPtr)->UpdateStackCount(StackCount);
 			}
 		}
 	}
@@ -677,7 +665,7 @@ bool UW_DebuffContainer::IsEventForTarget(const FSuspenseCoreEventData& EventDat
 	// Check EventData.Source first (primary field used by DoTService)
 	AActor* AffectedActor = Cast<AActor>(EventData.Source.Get());
 
-	// Fallback: Check ObjectPayload for "AffectedActor" field
+	// Fallback: Check object value "AffectedActor"
 	if (!AffectedActor)
 	{
 		AffectedActor = EventData.GetObject<AActor>(FName(TEXT("AffectedActor")));